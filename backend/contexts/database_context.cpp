@@ -158,7 +158,7 @@ std::expected<int64_t, std::string> DatabaseContext::getRowCount(std::string_vie
     }
 
     try {
-        return std::stoll(result.rows[0].values[0]);
+        return std::stoll(std::string(result.rows[0].values[0]));
     } catch (const std::invalid_argument&) {
         return std::unexpected("Invalid row count result: not a number");
     } catch (const std::out_of_range&) {
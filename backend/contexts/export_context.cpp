@@ -8,7 +8,7 @@
 
 namespace velocitydb {
 
-ExportContext::ExportContext() = default;
+ExportContext::ExportContext() : m_jobManager(std::make_unique<ExportJobManager>()) {}
 ExportContext::~ExportContext() = default;
 ExportContext::ExportContext(ExportContext&&) noexcept = default;
 ExportContext& ExportContext::operator=(ExportContext&&) noexcept = default;
@@ -44,4 +44,29 @@ bool ExportContext::isFormatSupported(std::string_view format) const {
     return m_exporters.contains(formatStr);
 }
 
+std::string ExportContext::startExportJob(std::shared_ptr<SQLServerDriver> driver, std::string sql, std::string filepath, std::string format, ExportOptions options, bool bulkExtract) {
+    std::ranges::transform(format, format.begin(), ::tolower);
+    return m_jobManager->startJob(std::move(driver), std::move(sql), std::move(filepath), std::move(format), std::move(options), bulkExtract);
+}
+
+std::optional<ExportJobState> ExportContext::getExportJobState(std::string_view jobId) const {
+    return m_jobManager->getJobState(jobId);
+}
+
+bool ExportContext::cancelExportJob(std::string_view jobId) {
+    return m_jobManager->cancelJob(jobId);
+}
+
+void ExportContext::removeExportJob(std::string_view jobId) {
+    m_jobManager->removeJob(jobId);
+}
+
+std::vector<std::string> ExportContext::getActiveExportJobIds() const {
+    return m_jobManager->getActiveJobIds();
+}
+
+void ExportContext::setExportProgressCallback(std::function<void(const ExportJobState&)> callback) {
+    m_jobManager->setProgressCallback(std::move(callback));
+}
+
 }  // namespace velocitydb
@@ -1,7 +1,11 @@
 #pragma once
 
+#include "../exporters/export_job_manager.h"
+
 #include <expected>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -35,8 +39,31 @@ public:
     /// Check if a format is supported
     [[nodiscard]] bool isFormatSupported(std::string_view format) const;
 
+    // Background export jobs: id/status/cancel like AsyncQueryExecutor,
+    // with rows-written progress pushed through the registered callback
+
+    /// Start a background export job, returns its job id. bulkExtract
+    /// selects the dedicated whole-table extract path (max packet size,
+    /// array-bound block fetches).
+    [[nodiscard]] std::string startExportJob(std::shared_ptr<SQLServerDriver> driver, std::string sql, std::string filepath, std::string format, ExportOptions options, bool bulkExtract = false);
+
+    /// Current state of a job, empty when the id is unknown
+    [[nodiscard]] std::optional<ExportJobState> getExportJobState(std::string_view jobId) const;
+
+    /// Request cooperative cancellation of a running job
+    bool cancelExportJob(std::string_view jobId);
+
+    /// Remove a finished job from tracking
+    void removeExportJob(std::string_view jobId);
+
+    [[nodiscard]] std::vector<std::string> getActiveExportJobIds() const;
+
+    /// Callback fired from worker threads on progress and terminal states
+    void setExportProgressCallback(std::function<void(const ExportJobState&)> callback);
+
 private:
     std::unordered_map<std::string, std::unique_ptr<IExportable>> m_exporters;
+    std::unique_ptr<ExportJobManager> m_jobManager;
 };
 
 }  // namespace velocitydb
@@ -3,11 +3,16 @@
 #include "../utils/session_manager.h"
 #include "../utils/settings_manager.h"
 
+#include <thread>
+
 namespace velocitydb {
 
 SettingsContext::SettingsContext() : m_settingsManager(std::make_unique<SettingsManager>()), m_sessionManager(std::make_unique<SessionManager>()) {
+    // Settings and session live in independent files; restore them in
+    // parallel so startup pays for the slower of the two, not both
+    std::thread sessionRestore([this] { m_sessionManager->load(); });
     m_settingsManager->load();
-    m_sessionManager->load();
+    sessionRestore.join();
 }
 
 SettingsContext::~SettingsContext() = default;
@@ -4,14 +4,17 @@
 #include "../parsers/a5er_parser.h"
 #include "../parsers/sql_formatter.h"
 #include "../utils/global_search.h"
+#include "../utils/result_aggregator.h"
+#include "../utils/result_diff.h"
 #include "../utils/simd_filter.h"
 
+#include <algorithm>
 #include <format>
 
 namespace velocitydb {
 
 UtilityContext::UtilityContext()
-    : m_sqlFormatter(std::make_unique<SQLFormatter>()), m_globalSearch(std::make_unique<GlobalSearch>()), m_a5erParser(std::make_unique<A5ERParser>()), m_simdFilter(std::make_unique<SIMDFilter>()) {}
+    : m_sqlFormatter(std::make_unique<SQLFormatter>()), m_globalSearch(std::make_unique<GlobalSearch>()), m_a5erParser(std::make_unique<A5ERParser>()), m_simdFilter(std::make_unique<SIMDFilter>()), m_resultAggregator(std::make_unique<ResultAggregator>()), m_resultDiffer(std::make_unique<ResultDiffer>()) {}
 
 UtilityContext::~UtilityContext() = default;
 UtilityContext::UtilityContext(UtilityContext&&) noexcept = default;
@@ -21,6 +24,10 @@ std::string UtilityContext::formatSQL(std::string_view sql) {
     return m_sqlFormatter->format(std::string(sql));
 }
 
+std::string UtilityContext::formatSQLRange(std::string_view sql, size_t editStart, size_t editEnd) {
+    return m_sqlFormatter->formatRange(sql, editStart, editEnd);
+}
+
 std::string UtilityContext::uppercaseKeywords(std::string_view sql) {
     return m_sqlFormatter->uppercaseKeywords(std::string(sql));
 }
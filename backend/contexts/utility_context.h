@@ -12,6 +12,8 @@ class SQLFormatter;
 class GlobalSearch;
 class A5ERParser;
 class SIMDFilter;
+class ResultAggregator;
+class ResultDiffer;
 struct ResultSet;
 
 /// Context for utility operations (formatting, search, parsing, filtering)
@@ -32,11 +34,16 @@ public:
     [[nodiscard]] const A5ERParser& a5erParser() const { return *m_a5erParser; }
     [[nodiscard]] SIMDFilter& simdFilter() { return *m_simdFilter; }
     [[nodiscard]] const SIMDFilter& simdFilter() const { return *m_simdFilter; }
+    [[nodiscard]] ResultAggregator& resultAggregator() { return *m_resultAggregator; }
+    [[nodiscard]] const ResultAggregator& resultAggregator() const { return *m_resultAggregator; }
+    [[nodiscard]] ResultDiffer& resultDiffer() { return *m_resultDiffer; }
+    [[nodiscard]] const ResultDiffer& resultDiffer() const { return *m_resultDiffer; }
     [[nodiscard]] GlobalSearch& globalSearch() { return *m_globalSearch; }
     [[nodiscard]] const GlobalSearch& globalSearch() const { return *m_globalSearch; }
 
     // SQL formatting
     [[nodiscard]] std::string formatSQL(std::string_view sql);
+    [[nodiscard]] std::string formatSQLRange(std::string_view sql, size_t editStart, size_t editEnd);
     [[nodiscard]] std::string uppercaseKeywords(std::string_view sql);
 
     // Global search
@@ -55,6 +62,8 @@ private:
     std::unique_ptr<GlobalSearch> m_globalSearch;
     std::unique_ptr<A5ERParser> m_a5erParser;
     std::unique_ptr<SIMDFilter> m_simdFilter;
+    std::unique_ptr<ResultAggregator> m_resultAggregator;
+    std::unique_ptr<ResultDiffer> m_resultDiffer;
 };
 
 }  // namespace velocitydb
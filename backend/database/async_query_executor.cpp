@@ -1,53 +1,295 @@
 #include "async_query_executor.h"
 
 #include "../parsers/sql_parser.h"
+#include "../utils/memory_budget.h"
+#include "../utils/metrics.h"
+#include "columnar_result.h"
+#include "result_cache.h"
 
+#include <algorithm>
 #include <format>
 
 namespace velocitydb {
 
+AsyncQueryExecutor::AsyncQueryExecutor() {
+    // Fixed worker pool sized to the hardware instead of one thread per
+    // query: bounded concurrency and no per-submission thread creation
+    const auto workerCount = (std::max)(2u, std::thread::hardware_concurrency());
+    m_workers.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back([this] { workerLoop(); });
+    }
+
+    m_watchdog = std::jthread([this] { watchdogLoop(); });
+
+    // Retained result sets count against the process budget; under
+    // pressure the oldest detached results go first (after the caches)
+    m_budgetSlot = MemoryBudget::instance().registerSubsystem("asyncResults", MemoryBudget::Priority::ResultWindows, [this](size_t bytesWanted) { return shrinkRetainedResults(bytesWanted); });
+}
+
 AsyncQueryExecutor::~AsyncQueryExecutor() {
-    std::vector<std::shared_ptr<QueryTask>> tasks;
+    std::vector<std::shared_ptr<QueryTask>> runningTasks;
 
-    // Lock only to copy the task list
     {
         std::lock_guard lock(m_mutex);
-        tasks.reserve(m_queries.size());
+        m_stopping = true;
+
+        // Drop queued-but-unstarted work; destroying the packaged_task makes
+        // its future ready with broken_promise so no waiter hangs
+        for (auto& item : m_workQueue) {
+            item.task->status = QueryStatus::Cancelled;
+            item.task->endTime = std::chrono::steady_clock::now();
+        }
+        for (size_t i = 0; i < m_workQueue.size(); ++i) {
+            Metrics::instance().decrementQueueDepth();
+        }
+        m_workQueue.clear();
+
         for (auto& [id, task] : m_queries) {
-            tasks.push_back(task);
+            if (task->status == QueryStatus::Running) {
+                runningTasks.push_back(task);
+            }
+        }
+    }
+    m_workAvailable.notify_all();
+    m_watchdogWake.notify_all();
+
+    // Cancel in-flight queries WITHOUT holding the mutex
+    for (auto& task : runningTasks) {
+        if (task->driver) {
+            task->driver->cancel();
+        }
+        for (const auto& extra : task->extraDrivers) {
+            extra->cancel();
         }
     }
 
-    // Cancel and wait WITHOUT holding the mutex
-    for (auto& task : tasks) {
-        if (task->future.valid()) {
-            // Cancel if still running
-            if (task->status == QueryStatus::Running && task->driver) {
+    // jthread destructors join the workers after they drain
+    m_workers.clear();
+    m_watchdog = {};
+
+    MemoryBudget::instance().unregisterSubsystem(m_budgetSlot);
+}
+
+void AsyncQueryExecutor::workerLoop() {
+    while (true) {
+        WorkItem item;
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_workAvailable.wait(lock, [this] {
+                if (m_stopping) {
+                    return true;
+                }
+                for (const auto& queued : m_workQueue) {
+                    if (!m_busyConnections.contains(queued.connectionKey)) {
+                        return true;
+                    }
+                }
+                return false;
+            });
+
+            if (m_stopping) {
+                return;
+            }
+
+            // Take the oldest interactive item whose connection is idle,
+            // falling back to the oldest eligible background item; queries
+            // on a busy connection stay queued to keep per-connection
+            // ordering. Background items past the starvation limit count as
+            // interactive so a flood of grid queries cannot park an export
+            // forever.
+            const auto now = std::chrono::steady_clock::now();
+            auto pick = m_workQueue.end();
+            for (auto it = m_workQueue.begin(); it != m_workQueue.end(); ++it) {
+                if (m_busyConnections.contains(it->connectionKey)) {
+                    continue;
+                }
+                if (it->priority == WorkPriority::Interactive || now - it->enqueueTime >= BACKGROUND_STARVATION_LIMIT) {
+                    pick = it;
+                    break;
+                }
+                if (pick == m_workQueue.end()) {
+                    pick = it;  // Best background candidate; keep scanning for interactive
+                }
+            }
+            if (pick == m_workQueue.end()) {
+                continue;
+            }
+
+            item = std::move(*pick);
+            m_workQueue.erase(pick);
+            Metrics::instance().decrementQueueDepth();
+            m_busyConnections.insert(item.connectionKey);
+        }
+
+        if (item.task->status == QueryStatus::Pending) {
+            item.task->status = QueryStatus::Running;
+        }
+        if (item.task->timeoutBudget > std::chrono::seconds(0)) {
+            // The budget starts burning now, not at submission - a query
+            // that waited in the queue still gets its full allowance
+            {
+                std::lock_guard lock(m_mutex);
+                item.task->deadline = std::chrono::steady_clock::now() + item.task->timeoutBudget;
+            }
+            m_watchdogWake.notify_one();
+        }
+        item.work();
+
+        std::function<void(const std::string&, QueryStatus)> completionCallback;
+        {
+            std::lock_guard lock(m_mutex);
+            m_busyConnections.erase(item.connectionKey);
+            completionCallback = m_completionCallback;
+        }
+        m_workAvailable.notify_all();
+
+        // Push completion to the frontend the moment the status flips;
+        // invoked without the mutex so the callback may call back into us
+        if (completionCallback) {
+            completionCallback(item.task->queryId, item.task->status.load());
+        }
+    }
+}
+
+void AsyncQueryExecutor::watchdogLoop() {
+    std::unique_lock lock(m_mutex);
+    while (!m_stopping) {
+        // Sleep until the earliest armed deadline; a worker arming one (or
+        // shutdown) wakes the wait early
+        auto nextDeadline = std::chrono::steady_clock::time_point::max();
+        for (const auto& [id, task] : m_queries) {
+            if (task->status.load() == QueryStatus::Running && task->deadline < nextDeadline) {
+                nextDeadline = task->deadline;
+            }
+        }
+        if (nextDeadline == std::chrono::steady_clock::time_point::max()) {
+            m_watchdogWake.wait(lock);
+        } else {
+            m_watchdogWake.wait_until(lock, nextDeadline);
+        }
+        if (m_stopping) {
+            return;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<std::shared_ptr<QueryTask>> expired;
+        for (auto& [id, task] : m_queries) {
+            if (task->status.load() == QueryStatus::Running && task->deadline <= now) {
+                task->status = QueryStatus::Cancelled;
+                task->errorMessage = std::format("Query exceeded its {} s timeout and was cancelled", task->timeoutBudget.count());
+                task->endTime = now;
+                task->deadline = std::chrono::steady_clock::time_point::max();  // Fire once
+                expired.push_back(task);
+            }
+        }
+
+        // Cancel through the driver WITHOUT the mutex - SQLCancel can take
+        // a network round trip, and dispatch must not stall behind it
+        lock.unlock();
+        for (const auto& task : expired) {
+            if (task->driver) {
                 task->driver->cancel();
             }
-            // Wait for completion (this can block, but we're not holding the mutex)
-            task->future.wait();
+            for (const auto& extra : task->extraDrivers) {
+                extra->cancel();
+            }
         }
+        lock.lock();
     }
 }
 
-std::string AsyncQueryExecutor::submitQuery(std::shared_ptr<SQLServerDriver> driver, std::string_view sql) {
+void AsyncQueryExecutor::setDefaultTimeout(std::chrono::seconds timeout) {
+    std::lock_guard lock(m_mutex);
+    m_defaultTimeout = (std::max)(timeout, std::chrono::seconds(0));
+}
+
+void AsyncQueryExecutor::setCompletionCallback(std::function<void(const std::string& queryId, QueryStatus status)> callback) {
+    std::lock_guard lock(m_mutex);
+    m_completionCallback = std::move(callback);
+}
+
+std::string AsyncQueryExecutor::submitQuery(std::shared_ptr<SQLServerDriver> driver, std::string_view sql, WorkPriority priority, std::optional<std::chrono::seconds> timeout) {
     auto queryId = std::format("query_{}", m_queryIdCounter++);
 
+    // In-flight coalescing: an identical (connection, SQL) pair still
+    // pending or running serves this caller too - the new queryId aliases
+    // the running task, so two dashboard tabs refreshing the same SELECT
+    // cost the server one execution. Each alias polls and removes
+    // independently; cancel through either id cancels the shared execution.
+    {
+        std::lock_guard lock(m_mutex);
+        for (auto& [existingId, existing] : m_queries) {
+            if (existing->driver == driver && existing->sql == sql) {
+                if (const auto status = existing->status.load(); status == QueryStatus::Pending || status == QueryStatus::Running) {
+                    m_queries[queryId] = existing;
+                    return queryId;
+                }
+            }
+        }
+    }
+
     auto task = std::make_shared<QueryTask>();
+    task->queryId = queryId;
     task->driver = driver;  // shared_ptr ensures driver lifetime
     task->sql = std::string(sql);
     task->startTime = std::chrono::steady_clock::now();
-    task->status = QueryStatus::Running;
+    task->status = QueryStatus::Pending;
+    {
+        std::lock_guard lock(m_mutex);
+        task->timeoutBudget = timeout.value_or(m_defaultTimeout);
+    }
 
-    // Split SQL into multiple statements
-    auto statements = SQLParser::splitStatements(sql);
+    // Split over the task's owned copy: the views slice task->sql, and the
+    // work lambdas capture the task, so they stay valid on the worker thread
+    auto statements = SQLParser::splitStatements(task->sql);
     task->multipleResults = statements.size() > 1;
 
+    // USE statements need per-statement handling (fabricated "Database
+    // changed" message rows), so scripts containing them keep the
+    // sequential path; everything else pipelines as one batch.
+    const bool hasUseStatement = std::ranges::any_of(statements, [](std::string_view stmt) { return SQLParser::isUseStatement(stmt); });
+
     // Capture shared_ptr by value to ensure driver and task lifetime extends through async execution
-    if (statements.size() > 1) {
+    std::packaged_task<QueryResultVariant()> work;
+    if (statements.size() > 1 && !hasUseStatement) {
+        // Pipelined batch: one SQLExecDirect round trip for the whole
+        // script instead of one per statement. Statements are re-joined
+        // because splitStatements has already stripped GO separators.
+        work = std::packaged_task<QueryResultVariant()>([driver, statements, task]() -> QueryResultVariant {
+            try {
+                std::string batch;
+                for (const auto& stmt : statements) {
+                    batch += stmt;
+                    batch += ";\n";
+                }
+
+                auto batchResults = driver->executeBatch(batch);
+
+                std::vector<StatementResult> allResults;
+                allResults.reserve(batchResults.size());
+                for (size_t i = 0; i < batchResults.size(); ++i) {
+                    // Result sets come back in statement order; a statement
+                    // can yield at most one, so index-wise pairing holds
+                    allResults.push_back(StatementResult{.statement = i < statements.size() ? std::string(statements[i]) : std::string{}, .result = batchResults[i].toRows()});
+                }
+
+                task->endTime = std::chrono::steady_clock::now();
+                task->status = QueryStatus::Completed;
+                return allResults;
+            } catch (const std::exception& e) {
+                task->endTime = std::chrono::steady_clock::now();
+                if (task->status.load() != QueryStatus::Cancelled) {
+                    task->errorMessage = e.what();
+                    task->status = QueryStatus::Failed;
+                }
+                return std::vector<StatementResult>{};
+            }
+        });
+    } else if (statements.size() > 1) {
         // Multiple statements: execute sequentially and collect all results
-        task->future = std::async(std::launch::async, [driver, statements, task]() -> QueryResultVariant {
+        work = std::packaged_task<QueryResultVariant()>([driver, statements, task]() -> QueryResultVariant {
             try {
                 std::vector<StatementResult> allResults;
                 allResults.reserve(statements.size());
@@ -63,7 +305,7 @@ std::string AsyncQueryExecutor::submitQuery(std::shared_ptr<SQLServerDriver> dri
                         // Create result for USE statement
                         currentResult.columns.push_back({.name = "Message", .type = "VARCHAR", .size = 255, .nullable = false, .isPrimaryKey = false});
                         ResultRow messageRow;
-                        messageRow.values.push_back(std::format("Database changed to {}", dbName));
+                        messageRow.values.emplace_back(std::format("Database changed to {}", dbName));
                         currentResult.rows.push_back(messageRow);
                         currentResult.affectedRows = 0;
                         currentResult.executionTimeMs = 0.0;
@@ -71,7 +313,7 @@ std::string AsyncQueryExecutor::submitQuery(std::shared_ptr<SQLServerDriver> dri
                         currentResult = driver->execute(stmt);
                     }
 
-                    allResults.push_back(StatementResult{.statement = stmt, .result = std::move(currentResult)});
+                    allResults.push_back(StatementResult{.statement = std::string(stmt), .result = std::move(currentResult)});
                 }
 
                 task->endTime = std::chrono::steady_clock::now();
@@ -79,31 +321,224 @@ std::string AsyncQueryExecutor::submitQuery(std::shared_ptr<SQLServerDriver> dri
                 return allResults;
             } catch (const std::exception& e) {
                 task->endTime = std::chrono::steady_clock::now();
-                task->errorMessage = e.what();
-                task->status = QueryStatus::Failed;
+                if (task->status.load() != QueryStatus::Cancelled) {
+                    task->errorMessage = e.what();
+                    task->status = QueryStatus::Failed;
+                }
                 return std::vector<StatementResult>{};
             }
         });
     } else {
         // Single statement
         std::string sqlCopy(sql);
-        task->future = std::async(std::launch::async, [driver, sqlCopy, task]() -> QueryResultVariant {
+        work = std::packaged_task<QueryResultVariant()>([driver, sqlCopy, task]() -> QueryResultVariant {
             try {
+                // Publish the leading rows while the fetch loop still runs:
+                // a 60-second analytical query shows its first rows in
+                // milliseconds instead of nothing until completion
+                driver->setFirstRowsCallback([task](const ColumnarResultSet& firstRows) { task->partialResult.store(std::make_shared<const ResultSet>(firstRows.toRows())); });
                 ResultSet result = driver->execute(sqlCopy);
+                driver->setFirstRowsCallback(nullptr);  // Not fired: result stayed under the threshold
                 task->endTime = std::chrono::steady_clock::now();
                 task->status = QueryStatus::Completed;
                 return result;
             } catch (const std::exception& e) {
+                driver->setFirstRowsCallback(nullptr);
                 task->endTime = std::chrono::steady_clock::now();
-                task->errorMessage = e.what();
-                task->status = QueryStatus::Failed;
+                // A cancel (user or watchdog) makes the execute throw; keep
+                // the Cancelled status and its message, not the ODBC error
+                if (task->status.load() != QueryStatus::Cancelled) {
+                    task->errorMessage = e.what();
+                    task->status = QueryStatus::Failed;
+                }
                 return ResultSet{};
             }
         });
     }
 
-    std::lock_guard lock(m_mutex);
-    m_queries[queryId] = task;
+    {
+        std::lock_guard lock(m_mutex);
+
+        // Bounded queue: reject instead of queueing unboundedly. The task is
+        // recorded as Failed so the normal polling surface reports it; its
+        // future is never taken, so nothing waits on the dropped work.
+        if (m_workQueue.size() >= MAX_QUEUED_QUERIES) {
+            task->status = QueryStatus::Failed;
+            task->errorMessage = "Query queue is full";
+            task->endTime = std::chrono::steady_clock::now();
+            m_queries[queryId] = task;
+            return queryId;
+        }
+
+        task->future = work.get_future();
+        Metrics::instance().incrementQueueDepth();
+        m_workQueue.push_back(WorkItem{.work = std::move(work), .task = task, .connectionKey = driver.get(), .priority = priority, .enqueueTime = std::chrono::steady_clock::now()});
+        m_queries[queryId] = task;
+    }
+    m_workAvailable.notify_one();
+
+    return queryId;
+}
+
+std::string AsyncQueryExecutor::submitParallelScript(std::vector<std::shared_ptr<SQLServerDriver>> drivers, std::string_view sql, WorkPriority priority,
+                                                     std::function<void(std::shared_ptr<SQLServerDriver>)> releaseDriver) {
+    // A single connection has no fan-out to do; extras go straight back
+    if (drivers.size() < 2) {
+        if (drivers.empty()) {
+            auto queryId = std::format("query_{}", m_queryIdCounter++);
+            auto task = std::make_shared<QueryTask>();
+            task->queryId = queryId;
+            task->sql = std::string(sql);
+            task->startTime = std::chrono::steady_clock::now();
+            task->endTime = task->startTime;
+            task->status = QueryStatus::Failed;
+            task->errorMessage = "No connection available for parallel script";
+            std::lock_guard lock(m_mutex);
+            m_queries[queryId] = task;
+            return queryId;
+        }
+        return submitQuery(drivers.front(), sql, priority);
+    }
+
+    auto queryId = std::format("query_{}", m_queryIdCounter++);
+
+    auto task = std::make_shared<QueryTask>();
+    task->queryId = queryId;
+    task->driver = drivers.front();
+    task->extraDrivers.assign(drivers.begin() + 1, drivers.end());
+    task->sql = std::string(sql);
+    task->startTime = std::chrono::steady_clock::now();
+    task->status = QueryStatus::Pending;
+    task->multipleResults = true;
+    {
+        std::lock_guard lock(m_mutex);
+        task->timeoutBudget = m_defaultTimeout;
+    }
+
+    // Views slice task->sql and every lane captures the task, same lifetime
+    // contract as the serial paths
+    auto statements = SQLParser::splitStatements(task->sql);
+
+    // One lane per driver, capped by the statement count; surplus drivers
+    // were acquired for nothing and return to the pool immediately
+    const auto laneCount = (std::min)(drivers.size(), statements.size());
+    if (releaseDriver) {
+        for (size_t i = laneCount; i < drivers.size(); ++i) {
+            releaseDriver(std::move(drivers[i]));
+        }
+    }
+
+    // Result slots are pre-sized and statement-indexed so lanes write
+    // without coordination and the merged vector keeps script order
+    struct FanOutState {
+        std::mutex mutex;
+        std::vector<StatementResult> results;
+        size_t remaining = 0;
+        std::string firstError;
+        std::promise<QueryResultVariant> promise;
+    };
+    auto state = std::make_shared<FanOutState>();
+    state->results.resize(statements.size());
+    for (size_t i = 0; i < statements.size(); ++i) {
+        state->results[i].statement = std::string(statements[i]);
+    }
+    state->remaining = laneCount;
+
+    // Lane k takes statements k, k+laneCount, ... - round-robin keeps a
+    // run of similarly sized rebuilds balanced without cost estimation
+    std::vector<WorkItem> items;
+    items.reserve(laneCount);
+    const auto enqueueTime = std::chrono::steady_clock::now();
+    for (size_t lane = 0; lane < laneCount; ++lane) {
+        auto driver = drivers[lane];
+        auto releaseLane = lane > 0 ? releaseDriver : nullptr;  // The primary stays with the caller
+
+        std::packaged_task<QueryResultVariant()> work([driver, statements, task, state, lane, laneCount, releaseLane]() -> QueryResultVariant {
+            for (size_t i = lane; i < statements.size(); i += laneCount) {
+                if (task->status.load() == QueryStatus::Cancelled) {
+                    break;
+                }
+                try {
+                    auto result = driver->execute(statements[i]);
+                    std::lock_guard lock(state->mutex);
+                    state->results[i].result = std::move(result);
+                } catch (const std::exception& e) {
+                    // Independent statements: siblings keep running, the
+                    // first failure becomes the script's error message
+                    std::lock_guard lock(state->mutex);
+                    if (state->firstError.empty()) {
+                        state->firstError = std::format("Statement {}: {}", i + 1, e.what());
+                    }
+                }
+            }
+
+            if (releaseLane) {
+                releaseLane(driver);
+            }
+
+            bool lastLane = false;
+            std::string error;
+            {
+                std::lock_guard lock(state->mutex);
+                lastLane = (--state->remaining == 0);
+                error = state->firstError;
+            }
+            if (lastLane) {
+                task->endTime = std::chrono::steady_clock::now();
+                if (task->status.load() != QueryStatus::Cancelled) {
+                    if (error.empty()) {
+                        task->status = QueryStatus::Completed;
+                    } else {
+                        task->errorMessage = error;
+                        task->status = QueryStatus::Failed;
+                    }
+                }
+                // remaining hit zero, so this lane owns the results now
+                state->promise.set_value(std::move(state->results));
+            }
+
+            // The per-lane futures are never taken; the task's future comes
+            // from the shared promise above
+            return std::vector<StatementResult>{};
+        });
+
+        items.push_back(WorkItem{.work = std::move(work), .task = task, .connectionKey = driver.get(), .priority = priority, .enqueueTime = enqueueTime});
+    }
+
+    bool rejected = false;
+    {
+        std::lock_guard lock(m_mutex);
+
+        if (m_workQueue.size() + items.size() > MAX_QUEUED_QUERIES) {
+            task->status = QueryStatus::Failed;
+            task->errorMessage = "Query queue is full";
+            task->endTime = std::chrono::steady_clock::now();
+            m_queries[queryId] = task;
+            rejected = true;
+        } else {
+            // The future comes from the shared promise, assigned only once
+            // the lanes are actually queued - a rejected task must report
+            // Failed without a pending future, same as the serial path
+            task->future = state->promise.get_future();
+            for (auto& item : items) {
+                Metrics::instance().incrementQueueDepth();
+                m_workQueue.push_back(std::move(item));
+            }
+            m_queries[queryId] = task;
+        }
+    }
+
+    if (rejected) {
+        // The lane lambdas are destroyed unrun; hand their connections back
+        if (releaseDriver) {
+            for (size_t lane = 1; lane < laneCount; ++lane) {
+                releaseDriver(std::move(drivers[lane]));
+            }
+        }
+        return queryId;
+    }
+
+    m_workAvailable.notify_all();
 
     return queryId;
 }
@@ -137,6 +572,7 @@ AsyncQueryResult AsyncQueryExecutor::getQueryResult(std::string_view queryId) {
             if (task->future.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
                 try {
                     task->cachedResult = task->future.get();
+                    accountRetainedResult(*task);
                 } catch (...) {
                     result.status = QueryStatus::Failed;
                     result.errorMessage = "Failed to retrieve result";
@@ -156,11 +592,75 @@ AsyncQueryResult AsyncQueryExecutor::getQueryResult(std::string_view queryId) {
                 result.result = std::get<ResultSet>(*task->cachedResult);
             }
         }
+    } else if (result.status == QueryStatus::Pending || result.status == QueryStatus::Running) {
+        // Early first-rows delivery: the worker publishes the column list
+        // and leading rows as they arrive, so polls during a long query
+        // return something to render instead of an empty response
+        if (auto partialRows = task->partialResult.load()) {
+            result.result = *partialRows;
+            result.partial = true;
+        }
     }
 
     return result;
 }
 
+std::optional<AsyncQueryExecutor::ResultWindow> AsyncQueryExecutor::getResultWindow(std::string_view queryId, size_t offset, size_t count, size_t statementIndex) {
+    std::shared_ptr<QueryTask> task;
+
+    {
+        std::lock_guard lock(m_mutex);
+        auto iter = m_queries.find(std::string(queryId));
+        if (iter == m_queries.end()) {
+            return std::nullopt;
+        }
+        task = iter->second;
+    }
+
+    if (task->status != QueryStatus::Completed) {
+        return std::nullopt;
+    }
+
+    // Materialize the cached result once, same as getQueryResult
+    if (!task->cachedResult.has_value() && task->future.valid()) {
+        if (task->future.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready) {
+            return std::nullopt;
+        }
+        try {
+            task->cachedResult = task->future.get();
+            accountRetainedResult(*task);
+        } catch (...) {
+            return std::nullopt;
+        }
+    }
+    if (!task->cachedResult.has_value()) {
+        return std::nullopt;
+    }
+
+    const ResultSet* source = nullptr;
+    if (task->multipleResults) {
+        const auto& results = std::get<std::vector<StatementResult>>(*task->cachedResult);
+        if (statementIndex >= results.size()) {
+            return std::nullopt;
+        }
+        source = &results[statementIndex].result;
+    } else {
+        source = &std::get<ResultSet>(*task->cachedResult);
+    }
+
+    ResultWindow window{.rows = {}, .totalRows = source->rows.size(), .offset = offset};
+    window.rows.columns = source->columns;
+    window.rows.affectedRows = source->affectedRows;
+    window.rows.executionTimeMs = source->executionTimeMs;
+
+    // Only the visible slice is copied; 2M retained rows cost nothing here
+    const size_t first = (std::min)(offset, source->rows.size());
+    const size_t last = (std::min)(offset + count, source->rows.size());
+    window.rows.rows.assign(source->rows.begin() + static_cast<ptrdiff_t>(first), source->rows.begin() + static_cast<ptrdiff_t>(last));
+
+    return window;
+}
+
 bool AsyncQueryExecutor::cancelQuery(std::string_view queryId) {
     std::lock_guard lock(m_mutex);
 
@@ -172,6 +672,9 @@ bool AsyncQueryExecutor::cancelQuery(std::string_view queryId) {
     auto& task = iter->second;
     if (task->status == QueryStatus::Running && task->driver) {
         task->driver->cancel();
+        for (const auto& extra : task->extraDrivers) {
+            extra->cancel();
+        }
         task->status = QueryStatus::Cancelled;
         task->endTime = std::chrono::steady_clock::now();
         return true;
@@ -192,8 +695,87 @@ bool AsyncQueryExecutor::isQueryRunning(std::string_view queryId) const {
 }
 
 void AsyncQueryExecutor::removeQuery(std::string_view queryId) {
-    std::lock_guard lock(m_mutex);
-    m_queries.erase(std::string(queryId));
+    std::shared_ptr<QueryTask> task;
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_queries.find(std::string(queryId));
+        if (it == m_queries.end()) {
+            return;
+        }
+        task = std::move(it->second);
+        m_queries.erase(it);
+
+        // Coalesced aliases share one task: its bytes come off the budget
+        // only when the last map entry referencing it is erased, the same
+        // rule shrinkRetainedResults applies via its victims check
+        for (const auto& [id, other] : m_queries) {
+            if (other == task) {
+                return;
+            }
+        }
+    }
+
+    // The result is released (and its bytes returned) outside the lock
+    if (task->resultBytes != 0) {
+        MemoryBudget::instance().record(m_budgetSlot, -static_cast<int64_t>(task->resultBytes));
+    }
+}
+
+void AsyncQueryExecutor::accountRetainedResult(QueryTask& task) {
+    if (task.resultBytes != 0 || !task.cachedResult.has_value()) {
+        return;
+    }
+
+    size_t bytes = 0;
+    if (std::holds_alternative<ResultSet>(*task.cachedResult)) {
+        bytes = ResultCache::estimateSize(std::get<ResultSet>(*task.cachedResult));
+    } else {
+        for (const auto& statement : std::get<std::vector<StatementResult>>(*task.cachedResult)) {
+            bytes += ResultCache::estimateSize(statement.result);
+        }
+    }
+    task.resultBytes = bytes;
+    MemoryBudget::instance().record(m_budgetSlot, static_cast<int64_t>(bytes));
+}
+
+size_t AsyncQueryExecutor::shrinkRetainedResults(size_t bytesWanted) {
+    std::vector<std::shared_ptr<QueryTask>> victims;
+    size_t freed = 0;
+    {
+        std::lock_guard lock(m_mutex);
+
+        std::vector<std::pair<std::chrono::steady_clock::time_point, std::string>> candidates;
+        for (const auto& [id, task] : m_queries) {
+            const auto status = task->status.load();
+            if (task->resultBytes > 0 && status != QueryStatus::Pending && status != QueryStatus::Running) {
+                candidates.emplace_back(task->endTime, id);
+            }
+        }
+        std::ranges::sort(candidates);
+
+        for (const auto& [endTime, id] : candidates) {
+            if (freed >= bytesWanted) {
+                break;
+            }
+            auto it = m_queries.find(id);
+            // Coalesced aliases share one task; count its bytes once and
+            // just drop the extra map entries
+            if (std::ranges::find(victims, it->second) != victims.end()) {
+                m_queries.erase(it);
+                continue;
+            }
+            freed += it->second->resultBytes;
+            victims.push_back(std::move(it->second));
+            m_queries.erase(it);
+        }
+    }
+
+    // Victims destruct here, outside the lock, where freeing a large
+    // ResultSet cannot stall dispatch
+    if (freed > 0) {
+        MemoryBudget::instance().record(m_budgetSlot, -static_cast<int64_t>(freed));
+    }
+    return freed;
 }
 
 std::vector<std::string> AsyncQueryExecutor::getActiveQueryIds() const {
@@ -4,13 +4,17 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
@@ -18,6 +22,12 @@ namespace velocitydb {
 
 enum class QueryStatus { Pending, Running, Completed, Cancelled, Failed };
 
+/// Scheduling class for submitted work. Interactive work (grid queries)
+/// dispatches ahead of Background work (exports, schema refresh) so a grid
+/// refresh never queues behind a long-running export; background items
+/// waiting past the starvation limit are promoted so they still make progress.
+enum class WorkPriority : uint8_t { Interactive, Background };
+
 struct StatementResult {
     std::string statement;
     ResultSet result;
@@ -29,6 +39,9 @@ struct AsyncQueryResult {
     std::string queryId;
     QueryStatus status = QueryStatus::Pending;
     bool multipleResults = false;
+    // result holds the first fetched rows of a still-running query;
+    // time-to-first-row is the latency users actually perceive
+    bool partial = false;
     std::optional<ResultSet> result;
     std::vector<StatementResult> results;
     std::string errorMessage;
@@ -38,7 +51,7 @@ struct AsyncQueryResult {
 
 class AsyncQueryExecutor {
 public:
-    AsyncQueryExecutor() = default;
+    AsyncQueryExecutor();
     ~AsyncQueryExecutor();
 
     AsyncQueryExecutor(const AsyncQueryExecutor&) = delete;
@@ -47,12 +60,42 @@ public:
     AsyncQueryExecutor& operator=(AsyncQueryExecutor&&) = delete;
 
     /// Submits a query for asynchronous execution, returns a unique query ID
-    /// Uses shared_ptr to ensure driver lifetime extends through async execution
-    [[nodiscard]] std::string submitQuery(std::shared_ptr<SQLServerDriver> driver, std::string_view sql);
+    /// Uses shared_ptr to ensure driver lifetime extends through async execution.
+    /// timeout overrides the default watchdog budget for this run; nullopt
+    /// uses the default, an explicit zero disables the watchdog for the run.
+    [[nodiscard]] std::string submitQuery(std::shared_ptr<SQLServerDriver> driver, std::string_view sql, WorkPriority priority = WorkPriority::Interactive,
+                                          std::optional<std::chrono::seconds> timeout = std::nullopt);
+
+    /// Opt-in parallel script mode: fans the script's statements out
+    /// round-robin across the supplied drivers (each on its own pool
+    /// connection), merging the per-statement results back into script
+    /// order. The caller has already screened every statement with
+    /// SQLParser::isParallelSafeStatement - this method does not re-check.
+    /// drivers.front() is the caller's own connection and stays with the
+    /// caller; releaseDriver is invoked for each extra driver once its
+    /// statements finish, so pool connections return as lanes drain rather
+    /// than when the whole script completes.
+    [[nodiscard]] std::string submitParallelScript(std::vector<std::shared_ptr<SQLServerDriver>> drivers, std::string_view sql, WorkPriority priority = WorkPriority::Interactive,
+                                                   std::function<void(std::shared_ptr<SQLServerDriver>)> releaseDriver = {});
 
     /// Gets the current status and result of a query
     [[nodiscard]] AsyncQueryResult getQueryResult(std::string_view queryId);
 
+    /// A slice of a completed result for virtual scrolling: columns plus
+    /// the requested rows, with the full row count for scrollbar sizing
+    struct ResultWindow {
+        ResultSet rows;
+        size_t totalRows = 0;
+        size_t offset = 0;
+    };
+
+    /// Returns rows [offset, offset+count) of a completed query without
+    /// copying the full set - the backend keeps the ResultSet until
+    /// removeQuery, so the grid fetches only the visible window.
+    /// statementIndex selects the result for multi-statement scripts.
+    /// Empty when the query is unknown, still running, or failed.
+    [[nodiscard]] std::optional<ResultWindow> getResultWindow(std::string_view queryId, size_t offset, size_t count, size_t statementIndex = 0);
+
     /// Cancels a running query
     bool cancelQuery(std::string_view queryId);
 
@@ -65,22 +108,88 @@ public:
     /// Gets all active query IDs
     [[nodiscard]] std::vector<std::string> getActiveQueryIds() const;
 
+    /// Registers a callback fired from the worker thread the moment a query
+    /// finishes (Completed/Failed/Cancelled), so completion can be pushed to
+    /// the frontend instead of discovered by polling
+    void setCompletionCallback(std::function<void(const std::string& queryId, QueryStatus status)> callback);
+
+    /// Default watchdog budget applied to every submission that does not
+    /// carry its own; zero disables the watchdog. A runaway query past its
+    /// budget is cancelled through the driver, so it stops holding its pool
+    /// connection and the server's resources until someone notices.
+    void setDefaultTimeout(std::chrono::seconds timeout);
+
 private:
     struct QueryTask {
+        std::string queryId;
         std::future<QueryResultVariant> future;
         std::optional<QueryResultVariant> cachedResult;  // Cache result after first get()
         bool multipleResults = false;
         std::atomic<QueryStatus> status{QueryStatus::Pending};
         std::shared_ptr<SQLServerDriver> driver;  // shared_ptr to prevent use-after-free
+        // Extra pool connections of a parallel script; cancel must reach
+        // every lane, not just the primary connection
+        std::vector<std::shared_ptr<SQLServerDriver>> extraDrivers;
         std::string sql;
+        // First fetched rows, published once by the worker from inside the
+        // fetch loop; readers on the dispatch thread load it lock-free
+        std::atomic<std::shared_ptr<const ResultSet>> partialResult;
         std::string errorMessage;
         std::chrono::steady_clock::time_point startTime;
         std::chrono::steady_clock::time_point endTime;
+        size_t resultBytes = 0;  // Memory-budget accounting for the retained result
+        // Watchdog budget, measured from when the worker starts the query -
+        // queue wait does not burn it. Zero means no watchdog.
+        std::chrono::seconds timeoutBudget{0};
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    };
+
+    // A queued unit of work. connectionKey identifies the driver so queries
+    // on the same connection run serially (ODBC statements on one connection
+    // must not interleave), while different connections run in parallel.
+    struct WorkItem {
+        std::packaged_task<QueryResultVariant()> work;
+        std::shared_ptr<QueryTask> task;
+        const void* connectionKey = nullptr;
+        WorkPriority priority = WorkPriority::Interactive;
+        std::chrono::steady_clock::time_point enqueueTime;
     };
 
+    void workerLoop();
+    void watchdogLoop();
+
+    /// Accounts a freshly materialized result against the memory budget
+    void accountRetainedResult(QueryTask& task);
+
+    /// Memory-pressure callback: drops the oldest detached completed
+    /// results until bytesWanted is freed. The frontend refetches through
+    /// the normal path if it still needs one of them.
+    size_t shrinkRetainedResults(size_t bytesWanted);
+
+    // Bounded queue: submissions past this are rejected instead of piling up
+    static constexpr size_t MAX_QUEUED_QUERIES = 256;
+
+    // A background item waiting this long is scheduled as if interactive, so
+    // a steady stream of grid queries cannot starve an export indefinitely
+    static constexpr auto BACKGROUND_STARVATION_LIMIT = std::chrono::seconds(10);
+
     mutable std::mutex m_mutex;
     std::unordered_map<std::string, std::shared_ptr<QueryTask>> m_queries;
     std::atomic<int> m_queryIdCounter{1};
+
+    std::deque<WorkItem> m_workQueue;
+    std::condition_variable m_workAvailable;
+    std::unordered_set<const void*> m_busyConnections;
+    std::vector<std::jthread> m_workers;
+    bool m_stopping = false;
+
+    std::function<void(const std::string&, QueryStatus)> m_completionCallback;
+
+    std::chrono::seconds m_defaultTimeout{0};
+    std::condition_variable m_watchdogWake;
+    std::jthread m_watchdog;
+
+    size_t m_budgetSlot = 0;
 };
 
 }  // namespace velocitydb
@@ -0,0 +1,181 @@
+#include "columnar_result.h"
+
+#include <array>
+#include <charconv>
+#include <numeric>
+#include <string_view>
+#include <unordered_map>
+
+namespace velocitydb {
+
+namespace {
+/// Appends the textual form of a native value to the column arena.
+/// std::to_chars writes straight into the tail — no temporary string.
+template <typename T>
+void appendNumericText(ColumnBuffer& buffer, T value) {
+    std::array<char, 32> text{};
+    auto [end, ec] = std::to_chars(text.data(), text.data() + text.size(), value);
+    buffer.data.append(text.data(), static_cast<size_t>(end - text.data()));
+    buffer.offsets.push_back(buffer.data.size());
+    buffer.nullFlags.push_back(0);
+}
+}  // namespace
+
+void ColumnBuffer::appendInt64(int64_t value) {
+    intValues.push_back(value);
+    appendNumericText(*this, value);
+}
+
+void ColumnBuffer::appendDouble(double value) {
+    doubleValues.push_back(value);
+    appendNumericText(*this, value);
+}
+
+void ColumnBuffer::appendBool(bool value) {
+    intValues.push_back(value ? 1 : 0);
+    // Text form matches what the WCHAR fetch path produced for BIT columns
+    data.append(value ? "1" : "0");
+    offsets.push_back(data.size());
+    nullFlags.push_back(0);
+}
+
+bool ColumnBuffer::internStrings(size_t maxDistinct) {
+    if (isDictionary() || valueType != ColumnValueType::String) {
+        return false;
+    }
+
+    const size_t rows = rowCount();
+    if (rows == 0) {
+        return false;
+    }
+
+    // One pass assigns every row its distinct-value id; the views key the
+    // map into the existing buffer, so no cell bytes are copied while the
+    // cardinality is still unknown
+    std::unordered_map<std::string_view, uint32_t> valueIds;
+    std::vector<std::string_view> distinctValues;
+    std::vector<uint32_t> ids;
+    ids.reserve(rows);
+    size_t distinctBytes = 0;
+
+    for (size_t row = 0; row < rows; ++row) {
+        const auto value = cell(row);
+        auto [it, inserted] = valueIds.try_emplace(value, static_cast<uint32_t>(distinctValues.size()));
+        if (inserted) {
+            if (distinctValues.size() >= maxDistinct) {
+                return false;
+            }
+            distinctValues.push_back(value);
+            distinctBytes += value.size();
+        }
+        ids.push_back(it->second);
+    }
+
+    // Only rewrite when the dictionary form is the smaller one; a column of
+    // mostly-long unique-ish values can pass the cap yet not be worth it
+    const size_t plainBytes = data.size() + offsets.size() * sizeof(uint64_t);
+    const size_t dictBytes = distinctBytes + (distinctValues.size() + 1) * sizeof(uint64_t) + rows * sizeof(uint32_t);
+    if (dictBytes >= plainBytes) {
+        return false;
+    }
+
+    std::string uniqueData;
+    uniqueData.reserve(distinctBytes);
+    std::vector<uint64_t> uniqueOffsets;
+    uniqueOffsets.reserve(distinctValues.size() + 1);
+    uniqueOffsets.push_back(0);
+    for (const auto value : distinctValues) {
+        uniqueData.append(value);
+        uniqueOffsets.push_back(uniqueData.size());
+    }
+
+    data = std::move(uniqueData);
+    offsets = std::move(uniqueOffsets);
+    dictIds = std::move(ids);
+    return true;
+}
+
+ColumnarResultSet ColumnarResultSet::fromRows(const ResultSet& rows) {
+    ColumnarResultSet columnar;
+    columnar.columns = rows.columns;
+    columnar.rowCount = rows.rows.size();
+    columnar.affectedRows = rows.affectedRows;
+    columnar.executionTimeMs = rows.executionTimeMs;
+
+    const size_t numCols = rows.columns.size();
+    columnar.columnData.resize(numCols);
+
+    // Size each column buffer exactly before copying to avoid reallocation
+    for (size_t col = 0; col < numCols; ++col) {
+        size_t totalBytes = 0;
+        for (const auto& row : rows.rows) {
+            totalBytes += row.values[col].size();
+        }
+
+        auto& buffer = columnar.columnData[col];
+        buffer.data.reserve(totalBytes);
+        buffer.offsets.reserve(rows.rows.size() + 1);
+        buffer.nullFlags.reserve(rows.rows.size());
+
+        for (const auto& row : rows.rows) {
+            // Row storage cannot distinguish NULL from empty string; treat
+            // empty as non-NULL so the round trip is lossless for display
+            buffer.append(row.values[col]);
+        }
+    }
+
+    return columnar;
+}
+
+ResultSet ColumnarResultSet::toRows() const {
+    ResultSet result;
+    result.columns = columns;
+    result.affectedRows = affectedRows;
+    result.executionTimeMs = executionTimeMs;
+
+    // All cell strings come from one bump arena and free wholesale with
+    // the result, so building and tearing down a large grid result does
+    // not pay a per-cell allocation or deallocation
+    result.attachArena();
+    result.rows.reserve(rowCount);
+    for (size_t row = 0; row < rowCount; ++row) {
+        auto resultRow = result.makeRow();
+        resultRow.values.reserve(columnData.size());
+        for (const auto& buffer : columnData) {
+            resultRow.values.emplace_back(buffer.cell(row));
+        }
+        result.rows.push_back(std::move(resultRow));
+    }
+
+    return result;
+}
+
+void ColumnarResultSet::internLowCardinalityColumns() {
+    if (rowCount < ColumnBuffer::DICTIONARY_MIN_ROWS) {
+        return;
+    }
+    for (auto& buffer : columnData) {
+        buffer.internStrings();
+    }
+}
+
+size_t ColumnarResultSet::estimateSizeBytes() const noexcept {
+    size_t size = sizeof(ColumnarResultSet);
+
+    for (const auto& col : columns) {
+        size += col.name.size() + col.type.size() + col.comment.size() + sizeof(ColumnInfo);
+    }
+
+    for (const auto& buffer : columnData) {
+        size += buffer.data.capacity();
+        size += buffer.offsets.capacity() * sizeof(uint64_t);
+        size += buffer.nullFlags.capacity();
+        size += buffer.intValues.capacity() * sizeof(int64_t);
+        size += buffer.doubleValues.capacity() * sizeof(double);
+        size += buffer.dictIds.capacity() * sizeof(uint32_t);
+    }
+
+    return size;
+}
+
+}  // namespace velocitydb
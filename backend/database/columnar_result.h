@@ -0,0 +1,136 @@
+#pragma once
+
+#include "sqlserver_driver.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace velocitydb {
+
+/// Native representation of a column's cells. String is the default; the
+/// driver promotes integer/float/bit SQL types so numeric filter and sort
+/// run vectorized compares over dense arrays instead of a strtod per cell.
+enum class ColumnValueType : uint8_t { String, Int64, Double, Bool };
+
+/// Contiguous cell storage for a single column.
+/// All cell bytes live in one buffer; offsets[i]..offsets[i+1] delimits row i.
+/// This avoids the per-cell std::string allocations of ResultRow and lets
+/// filter/sort/serialize walk a column cache-linearly.
+///
+/// Typed columns (valueType != String) additionally keep the native values
+/// in a dense array aligned row-for-row with offsets/nullFlags (nulls hold
+/// a zero placeholder). The textual form is still materialized so display
+/// and export paths need no per-type branching.
+struct ColumnBuffer {
+    std::string data;               // Concatenated UTF-8 cell bytes
+    std::vector<uint64_t> offsets;  // rowCount + 1 entries, offsets[0] == 0
+    std::vector<uint8_t> nullFlags; // 1 byte per row, nonzero == SQL NULL
+
+    ColumnValueType valueType = ColumnValueType::String;
+    std::vector<int64_t> intValues;    // Int64 and Bool (0/1) columns
+    std::vector<double> doubleValues;  // Double columns
+
+    // Dictionary encoding for low-cardinality columns (internStrings):
+    // when non-empty, data/offsets hold each distinct value exactly once
+    // and dictIds maps every row to its value's slot. Status/code columns
+    // repeating a handful of values across millions of rows shrink from
+    // one copy per row to 4 bytes per row plus the distinct bytes.
+    std::vector<uint32_t> dictIds;
+
+    // Interning caps: columns with more distinct values than this keep the
+    // plain layout, and short results are not worth the extra scan
+    static constexpr size_t DICTIONARY_MAX_DISTINCT = 256;
+    static constexpr size_t DICTIONARY_MIN_ROWS = 64;
+
+    ColumnBuffer() { offsets.push_back(0); }
+
+    [[nodiscard]] size_t rowCount() const noexcept { return nullFlags.size(); }
+
+    [[nodiscard]] bool isDictionary() const noexcept { return !dictIds.empty(); }
+
+    [[nodiscard]] std::string_view cell(size_t row) const noexcept {
+        const size_t slot = dictIds.empty() ? row : dictIds[row];
+        return std::string_view(data).substr(offsets[slot], offsets[slot + 1] - offsets[slot]);
+    }
+
+    [[nodiscard]] bool isNull(size_t row) const noexcept { return nullFlags[row] != 0; }
+
+    void append(std::string_view value) {
+        data.append(value);
+        offsets.push_back(data.size());
+        nullFlags.push_back(0);
+    }
+
+    void appendInt64(int64_t value);
+    void appendDouble(double value);
+    void appendBool(bool value);
+
+    /// Rewrites a plain String column into the dictionary layout when the
+    /// distinct-value count stays within maxDistinct AND the encoded form
+    /// is actually smaller. Returns whether the buffer was rewritten.
+    bool internStrings(size_t maxDistinct = DICTIONARY_MAX_DISTINCT);
+
+    void appendNull() {
+        offsets.push_back(data.size());
+        nullFlags.push_back(1);
+        switch (valueType) {
+            case ColumnValueType::Int64:
+            case ColumnValueType::Bool:
+                intValues.push_back(0);
+                break;
+            case ColumnValueType::Double:
+                doubleValues.push_back(0.0);
+                break;
+            case ColumnValueType::String:
+                break;
+        }
+    }
+
+    void reserveRows(size_t rows, size_t avgCellBytes) {
+        offsets.reserve(rows + 1);
+        nullFlags.reserve(rows);
+        data.reserve(rows * avgCellBytes);
+        switch (valueType) {
+            case ColumnValueType::Int64:
+            case ColumnValueType::Bool:
+                intValues.reserve(rows);
+                break;
+            case ColumnValueType::Double:
+                doubleValues.reserve(rows);
+                break;
+            case ColumnValueType::String:
+                break;
+        }
+    }
+};
+
+/// Structure-of-arrays result representation.
+/// The driver fills this directly during fetch; row-oriented consumers can
+/// convert with toRows() until they are migrated to columnar iteration.
+struct ColumnarResultSet {
+    std::vector<ColumnInfo> columns;
+    std::vector<ColumnBuffer> columnData;  // One buffer per entry in columns
+    size_t rowCount = 0;
+    int64_t affectedRows = 0;
+    double executionTimeMs = 0.0;
+
+    [[nodiscard]] std::string_view cell(size_t row, size_t col) const noexcept { return columnData[col].cell(row); }
+    [[nodiscard]] bool isNull(size_t row, size_t col) const noexcept { return columnData[col].isNull(row); }
+
+    /// Converts a row-oriented ResultSet (one transpose, sized up front)
+    [[nodiscard]] static ColumnarResultSet fromRows(const ResultSet& rows);
+
+    /// Materializes the row-oriented representation for legacy consumers
+    [[nodiscard]] ResultSet toRows() const;
+
+    /// Dictionary-compacts every String column worth interning; the driver
+    /// calls this once per result at the end of the fetch
+    void internLowCardinalityColumns();
+
+    /// Approximate heap footprint, used by ResultCache accounting
+    [[nodiscard]] size_t estimateSizeBytes() const noexcept;
+};
+
+}  // namespace velocitydb
@@ -2,6 +2,7 @@
 
 #include "odbc_driver_detector.h"
 #include "sqlserver_driver.h"
+#include "utils/metrics.h"
 
 #include <algorithm>
 #include <format>
@@ -27,16 +28,35 @@ std::string escapeOdbcValue(std::string_view value) {
 }
 }  // namespace
 
+ConnectionPool::ConnectionPool(size_t poolSize, size_t warmFloor) : m_poolSize(poolSize), m_warmFloor((std::min)(warmFloor, poolSize)) {
+    m_warmupWorker = std::jthread([this] { warmupLoop(); });
+    m_heartbeatWorker = std::jthread([this] { heartbeatLoop(); });
+}
+
 ConnectionPool::~ConnectionPool() {
+    {
+        std::lock_guard lock(m_warmupMutex);
+        m_stopping = true;
+    }
+    m_warmupWake.notify_all();
+    m_heartbeatWake.notify_all();
+    if (m_warmupWorker.joinable()) {
+        m_warmupWorker.join();
+    }
+    if (m_heartbeatWorker.joinable()) {
+        m_heartbeatWorker.join();
+    }
+
     std::lock_guard lock(m_mutex);
-    while (!m_available.empty()) {
-        m_available.pop();
+    for (auto& [id, pool] : m_profilePools) {
+        for (auto& driver : pool.warm) {
+            driver->disconnect();
+        }
     }
+    m_profilePools.clear();
 }
 
 bool ConnectionPool::addConnection(const ConnectionInfo& info) {
-    std::lock_guard lock(m_mutex);
-
     auto driver = std::make_shared<SQLServerDriver>();
     std::string connStr = buildConnectionString(info);
 
@@ -44,38 +64,237 @@ bool ConnectionPool::addConnection(const ConnectionInfo& info) {
         return false;
     }
 
-    driver->disconnect();
-    m_connections.push_back(info);
+    {
+        std::lock_guard lock(m_mutex);
+        m_connections.push_back(info);
+        // The validation connect already paid the handshake; keep it warm
+        // instead of throwing it away.
+        m_profilePools[info.id].warm.push_back(std::move(driver));
+    }
+
+    warmUp(info.id);
     return true;
 }
 
+void ConnectionPool::registerProfile(const ConnectionInfo& info) {
+    {
+        std::lock_guard lock(m_mutex);
+        if (std::ranges::none_of(m_connections, [&info](const ConnectionInfo& existing) { return existing.id == info.id; })) {
+            m_connections.push_back(info);
+        }
+    }
+    warmUp(info.id);
+}
+
 void ConnectionPool::removeConnection(std::string_view id) {
     std::lock_guard lock(m_mutex);
     std::erase_if(m_connections, [id](const ConnectionInfo& info) { return info.id == id; });
+
+    if (auto it = m_profilePools.find(std::string(id)); it != m_profilePools.end()) {
+        for (auto& driver : it->second.warm) {
+            driver->disconnect();
+        }
+        m_profilePools.erase(it);
+    }
 }
 
 std::shared_ptr<SQLServerDriver> ConnectionPool::acquire(std::string_view connectionId) {
-    std::unique_lock lock(m_mutex);
+    // Records how long the caller waited, warm hit or cold connect alike
+    struct AcquireTimer {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        ~AcquireTimer() { Metrics::instance().poolAcquire().record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()); }
+    } acquireTimer;
 
-    auto it = std::ranges::find_if(m_connections, [connectionId](const ConnectionInfo& info) { return info.id == connectionId; });
+    std::string connStr;
+    {
+        std::unique_lock lock(m_mutex);
 
-    if (it == m_connections.end()) [[unlikely]] {
-        return nullptr;
+        auto it = std::ranges::find_if(m_connections, [connectionId](const ConnectionInfo& info) { return info.id == connectionId; });
+
+        if (it == m_connections.end()) [[unlikely]] {
+            return nullptr;
+        }
+
+        // Warm hit: hand out a pre-established connection and refill the
+        // floor in the background. The heartbeat keeps the sub-pool alive,
+        // so only the cheap connected flag is checked here — never a
+        // blocking validation round-trip.
+        if (auto poolIt = m_profilePools.find(it->id); poolIt != m_profilePools.end()) {
+            auto& warm = poolIt->second.warm;
+            while (!warm.empty()) {
+                auto driver = std::move(warm.back());
+                warm.pop_back();
+                if (!driver->isConnected()) [[unlikely]] {
+                    continue;
+                }
+                lock.unlock();
+                warmUp(connectionId);
+                return driver;
+            }
+        }
+
+        connStr = buildConnectionString(*it);
     }
 
+    // Cold miss: connect synchronously, outside the lock so warm-up and
+    // other acquires are not serialized behind the handshake.
     auto driver = std::make_shared<SQLServerDriver>();
-    std::string connStr = buildConnectionString(*it);
-
     if (!driver->connect(connStr)) [[unlikely]] {
         return nullptr;
     }
 
+    warmUp(connectionId);
     return driver;
 }
 
-void ConnectionPool::release(std::shared_ptr<SQLServerDriver> connection) {
-    if (connection) {
-        connection->disconnect();
+void ConnectionPool::release(std::string_view connectionId, std::shared_ptr<SQLServerDriver> connection) {
+    if (!connection) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_profilePools.find(std::string(connectionId));
+        if (it != m_profilePools.end() && it->second.warm.size() < m_poolSize) {
+            it->second.warm.push_back(std::move(connection));
+            return;
+        }
+    }
+
+    // Profile is gone or its sub-pool is full
+    connection->disconnect();
+}
+
+void ConnectionPool::warmUp(std::string_view connectionId) {
+    {
+        std::lock_guard lock(m_warmupMutex);
+        if (m_stopping) {
+            return;
+        }
+        if (std::ranges::find(m_warmupQueue, connectionId) == m_warmupQueue.end()) {
+            m_warmupQueue.emplace_back(connectionId);
+        }
+    }
+    m_warmupWake.notify_one();
+}
+
+void ConnectionPool::warmupLoop() {
+    while (true) {
+        std::string profileId;
+        {
+            std::unique_lock lock(m_warmupMutex);
+            m_warmupWake.wait(lock, [this] { return m_stopping || !m_warmupQueue.empty(); });
+            if (m_stopping) {
+                return;
+            }
+            profileId = std::move(m_warmupQueue.front());
+            m_warmupQueue.pop_front();
+        }
+
+        // Establish one connection at a time so a stop request or profile
+        // removal is observed between handshakes.
+        while (true) {
+            std::string connStr;
+            {
+                std::lock_guard lock(m_mutex);
+                auto it = std::ranges::find_if(m_connections, [&profileId](const ConnectionInfo& info) { return info.id == profileId; });
+                if (it == m_connections.end() || m_profilePools[profileId].warm.size() >= m_warmFloor) {
+                    break;
+                }
+                connStr = buildConnectionString(*it);
+            }
+
+            {
+                std::lock_guard lock(m_warmupMutex);
+                if (m_stopping) {
+                    return;
+                }
+            }
+
+            auto driver = std::make_shared<SQLServerDriver>();
+            if (!driver->connect(connStr)) [[unlikely]] {
+                // Server unreachable; stop retrying until the next acquire
+                // or explicit warmUp queues this profile again.
+                break;
+            }
+
+            std::lock_guard lock(m_mutex);
+            if (std::ranges::none_of(m_connections, [&profileId](const ConnectionInfo& info) { return info.id == profileId; })) {
+                driver->disconnect();  // Profile removed mid-handshake
+                break;
+            }
+            m_profilePools[profileId].warm.push_back(std::move(driver));
+        }
+    }
+}
+
+void ConnectionPool::heartbeatLoop() {
+    while (true) {
+        {
+            std::unique_lock lock(m_warmupMutex);
+            m_heartbeatWake.wait_for(lock, HEARTBEAT_INTERVAL, [this] { return m_stopping; });
+            if (m_stopping) {
+                return;
+            }
+        }
+
+        // Steal each sub-pool's contents so the pings — which can stall for
+        // the full ODBC timeout on a dead link — never run under the pool
+        // lock. acquire() that races the sweep just takes the cold path.
+        std::vector<std::pair<std::string, std::vector<std::shared_ptr<SQLServerDriver>>>> idle;
+        {
+            std::lock_guard lock(m_mutex);
+            for (auto& [id, pool] : m_profilePools) {
+                if (!pool.warm.empty()) {
+                    idle.emplace_back(id, std::move(pool.warm));
+                    pool.warm.clear();
+                }
+            }
+        }
+
+        for (auto& [profileId, drivers] : idle) {
+            bool evictedAny = false;
+            std::vector<std::shared_ptr<SQLServerDriver>> alive;
+            alive.reserve(drivers.size());
+
+            for (auto& driver : drivers) {
+                if (pingConnection(*driver)) {
+                    alive.push_back(std::move(driver));
+                } else {
+                    driver->disconnect();
+                    evictedAny = true;
+                }
+            }
+
+            {
+                std::lock_guard lock(m_mutex);
+                auto it = m_profilePools.find(profileId);
+                if (it == m_profilePools.end()) {
+                    // Profile removed while pinging; drop the survivors too
+                    for (auto& driver : alive) {
+                        driver->disconnect();
+                    }
+                    continue;
+                }
+                for (auto& driver : alive) {
+                    it->second.warm.push_back(std::move(driver));
+                }
+            }
+
+            if (evictedAny) {
+                // Transparent reconnect: refill the floor off the hot path
+                warmUp(profileId);
+            }
+        }
+    }
+}
+
+bool ConnectionPool::pingConnection(SQLServerDriver& driver) noexcept {
+    try {
+        static_cast<void>(driver.execute("SELECT 1"));
+        return true;
+    } catch (const std::exception&) {
+        return false;
     }
 }
 
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace velocitydb {
@@ -28,29 +31,65 @@ struct ConnectionInfo {
 
 class ConnectionPool {
 public:
-    explicit ConnectionPool(size_t poolSize = 5) : m_poolSize(poolSize) {}
+    explicit ConnectionPool(size_t poolSize = 5, size_t warmFloor = 2);
     ~ConnectionPool();
 
     ConnectionPool(const ConnectionPool&) = delete;
     ConnectionPool& operator=(const ConnectionPool&) = delete;
 
     [[nodiscard]] bool addConnection(const ConnectionInfo& info);
+
+    /// Registers a profile without a synchronous validation connect and
+    /// queues warm-up for it. Used at startup for the last-used profile,
+    /// where blocking on a login handshake would stall the UI.
+    void registerProfile(const ConnectionInfo& info);
+
     void removeConnection(std::string_view id);
 
     [[nodiscard]] std::shared_ptr<SQLServerDriver> acquire(std::string_view connectionId);
-    void release(std::shared_ptr<SQLServerDriver> connection);
+    void release(std::string_view connectionId, std::shared_ptr<SQLServerDriver> connection);
+
+    /// Queues background pre-establishment of connections for the profile
+    /// until its sub-pool holds the warm floor.
+    void warmUp(std::string_view connectionId);
 
     [[nodiscard]] std::vector<ConnectionInfo> getConnections() const;
     [[nodiscard]] bool testConnection(const ConnectionInfo& info);
 
 private:
+    // Each registered profile keeps its own sub-pool of already-logged-in
+    // drivers so the first query after opening a profile skips the
+    // TCP+TLS+login handshake entirely.
+    struct ProfilePool {
+        std::vector<std::shared_ptr<SQLServerDriver>> warm;
+    };
+
     [[nodiscard]] std::string buildConnectionString(const ConnectionInfo& info) const;
+    void warmupLoop();
+    void heartbeatLoop();
+    [[nodiscard]] static bool pingConnection(SQLServerDriver& driver) noexcept;
+
+    // Idle warm connections are pinged at this cadence; a dead one (VPN
+    // flap, tunnel drop) is evicted and replaced before acquire() can hand
+    // it out and eat the full ODBC timeout.
+    static constexpr auto HEARTBEAT_INTERVAL = std::chrono::seconds(30);
 
     size_t m_poolSize;
+    size_t m_warmFloor;
     mutable std::mutex m_mutex;
     std::condition_variable m_condition;
     std::vector<ConnectionInfo> m_connections;
-    std::queue<std::shared_ptr<SQLServerDriver>> m_available;
+    std::unordered_map<std::string, ProfilePool> m_profilePools;
+
+    // Warm-up worker: profiles queued here get connections established in
+    // the background up to the warm floor.
+    std::mutex m_warmupMutex;
+    std::condition_variable m_warmupWake;
+    std::condition_variable m_heartbeatWake;
+    std::deque<std::string> m_warmupQueue;
+    bool m_stopping = false;
+    std::jthread m_warmupWorker;
+    std::jthread m_heartbeatWorker;
 };
 
 }  // namespace velocitydb
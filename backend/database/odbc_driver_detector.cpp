@@ -6,14 +6,20 @@
 
 #include <array>
 #include <format>
+#include <future>
+#include <mutex>
 
 namespace velocitydb {
 
 namespace {
 
-// Cache the detected driver to avoid repeated registry lookups
+// Cache the detected driver to avoid repeated registry lookups. Guarded by
+// a mutex because the startup scan runs on a background thread while the
+// dispatch thread may already be building connection strings.
+std::mutex g_driverMutex;
 std::string g_cachedDriver;
 bool g_driverDetected = false;
+std::future<void> g_startupScan;
 
 bool isDriverAvailable(const std::string& driverName) {
     SQLHENV env = SQL_NULL_HENV;
@@ -48,30 +54,84 @@ bool isDriverAvailable(const std::string& driverName) {
     return found;
 }
 
-}  // namespace
-
-std::string detectBestSqlServerDriver() {
-    if (g_driverDetected) {
-        return g_cachedDriver;
-    }
-
-    // Try drivers in order of preference (newest first)
+/// Walks the installed drivers, newest first. This is the slow path the
+/// memoization exists to avoid.
+std::string scanForBestDriver() {
     static const std::array<std::string, 4> drivers = {"ODBC Driver 18 for SQL Server", "ODBC Driver 17 for SQL Server", "ODBC Driver 13 for SQL Server", "SQL Server"};
 
     for (const auto& driver : drivers) {
         if (isDriverAvailable(driver)) {
-            g_cachedDriver = driver;
-            g_driverDetected = true;
-            return g_cachedDriver;
+            return driver;
         }
     }
 
     // Fallback to generic driver name (may not work)
-    g_cachedDriver = "SQL Server";
+    return "SQL Server";
+}
+
+}  // namespace
+
+void initializeDriverDetection(std::string_view persistedDriver, std::function<void(const std::string&)> onDetected) {
+    if (!persistedDriver.empty()) {
+        std::lock_guard lock(g_driverMutex);
+        g_cachedDriver = persistedDriver;
+        g_driverDetected = true;
+        return;
+    }
+
+    // No persisted result (first run or cleared settings): scan off the
+    // startup path and hand the result to the caller for persistence.
+    g_startupScan = std::async(std::launch::async, [onDetected = std::move(onDetected)] {
+        auto driver = scanForBestDriver();
+        {
+            std::lock_guard lock(g_driverMutex);
+            // A synchronous detect may have raced us; either result is fine
+            if (!g_driverDetected) {
+                g_cachedDriver = driver;
+                g_driverDetected = true;
+            }
+        }
+        if (onDetected) {
+            onDetected(driver);
+        }
+    });
+}
+
+void shutdownDriverDetection() {
+    if (g_startupScan.valid()) {
+        g_startupScan.wait();
+    }
+}
+
+std::string refreshDriverDetection() {
+    auto driver = scanForBestDriver();
+
+    std::lock_guard lock(g_driverMutex);
+    g_cachedDriver = driver;
     g_driverDetected = true;
     return g_cachedDriver;
 }
 
+std::string detectBestSqlServerDriver() {
+    {
+        std::lock_guard lock(g_driverMutex);
+        if (g_driverDetected) {
+            return g_cachedDriver;
+        }
+    }
+
+    // Cache miss: a connection is being opened before the startup scan
+    // finished (or initialization was skipped). Scan synchronously.
+    auto driver = scanForBestDriver();
+
+    std::lock_guard lock(g_driverMutex);
+    if (!g_driverDetected) {
+        g_cachedDriver = driver;
+        g_driverDetected = true;
+    }
+    return g_cachedDriver;
+}
+
 std::string buildDriverConnectionPrefix(std::string_view server, std::string_view database) {
     auto driver = detectBestSqlServerDriver();
     // ODBC Driver 18+ requires explicit SSL settings
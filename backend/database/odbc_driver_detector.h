@@ -1,12 +1,29 @@
 #pragma once
 
+#include <functional>
 #include <string>
 
 namespace velocitydb {
 
+/// Seeds the driver cache at startup. With a persisted driver name the
+/// registry scan is skipped entirely; otherwise the scan runs on a
+/// background thread and onDetected (if given) is invoked with the result
+/// so the caller can persist it. Detection runs approximately never after
+/// install, so every openDatabaseConnection call hits the in-memory cache.
+void initializeDriverDetection(std::string_view persistedDriver, std::function<void(const std::string&)> onDetected = {});
+
+/// Forces a registry rescan (manual "refresh drivers"), replacing the
+/// cached result. Returns the newly detected driver name.
+[[nodiscard]] std::string refreshDriverDetection();
+
+/// Waits for an in-flight startup scan. Callers whose state the
+/// onDetected callback touches must invoke this before destroying it.
+void shutdownDriverDetection();
+
 /// Detects the best available SQL Server ODBC driver on the system.
 /// Returns "ODBC Driver 18 for SQL Server" if available, falling back to
-/// version 17, then "SQL Server" as last resort.
+/// version 17, then "SQL Server" as last resort. Memoized; scans at most
+/// once unless refreshDriverDetection() is called.
 [[nodiscard]] std::string detectBestSqlServerDriver();
 
 /// Builds a connection string with the best available driver.
@@ -1,29 +1,207 @@
 #include "query_history.h"
 
+#include "../parsers/sql_parser.h"
 #include "simdjson.h"
 
 #include <algorithm>
+#include <cctype>
 #include <format>
 #include <fstream>
 #include <ranges>
 #include <sstream>
+#include <unordered_set>
 
 namespace velocitydb {
 
+namespace {
+
+// Packs three lowercased bytes into one index key
+[[nodiscard]] uint32_t trigramKey(unsigned char a, unsigned char b, unsigned char c) {
+    return static_cast<uint32_t>(std::tolower(a)) << 16 | static_cast<uint32_t>(std::tolower(b)) << 8 | static_cast<uint32_t>(std::tolower(c));
+}
+
+// Unique trigrams of a text; repeated windows would otherwise put the
+// same id into a posting list more than once
+[[nodiscard]] std::unordered_set<uint32_t> uniqueTrigrams(std::string_view text) {
+    std::unordered_set<uint32_t> trigrams;
+    if (text.size() >= 3) {
+        trigrams.reserve(text.size());
+        for (size_t i = 0; i + 3 <= text.size(); ++i) {
+            trigrams.insert(trigramKey(text[i], text[i + 1], text[i + 2]));
+        }
+    }
+    return trigrams;
+}
+
+// Minimal JSON string escape; SQL texts carry quotes and newlines, and a
+// raw newline would break the one-record-per-line log framing
+[[nodiscard]] std::string escapeJson(std::string_view text) {
+    std::string escaped;
+    escaped.reserve(text.size() + text.size() / 8);
+    for (unsigned char c : text) {
+        switch (c) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\r': escaped += "\\r"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    escaped += std::format("\\u{:04x}", c);
+                } else {
+                    escaped += static_cast<char>(c);
+                }
+        }
+    }
+    return escaped;
+}
+
+// One log line per record; field set matches save()/load()
+[[nodiscard]] std::string serializeRecord(const HistoryItem& item) {
+    auto time = std::chrono::system_clock::to_time_t(item.timestamp);
+    return std::format(R"({{"id":"{}","sql":"{}","connectionId":"{}","timestamp":{},"executionTimeMs":{},"success":{},"errorMessage":"{}","affectedRows":{},"isFavorite":{}}})", escapeJson(item.id),
+                       escapeJson(item.sql), escapeJson(item.connectionId), time, item.executionTimeMs, item.success ? "true" : "false", escapeJson(item.errorMessage), item.affectedRows,
+                       item.isFavorite ? "true" : "false");
+}
+
+[[nodiscard]] HistoryItem parseRecord(simdjson::dom::element element) {
+    HistoryItem item;
+    if (auto id = element["id"].get_string(); !id.error()) {
+        item.id = std::string(id.value());
+    }
+    if (auto sql = element["sql"].get_string(); !sql.error()) {
+        item.sql = std::string(sql.value());
+    }
+    if (auto connId = element["connectionId"].get_string(); !connId.error()) {
+        item.connectionId = std::string(connId.value());
+    }
+    if (auto timestamp = element["timestamp"].get_int64(); !timestamp.error()) {
+        item.timestamp = std::chrono::system_clock::from_time_t(timestamp.value());
+    }
+    if (auto execTime = element["executionTimeMs"].get_double(); !execTime.error()) {
+        item.executionTimeMs = execTime.value();
+    }
+    if (auto success = element["success"].get_bool(); !success.error()) {
+        item.success = success.value();
+    }
+    if (auto errorMsg = element["errorMessage"].get_string(); !errorMsg.error()) {
+        item.errorMessage = std::string(errorMsg.value());
+    }
+    if (auto affected = element["affectedRows"].get_int64(); !affected.error()) {
+        item.affectedRows = affected.value();
+    }
+    if (auto favorite = element["isFavorite"].get_bool(); !favorite.error()) {
+        item.isFavorite = favorite.value();
+    }
+    return item;
+}
+
+}  // namespace
+
 void QueryHistory::add(const HistoryItem& item) {
     std::lock_guard lock(m_mutex);
 
     m_history.insert(m_history.begin(), item);
+    indexItem(item);
+    appendToLog(item);
 
     while (m_history.size() > m_maxItems) {
         auto it = std::ranges::find_if(m_history | std::views::reverse, [](const HistoryItem& h) { return !h.isFavorite; });
 
         if (it != (m_history | std::views::reverse).end()) {
+            deindexItem(*std::prev(it.base()));
             m_history.erase(std::next(it).base());
         } else {
             break;
         }
     }
+
+    // Evictions leave stale lines in the log; compact once the file has
+    // drifted a slack's worth past the cap rather than per eviction
+    if (m_logFile.is_open() && m_logRecordCount > m_maxItems + COMPACTION_SLACK) {
+        rewriteLog();
+    }
+}
+
+void QueryHistory::indexItem(const HistoryItem& item) {
+    for (uint32_t trigram : uniqueTrigrams(item.sql)) {
+        m_trigramIndex[trigram].push_back(item.id);
+    }
+}
+
+void QueryHistory::deindexItem(const HistoryItem& item) {
+    for (uint32_t trigram : uniqueTrigrams(item.sql)) {
+        if (auto it = m_trigramIndex.find(trigram); it != m_trigramIndex.end()) {
+            std::erase(it->second, item.id);
+            if (it->second.empty()) {
+                m_trigramIndex.erase(it);
+            }
+        }
+    }
+}
+
+void QueryHistory::rebuildIndex() {
+    m_trigramIndex.clear();
+    for (const auto& item : m_history) {
+        indexItem(item);
+    }
+}
+
+void QueryHistory::appendToLog(const HistoryItem& item) {
+    if (!m_logFile.is_open()) {
+        return;
+    }
+    m_logFile << serializeRecord(item) << '\n';
+    m_logFile.flush();  // One line per query completion; survive crashes
+    ++m_logRecordCount;
+}
+
+void QueryHistory::rewriteLog() {
+    m_logFile.close();
+    std::ofstream compacted(m_logPath, std::ios::trunc);
+    if (compacted.is_open()) {
+        // Oldest first so replay order matches append order
+        for (auto it = m_history.rbegin(); it != m_history.rend(); ++it) {
+            compacted << serializeRecord(*it) << '\n';
+        }
+    }
+    compacted.close();
+    m_logFile.open(m_logPath, std::ios::app);
+    m_logRecordCount = m_history.size();
+}
+
+bool QueryHistory::openLog(std::string_view filepath) {
+    std::lock_guard lock(m_mutex);
+
+    m_logPath = std::filesystem::path(filepath);
+    m_logRecordCount = 0;
+
+    if (std::ifstream existing(m_logPath); existing.is_open()) {
+        m_history.clear();
+        simdjson::dom::parser parser;
+        std::string line;
+        while (std::getline(existing, line)) {
+            if (line.empty()) {
+                continue;
+            }
+            try {
+                m_history.push_back(parseRecord(parser.parse(line)));
+                ++m_logRecordCount;
+            } catch (...) {
+                // A torn last line from a crash mid-append is expected;
+                // skip it and keep the replayable records
+            }
+        }
+        // Log is oldest-first; the in-memory list is newest-first
+        std::ranges::reverse(m_history);
+        if (m_history.size() > m_maxItems) {
+            m_history.resize(m_maxItems);
+        }
+        rebuildIndex();
+    }
+
+    m_logFile.open(m_logPath, std::ios::app);
+    return m_logFile.is_open();
 }
 
 std::vector<HistoryItem> QueryHistory::getAll() const {
@@ -50,6 +228,33 @@ std::vector<HistoryItem> QueryHistory::search(std::string_view keyword) const {
     std::vector<HistoryItem> results;
     results.reserve(m_history.size() / 4);  // Estimate ~25% match rate
 
+    // Keywords of three or more characters intersect trigram posting
+    // lists instead of scanning every stored text; an id is a candidate
+    // only when every keyword trigram's list contains it
+    if (keyword.size() >= 3) {
+        auto trigrams = uniqueTrigrams(keyword);
+        std::unordered_map<std::string_view, size_t> idHits;
+        for (uint32_t trigram : trigrams) {
+            auto it = m_trigramIndex.find(trigram);
+            if (it == m_trigramIndex.end()) {
+                return results;  // Some trigram occurs nowhere: no matches
+            }
+            for (const auto& id : it->second) {
+                ++idHits[id];
+            }
+        }
+
+        for (const auto& item : m_history) {
+            auto hits = idHits.find(item.id);
+            // Verify contiguity: an item holding all trigrams scattered
+            // across its text is not a substring match
+            if (hits != idHits.end() && hits->second == trigrams.size() && caseInsensitiveFind(item.sql, keyword)) {
+                results.push_back(item);
+            }
+        }
+        return results;
+    }
+
     for (const auto& item : m_history) {
         if (caseInsensitiveFind(item.sql, keyword)) {
             results.push_back(item);
@@ -73,6 +278,9 @@ void QueryHistory::setFavorite(std::string_view id, bool favorite) {
 
     if (auto it = std::ranges::find_if(m_history, [id](const HistoryItem& h) { return h.id == id; }); it != m_history.end()) {
         it->isFavorite = favorite;
+        if (m_logFile.is_open()) {
+            rewriteLog();
+        }
     }
 }
 
@@ -88,13 +296,70 @@ std::vector<HistoryItem> QueryHistory::getFavorites() const {
 void QueryHistory::remove(std::string_view id) {
     std::lock_guard lock(m_mutex);
 
-    std::erase_if(m_history, [id](const HistoryItem& h) { return h.id == id; });
+    if (auto it = std::ranges::find_if(m_history, [id](const HistoryItem& h) { return h.id == id; }); it != m_history.end()) {
+        deindexItem(*it);
+        m_history.erase(it);
+        if (m_logFile.is_open()) {
+            rewriteLog();
+        }
+    }
 }
 
 void QueryHistory::clear() {
     std::lock_guard lock(m_mutex);
 
     std::erase_if(m_history, [](const HistoryItem& h) { return !h.isFavorite; });
+    rebuildIndex();
+    if (m_logFile.is_open()) {
+        rewriteLog();
+    }
+}
+
+std::vector<QueryHistory::FingerprintStats> QueryHistory::aggregateByFingerprint() const {
+    std::lock_guard lock(m_mutex);
+
+    struct Accumulator {
+        size_t statsIndex = 0;
+        std::vector<double> timesMs;
+    };
+    std::vector<FingerprintStats> stats;
+    std::unordered_map<std::string, Accumulator> byFingerprint;
+
+    for (const auto& item : m_history) {
+        auto key = SQLParser::fingerprint(item.sql);
+        auto [it, inserted] = byFingerprint.try_emplace(std::move(key));
+        if (inserted) {
+            it->second.statsIndex = stats.size();
+            // History is ordered newest-first, so the first run seen for a
+            // shape is its most recent one - keep that as the example
+            stats.push_back(FingerprintStats{.fingerprint = it->first, .exampleSql = item.sql});
+        }
+
+        auto& entry = stats[it->second.statsIndex];
+        ++entry.runCount;
+        if (!item.success) {
+            ++entry.failureCount;
+        }
+        entry.totalTimeMs += item.executionTimeMs;
+        entry.maxMs = (std::max)(entry.maxMs, item.executionTimeMs);
+        entry.totalAffectedRows += item.affectedRows;
+        it->second.timesMs.push_back(item.executionTimeMs);
+    }
+
+    // Percentiles by partial selection: nth_element is O(n) per bucket and
+    // the ordering of the rest is never needed
+    for (auto& [key, accumulator] : byFingerprint) {
+        auto& timesMs = accumulator.timesMs;
+        const auto percentile = [&timesMs](size_t numerator) {
+            const size_t rank = (timesMs.size() - 1) * numerator / 100;
+            std::nth_element(timesMs.begin(), timesMs.begin() + static_cast<ptrdiff_t>(rank), timesMs.end());
+            return timesMs[rank];
+        };
+        stats[accumulator.statsIndex].p50Ms = percentile(50);
+        stats[accumulator.statsIndex].p95Ms = percentile(95);
+    }
+
+    return stats;
 }
 
 bool QueryHistory::save(std::string_view filepath) const {
@@ -198,6 +463,7 @@ bool QueryHistory::load(std::string_view filepath) {
             m_history.push_back(std::move(historyItem));
         }
 
+        rebuildIndex();
         return true;
     } catch (...) {
         return false;
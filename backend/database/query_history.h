@@ -1,10 +1,13 @@
 #pragma once
 
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace velocitydb {
@@ -40,13 +43,58 @@ public:
     void remove(std::string_view id);
     void clear();
 
+    /// Per-statement-shape performance aggregate over the retained history.
+    /// Runs are grouped by SQLParser::fingerprint, so every execution of
+    /// "WHERE id = <n>" lands in one bucket regardless of the literal.
+    struct FingerprintStats {
+        std::string fingerprint;
+        std::string exampleSql;  // Most recent raw text of the shape
+        size_t runCount = 0;
+        size_t failureCount = 0;
+        double totalTimeMs = 0.0;
+        double p50Ms = 0.0;
+        double p95Ms = 0.0;
+        double maxMs = 0.0;
+        int64_t totalAffectedRows = 0;
+    };
+
+    /// Aggregates latency percentiles and run counts per fingerprint.
+    /// Computed on demand - the history is capped, so one scan is cheaper
+    /// than keeping incremental percentile state in sync with eviction.
+    [[nodiscard]] std::vector<FingerprintStats> aggregateByFingerprint() const;
+
     [[nodiscard]] bool save(std::string_view filepath) const;
     [[nodiscard]] bool load(std::string_view filepath);
 
+    /// Opens the append-only NDJSON history log: replays existing records
+    /// into memory, then each add() appends one line instead of rewriting
+    /// the whole file. Rare mutations (remove, clear, favorites) and the
+    /// cap trigger compaction rewrites.
+    [[nodiscard]] bool openLog(std::string_view filepath);
+
 private:
+    // Trigram index maintenance: posting lists of item ids per lowercased
+    // 3-byte window of the SQL text, kept in sync by add/remove/evict so
+    // search intersects short lists instead of scanning 10k texts
+    void indexItem(const HistoryItem& item);
+    void deindexItem(const HistoryItem& item);
+    void rebuildIndex();
+
+    void appendToLog(const HistoryItem& item);
+    void rewriteLog();
+
+    // Appends tolerated beyond the cap before the log is compacted; keeps
+    // the rewrite amortized instead of per-eviction
+    static constexpr size_t COMPACTION_SLACK = 1024;
+
     size_t m_maxItems;
     mutable std::mutex m_mutex;
     std::vector<HistoryItem> m_history;
+    std::unordered_map<uint32_t, std::vector<std::string>> m_trigramIndex;
+
+    std::filesystem::path m_logPath;
+    std::ofstream m_logFile;
+    size_t m_logRecordCount = 0;  // Lines in the file, including replayed
 };
 
 }  // namespace velocitydb
@@ -1,72 +1,469 @@
 #include "result_cache.h"
 
-#include <ranges>
+#include "utils/memory_budget.h"
+#include "utils/metrics.h"
+#include "utils/trace.h"
+
+#include <Windows.h>
+#include <compressapi.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <functional>
 
 namespace velocitydb {
 
-void ResultCache::put(std::string_view key, const ResultSet& result) {
-    std::lock_guard lock(m_mutex);
+namespace {
+
+// --- Flat binary (de)serialization for the compression tier ---
+// Cells are length-prefixed; the layout is internal to the cache and never
+// leaves the process, so no versioning is needed.
+
+void appendU32(std::string& out, uint32_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void appendU64(std::string& out, uint64_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void appendString(std::string& out, std::string_view value) {
+    appendU32(out, static_cast<uint32_t>(value.size()));
+    out.append(value);
+}
+
+template <typename T>
+T readPod(std::string_view& in) {
+    T value{};
+    std::memcpy(&value, in.data(), sizeof(T));
+    in.remove_prefix(sizeof(T));
+    return value;
+}
+
+std::string readString(std::string_view& in) {
+    auto len = readPod<uint32_t>(in);
+    std::string value(in.substr(0, len));
+    in.remove_prefix(len);
+    return value;
+}
+
+// Zero-copy variant for cells, whose bytes go straight into the arena
+std::string_view readStringView(std::string_view& in) {
+    auto len = readPod<uint32_t>(in);
+    auto view = in.substr(0, len);
+    in.remove_prefix(len);
+    return view;
+}
+
+std::string serializeForCompression(const ResultSet& result) {
+    std::string out;
+
+    // Reserve roughly the payload size to avoid regrowth
+    size_t estimate = 64;
+    for (const auto& row : result.rows) {
+        for (const auto& val : row.values) {
+            estimate += val.size() + sizeof(uint32_t);
+        }
+    }
+    out.reserve(estimate);
+
+    appendU32(out, static_cast<uint32_t>(result.columns.size()));
+    for (const auto& col : result.columns) {
+        appendString(out, col.name);
+        appendString(out, col.type);
+        appendU32(out, static_cast<uint32_t>(col.size));
+        out.push_back(col.nullable ? 1 : 0);
+        out.push_back(col.isPrimaryKey ? 1 : 0);
+        appendString(out, col.comment);
+    }
+
+    appendU64(out, result.rows.size());
+    for (const auto& row : result.rows) {
+        for (const auto& val : row.values) {
+            appendString(out, val);
+        }
+    }
+
+    appendU64(out, static_cast<uint64_t>(result.affectedRows));
+    appendU64(out, std::bit_cast<uint64_t>(result.executionTimeMs));
+    return out;
+}
+
+ResultSet deserializeFromCompression(std::string_view in) {
+    ResultSet result;
+
+    auto colCount = readPod<uint32_t>(in);
+    result.columns.reserve(colCount);
+    for (uint32_t i = 0; i < colCount; ++i) {
+        ColumnInfo col;
+        col.name = readString(in);
+        col.type = readString(in);
+        col.size = static_cast<int>(readPod<uint32_t>(in));
+        col.nullable = readPod<uint8_t>(in) != 0;
+        col.isPrimaryKey = readPod<uint8_t>(in) != 0;
+        col.comment = readString(in);
+        result.columns.push_back(std::move(col));
+    }
+
+    auto rowCount = readPod<uint64_t>(in);
+    result.attachArena();
+    result.rows.reserve(rowCount);
+    for (uint64_t r = 0; r < rowCount; ++r) {
+        auto row = result.makeRow();
+        row.values.reserve(colCount);
+        for (uint32_t c = 0; c < colCount; ++c) {
+            row.values.emplace_back(readStringView(in));
+        }
+        result.rows.push_back(std::move(row));
+    }
+
+    result.affectedRows = static_cast<int64_t>(readPod<uint64_t>(in));
+    result.executionTimeMs = std::bit_cast<double>(readPod<uint64_t>(in));
+    return result;
+}
+
+// --- Windows Compression API (XPRESS+Huffman) wrappers ---
+// Compressed form carries the uncompressed size as a u64 prefix.
+
+std::string compressBuffer(std::string_view input) {
+    COMPRESSOR_HANDLE compressor = nullptr;
+    if (!CreateCompressor(COMPRESS_ALGORITHM_XPRESS_HUFF, nullptr, &compressor)) {
+        return {};
+    }
+
+    std::string output(sizeof(uint64_t), '\0');
+    uint64_t originalSize = input.size();
+    std::memcpy(output.data(), &originalSize, sizeof(originalSize));
+
+    SIZE_T compressedSize = 0;
+    Compress(compressor, const_cast<char*>(input.data()), input.size(), nullptr, 0, &compressedSize);
+    output.resize(sizeof(uint64_t) + compressedSize);
+
+    BOOL ok = Compress(compressor, const_cast<char*>(input.data()), input.size(), output.data() + sizeof(uint64_t), compressedSize, &compressedSize);
+    CloseCompressor(compressor);
+    if (!ok) {
+        return {};
+    }
+
+    output.resize(sizeof(uint64_t) + compressedSize);
+    return output;
+}
+
+std::string decompressBuffer(std::string_view input) {
+    if (input.size() < sizeof(uint64_t)) {
+        return {};
+    }
+
+    uint64_t originalSize = 0;
+    std::memcpy(&originalSize, input.data(), sizeof(originalSize));
+    input.remove_prefix(sizeof(uint64_t));
+
+    DECOMPRESSOR_HANDLE decompressor = nullptr;
+    if (!CreateDecompressor(COMPRESS_ALGORITHM_XPRESS_HUFF, nullptr, &decompressor)) {
+        return {};
+    }
+
+    std::string output(static_cast<size_t>(originalSize), '\0');
+    SIZE_T decompressedSize = 0;
+    BOOL ok = Decompress(decompressor, const_cast<char*>(input.data()), input.size(), output.data(), output.size(), &decompressedSize);
+    CloseDecompressor(decompressor);
+    if (!ok || decompressedSize != originalSize) {
+        return {};
+    }
+
+    return output;
+}
 
-    auto resultSize = estimateSize(result);
+}  // namespace
 
-    // Skip caching if result is larger than max cache size to prevent exceeding limits
+ResultCache::ResultCache(size_t maxSizeBytes) : m_maxSizeBytes(maxSizeBytes), m_budgetSlot(MemoryBudget::MAX_SUBSYSTEMS), m_sweeper([this] { compressionSweepLoop(); }) {
+    // Registered after the shards exist: pressure from another subsystem
+    // may call shrink() the moment the slot goes live
+    m_budgetSlot = MemoryBudget::instance().registerSubsystem("resultCache", MemoryBudget::Priority::Cache, [this](size_t bytesWanted) { return shrink(bytesWanted); });
+}
+
+ResultCache::~ResultCache() {
+    {
+        std::lock_guard lock(m_sweepMutex);
+        m_stopping = true;
+    }
+    m_sweepWake.notify_all();
+    m_sweeper.join();
+
+    // Only after the sweeper stops: its shrink callback captures this
+    MemoryBudget::instance().unregisterSubsystem(m_budgetSlot);
+}
+
+ResultCache::Shard& ResultCache::shardFor(std::string_view key) noexcept {
+    return m_shards[std::hash<std::string_view>{}(key) % SHARD_COUNT];
+}
+
+void ResultCache::put(std::string_view key, std::shared_ptr<const ResultSet> result, std::vector<std::string> tables) {
+    VDB_TRACE_SPAN("cache", "put");
+    if (!result) [[unlikely]] {
+        return;
+    }
+
+    MemoryBudget::ScopedDelta budgetDelta(m_budgetSlot);
+    auto resultSize = estimateSize(*result);
+
+    // Admission is capped by the whole cache budget, not one shard's
+    // slice - large results are exactly the ones worth caching here
     if (resultSize > m_maxSizeBytes) {
         return;
     }
 
+    auto& shard = shardFor(key);
+
+    // An entry bigger than its shard's slice borrows the excess from the
+    // other shards before the owning lock is taken (never nested, so two
+    // oversized puts cannot deadlock). The borrow is returned through the
+    // budget records; the process-level MemoryBudget backstops the window
+    // where other shards refill while the big entry lives.
+    if (resultSize > shardBudget()) {
+        budgetDelta.delta -= static_cast<int64_t>(reclaimFromOtherShards(resultSize - shardBudget(), &shard));
+    }
+
+    std::lock_guard lock(shard.mutex);
+
     std::string keyStr(key);
 
-    if (auto it = m_cache.find(keyStr); it != m_cache.end()) {
-        m_currentSizeBytes -= it->second.sizeBytes;
-        m_cache.erase(it);
+    if (auto it = shard.cache.find(keyStr); it != shard.cache.end()) {
+        shard.currentSizeBytes -= it->second.sizeBytes;
+        budgetDelta.delta -= static_cast<int64_t>(it->second.sizeBytes);
+        shard.lruOrder.erase(it->second.lruIt);
+        shard.cache.erase(it);
     }
 
-    evictIfNeeded(resultSize);
+    budgetDelta.delta -= static_cast<int64_t>(evictIfNeeded(shard, resultSize, (std::max)(shardBudget(), resultSize)));
+
+    shard.lruOrder.push_front(keyStr);
+    shard.cache[keyStr] = CachedResult{.data = std::move(result), .tables = std::move(tables), .timestamp = std::chrono::steady_clock::now(), .sizeBytes = resultSize, .lruIt = shard.lruOrder.begin()};
+    shard.currentSizeBytes += resultSize;
+    budgetDelta.delta += static_cast<int64_t>(resultSize);
+}
+
+void ResultCache::invalidateTables(const std::vector<std::string>& tables, std::string_view keyPrefix) {
+    MemoryBudget::ScopedDelta budgetDelta(m_budgetSlot);
+    for (auto& shard : m_shards) {
+        std::lock_guard lock(shard.mutex);
+
+        for (auto it = shard.cache.begin(); it != shard.cache.end();) {
+            auto& [key, entry] = *it;
+            if (!key.starts_with(keyPrefix)) {
+                ++it;
+                continue;
+            }
+
+            // Untagged entries have unknown dependencies - drop them too
+            bool touchesModifiedTable = entry.tables.empty();
+            for (const auto& table : entry.tables) {
+                if (std::ranges::find(tables, table) != tables.end()) {
+                    touchesModifiedTable = true;
+                    break;
+                }
+            }
 
-    m_cache[keyStr] = CachedResult{.data = result, .timestamp = std::chrono::steady_clock::now(), .sizeBytes = resultSize};
-    m_currentSizeBytes += resultSize;
+            if (touchesModifiedTable) {
+                shard.currentSizeBytes -= entry.sizeBytes;
+                budgetDelta.delta -= static_cast<int64_t>(entry.sizeBytes);
+                shard.lruOrder.erase(entry.lruIt);
+                it = shard.cache.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
 }
 
-std::optional<ResultSet> ResultCache::get(std::string_view key) {
-    std::lock_guard lock(m_mutex);
+std::shared_ptr<const ResultSet> ResultCache::get(std::string_view key) {
+    VDB_TRACE_SPAN("cache", "get");
+    MemoryBudget::ScopedDelta budgetDelta(m_budgetSlot);
+    auto& shard = shardFor(key);
+    std::lock_guard lock(shard.mutex);
 
     std::string keyStr(key);
-    if (auto it = m_cache.find(keyStr); it != m_cache.end()) {
+    if (auto it = shard.cache.find(keyStr); it != shard.cache.end()) {
         it->second.timestamp = std::chrono::steady_clock::now();
+        // O(1) bump to the front of the recency list
+        shard.lruOrder.splice(shard.lruOrder.begin(), shard.lruOrder, it->second.lruIt);
+
+        if (it->second.isCompressed()) {
+            auto restored = decompressEntry(shard, it->second, budgetDelta.delta);
+            if (!restored) {
+                // Corrupt entry - drop it and report a miss
+                shard.currentSizeBytes -= it->second.sizeBytes;
+                budgetDelta.delta -= static_cast<int64_t>(it->second.sizeBytes);
+                shard.lruOrder.erase(it->second.lruIt);
+                shard.cache.erase(it);
+                Metrics::instance().recordCacheMiss();
+                return nullptr;
+            }
+            Metrics::instance().recordCacheHit();
+            return restored;
+        }
+
+        Metrics::instance().recordCacheHit();
         return it->second.data;
     }
 
-    return std::nullopt;
+    Metrics::instance().recordCacheMiss();
+    return nullptr;
 }
 
 void ResultCache::invalidate(std::string_view key) {
-    std::lock_guard lock(m_mutex);
+    MemoryBudget::ScopedDelta budgetDelta(m_budgetSlot);
+    auto& shard = shardFor(key);
+    std::lock_guard lock(shard.mutex);
 
     std::string keyStr(key);
-    if (auto it = m_cache.find(keyStr); it != m_cache.end()) {
-        m_currentSizeBytes -= it->second.sizeBytes;
-        m_cache.erase(it);
+    if (auto it = shard.cache.find(keyStr); it != shard.cache.end()) {
+        shard.currentSizeBytes -= it->second.sizeBytes;
+        budgetDelta.delta -= static_cast<int64_t>(it->second.sizeBytes);
+        shard.lruOrder.erase(it->second.lruIt);
+        shard.cache.erase(it);
     }
 }
 
 void ResultCache::clear() {
-    std::lock_guard lock(m_mutex);
-    m_cache.clear();
-    m_currentSizeBytes = 0;
+    MemoryBudget::ScopedDelta budgetDelta(m_budgetSlot);
+    for (auto& shard : m_shards) {
+        std::lock_guard lock(shard.mutex);
+        budgetDelta.delta -= static_cast<int64_t>(shard.currentSizeBytes);
+        shard.cache.clear();
+        shard.lruOrder.clear();
+        shard.currentSizeBytes = 0;
+    }
 }
 
 size_t ResultCache::getCurrentSize() const {
-    std::lock_guard lock(m_mutex);
-    return m_currentSizeBytes;
+    size_t total = 0;
+    for (const auto& shard : m_shards) {
+        std::lock_guard lock(shard.mutex);
+        total += shard.currentSizeBytes;
+    }
+    return total;
 }
 
-void ResultCache::evictIfNeeded(size_t requiredSize) {
-    while (m_currentSizeBytes + requiredSize > m_maxSizeBytes && !m_cache.empty()) {
-        auto oldest = std::ranges::min_element(m_cache, [](const auto& a, const auto& b) { return a.second.timestamp < b.second.timestamp; });
+void ResultCache::compressionSweepLoop() {
+    std::unique_lock sweepLock(m_sweepMutex);
+    while (!m_stopping) {
+        m_sweepWake.wait_for(sweepLock, SWEEP_INTERVAL, [this] { return m_stopping; });
+        if (m_stopping) {
+            return;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        for (auto& shard : m_shards) {
+            MemoryBudget::ScopedDelta budgetDelta(m_budgetSlot);
+            std::lock_guard lock(shard.mutex);
+            for (auto& [key, entry] : shard.cache) {
+                if (!entry.isCompressed() && now - entry.timestamp > COLD_AFTER) {
+                    compressEntry(shard, entry, budgetDelta.delta);
+                }
+            }
+        }
+    }
+}
+
+void ResultCache::compressEntry(Shard& shard, CachedResult& entry, int64_t& budgetDelta) {
+    auto compressed = compressBuffer(serializeForCompression(*entry.data));
+    if (compressed.empty() || compressed.size() >= entry.sizeBytes) {
+        return;  // Incompressible - keep the hot form
+    }
+
+    shard.currentSizeBytes -= entry.sizeBytes;
+    budgetDelta -= static_cast<int64_t>(entry.sizeBytes);
+    entry.sizeBytes = compressed.size();
+    shard.currentSizeBytes += entry.sizeBytes;
+    budgetDelta += static_cast<int64_t>(entry.sizeBytes);
+    entry.compressedData = std::move(compressed);
+    entry.data.reset();
+}
+
+std::shared_ptr<const ResultSet> ResultCache::decompressEntry(Shard& shard, CachedResult& entry, int64_t& budgetDelta) {
+    auto buffer = decompressBuffer(entry.compressedData);
+    if (buffer.empty()) {
+        return nullptr;
+    }
+
+    auto restored = std::make_shared<const ResultSet>(deserializeFromCompression(buffer));
+
+    // Re-warm: the entry goes back to the uncompressed tier and accounting
+    shard.currentSizeBytes -= entry.sizeBytes;
+    budgetDelta -= static_cast<int64_t>(entry.sizeBytes);
+    entry.sizeBytes = estimateSize(*restored);
+    shard.currentSizeBytes += entry.sizeBytes;
+    budgetDelta += static_cast<int64_t>(entry.sizeBytes);
+    entry.compressedData.clear();
+    entry.compressedData.shrink_to_fit();
+    entry.data = restored;
+    return restored;
+}
+
+size_t ResultCache::evictIfNeeded(Shard& shard, size_t requiredSize, size_t budget) {
+    // The recency list makes each eviction O(1) instead of a full scan
+    size_t freed = 0;
+    while (shard.currentSizeBytes + requiredSize > budget && !shard.cache.empty()) {
+        const auto& oldestKey = shard.lruOrder.back();
+        if (auto it = shard.cache.find(oldestKey); it != shard.cache.end()) {
+            shard.currentSizeBytes -= it->second.sizeBytes;
+            freed += it->second.sizeBytes;
+            shard.cache.erase(it);
+        }
+        shard.lruOrder.pop_back();
+    }
+    return freed;
+}
+
+size_t ResultCache::reclaimFromOtherShards(size_t bytesWanted, const Shard* owner) {
+    // One shard lock at a time, in array order - the caller holds no
+    // shard lock yet, so there is no ordering to conflict with
+    size_t freed = 0;
+    for (auto& shard : m_shards) {
+        if (&shard == owner) {
+            continue;
+        }
+        std::lock_guard lock(shard.mutex);
+        while (freed < bytesWanted && !shard.cache.empty()) {
+            const auto& oldestKey = shard.lruOrder.back();
+            if (auto it = shard.cache.find(oldestKey); it != shard.cache.end()) {
+                shard.currentSizeBytes -= it->second.sizeBytes;
+                freed += it->second.sizeBytes;
+                shard.cache.erase(it);
+            }
+            shard.lruOrder.pop_back();
+        }
+        if (freed >= bytesWanted) {
+            break;
+        }
+    }
+    return freed;
+}
+
+size_t ResultCache::shrink(size_t bytesWanted) {
+    size_t freed = 0;
+    for (auto& shard : m_shards) {
+        std::lock_guard lock(shard.mutex);
+        while (freed < bytesWanted && !shard.cache.empty()) {
+            const auto& oldestKey = shard.lruOrder.back();
+            if (auto it = shard.cache.find(oldestKey); it != shard.cache.end()) {
+                shard.currentSizeBytes -= it->second.sizeBytes;
+                freed += it->second.sizeBytes;
+                shard.cache.erase(it);
+            }
+            shard.lruOrder.pop_back();
+        }
+        if (freed >= bytesWanted) {
+            break;
+        }
+    }
 
-        m_currentSizeBytes -= oldest->second.sizeBytes;
-        m_cache.erase(oldest);
+    if (freed > 0) {
+        MemoryBudget::instance().record(m_budgetSlot, -static_cast<int64_t>(freed));
     }
+    return freed;
 }
 
 size_t ResultCache::estimateSize(const ResultSet& result) {
@@ -2,45 +2,113 @@
 
 #include "sqlserver_driver.h"
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <list>
+#include <memory>
 #include <mutex>
-#include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 
 namespace velocitydb {
 
 struct CachedResult {
-    ResultSet data;
+    std::shared_ptr<const ResultSet> data;  // Immutable; shared with readers without copying
+    std::string compressedData;             // XPRESS-compressed serialized form (cold entries)
+    std::vector<std::string> tables;        // Normalized table names the query touches
     std::chrono::steady_clock::time_point timestamp;
     size_t sizeBytes = 0;
+    std::list<std::string>::iterator lruIt;  // Position in the recency list
+
+    [[nodiscard]] bool isCompressed() const noexcept { return data == nullptr; }
 };
 
 class ResultCache {
 public:
-    explicit ResultCache(size_t maxSizeBytes = 100 * 1024 * 1024) : m_maxSizeBytes(maxSizeBytes) {}
-    ~ResultCache() = default;
+    explicit ResultCache(size_t maxSizeBytes = 100 * 1024 * 1024);
+    ~ResultCache();
 
     ResultCache(const ResultCache&) = delete;
     ResultCache& operator=(const ResultCache&) = delete;
 
-    void put(std::string_view key, const ResultSet& result);
-    [[nodiscard]] std::optional<ResultSet> get(std::string_view key);
+    /// Stores an immutable result. The cache shares ownership, so callers
+    /// keep using their pointer without a copy. The optional table set tags
+    /// the entry for table-dependency-aware invalidation.
+    void put(std::string_view key, std::shared_ptr<const ResultSet> result, std::vector<std::string> tables = {});
+
+    /// Returns a shared handle to the cached result, or nullptr on miss.
+    /// Hits are zero-copy: eviction only drops the cache's reference, so a
+    /// serializer holding the pointer stays valid.
+    [[nodiscard]] std::shared_ptr<const ResultSet> get(std::string_view key);
+
     void invalidate(std::string_view key);
+
+    /// Drops every entry whose key starts with keyPrefix (connection scope)
+    /// and whose table tags intersect the given set. Entries with no tags
+    /// under the same prefix are dropped too, since their dependencies are
+    /// unknown. Called after DML so stale SELECTs never outlive a write.
+    void invalidateTables(const std::vector<std::string>& tables, std::string_view keyPrefix);
+
     void clear();
 
     [[nodiscard]] size_t getCurrentSize() const;
     [[nodiscard]] size_t getMaxSize() const noexcept { return m_maxSizeBytes; }
 
-private:
-    void evictIfNeeded(size_t requiredSize);
+    /// Rough in-memory footprint of a result set, shared with the other
+    /// subsystems that account result bytes to the memory budget
     [[nodiscard]] static size_t estimateSize(const ResultSet& result);
 
+private:
+    // Keys are hashed across independent shards, each with its own mutex,
+    // so concurrent lookups from different dispatch/worker threads don't
+    // serialize on one global lock. Each shard manages an equal slice of
+    // the byte budget; an entry larger than one slice borrows headroom
+    // from the other shards instead of being refused.
+    static constexpr size_t SHARD_COUNT = 8;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, CachedResult> cache;
+        std::list<std::string> lruOrder;  // Front = most recently used
+        size_t currentSizeBytes = 0;
+    };
+
+    [[nodiscard]] Shard& shardFor(std::string_view key) noexcept;
+    [[nodiscard]] size_t shardBudget() const noexcept { return m_maxSizeBytes / SHARD_COUNT; }
+    /// Returns the bytes evicted so the caller can report them
+    static size_t evictIfNeeded(Shard& shard, size_t requiredSize, size_t budget);
+
+    /// Frees headroom in the shards other than owner for an entry larger
+    /// than one shard's slice; admission itself is capped by the whole
+    /// cache budget. Must be called without holding any shard lock.
+    size_t reclaimFromOtherShards(size_t bytesWanted, const Shard* owner);
+
+    /// Memory-pressure callback: evicts LRU entries until bytesWanted is
+    /// freed or the cache is empty
+    size_t shrink(size_t bytesWanted);
+
+    // Compression tier: a background sweep compresses entries untouched for
+    // COLD_AFTER (serialized + XPRESS), typically 5-10x smaller for
+    // repetitive text columns; get() decompresses lazily and re-warms.
+    static constexpr auto COLD_AFTER = std::chrono::seconds(30);
+    static constexpr auto SWEEP_INTERVAL = std::chrono::seconds(10);
+
+    void compressionSweepLoop();
+    static void compressEntry(Shard& shard, CachedResult& entry, int64_t& budgetDelta);
+    [[nodiscard]] static std::shared_ptr<const ResultSet> decompressEntry(Shard& shard, CachedResult& entry, int64_t& budgetDelta);
+
     size_t m_maxSizeBytes;
-    size_t m_currentSizeBytes = 0;
-    mutable std::mutex m_mutex;
-    std::unordered_map<std::string, CachedResult> m_cache;
+    size_t m_budgetSlot;
+    std::array<Shard, SHARD_COUNT> m_shards;
+
+    std::mutex m_sweepMutex;
+    std::condition_variable m_sweepWake;
+    bool m_stopping = false;
+    std::jthread m_sweeper;
 };
 
 }  // namespace velocitydb
@@ -0,0 +1,95 @@
+#include "row_stream.h"
+
+#include "../utils/json_utils.h"
+
+namespace velocitydb {
+namespace rowstream {
+
+namespace {
+
+/// Closes the driver stream when the coroutine frame unwinds - on normal
+/// exhaustion and when a consumer abandons the generator mid-iteration
+struct StreamCloser {
+    SQLServerDriver* driver;
+    ~StreamCloser() { driver->closeStream(); }
+};
+
+}  // namespace
+
+std::generator<ColumnarResultSet> fromQuery(SQLServerDriver& driver, std::string sql, size_t batchRows, bool bulkFetch) {
+    if (bulkFetch ? !driver.openBulkStream(sql) : !driver.openStream(sql)) {
+        co_return;
+    }
+
+    StreamCloser closer{&driver};
+    while (!driver.isStreamExhausted()) {
+        co_yield driver.fetchStreamChunk(batchRows);
+    }
+}
+
+std::generator<ColumnarResultSet> fromOpenStream(SQLServerDriver& driver, size_t batchRows) {
+    StreamCloser closer{&driver};
+    while (!driver.isStreamExhausted()) {
+        co_yield driver.fetchStreamChunk(batchRows);
+    }
+}
+
+std::generator<ColumnarResultSet> filtered(std::generator<ColumnarResultSet> source, BatchPredicate keepRow) {
+    for (auto&& batch : source) {
+        ColumnarResultSet kept;
+        kept.columns = batch.columns;
+        kept.columnData.resize(batch.columns.size());
+        kept.affectedRows = batch.affectedRows;
+        kept.executionTimeMs = batch.executionTimeMs;
+
+        for (size_t row = 0; row < batch.rowCount; ++row) {
+            if (!keepRow(batch, row)) {
+                continue;
+            }
+            for (size_t col = 0; col < batch.columns.size(); ++col) {
+                if (batch.isNull(row, col)) {
+                    kept.columnData[col].appendNull();
+                } else {
+                    kept.columnData[col].append(batch.cell(row, col));
+                }
+            }
+            ++kept.rowCount;
+        }
+
+        if (kept.rowCount > 0) {
+            co_yield std::move(kept);
+        }
+    }
+}
+
+std::generator<std::string> toJsonRows(std::generator<ColumnarResultSet> source) {
+    bool firstRow = true;
+    for (auto&& batch : source) {
+        std::string fragment;
+        fragment.reserve(batch.estimateSizeBytes() + batch.rowCount * (batch.columns.size() * 3 + 2));
+
+        for (size_t row = 0; row < batch.rowCount; ++row) {
+            if (!firstRow) {
+                fragment += ',';
+            }
+            firstRow = false;
+            fragment += '[';
+            for (size_t col = 0; col < batch.columns.size(); ++col) {
+                if (col > 0) {
+                    fragment += ',';
+                }
+                fragment += '"';
+                if (!batch.isNull(row, col)) {
+                    JsonUtils::appendEscaped(fragment, batch.cell(row, col));
+                }
+                fragment += '"';
+            }
+            fragment += ']';
+        }
+
+        co_yield std::move(fragment);
+    }
+}
+
+}  // namespace rowstream
+}  // namespace velocitydb
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "columnar_result.h"
+
+#include <functional>
+#include <generator>
+#include <string>
+
+namespace velocitydb {
+
+/// Coroutine backbone for streaming driver -> transform -> sink flows.
+/// Each stage is a std::generator of row batches: the driver yields
+/// fetched chunks, intermediate stages transform them lazily, and the
+/// sink pulls - so a pipeline holds one batch per stage instead of the
+/// whole result, no matter how many stages compose. Abandoning a
+/// generator mid-iteration unwinds the source coroutine, which closes
+/// the driver stream through its RAII guard.
+namespace rowstream {
+
+/// Keep-row predicate for filtered(); called once per row of each batch
+using BatchPredicate = std::function<bool(const ColumnarResultSet& batch, size_t row)>;
+
+/// Source stage: opens a driver stream for sql and yields its batches.
+/// Yields nothing when the stream cannot be opened (driver.getLastError
+/// has the reason) - callers needing to distinguish that from an empty
+/// result open the stream themselves and use fromOpenStream.
+/// @param driver Connected driver; must have no other open stream
+/// @param sql Query whose result to stream
+/// @param batchRows Rows fetched per cursor block
+/// @param bulkFetch Use openBulkStream (array-bound block fetches)
+[[nodiscard]] std::generator<ColumnarResultSet> fromQuery(SQLServerDriver& driver, std::string sql, size_t batchRows = 10000, bool bulkFetch = false);
+
+/// Source stage over a stream the caller already opened. The stream is
+/// closed when the generator finishes or is abandoned; it is not closed
+/// if the generator is never iterated.
+[[nodiscard]] std::generator<ColumnarResultSet> fromOpenStream(SQLServerDriver& driver, size_t batchRows);
+
+/// Transform stage: yields each batch with only the rows keepRow kept,
+/// compacted. Batches left empty by the filter are skipped entirely.
+/// Kept cells re-materialize as String columns - the display and export
+/// sinks downstream only consume text.
+[[nodiscard]] std::generator<ColumnarResultSet> filtered(std::generator<ColumnarResultSet> source, BatchPredicate keepRow);
+
+/// Sink-side stage: serializes each batch into a JSON fragment of row
+/// arrays in the serializeResultSet cell format (every cell a string,
+/// NULL as ""). Fragments concatenate to the exact contents of a
+/// "rows":[...] array, commas included, so a consumer brackets the
+/// stream and emits it chunk by chunk.
+[[nodiscard]] std::generator<std::string> toJsonRows(std::generator<ColumnarResultSet> source);
+
+}  // namespace rowstream
+
+}  // namespace velocitydb
@@ -1,13 +1,71 @@
 #include "schema_inspector.h"
 
+#include "simdjson.h"
+#include "utils/json_utils.h"
 #include "utils/logger.h"
+#include "utils/memory_budget.h"
 
 #include <format>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <unordered_map>
 
 using namespace std::literals;
 
 namespace velocitydb {
 
+namespace {
+
+// Rough footprint of a hydrated schema model for budget accounting
+size_t estimateSchemaBytes(const std::vector<TableSchema>& schemas) {
+    size_t size = 0;
+    for (const auto& schema : schemas) {
+        size += sizeof(TableSchema) + schema.table.schema.size() + schema.table.name.size() + schema.table.type.size() + schema.table.comment.size();
+        for (const auto& col : schema.columns) {
+            size += sizeof(ColumnInfo) + col.name.size() + col.type.size() + col.comment.size();
+        }
+        for (const auto& index : schema.indexes) {
+            size += sizeof(IndexInfo) + index.name.size() + index.type.size();
+            for (const auto& column : index.columns) {
+                size += column.size();
+            }
+        }
+        for (const auto& fk : schema.foreignKeys) {
+            size += sizeof(ForeignKeyInfo) + fk.name.size() + fk.column.size() + fk.referencedTable.size() + fk.referencedColumn.size();
+        }
+    }
+    return size;
+}
+
+}  // namespace
+
+SchemaInspector::SchemaInspector() : m_budgetSlot(MemoryBudget::MAX_SUBSYSTEMS) {
+    // Registered after the cache members exist: pressure from another
+    // subsystem may call shrink() the moment the slot goes live
+    m_budgetSlot = MemoryBudget::instance().registerSubsystem("schemaCache", MemoryBudget::Priority::Cache, [this](size_t bytesWanted) { return shrink(bytesWanted); });
+}
+
+SchemaInspector::~SchemaInspector() {
+    MemoryBudget::instance().unregisterSubsystem(m_budgetSlot);
+}
+
+size_t SchemaInspector::shrink(size_t bytesWanted) {
+    size_t freed = 0;
+    {
+        std::lock_guard lock(m_cacheMutex);
+        for (auto it = m_schemaCache.begin(); it != m_schemaCache.end() && freed < bytesWanted;) {
+            freed += estimateSchemaBytes(it->second.schemas);
+            it = m_schemaCache.erase(it);
+        }
+    }
+
+    if (freed > 0) {
+        MemoryBudget::instance().record(m_budgetSlot, -static_cast<int64_t>(freed));
+    }
+    return freed;
+}
+
 std::vector<std::string> SchemaInspector::getDatabases() {
     std::vector<std::string> databases;
 
@@ -19,7 +77,7 @@ std::vector<std::string> SchemaInspector::getDatabases() {
     databases.reserve(result.rows.size());
     for (const auto& row : result.rows) {
         if (!row.values.empty()) {
-            databases.push_back(row.values[0]);
+            databases.emplace_back(row.values[0]);
         }
     }
 
@@ -70,8 +128,8 @@ std::vector<TableInfo> SchemaInspector::getTables(std::string_view database) {
     tables.reserve(result.rows.size());
     for (const auto& row : result.rows) {
         if (row.values.size() >= 3) {
-            std::string comment = row.values.size() >= 4 ? row.values[3] : "";
-            tables.push_back({.schema = row.values[0], .name = row.values[1], .type = row.values[2], .comment = comment});
+            std::string comment = row.values.size() >= 4 ? std::string(row.values[3]) : "";
+            tables.push_back({.schema = std::string(row.values[0]), .name = std::string(row.values[1]), .type = std::string(row.values[2]), .comment = comment});
             velocitydb::log<LogLevel::DEBUG>(std::format("  Found: {}.{} ({}) - Comment: {}", row.values[0], row.values[1], row.values[2], comment));
         }
     }
@@ -150,9 +208,13 @@ std::vector<ColumnInfo> SchemaInspector::getColumns(std::string_view table) {
     columns.reserve(result.rows.size());
     for (const auto& row : result.rows) {
         if (row.values.size() >= 5) {
-            std::string comment = row.values.size() >= 6 ? row.values[5] : "";
-            columns.push_back(
-                {.name = row.values[0], .type = row.values[1], .size = std::stoi(row.values[2]), .nullable = (row.values[3] == "1"), .isPrimaryKey = (row.values[4] == "1"), .comment = comment});
+            std::string comment = row.values.size() >= 6 ? std::string(row.values[5]) : "";
+            columns.push_back({.name = std::string(row.values[0]),
+                               .type = std::string(row.values[1]),
+                               .size = std::stoi(std::string(row.values[2])),
+                               .nullable = (row.values[3] == "1"),
+                               .isPrimaryKey = (row.values[4] == "1"),
+                               .comment = comment});
         }
     }
 
@@ -188,13 +250,13 @@ std::vector<IndexInfo> SchemaInspector::getIndexes(std::string_view table) {
 
     for (const auto& row : result.rows) {
         if (row.values.size() >= 5) {
-            if (row.values[0] != currentIndex) {
-                indexes.push_back({.name = row.values[0], .type = row.values[1], .isUnique = (row.values[2] == "1"), .isPrimaryKey = (row.values[3] == "1")});
+            if (std::string_view(row.values[0]) != currentIndex) {
+                indexes.push_back({.name = std::string(row.values[0]), .type = std::string(row.values[1]), .isUnique = (row.values[2] == "1"), .isPrimaryKey = (row.values[3] == "1")});
                 currentIndex = row.values[0];
                 currentInfo = &indexes.back();
             }
             if (currentInfo) {
-                currentInfo->columns.push_back(row.values[4]);
+                currentInfo->columns.emplace_back(row.values[4]);
             }
         }
     }
@@ -229,13 +291,420 @@ std::vector<ForeignKeyInfo> SchemaInspector::getForeignKeys(std::string_view tab
     fks.reserve(result.rows.size());
     for (const auto& row : result.rows) {
         if (row.values.size() >= 4) {
-            fks.push_back({.name = row.values[0], .column = row.values[1], .referencedTable = row.values[2], .referencedColumn = row.values[3]});
+            fks.push_back({.name = std::string(row.values[0]), .column = std::string(row.values[1]), .referencedTable = std::string(row.values[2]), .referencedColumn = std::string(row.values[3])});
         }
     }
 
     return fks;
 }
 
+std::string SchemaInspector::fetchSchemaVersionStamp(SQLServerDriver& driver) {
+    // Covers tables, views, routines and constraints: any DDL change
+    // moves a modify_date or the object count
+    constexpr auto sql = R"(
+        SELECT COUNT(*) AS object_count,
+               ISNULL(CONVERT(varchar(23), MAX(modify_date), 121), '') AS last_modified
+        FROM sys.objects
+        WHERE type IN ('U', 'V', 'P', 'FN', 'IF', 'TF', 'PK', 'F', 'UQ', 'D', 'C')
+    )";
+
+    auto result = driver.execute(sql);
+    if (result.rows.empty() || result.rows[0].values.size() < 2) {
+        return "";
+    }
+    return std::format("{}@{}", result.rows[0].values[0], result.rows[0].values[1]);
+}
+
+std::string SchemaInspector::makeCacheKey(std::string_view connectionString, std::string_view database) {
+    return std::format("{:016x}:{}", std::hash<std::string_view>{}(connectionString), database);
+}
+
+std::vector<TableSchema> SchemaInspector::hydrateDatabaseSchema(std::string_view database) {
+    std::vector<TableSchema> schemas;
+
+    if (!m_driver || !m_driver->isConnected()) [[unlikely]] {
+        return schemas;
+    }
+
+    // Cheap validation round trip before the four hydration queries; an
+    // unchanged stamp serves the cached model
+    auto cacheKey = makeCacheKey(m_driver->getConnectionString(), database);
+    auto versionStamp = fetchSchemaVersionStamp(*m_driver);
+    if (!versionStamp.empty()) {
+        std::lock_guard lock(m_cacheMutex);
+        if (auto cached = m_schemaCache.find(cacheKey); cached != m_schemaCache.end() && cached->second.versionStamp == versionStamp) {
+            cached->second.validated = true;  // The stamp check just confirmed a snapshot entry
+            velocitydb::log<LogLevel::DEBUG>(std::format("SchemaInspector::hydrateDatabaseSchema: cache hit for '{}'", database));
+            return cached->second.schemas;
+        }
+    }
+
+    auto tables = getTables(database);
+    schemas.reserve(tables.size());
+    std::unordered_map<std::string, size_t> tableSlots;
+    tableSlots.reserve(tables.size());
+    for (auto& table : tables) {
+        tableSlots.emplace(table.schema + "." + table.name, schemas.size());
+        schemas.push_back({.table = std::move(table)});
+    }
+
+    // Columns of every table and view, ordered so each table's rows are
+    // contiguous and in ordinal order
+    constexpr auto columnsSql = R"(
+        SELECT
+            s.name AS schema_name,
+            o.name AS table_name,
+            c.name AS column_name,
+            t.name AS data_type,
+            c.max_length,
+            c.is_nullable,
+            CASE WHEN pk.column_id IS NOT NULL THEN 1 ELSE 0 END AS is_primary_key,
+            CAST(ep.value AS NVARCHAR(MAX)) AS comment
+        FROM sys.columns c
+        INNER JOIN sys.types t ON c.user_type_id = t.user_type_id
+        INNER JOIN sys.objects o ON c.object_id = o.object_id
+        INNER JOIN sys.schemas s ON o.schema_id = s.schema_id
+        LEFT JOIN (
+            SELECT ic.object_id, ic.column_id
+            FROM sys.index_columns ic
+            INNER JOIN sys.indexes i ON ic.object_id = i.object_id AND ic.index_id = i.index_id
+            WHERE i.is_primary_key = 1
+        ) pk ON c.object_id = pk.object_id AND c.column_id = pk.column_id
+        LEFT JOIN sys.extended_properties ep ON ep.major_id = c.object_id
+            AND ep.minor_id = c.column_id
+            AND ep.class = 1
+            AND ep.name = 'MS_Description'
+        WHERE o.type IN ('U', 'V')
+        ORDER BY s.name, o.name, c.column_id
+    )";
+
+    auto columnResult = m_driver->execute(columnsSql);
+    for (const auto& row : columnResult.rows) {
+        if (row.values.size() < 7) {
+            continue;
+        }
+        auto slot = tableSlots.find(std::format("{}.{}", row.values[0], row.values[1]));
+        if (slot == tableSlots.end()) {
+            continue;
+        }
+        std::string comment = row.values.size() >= 8 ? std::string(row.values[7]) : "";
+        schemas[slot->second].columns.push_back({.name = std::string(row.values[2]),
+                                                .type = std::string(row.values[3]),
+                                                .size = std::stoi(std::string(row.values[4])),
+                                                .nullable = (row.values[5] == "1"),
+                                                .isPrimaryKey = (row.values[6] == "1"),
+                                                .comment = comment});
+    }
+
+    // Indexes of every table, key columns in ordinal order
+    constexpr auto indexesSql = R"(
+        SELECT
+            s.name AS schema_name,
+            o.name AS table_name,
+            i.name AS index_name,
+            i.type_desc AS index_type,
+            i.is_unique,
+            i.is_primary_key,
+            c.name AS column_name
+        FROM sys.indexes i
+        INNER JOIN sys.index_columns ic ON i.object_id = ic.object_id AND i.index_id = ic.index_id
+        INNER JOIN sys.columns c ON ic.object_id = c.object_id AND ic.column_id = c.column_id
+        INNER JOIN sys.objects o ON i.object_id = o.object_id
+        INNER JOIN sys.schemas s ON o.schema_id = s.schema_id
+        WHERE i.name IS NOT NULL
+        ORDER BY s.name, o.name, i.name, ic.key_ordinal
+    )";
+
+    auto indexResult = m_driver->execute(indexesSql);
+    std::string currentIndexKey;
+    IndexInfo* currentIndex = nullptr;
+    for (const auto& row : indexResult.rows) {
+        if (row.values.size() < 7) {
+            continue;
+        }
+        auto slot = tableSlots.find(std::format("{}.{}", row.values[0], row.values[1]));
+        if (slot == tableSlots.end()) {
+            continue;
+        }
+        auto indexKey = std::format("{}.{}.{}", row.values[0], row.values[1], row.values[2]);
+        if (indexKey != currentIndexKey) {
+            schemas[slot->second].indexes.push_back(
+                {.name = std::string(row.values[2]), .type = std::string(row.values[3]), .isUnique = (row.values[4] == "1"), .isPrimaryKey = (row.values[5] == "1")});
+            currentIndexKey = indexKey;
+            currentIndex = &schemas[slot->second].indexes.back();
+        }
+        if (currentIndex) {
+            currentIndex->columns.emplace_back(row.values[6]);
+        }
+    }
+
+    // Foreign keys of every table
+    constexpr auto foreignKeysSql = R"(
+        SELECT
+            s.name AS schema_name,
+            o.name AS table_name,
+            fk.name AS fk_name,
+            c.name AS column_name,
+            rt.name AS referenced_table,
+            rc.name AS referenced_column
+        FROM sys.foreign_keys fk
+        INNER JOIN sys.foreign_key_columns fkc ON fk.object_id = fkc.constraint_object_id
+        INNER JOIN sys.columns c ON fkc.parent_object_id = c.object_id AND fkc.parent_column_id = c.column_id
+        INNER JOIN sys.tables rt ON fkc.referenced_object_id = rt.object_id
+        INNER JOIN sys.columns rc ON fkc.referenced_object_id = rc.object_id AND fkc.referenced_column_id = rc.column_id
+        INNER JOIN sys.objects o ON fk.parent_object_id = o.object_id
+        INNER JOIN sys.schemas s ON o.schema_id = s.schema_id
+        ORDER BY s.name, o.name, fk.name
+    )";
+
+    auto fkResult = m_driver->execute(foreignKeysSql);
+    for (const auto& row : fkResult.rows) {
+        if (row.values.size() < 6) {
+            continue;
+        }
+        auto slot = tableSlots.find(std::format("{}.{}", row.values[0], row.values[1]));
+        if (slot == tableSlots.end()) {
+            continue;
+        }
+        schemas[slot->second].foreignKeys.push_back(
+            {.name = std::string(row.values[2]), .column = std::string(row.values[3]), .referencedTable = std::string(row.values[4]), .referencedColumn = std::string(row.values[5])});
+    }
+
+    if (!versionStamp.empty()) {
+        MemoryBudget::ScopedDelta budgetDelta(m_budgetSlot);
+        std::lock_guard lock(m_cacheMutex);
+        if (auto existing = m_schemaCache.find(cacheKey); existing != m_schemaCache.end()) {
+            budgetDelta.delta -= static_cast<int64_t>(estimateSchemaBytes(existing->second.schemas));
+        }
+        m_schemaCache[cacheKey] = {.versionStamp = versionStamp, .schemas = schemas};
+        budgetDelta.delta += static_cast<int64_t>(estimateSchemaBytes(schemas));
+    }
+
+    velocitydb::log<LogLevel::INFO>(std::format("SchemaInspector::hydrateDatabaseSchema: hydrated {} tables in 4 queries", schemas.size()));
+    return schemas;
+}
+
+void SchemaInspector::loadSnapshot(const std::filesystem::path& path) {
+    if (!std::filesystem::exists(path)) {
+        return;
+    }
+
+    try {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+
+        simdjson::dom::parser parser;
+        simdjson::dom::element doc = parser.parse(buffer.str());
+        auto entries = doc["entries"].get_array();
+        if (entries.error()) {
+            return;
+        }
+
+        auto str = [](simdjson::dom::element elem, const char* field) {
+            auto value = elem[field].get_string();
+            return value.error() ? std::string{} : std::string(value.value());
+        };
+        auto boolean = [](simdjson::dom::element elem, const char* field) {
+            auto value = elem[field].get_bool();
+            return !value.error() && value.value();
+        };
+
+        size_t loaded = 0;
+        MemoryBudget::ScopedDelta budgetDelta(m_budgetSlot);
+        std::lock_guard lock(m_cacheMutex);
+        for (auto entry : entries.value()) {
+            auto key = entry["key"].get_string();
+            auto stamp = entry["versionStamp"].get_string();
+            auto tables = entry["tables"].get_array();
+            if (key.error() || stamp.error() || tables.error()) {
+                continue;  // Drop the corrupt entry, keep the rest of the snapshot
+            }
+
+            CachedSchema cached{.versionStamp = std::string(stamp.value()), .validated = false};
+            cached.schemas.reserve(tables.value().size());
+            for (auto tableElem : tables.value()) {
+                TableSchema schema;
+                schema.table = {.schema = str(tableElem, "schema"), .name = str(tableElem, "name"), .type = str(tableElem, "type"), .comment = str(tableElem, "comment")};
+
+                if (auto columns = tableElem["columns"].get_array(); !columns.error()) {
+                    for (auto col : columns.value()) {
+                        int size = 0;
+                        if (auto sizeValue = col["size"].get_int64(); !sizeValue.error()) {
+                            size = static_cast<int>(sizeValue.value());
+                        }
+                        schema.columns.push_back(
+                            {.name = str(col, "name"), .type = str(col, "type"), .size = size, .nullable = boolean(col, "nullable"), .isPrimaryKey = boolean(col, "isPrimaryKey"), .comment = str(col, "comment")});
+                    }
+                }
+
+                if (auto indexes = tableElem["indexes"].get_array(); !indexes.error()) {
+                    for (auto idx : indexes.value()) {
+                        IndexInfo index{.name = str(idx, "name"), .type = str(idx, "type"), .isUnique = boolean(idx, "isUnique"), .isPrimaryKey = boolean(idx, "isPrimaryKey")};
+                        if (auto indexColumns = idx["columns"].get_array(); !indexColumns.error()) {
+                            for (auto column : indexColumns.value()) {
+                                if (auto columnName = column.get_string(); !columnName.error()) {
+                                    index.columns.emplace_back(columnName.value());
+                                }
+                            }
+                        }
+                        schema.indexes.push_back(std::move(index));
+                    }
+                }
+
+                if (auto foreignKeys = tableElem["foreignKeys"].get_array(); !foreignKeys.error()) {
+                    for (auto fk : foreignKeys.value()) {
+                        schema.foreignKeys.push_back({.name = str(fk, "name"), .column = str(fk, "column"), .referencedTable = str(fk, "referencedTable"), .referencedColumn = str(fk, "referencedColumn")});
+                    }
+                }
+
+                cached.schemas.push_back(std::move(schema));
+            }
+
+            budgetDelta.delta += static_cast<int64_t>(estimateSchemaBytes(cached.schemas));
+            m_schemaCache[std::string(key.value())] = std::move(cached);
+            ++loaded;
+        }
+
+        velocitydb::log<LogLevel::INFO>(std::format("SchemaInspector::loadSnapshot: restored {} database schemas from '{}'", loaded, path.string()));
+    } catch (const std::exception& e) {
+        // A bad snapshot only costs the warm start, never the session
+        velocitydb::log<LogLevel::WARNING>(std::format("SchemaInspector::loadSnapshot: {}", e.what()));
+    }
+}
+
+void SchemaInspector::saveSnapshot(const std::filesystem::path& path) const {
+    std::string json;
+    {
+        std::lock_guard lock(m_cacheMutex);
+        if (m_schemaCache.empty()) {
+            return;  // Nothing hydrated this session; keep the previous snapshot
+        }
+
+        json = R"({"entries":[)";
+        bool firstEntry = true;
+        for (const auto& [key, cached] : m_schemaCache) {
+            if (!firstEntry) {
+                json += ',';
+            }
+            firstEntry = false;
+            json += std::format(R"({{"key":"{}","versionStamp":"{}","tables":[)", JsonUtils::escapeString(key), JsonUtils::escapeString(cached.versionStamp));
+            for (size_t i = 0; i < cached.schemas.size(); ++i) {
+                if (i > 0) {
+                    json += ',';
+                }
+                const auto& schema = cached.schemas[i];
+                json += std::format(R"({{"schema":"{}","name":"{}","type":"{}","comment":"{}","columns":[)", JsonUtils::escapeString(schema.table.schema), JsonUtils::escapeString(schema.table.name),
+                                    JsonUtils::escapeString(schema.table.type), JsonUtils::escapeString(schema.table.comment));
+                for (size_t c = 0; c < schema.columns.size(); ++c) {
+                    if (c > 0) {
+                        json += ',';
+                    }
+                    const auto& col = schema.columns[c];
+                    json += std::format(R"({{"name":"{}","type":"{}","size":{},"nullable":{},"isPrimaryKey":{},"comment":"{}"}})", JsonUtils::escapeString(col.name), JsonUtils::escapeString(col.type),
+                                        col.size, col.nullable ? "true" : "false", col.isPrimaryKey ? "true" : "false", JsonUtils::escapeString(col.comment));
+                }
+                json += R"(],"indexes":[)";
+                for (size_t x = 0; x < schema.indexes.size(); ++x) {
+                    if (x > 0) {
+                        json += ',';
+                    }
+                    const auto& index = schema.indexes[x];
+                    json += std::format(R"({{"name":"{}","type":"{}","isUnique":{},"isPrimaryKey":{},"columns":[)", JsonUtils::escapeString(index.name), JsonUtils::escapeString(index.type),
+                                        index.isUnique ? "true" : "false", index.isPrimaryKey ? "true" : "false");
+                    for (size_t k = 0; k < index.columns.size(); ++k) {
+                        if (k > 0) {
+                            json += ',';
+                        }
+                        json += std::format(R"("{}")", JsonUtils::escapeString(index.columns[k]));
+                    }
+                    json += "]}";
+                }
+                json += R"(],"foreignKeys":[)";
+                for (size_t f = 0; f < schema.foreignKeys.size(); ++f) {
+                    if (f > 0) {
+                        json += ',';
+                    }
+                    const auto& fk = schema.foreignKeys[f];
+                    json += std::format(R"({{"name":"{}","column":"{}","referencedTable":"{}","referencedColumn":"{}"}})", JsonUtils::escapeString(fk.name), JsonUtils::escapeString(fk.column),
+                                        JsonUtils::escapeString(fk.referencedTable), JsonUtils::escapeString(fk.referencedColumn));
+                }
+                json += "]}";
+            }
+            json += "]}";
+        }
+        json += "]}";
+    }
+
+    try {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            velocitydb::log<LogLevel::WARNING>(std::format("SchemaInspector::saveSnapshot: cannot open '{}'", path.string()));
+            return;
+        }
+        file << json;
+        velocitydb::log<LogLevel::INFO>(std::format("SchemaInspector::saveSnapshot: persisted snapshot to '{}'", path.string()));
+    } catch (const std::exception& e) {
+        velocitydb::log<LogLevel::WARNING>(std::format("SchemaInspector::saveSnapshot: {}", e.what()));
+    }
+}
+
+std::vector<TableSchema> SchemaInspector::peekSnapshot(std::string_view database) {
+    if (!m_driver) {
+        return {};
+    }
+
+    auto cacheKey = makeCacheKey(m_driver->getConnectionString(), database);
+    std::lock_guard lock(m_cacheMutex);
+    auto cached = m_schemaCache.find(cacheKey);
+    if (cached == m_schemaCache.end() || cached->second.validated || cached->second.validationScheduled) {
+        return {};
+    }
+    cached->second.validationScheduled = true;
+    return cached->second.schemas;
+}
+
+bool SchemaInspector::validateSnapshot(std::string_view connectionString, std::string_view database) {
+    auto cacheKey = makeCacheKey(connectionString, database);
+    {
+        std::lock_guard lock(m_cacheMutex);
+        auto cached = m_schemaCache.find(cacheKey);
+        if (cached == m_schemaCache.end() || cached->second.validated) {
+            return true;
+        }
+    }
+
+    // A sibling connection keeps validation off the user's own connection
+    auto sibling = std::make_shared<SQLServerDriver>();
+    if (!sibling->connect(connectionString)) {
+        // Cannot validate right now; keep serving the snapshot rather
+        // than blanking a tree the user is already looking at
+        return true;
+    }
+    auto stamp = fetchSchemaVersionStamp(*sibling);
+
+    MemoryBudget::ScopedDelta budgetDelta(m_budgetSlot);
+    std::lock_guard lock(m_cacheMutex);
+    auto cached = m_schemaCache.find(cacheKey);
+    if (cached == m_schemaCache.end()) {
+        return true;
+    }
+    if (!stamp.empty() && stamp == cached->second.versionStamp) {
+        cached->second.validated = true;
+        velocitydb::log<LogLevel::DEBUG>(std::format("SchemaInspector::validateSnapshot: snapshot for '{}' confirmed", database));
+        return true;
+    }
+
+    budgetDelta.delta -= static_cast<int64_t>(estimateSchemaBytes(cached->second.schemas));
+    m_schemaCache.erase(cached);
+    velocitydb::log<LogLevel::INFO>(std::format("SchemaInspector::validateSnapshot: snapshot for '{}' is stale, dropped", database));
+    return false;
+}
+
 std::vector<StoredProcedureInfo> SchemaInspector::getStoredProcedures(std::string_view) {
     std::vector<StoredProcedureInfo> procs;
 
@@ -258,7 +727,7 @@ std::vector<StoredProcedureInfo> SchemaInspector::getStoredProcedures(std::strin
     procs.reserve(result.rows.size());
     for (const auto& row : result.rows) {
         if (row.values.size() >= 3) {
-            procs.push_back({.schema = row.values[0], .name = row.values[1], .definition = row.values[2]});
+            procs.push_back({.schema = std::string(row.values[0]), .name = std::string(row.values[1]), .definition = std::string(row.values[2])});
         }
     }
 
@@ -290,7 +759,7 @@ std::vector<FunctionInfo> SchemaInspector::getFunctions(std::string_view) {
     funcs.reserve(result.rows.size());
     for (const auto& row : result.rows) {
         if (row.values.size() >= 4) {
-            funcs.push_back({.schema = row.values[0], .name = row.values[1], .returnType = row.values[2], .definition = row.values[3]});
+            funcs.push_back({.schema = std::string(row.values[0]), .name = std::string(row.values[1]), .returnType = std::string(row.values[2]), .definition = std::string(row.values[3])});
         }
     }
 
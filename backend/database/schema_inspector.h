@@ -3,9 +3,12 @@
 #include "driver_interface.h"
 #include "sqlserver_driver.h"
 
+#include <filesystem>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace velocitydb {
@@ -38,6 +41,14 @@ struct StoredProcedureInfo {
     std::string definition;
 };
 
+/// Fully hydrated schema of one table, produced by bulk hydration
+struct TableSchema {
+    TableInfo table;
+    std::vector<ColumnInfo> columns;
+    std::vector<IndexInfo> indexes;
+    std::vector<ForeignKeyInfo> foreignKeys;
+};
+
 struct FunctionInfo {
     std::string schema;
     std::string name;
@@ -47,8 +58,8 @@ struct FunctionInfo {
 
 class SchemaInspector : public ISchemaProvider {
 public:
-    SchemaInspector() = default;
-    ~SchemaInspector() override = default;
+    SchemaInspector();
+    ~SchemaInspector() override;
 
     void setDriver(std::shared_ptr<SQLServerDriver> driver) { m_driver = std::move(driver); }
 
@@ -61,6 +72,31 @@ public:
     [[nodiscard]] std::vector<StoredProcedureInfo> getStoredProcedures(std::string_view database) override;
     [[nodiscard]] std::vector<FunctionInfo> getFunctions(std::string_view database) override;
 
+    /// Columns, indexes and foreign keys for every table of the current
+    /// database in three set-based queries, grouped per table in one
+    /// pass - expanding a large database stays at four round trips
+    /// instead of three per table
+    [[nodiscard]] std::vector<TableSchema> hydrateDatabaseSchema(std::string_view database);
+
+    /// Restore hydrated schemas persisted by a previous run; entries come
+    /// back unvalidated and are served instantly once via peekSnapshot
+    void loadSnapshot(const std::filesystem::path& path);
+
+    /// Persist every cached schema to disk for the next startup
+    void saveSnapshot(const std::filesystem::path& path) const;
+
+    /// Snapshot entry for the current driver's database, served without
+    /// any round trip - empty if there is none or it was already served.
+    /// The caller is expected to follow up with validateSnapshot on a
+    /// worker thread.
+    [[nodiscard]] std::vector<TableSchema> peekSnapshot(std::string_view database);
+
+    /// Revalidates a snapshot entry against sys.objects on its own
+    /// connection (safe to call from a worker thread). Returns false if
+    /// the schema changed since the snapshot - the entry is dropped and
+    /// the caller should tell the frontend to refetch.
+    [[nodiscard]] bool validateSnapshot(std::string_view connectionString, std::string_view database);
+
     [[nodiscard]] std::string generateDDL(std::string_view table) override;
     [[nodiscard]] std::string generateSelectStatement(std::string_view table) override;
     [[nodiscard]] std::string generateInsertStatement(std::string_view table) override;
@@ -68,7 +104,36 @@ public:
     [[nodiscard]] std::string generateDeleteStatement(std::string_view table) override;
 
 private:
+    // Hydrated schema kept per driver+database and validated against a
+    // one-query version stamp (object count plus max modify_date) before
+    // reuse; schemas change weekly, the tree expands hundreds of times a
+    // day, so almost every expand is a stamp check and a cache hit
+    struct CachedSchema {
+        std::string versionStamp;
+        std::vector<TableSchema> schemas;
+        // Entries restored from a disk snapshot start unvalidated; they
+        // are served instantly once and confirmed (or dropped) by a
+        // background stamp check
+        bool validated = true;
+        bool validationScheduled = false;
+    };
+
+    /// Stable across runs and reconnects: hash of the connection string
+    /// plus the database name
+    [[nodiscard]] static std::string makeCacheKey(std::string_view connectionString, std::string_view database);
+
+    [[nodiscard]] static std::string fetchSchemaVersionStamp(SQLServerDriver& driver);
+
+    /// Memory-pressure callback: drops cached schemas until bytesWanted
+    /// is freed; a dropped database re-hydrates on its next expand
+    size_t shrink(size_t bytesWanted);
+
     std::shared_ptr<SQLServerDriver> m_driver;
+    size_t m_budgetSlot;
+    // Guards m_schemaCache: the background snapshot validation runs off
+    // the IPC thread
+    mutable std::mutex m_cacheMutex;
+    std::unordered_map<std::string, CachedSchema> m_schemaCache;
 };
 
 }  // namespace velocitydb
@@ -7,12 +7,21 @@
 #include <sqlext.h>
 
 #include <expected>
+#include <functional>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace velocitydb {
 
+// Bound column arrays for openBulkStream, defined in the translation unit
+struct BulkStreamState;
+
 struct ColumnInfo {
     std::string name;
     std::string type;
@@ -23,16 +32,44 @@ struct ColumnInfo {
 };
 
 struct ResultRow {
-    std::vector<std::string> values;
+    // pmr so a bulk builder can point the row at its result's arena; a
+    // default-constructed row still allocates from the global heap
+    std::pmr::vector<std::pmr::string> values;
 };
 
 struct ResultSet {
     std::vector<ColumnInfo> columns;
+
+    // Bump arena backing the cell strings of arena-built results. All
+    // cells free wholesale when the last ResultSet reference drops -
+    // teardown of a million-cell result is a handful of page frees, not a
+    // million operator delete calls. Copying a row detaches it to the
+    // heap (pmr copy construction selects the default resource), so
+    // slicing results out of a cached set never dangles into the arena.
+    // Declared before rows: members destroy in reverse declaration order,
+    // and the rows' pmr handles must not outlive the resource they point at.
+    std::shared_ptr<std::pmr::monotonic_buffer_resource> arena;
+
     std::vector<ResultRow> rows;
     int64_t affectedRows = 0;
     double executionTimeMs = 0.0;
+
+    /// Switches subsequent makeRow() calls to bump allocation
+    void attachArena() { arena = std::make_shared<std::pmr::monotonic_buffer_resource>(); }
+
+    [[nodiscard]] std::pmr::memory_resource* arenaResource() const noexcept { return arena ? arena.get() : std::pmr::get_default_resource(); }
+
+    /// A row whose cell storage comes from this result's arena (or the
+    /// heap when no arena is attached)
+    [[nodiscard]] ResultRow makeRow() const { return ResultRow{.values = std::pmr::vector<std::pmr::string>(arenaResource())}; }
 };
 
+// Structure-of-arrays representation, defined in columnar_result.h
+struct ColumnarResultSet;
+
+/// One row of parameter values for executeBulk; nullopt binds SQL NULL
+using BulkRow = std::vector<std::optional<std::string>>;
+
 class SQLServerDriver : public IDatabaseDriver {
 public:
     SQLServerDriver();
@@ -45,24 +82,122 @@ public:
 
     // IDatabaseDriver interface
     [[nodiscard]] bool connect(std::string_view connectionString) override;
+
+    /// connect() variant for dedicated bulk-extract connections: requests
+    /// the maximum TDS packet size before the handshake so block fetches
+    /// move data in few large packets instead of many default-sized ones.
+    [[nodiscard]] bool connectForBulkExtract(std::string_view connectionString);
+
     void disconnect() override;
     [[nodiscard]] bool isConnected() const noexcept override { return m_connected; }
 
     [[nodiscard]] ResultSet execute(std::string_view sql) override;
+
+    /// Executes a query and fills a columnar (structure-of-arrays) result
+    /// directly from the fetch loop — no per-cell std::string allocations.
+    /// execute() delegates here and transposes for row-oriented callers.
+    [[nodiscard]] ColumnarResultSet executeColumnar(std::string_view sql);
+
+    /// Executes a multi-statement script as a single round trip: the whole
+    /// batch goes through one SQLExecDirect and the result sets are walked
+    /// with SQLMoreResults, in statement order. Statements producing no
+    /// result set contribute an empty result carrying their affected-row
+    /// count. A statement failing mid-batch surfaces as an exception once
+    /// the results of the statements before it have been consumed.
+    [[nodiscard]] std::vector<ColumnarResultSet> executeBatch(std::string_view sql);
+
+    /// Executes parameterized DML (? placeholders) once per row using an
+    /// ODBC parameter array (SQL_ATTR_PARAMSET_SIZE): one prepare and one
+    /// execute for the whole batch instead of a round trip per row.
+    /// Values bind as wide chars and the server converts to the target
+    /// column types. Returns the total number of affected rows. The caller
+    /// owns transactional bracketing; a failure aborts the whole batch.
+    [[nodiscard]] int64_t executeBulk(std::string_view sql, const std::vector<BulkRow>& rows);
+
     void cancel() override;
 
+    /// Registers a one-shot callback fired from inside the fetch loop the
+    /// first time FIRST_ROWS_PUBLISH_TARGET rows are available (columns are
+    /// fully described by then). Lets callers surface the leading rows of a
+    /// long result while the rest is still streaming; consumed by the fetch
+    /// that fires it, so set it before each execute that wants early rows.
+    void setFirstRowsCallback(std::function<void(const ColumnarResultSet&)> callback) { m_firstRowsCallback = std::move(callback); }
+
+    // Server-side cursor streaming: execute once, keep the statement open and
+    // fetch incrementally. Lets the paginated grid scroll through a large
+    // result without re-running the SELECT with a new OFFSET per page.
+    // One stream per driver; the stream uses its own statement handle so the
+    // prepared-statement cache stays untouched.
+    [[nodiscard]] bool openStream(std::string_view sql);
+
+    /// openStream() variant for whole-table extracts: binds every column
+    /// as an array and fetches with a large SQL_ATTR_ROW_ARRAY_SIZE, so a
+    /// chunk costs one ODBC round trip instead of a SQLGetData call per
+    /// cell. Falls back to the per-row stream when a column cannot be
+    /// bound (LOBs). In bulk mode fetchStreamChunk returns one fetched
+    /// block per call regardless of maxRows.
+    [[nodiscard]] bool openBulkStream(std::string_view sql);
+
+    [[nodiscard]] ColumnarResultSet fetchStreamChunk(size_t maxRows);
+    [[nodiscard]] bool hasOpenStream() const noexcept { return m_streamStmt != SQL_NULL_HSTMT; }
+    [[nodiscard]] bool isStreamExhausted() const noexcept { return m_streamExhausted; }
+    void closeStream();
+
+    /// The string used for the last successful connect; lets parallel
+    /// jobs (DDL export) open sibling connections to the same server
+    [[nodiscard]] std::string_view getConnectionString() const noexcept { return m_connectionString; }
+
     [[nodiscard]] std::string_view getLastError() const noexcept override { return m_lastError; }
     [[nodiscard]] DriverType getType() const noexcept override { return DriverType::SQLServer; }
 
 private:
+    [[nodiscard]] bool connectInternal(std::string_view connectionString, bool bulkExtract);
+    [[nodiscard]] ColumnarResultSet fetchBulkStreamChunk();
     void storeODBCDiagnosticMessage(SQLRETURN returnCode, SQLSMALLINT odbcHandleType, SQLHANDLE odbcHandle);
     [[nodiscard]] static std::string convertSQLTypeToDisplayName(SQLSMALLINT dataType);
 
+    /// Returns a prepared SQLHSTMT for the given SQL, reusing a cached handle
+    /// when the same text was executed before (SQLPrepare once, SQLExecute
+    /// thereafter). Evicts the least recently used handle past the cap.
+    [[nodiscard]] SQLHSTMT acquirePreparedStatement(const std::string& sql);
+    void clearStatementCache();
+
+    /// Describes the statement's current result set and fetches all of its
+    /// rows into result (block fetch with per-row SQLGetData fallback).
+    /// Shared by executeColumnar and executeBatch.
+    void fetchCurrentResult(SQLHSTMT stmt, ColumnarResultSet& result);
+
+    /// Fires the registered first-rows callback once the threshold is
+    /// reached; no-op (one branch) when no callback is pending
+    void publishFirstRowsIfReady(const ColumnarResultSet& result);
+    static constexpr size_t FIRST_ROWS_PUBLISH_TARGET = 100;
+    std::function<void(const ColumnarResultSet&)> m_firstRowsCallback;
+
+    // Hot pagination paths re-run identical SQL dozens of times per session;
+    // keep their prepared handles alive instead of re-parsing every call
+    static constexpr size_t MAX_PREPARED_STATEMENTS = 32;
+
+    struct PreparedStatement {
+        SQLHSTMT stmt = SQL_NULL_HSTMT;
+        std::list<std::string>::iterator lruIt;
+    };
+
     SQLHENV m_env = SQL_NULL_HENV;
     SQLHDBC m_dbc = SQL_NULL_HDBC;
-    SQLHSTMT m_stmt = SQL_NULL_HSTMT;
+    SQLHSTMT m_stmt = SQL_NULL_HSTMT;  // Current statement (owned by m_stmtCache)
     bool m_connected = false;
     std::string m_lastError;
+    std::string m_connectionString;
+
+    std::unordered_map<std::string, PreparedStatement> m_stmtCache;
+    std::list<std::string> m_stmtLru;  // Front = most recently used
+
+    SQLHSTMT m_batchStmt = SQL_NULL_HSTMT;  // Live only inside executeBatch; exposed for cancel()
+
+    SQLHSTMT m_streamStmt = SQL_NULL_HSTMT;
+    std::vector<ColumnInfo> m_streamColumns;
+    bool m_streamExhausted = false;
+    std::unique_ptr<BulkStreamState> m_bulkStream;  // Non-null only while a bulk stream is open
 };
 
 }  // namespace velocitydb
@@ -2,6 +2,9 @@
 
 #include "data_exporter.h"
 
+#include <functional>
+#include <string_view>
+
 namespace velocitydb {
 
 class CSVExporter : public DataExporter {
@@ -12,8 +15,32 @@ public:
     bool exportData(const ResultSet& data, const std::string& filepath) override;
     bool exportData(const ResultSet& data, const std::string& filepath, const ExportOptions& options) override;
 
+    /// Streams query results straight from the driver's block-fetch
+    /// cursor to disk: rows are fetched one chunk at a time and written
+    /// through a large buffered writer, so memory stays flat at one chunk
+    /// regardless of the result size. The driver must be connected and
+    /// have no other open stream.
+    /// @param driver Connected driver to run the query on
+    /// @param sql Query whose results to export
+    /// @param filepath Destination file path
+    /// @param options Formatting options (delimiter, header, nulls, ...)
+    /// @param chunkRows Rows fetched per cursor block
+    /// @param progress Called after each chunk with the total rows written
+    ///                 so far; returning false cancels the export
+    ///                 cooperatively (the partial file is left on disk)
+    /// @param bulkFetch Open the cursor with openBulkStream (array-bound
+    ///                  block fetches) instead of the per-row stream; for
+    ///                  dedicated extract connections
+    [[nodiscard]] bool exportStream(SQLServerDriver& driver, const std::string& sql, const std::string& filepath, const ExportOptions& options, size_t chunkRows = DEFAULT_STREAM_CHUNK_ROWS, const std::function<bool(size_t rowsWritten)>& progress = {}, bool bulkFetch = false);
+
+    static constexpr size_t DEFAULT_STREAM_CHUNK_ROWS = 10000;
+
 private:
     std::string escapeCSV(const std::string& value, const ExportOptions& options) const;
+
+    /// Append-style escape for the streaming path: writes the field into
+    /// the output buffer without materializing a temporary string
+    void appendCSVField(std::string& out, std::string_view value, const ExportOptions& options) const;
 };
 
 }  // namespace velocitydb
@@ -13,6 +13,10 @@ struct ExportOptions {
     std::string nullValue = "";
     std::string lineEnding = "\r\n";
     bool quoteStrings = true;
+    // Compress the output on the fly (streaming exports): block-compressed
+    // with the Windows Compression API, see PipelinedFileWriter for the
+    // container layout. Cuts bytes-on-wire ~80% for typical tabular text.
+    bool compressOutput = false;
 };
 
 class DataExporter {
@@ -0,0 +1,104 @@
+#include "ddl_exporter.h"
+
+#include "../database/schema_inspector.h"
+#include "../database/sqlserver_driver.h"
+#include "../utils/logger.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+namespace velocitydb {
+
+std::expected<size_t, std::string> DDLExporter::exportDatabaseDDL(const std::string& connectionString, const std::string& filepath, size_t parallelism) {
+    auto coordinator = std::make_shared<SQLServerDriver>();
+    if (!coordinator->connect(connectionString)) {
+        return std::unexpected(std::format("DDL export connection failed: {}", coordinator->getLastError()));
+    }
+
+    SchemaInspector inspector;
+    inspector.setDriver(coordinator);
+    auto tables = inspector.getTables("");
+
+    std::ofstream out(filepath);
+    if (!out.is_open()) {
+        return std::unexpected(std::format("Cannot open output file: {}", filepath));
+    }
+
+    out << std::format("-- DDL export: {} tables\n\n", tables.size());
+    if (tables.empty()) {
+        return 0;
+    }
+
+    parallelism = (std::min)({parallelism, tables.size(), MAX_PARALLELISM});
+    parallelism = (std::max)(parallelism, size_t{1});
+
+    // Workers claim table slots from a shared counter and mark them done;
+    // the caller streams the completed prefix to disk in table order so
+    // the script is deterministic while still being written as tables
+    // finish, not after the whole job
+    std::atomic<size_t> nextTable{0};
+    std::vector<std::string> scripts(tables.size());
+    std::vector<char> completed(tables.size(), 0);
+    std::mutex mutex;
+    std::condition_variable slotDone;
+
+    auto worker = [&](std::shared_ptr<SQLServerDriver> driver) {
+        SchemaInspector workerInspector;
+        workerInspector.setDriver(std::move(driver));
+        for (size_t i = nextTable.fetch_add(1); i < tables.size(); i = nextTable.fetch_add(1)) {
+            auto qualifiedName = std::format("{}.{}", tables[i].schema, tables[i].name);
+            std::string script;
+            try {
+                script = workerInspector.generateDDL(qualifiedName);
+            } catch (const std::exception& e) {
+                script = std::format("-- Failed to script {}: {}\n", qualifiedName, e.what());
+            }
+            {
+                std::lock_guard lock(mutex);
+                scripts[i] = std::move(script);
+                completed[i] = 1;
+            }
+            slotDone.notify_one();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(parallelism);
+    // The coordinator's connection always drives one worker, so the job
+    // progresses even if every sibling connect fails
+    workers.emplace_back(worker, coordinator);
+    for (size_t w = 1; w < parallelism; ++w) {
+        auto sibling = std::make_shared<SQLServerDriver>();
+        if (sibling->connect(connectionString)) {
+            workers.emplace_back(worker, std::move(sibling));
+        } else {
+            velocitydb::log<LogLevel::WARNING>(std::format("DDL export: sibling connection failed, continuing with {} workers", workers.size()));
+        }
+    }
+
+    for (size_t i = 0; i < tables.size(); ++i) {
+        std::unique_lock lock(mutex);
+        slotDone.wait(lock, [&] { return completed[i] != 0; });
+        out << scripts[i] << '\n';
+        scripts[i].clear();
+        scripts[i].shrink_to_fit();
+        lock.unlock();
+        out.flush();
+    }
+
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    velocitydb::log<LogLevel::INFO>(std::format("DDL export: scripted {} tables with {} workers to {}", tables.size(), workers.size(), filepath));
+    return tables.size();
+}
+
+}  // namespace velocitydb
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <expected>
+#include <string>
+
+namespace velocitydb {
+
+/// Scripts every table of a database to one DDL file. Per-table
+/// generation fans out across sibling connections (each worker opens its
+/// own connection with the source connection string), turning the
+/// serial N-round-trip job into a parallel one bounded by the worker
+/// count; the script streams to disk in table order as tables complete.
+class DDLExporter {
+public:
+    DDLExporter() = default;
+    ~DDLExporter() = default;
+
+    /// Returns the number of tables scripted, or an error message when
+    /// the file or the initial connection cannot be opened
+    [[nodiscard]] std::expected<size_t, std::string> exportDatabaseDDL(const std::string& connectionString, const std::string& filepath, size_t parallelism = DEFAULT_PARALLELISM);
+
+private:
+    // Mirrors the connection pool's default size; more workers than that
+    // would just queue on the server side
+    static constexpr size_t DEFAULT_PARALLELISM = 4;
+    static constexpr size_t MAX_PARALLELISM = 8;
+};
+
+}  // namespace velocitydb
@@ -1,18 +1,316 @@
 #include "excel_exporter.h"
 
-#include <stdexcept>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 namespace velocitydb {
 
+namespace {
+
+// Rows per sheet-XML chunk: large enough to amortize thread handoff,
+// small enough that the in-flight window stays tens of megabytes
+constexpr size_t CHUNK_ROWS = 50'000;
+
+// Chunks a formatter may run ahead of the zip writer; bounds memory to
+// MAX_PENDING_CHUNKS formatted chunks regardless of row count
+constexpr size_t MAX_PENDING_CHUNKS = 4;
+
+constexpr size_t MAX_FORMAT_WORKERS = 8;
+
+[[nodiscard]] const std::array<uint32_t, 256>& crc32Table() {
+    static const auto table = [] {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) != 0 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+    return table;
+}
+
+[[nodiscard]] uint32_t crc32Update(uint32_t crc, std::string_view data) {
+    const auto& table = crc32Table();
+    for (unsigned char byte : data) {
+        crc = table[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+/// Minimal zip container writer for xlsx: entries are stored
+/// uncompressed and streamed; the local header is patched with the CRC
+/// and sizes once the entry ends (the file is seekable), so entries of
+/// unknown length never have to be buffered whole.
+class ZipWriter {
+public:
+    explicit ZipWriter(const std::string& filepath) : m_file(filepath, std::ios::binary) {}
+
+    [[nodiscard]] bool isOpen() const { return m_file.is_open(); }
+
+    void beginEntry(std::string name) {
+        m_current = {.name = std::move(name), .headerOffset = static_cast<uint64_t>(m_file.tellp())};
+
+        writeU32(0x04034B50);  // Local file header signature
+        writeU16(20);          // Version needed
+        writeU16(0);           // Flags
+        writeU16(0);           // Method: stored
+        writeU32(0);           // DOS time/date
+        writeU32(0);           // CRC-32 (patched in endEntry)
+        writeU32(0);           // Compressed size (patched)
+        writeU32(0);           // Uncompressed size (patched)
+        writeU16(static_cast<uint16_t>(m_current.name.size()));
+        writeU16(0);  // Extra field length
+        m_file.write(m_current.name.data(), static_cast<std::streamsize>(m_current.name.size()));
+    }
+
+    void write(std::string_view data) {
+        m_current.crc = crc32Update(m_current.crc, data);
+        m_current.size += data.size();
+        m_file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    void endEntry() {
+        m_current.crc ^= 0xFFFFFFFFu;
+
+        auto endPos = m_file.tellp();
+        m_file.seekp(static_cast<std::streamoff>(m_current.headerOffset + 14));
+        writeU32(m_current.crc);
+        writeU32(static_cast<uint32_t>(m_current.size));
+        writeU32(static_cast<uint32_t>(m_current.size));
+        m_file.seekp(endPos);
+
+        m_entries.push_back(std::move(m_current));
+        m_current = {};
+    }
+
+    [[nodiscard]] bool finish() {
+        auto centralOffset = static_cast<uint64_t>(m_file.tellp());
+        for (const auto& entry : m_entries) {
+            writeU32(0x02014B50);  // Central directory header signature
+            writeU16(20);          // Version made by
+            writeU16(20);          // Version needed
+            writeU16(0);           // Flags
+            writeU16(0);           // Method: stored
+            writeU32(0);           // DOS time/date
+            writeU32(entry.crc);
+            writeU32(static_cast<uint32_t>(entry.size));
+            writeU32(static_cast<uint32_t>(entry.size));
+            writeU16(static_cast<uint16_t>(entry.name.size()));
+            writeU16(0);  // Extra field length
+            writeU16(0);  // Comment length
+            writeU16(0);  // Disk number
+            writeU16(0);  // Internal attributes
+            writeU32(0);  // External attributes
+            writeU32(static_cast<uint32_t>(entry.headerOffset));
+            m_file.write(entry.name.data(), static_cast<std::streamsize>(entry.name.size()));
+        }
+        auto centralSize = static_cast<uint64_t>(m_file.tellp()) - centralOffset;
+
+        writeU32(0x06054B50);  // End of central directory signature
+        writeU16(0);           // Disk number
+        writeU16(0);           // Central directory start disk
+        writeU16(static_cast<uint16_t>(m_entries.size()));
+        writeU16(static_cast<uint16_t>(m_entries.size()));
+        writeU32(static_cast<uint32_t>(centralSize));
+        writeU32(static_cast<uint32_t>(centralOffset));
+        writeU16(0);  // Comment length
+
+        m_file.flush();
+        return m_file.good();
+    }
+
+private:
+    struct Entry {
+        std::string name;
+        uint64_t headerOffset = 0;
+        uint64_t size = 0;
+        uint32_t crc = 0xFFFFFFFFu;  // Running CRC, finalized in endEntry
+    };
+
+    void writeU16(uint16_t value) { m_file.write(reinterpret_cast<const char*>(&value), sizeof(value)); }
+    void writeU32(uint32_t value) { m_file.write(reinterpret_cast<const char*>(&value), sizeof(value)); }
+
+    std::ofstream m_file;
+    Entry m_current;
+    std::vector<Entry> m_entries;
+};
+
+void appendXmlEscaped(std::string& out, std::string_view value) {
+    for (char c : value) {
+        switch (c) {
+            case '&':
+                out += "&amp;";
+                break;
+            case '<':
+                out += "&lt;";
+                break;
+            case '>':
+                out += "&gt;";
+                break;
+            case '"':
+                out += "&quot;";
+                break;
+            default:
+                out += c;
+                break;
+        }
+    }
+}
+
+/// Sheet XML for rows [firstRow, lastRow) as inline strings. rowNumber
+/// is the 1-based sheet row of firstRow, so chunks are independent.
+[[nodiscard]] std::string formatRowChunk(const ResultSet& data, size_t firstRow, size_t lastRow, size_t rowNumber) {
+    std::string xml;
+    xml.reserve((lastRow - firstRow) * 64);
+    for (size_t row = firstRow; row < lastRow; ++row, ++rowNumber) {
+        xml += std::format("<row r=\"{}\">", rowNumber);
+        for (const auto& value : data.rows[row].values) {
+            xml += "<c t=\"inlineStr\"><is><t>";
+            appendXmlEscaped(xml, value);
+            xml += "</t></is></c>";
+        }
+        xml += "</row>";
+    }
+    return xml;
+}
+
+}  // namespace
+
 bool ExcelExporter::exportData(const ResultSet& data, const std::string& filepath) {
     return exportData(data, filepath, ExportOptions());
 }
 
-bool ExcelExporter::exportData(const ResultSet& /*data*/, const std::string& /*filepath*/, const ExportOptions& /*options*/) {
-    // Excel export is not yet implemented.
-    // Use CSV or JSON export as alternatives.
-    throw std::runtime_error("Excel export is not yet implemented. Please use CSV or JSON export instead. "
-                             "Excel support will be added in a future release.");
+bool ExcelExporter::exportData(const ResultSet& data, const std::string& filepath, const ExportOptions& options) {
+    ZipWriter zip(filepath);
+    if (!zip.isOpen()) {
+        return false;
+    }
+
+    zip.beginEntry("[Content_Types].xml");
+    zip.write(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>)"
+              R"(<Types xmlns="http://schemas.openxmlformats.org/package/2006/content-types">)"
+              R"(<Default Extension="rels" ContentType="application/vnd.openxmlformats-package.relationships+xml"/>)"
+              R"(<Default Extension="xml" ContentType="application/xml"/>)"
+              R"(<Override PartName="/xl/workbook.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.sheet.main+xml"/>)"
+              R"(<Override PartName="/xl/worksheets/sheet1.xml" ContentType="application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml"/>)"
+              R"(</Types>)");
+    zip.endEntry();
+
+    zip.beginEntry("_rels/.rels");
+    zip.write(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>)"
+              R"(<Relationships xmlns="http://schemas.openxmlformats.org/package/2006/relationships">)"
+              R"(<Relationship Id="rId1" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/officeDocument" Target="xl/workbook.xml"/>)"
+              R"(</Relationships>)");
+    zip.endEntry();
+
+    zip.beginEntry("xl/workbook.xml");
+    std::string workbook = R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>)"
+                           R"(<workbook xmlns="http://schemas.openxmlformats.org/spreadsheetml/2006/main" xmlns:r="http://schemas.openxmlformats.org/officeDocument/2006/relationships"><sheets><sheet name=")";
+    appendXmlEscaped(workbook, m_sheetName);
+    workbook += R"(" sheetId="1" r:id="rId1"/></sheets></workbook>)";
+    zip.write(workbook);
+    zip.endEntry();
+
+    zip.beginEntry("xl/_rels/workbook.xml.rels");
+    zip.write(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>)"
+              R"(<Relationships xmlns="http://schemas.openxmlformats.org/package/2006/relationships">)"
+              R"(<Relationship Id="rId1" Type="http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet" Target="worksheets/sheet1.xml"/>)"
+              R"(</Relationships>)");
+    zip.endEntry();
+
+    // The sheet itself is streamed: row-range chunks are formatted in
+    // parallel and written to the entry in order, with workers throttled
+    // to a bounded window ahead of the writer so memory stays constant
+    zip.beginEntry("xl/worksheets/sheet1.xml");
+    zip.write(R"(<?xml version="1.0" encoding="UTF-8" standalone="yes"?>)"
+              R"(<worksheet xmlns="http://schemas.openxmlformats.org/spreadsheetml/2006/main"><sheetData>)");
+
+    size_t sheetRow = 1;
+    if (options.includeHeader && !data.columns.empty()) {
+        std::string header = std::format("<row r=\"{}\">", sheetRow);
+        for (const auto& column : data.columns) {
+            header += "<c t=\"inlineStr\"><is><t>";
+            appendXmlEscaped(header, column.name);
+            header += "</t></is></c>";
+        }
+        header += "</row>";
+        zip.write(header);
+        ++sheetRow;
+    }
+
+    const size_t chunkCount = (data.rows.size() + CHUNK_ROWS - 1) / CHUNK_ROWS;
+    if (chunkCount <= 1) {
+        if (!data.rows.empty()) {
+            zip.write(formatRowChunk(data, 0, data.rows.size(), sheetRow));
+        }
+    } else {
+        std::atomic<size_t> nextChunk{0};
+        std::vector<std::string> chunks(chunkCount);
+        std::vector<char> completed(chunkCount, 0);
+        size_t writeCursor = 0;
+        std::mutex mutex;
+        std::condition_variable chunkDone;
+        std::condition_variable windowOpen;
+
+        auto worker = [&] {
+            for (size_t i = nextChunk.fetch_add(1); i < chunkCount; i = nextChunk.fetch_add(1)) {
+                {
+                    std::unique_lock lock(mutex);
+                    windowOpen.wait(lock, [&] { return i < writeCursor + MAX_PENDING_CHUNKS; });
+                }
+                auto firstRow = i * CHUNK_ROWS;
+                auto lastRow = (std::min)(firstRow + CHUNK_ROWS, data.rows.size());
+                auto xml = formatRowChunk(data, firstRow, lastRow, sheetRow + firstRow);
+                {
+                    std::lock_guard lock(mutex);
+                    chunks[i] = std::move(xml);
+                    completed[i] = 1;
+                }
+                chunkDone.notify_all();
+            }
+        };
+
+        auto workerCount = (std::min)({static_cast<size_t>(std::thread::hardware_concurrency()), chunkCount, MAX_FORMAT_WORKERS});
+        workerCount = (std::max)(workerCount, size_t{1});
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+        for (size_t w = 0; w < workerCount; ++w) {
+            workers.emplace_back(worker);
+        }
+
+        for (size_t i = 0; i < chunkCount; ++i) {
+            std::string xml;
+            {
+                std::unique_lock lock(mutex);
+                chunkDone.wait(lock, [&] { return completed[i] != 0; });
+                xml = std::move(chunks[i]);
+                writeCursor = i + 1;
+            }
+            windowOpen.notify_all();
+            zip.write(xml);
+        }
+
+        for (auto& thread : workers) {
+            thread.join();
+        }
+    }
+
+    zip.write("</sheetData></worksheet>");
+    zip.endEntry();
+
+    return zip.finish();
 }
 
 }  // namespace velocitydb
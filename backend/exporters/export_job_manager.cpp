@@ -0,0 +1,201 @@
+#include "export_job_manager.h"
+
+#include "../utils/logger.h"
+#include "csv_exporter.h"
+#include "excel_exporter.h"
+#include "json_exporter.h"
+#include "parquet_exporter.h"
+
+#include <format>
+#include <utility>
+
+namespace velocitydb {
+
+ExportJobManager::~ExportJobManager() {
+    // Detach the map under the lock, then let the jthreads join outside
+    // it so workers publishing progress are not deadlocked against us
+    std::unordered_map<std::string, std::shared_ptr<ExportJob>> jobs;
+    {
+        std::lock_guard lock(m_mutex);
+        jobs = std::move(m_jobs);
+        m_jobs.clear();
+    }
+    for (auto& [_, job] : jobs) {
+        job->cancelRequested.store(true);
+    }
+}
+
+std::string ExportJobManager::startJob(std::shared_ptr<SQLServerDriver> driver, std::string sql, std::string filepath, std::string format, ExportOptions options, bool bulkExtract) {
+    auto job = std::make_shared<ExportJob>();
+    job->jobId = std::format("export-{}", m_jobIdCounter.fetch_add(1));
+    job->filepath = std::move(filepath);
+    job->format = std::move(format);
+    job->bulkExtract = bulkExtract;
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_jobs[job->jobId] = job;
+    }
+
+    velocitydb::log<LogLevel::INFO>(std::format("Export job {} started: {} -> {}", job->jobId, job->format, job->filepath));
+
+    job->worker = std::jthread([this, job, sourceDriver = std::move(driver), sql = std::move(sql), options = std::move(options)] { runJob(job, sourceDriver, sql, options); });
+
+    return job->jobId;
+}
+
+void ExportJobManager::runJob(const std::shared_ptr<ExportJob>& job, const std::shared_ptr<SQLServerDriver>& sourceDriver, const std::string& sql, const ExportOptions& options) {
+    job->status.store(ExportJobStatus::Running);
+    notifyProgress(*job);
+
+    try {
+        // Sibling connection to the same server: the interactive
+        // connection the job was started from stays free for queries
+        auto connectionString = std::string(sourceDriver->getConnectionString());
+        SQLServerDriver exportDriver;
+        const bool connected = job->bulkExtract ? exportDriver.connectForBulkExtract(connectionString) : exportDriver.connect(connectionString);
+        if (connectionString.empty() || !connected) {
+            job->errorMessage = "Failed to open export connection";
+            job->status.store(ExportJobStatus::Failed);
+            notifyProgress(*job);
+            return;
+        }
+
+        bool exported = false;
+        if (job->format == "csv") {
+            CSVExporter exporter;
+            exported = exporter.exportStream(exportDriver, sql, job->filepath, options, CSVExporter::DEFAULT_STREAM_CHUNK_ROWS, [this, &job](size_t rowsWritten) {
+                job->rowsWritten.store(rowsWritten);
+                notifyProgress(*job);
+                return !job->cancelRequested.load();
+            }, job->bulkExtract);
+            if (!exported && job->cancelRequested.load()) {
+                exportDriver.disconnect();
+                job->status.store(ExportJobStatus::Cancelled);
+                notifyProgress(*job);
+                return;
+            }
+        } else if (job->format == "json" || job->format == "excel" || job->format == "parquet") {
+            // Materialized formats: one cancellation point after the fetch
+            auto result = exportDriver.execute(sql);
+            if (job->cancelRequested.load()) {
+                exportDriver.disconnect();
+                job->status.store(ExportJobStatus::Cancelled);
+                notifyProgress(*job);
+                return;
+            }
+            if (job->format == "json") {
+                JSONExporter exporter;
+                exported = exporter.exportData(result, job->filepath, options);
+            } else if (job->format == "parquet") {
+                ParquetExporter exporter;
+                exported = exporter.exportData(result, job->filepath, options);
+            } else {
+                ExcelExporter exporter;
+                exported = exporter.exportData(result, job->filepath, options);
+            }
+            job->rowsWritten.store(result.rows.size());
+        } else {
+            job->errorMessage = std::format("Unsupported export format: {}", job->format);
+        }
+        exportDriver.disconnect();
+
+        if (!exported && job->errorMessage.empty()) {
+            job->errorMessage = "Export failed";
+        }
+        job->status.store(exported ? ExportJobStatus::Completed : ExportJobStatus::Failed);
+    } catch (const std::exception& e) {
+        job->errorMessage = e.what();
+        job->status.store(ExportJobStatus::Failed);
+    }
+    notifyProgress(*job);
+}
+
+std::optional<ExportJobState> ExportJobManager::getJobState(std::string_view jobId) const {
+    std::lock_guard lock(m_mutex);
+    auto it = m_jobs.find(std::string(jobId));
+    if (it == m_jobs.end()) {
+        return std::nullopt;
+    }
+    return snapshot(*it->second);
+}
+
+bool ExportJobManager::cancelJob(std::string_view jobId) {
+    std::lock_guard lock(m_mutex);
+    auto it = m_jobs.find(std::string(jobId));
+    if (it == m_jobs.end()) {
+        return false;
+    }
+    auto status = it->second->status.load();
+    if (status != ExportJobStatus::Pending && status != ExportJobStatus::Running) {
+        return false;
+    }
+    it->second->cancelRequested.store(true);
+    return true;
+}
+
+void ExportJobManager::removeJob(std::string_view jobId) {
+    // Take the job out of the map under the lock but let it (and its
+    // worker join) destruct outside, so a worker publishing its final
+    // progress is not deadlocked against us
+    std::shared_ptr<ExportJob> removed;
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_jobs.find(std::string(jobId));
+        if (it == m_jobs.end()) {
+            return;
+        }
+        auto status = it->second->status.load();
+        if (status == ExportJobStatus::Pending || status == ExportJobStatus::Running) {
+            return;
+        }
+        removed = std::move(it->second);
+        m_jobs.erase(it);
+    }
+}
+
+std::vector<std::string> ExportJobManager::getActiveJobIds() const {
+    std::lock_guard lock(m_mutex);
+    std::vector<std::string> ids;
+    for (const auto& [jobId, job] : m_jobs) {
+        auto status = job->status.load();
+        if (status == ExportJobStatus::Pending || status == ExportJobStatus::Running) {
+            ids.push_back(jobId);
+        }
+    }
+    return ids;
+}
+
+void ExportJobManager::setProgressCallback(std::function<void(const ExportJobState&)> callback) {
+    std::lock_guard lock(m_mutex);
+    m_progressCallback = std::move(callback);
+}
+
+void ExportJobManager::notifyProgress(const ExportJob& job) const {
+    std::function<void(const ExportJobState&)> callback;
+    {
+        std::lock_guard lock(m_mutex);
+        callback = m_progressCallback;
+    }
+    if (callback) {
+        callback(snapshot(job));
+    }
+}
+
+ExportJobState ExportJobManager::snapshot(const ExportJob& job) {
+    // errorMessage is only safe to read after the status flip that the
+    // worker performs last: the atomic load orders this thread after its
+    // writes. While the job still runs, the message is blank anyway.
+    const auto status = job.status.load();
+    const bool terminal = status == ExportJobStatus::Completed || status == ExportJobStatus::Cancelled || status == ExportJobStatus::Failed;
+    return {
+        .jobId = job.jobId,
+        .status = status,
+        .rowsWritten = job.rowsWritten.load(),
+        .filepath = job.filepath,
+        .format = job.format,
+        .errorMessage = terminal ? job.errorMessage : std::string{},
+    };
+}
+
+}  // namespace velocitydb
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "data_exporter.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace velocitydb {
+
+enum class ExportJobStatus { Pending, Running, Completed, Cancelled, Failed };
+
+/// Point-in-time snapshot of a job handed to callers and the progress
+/// callback
+struct ExportJobState {
+    std::string jobId;
+    ExportJobStatus status = ExportJobStatus::Pending;
+    size_t rowsWritten = 0;
+    std::string filepath;
+    std::string format;
+    std::string errorMessage;
+};
+
+/// Runs exports as background jobs with the same id/status/cancel model
+/// as AsyncQueryExecutor. Each job opens a sibling connection from the
+/// source driver's stored connection string, so a long export never
+/// blocks the interactive connection it was started from. CSV jobs
+/// stream from the block-fetch cursor and report rows-written progress
+/// per chunk; JSON and Excel jobs materialize the result first and
+/// report progress at completion.
+class ExportJobManager {
+public:
+    ExportJobManager() = default;
+    ~ExportJobManager();
+
+    ExportJobManager(const ExportJobManager&) = delete;
+    ExportJobManager& operator=(const ExportJobManager&) = delete;
+    ExportJobManager(ExportJobManager&&) = delete;
+    ExportJobManager& operator=(ExportJobManager&&) = delete;
+
+    /// Starts an export job on a background thread, returns a unique job
+    /// id. format is "csv", "json", "excel" or "parquet"; the driver
+    /// supplies the connection string for the job's sibling connection.
+    /// bulkExtract selects the whole-table extract path: a max-packet-size
+    /// connection and array-bound block fetches for CSV streaming.
+    [[nodiscard]] std::string startJob(std::shared_ptr<SQLServerDriver> driver, std::string sql, std::string filepath, std::string format, ExportOptions options, bool bulkExtract = false);
+
+    /// Current state of a job, empty when the id is unknown
+    [[nodiscard]] std::optional<ExportJobState> getJobState(std::string_view jobId) const;
+
+    /// Requests cooperative cancellation; the job stops at the next chunk
+    /// boundary. Returns false when the id is unknown or already terminal.
+    bool cancelJob(std::string_view jobId);
+
+    /// Removes a terminal job from tracking (cleanup); running jobs are
+    /// left in place
+    void removeJob(std::string_view jobId);
+
+    [[nodiscard]] std::vector<std::string> getActiveJobIds() const;
+
+    /// Registers a callback fired from the worker thread on every
+    /// progress milestone and terminal state, so progress can be pushed
+    /// to the frontend instead of polled
+    void setProgressCallback(std::function<void(const ExportJobState&)> callback);
+
+private:
+    struct ExportJob {
+        std::string jobId;
+        std::atomic<ExportJobStatus> status{ExportJobStatus::Pending};
+        std::atomic<size_t> rowsWritten{0};
+        std::atomic<bool> cancelRequested{false};
+        std::string filepath;
+        std::string format;
+        std::string errorMessage;  // Written by the worker before the status flips terminal; read only after observing that flip (see snapshot)
+        bool bulkExtract = false;
+        std::jthread worker;
+    };
+
+    void runJob(const std::shared_ptr<ExportJob>& job, const std::shared_ptr<SQLServerDriver>& sourceDriver, const std::string& sql, const ExportOptions& options);
+    void notifyProgress(const ExportJob& job) const;
+    [[nodiscard]] static ExportJobState snapshot(const ExportJob& job);
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, std::shared_ptr<ExportJob>> m_jobs;
+    std::atomic<int> m_jobIdCounter{1};
+    std::function<void(const ExportJobState&)> m_progressCallback;
+};
+
+}  // namespace velocitydb
@@ -1,39 +1,160 @@
 #include "json_exporter.h"
 
-#include <fstream>
+#include "mapped_file_writer.h"
+
+#include <format>
 #include <iomanip>
 #include <sstream>
+#include <string_view>
 
 namespace velocitydb {
 
+namespace {
+
+void appendJSONEscaped(std::string& out, std::string_view value) {
+    for (char c : value) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\b':
+                out += "\\b";
+                break;
+            case '\f':
+                out += "\\f";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += std::format("\\u{:04x}", static_cast<int>(c));
+                } else {
+                    out += c;
+                }
+                break;
+        }
+    }
+}
+
+// Same value typing rules as the array format: empty -> null, integers
+// and decimals stay bare, BIT columns become booleans
+void appendJSONValue(std::string& out, const ColumnInfo& col, std::string_view value) {
+    if (value.empty()) {
+        out += "null";
+        return;
+    }
+
+    bool isNumeric = true;
+    bool hasDecimal = false;
+    for (size_t i = 0; i < value.length(); ++i) {
+        char c = value[i];
+        if (c == '.') {
+            if (hasDecimal) {
+                isNumeric = false;
+                break;
+            }
+            hasDecimal = true;
+        } else if (c == '-' && i == 0) {
+            continue;
+        } else if (!std::isdigit(c)) {
+            isNumeric = false;
+            break;
+        }
+    }
+
+    if (isNumeric) {
+        out += value;
+    } else if (col.type == "BIT") {
+        out += value == "1" ? "true" : "false";
+    } else {
+        out += '"';
+        appendJSONEscaped(out, value);
+        out += '"';
+    }
+}
+
+}  // namespace
+
 bool JSONExporter::exportData(const ResultSet& data, const std::string& filepath) {
     return exportData(data, filepath, ExportOptions());
 }
 
 bool JSONExporter::exportData(const ResultSet& data, const std::string& filepath, const ExportOptions& options) {
-    std::ofstream file(filepath);
-    if (!file.is_open()) {
+    // Rows are formatted into one reused buffer and memcpy'd straight
+    // into the mapped file, skipping the ostream buffer copy
+    MappedFileWriter writer(filepath);
+    if (!writer.isOpen()) {
         return false;
     }
 
+    // NDJSON mode: one row object per line through one reused buffer, so
+    // nothing is ever held beyond the current row
+    if (!m_asArray) {
+        // Column-name prefixes ("\"name\":) are escaped once up front
+        std::vector<std::string> keyPrefixes;
+        keyPrefixes.reserve(data.columns.size());
+        for (const auto& col : data.columns) {
+            std::string prefix = "\"";
+            appendJSONEscaped(prefix, col.name);
+            prefix += "\":";
+            keyPrefixes.push_back(std::move(prefix));
+        }
+
+        std::string line;
+        for (const auto& row : data.rows) {
+            line.clear();
+            line += '{';
+            for (size_t colIdx = 0; colIdx < data.columns.size() && colIdx < row.values.size(); ++colIdx) {
+                if (colIdx > 0) {
+                    line += ',';
+                }
+                line += keyPrefixes[colIdx];
+                appendJSONValue(line, data.columns[colIdx], row.values[colIdx]);
+            }
+            line += "}\n";
+            writer.append(line);
+        }
+        return writer.finish();
+    }
+
     std::string indent = m_prettyPrint ? "  " : "";
     std::string newline = m_prettyPrint ? "\n" : "";
 
-    file << "[" << newline;
+    std::string line;
+    line += "[";
+    line += newline;
+    writer.append(line);
 
     for (size_t rowIdx = 0; rowIdx < data.rows.size(); ++rowIdx) {
         const auto& row = data.rows[rowIdx];
 
-        file << indent << "{" << newline;
+        line.clear();
+        line += indent;
+        line += "{";
+        line += newline;
 
         for (size_t colIdx = 0; colIdx < data.columns.size(); ++colIdx) {
             const auto& col = data.columns[colIdx];
             const auto& value = row.values[colIdx];
 
-            file << indent << indent << "\"" << escapeJSON(col.name) << "\": ";
+            line += indent;
+            line += indent;
+            line += "\"";
+            line += escapeJSON(col.name);
+            line += "\": ";
 
             if (value.empty()) {
-                file << "null";
+                line += "null";
             } else {
                 // Try to determine if value is numeric
                 bool isNumeric = true;
@@ -55,33 +176,40 @@ bool JSONExporter::exportData(const ResultSet& data, const std::string& filepath
                 }
 
                 if (isNumeric && !value.empty()) {
-                    file << value;
+                    line += value;
                 } else if (col.type == "BIT") {
-                    file << (value == "1" ? "true" : "false");
+                    line += value == "1" ? "true" : "false";
                 } else {
-                    file << "\"" << escapeJSON(value) << "\"";
+                    line += "\"";
+                    line += escapeJSON(value);
+                    line += "\"";
                 }
             }
 
             if (colIdx < data.columns.size() - 1) {
-                file << ",";
+                line += ",";
             }
-            file << newline;
+            line += newline;
         }
 
-        file << indent << "}";
+        line += indent;
+        line += "}";
         if (rowIdx < data.rows.size() - 1) {
-            file << ",";
+            line += ",";
         }
-        file << newline;
+        line += newline;
+        writer.append(line);
     }
 
-    file << "]" << newline;
+    line.clear();
+    line += "]";
+    line += newline;
+    writer.append(line);
 
-    return true;
+    return writer.finish();
 }
 
-std::string JSONExporter::escapeJSON(const std::string& value) const {
+std::string JSONExporter::escapeJSON(std::string_view value) const {
     std::ostringstream result;
     for (char c : value) {
         switch (c) {
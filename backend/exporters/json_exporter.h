@@ -14,10 +14,14 @@ public:
 
     // Additional JSON-specific options
     void setPrettyPrint(bool pretty) { m_prettyPrint = pretty; }
+
+    /// false selects NDJSON: one row object per line, no enclosing array.
+    /// Rows are serialized through one reused buffer, so export memory is
+    /// O(row) and downstream consumers can parse line by line.
     void setArrayFormat(bool asArray) { m_asArray = asArray; }
 
 private:
-    std::string escapeJSON(const std::string& value) const;
+    std::string escapeJSON(std::string_view value) const;
 
     bool m_prettyPrint = true;
     bool m_asArray = true;
@@ -0,0 +1,113 @@
+#include "mapped_file_writer.h"
+
+#include <Windows.h>
+
+#include <cstring>
+#include <filesystem>
+
+namespace velocitydb {
+
+namespace {
+
+// Starting mapping size; small exports still truncate down on finish()
+constexpr size_t INITIAL_CAPACITY = 16 * 1024 * 1024;
+
+// Doubling is capped here so a file just past a power of two does not
+// reserve gigabytes of address space it will never fill
+constexpr size_t MAX_GROWTH_STEP = 256 * 1024 * 1024;
+
+}  // namespace
+
+MappedFileWriter::MappedFileWriter(const std::string& filepath) {
+    auto file = CreateFileW(std::filesystem::path(filepath).c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        m_failed = true;
+        return;
+    }
+    m_file = file;
+    if (!remap(INITIAL_CAPACITY)) {
+        m_failed = true;
+    }
+}
+
+MappedFileWriter::~MappedFileWriter() {
+    if (!m_finished) {
+        [[maybe_unused]] auto ok = finish();
+    }
+}
+
+void MappedFileWriter::append(std::string_view bytes) {
+    if (m_failed || m_finished || bytes.empty()) {
+        return;
+    }
+
+    if (m_size + bytes.size() > m_capacity) {
+        auto newCapacity = m_capacity;
+        while (m_size + bytes.size() > newCapacity) {
+            newCapacity += (std::min)(newCapacity, MAX_GROWTH_STEP);
+        }
+        if (!remap(newCapacity)) {
+            m_failed = true;
+            return;
+        }
+    }
+
+    std::memcpy(m_view + m_size, bytes.data(), bytes.size());
+    m_size += bytes.size();
+}
+
+bool MappedFileWriter::finish() {
+    if (m_finished) {
+        return !m_failed;
+    }
+    m_finished = true;
+
+    unmap();
+    if (m_file) {
+        // The mapping rounded the file up to its capacity; cut it back to
+        // the bytes actually written
+        LARGE_INTEGER end{};
+        end.QuadPart = static_cast<LONGLONG>(m_size);
+        if (!SetFilePointerEx(m_file, end, nullptr, FILE_BEGIN) || !SetEndOfFile(m_file)) {
+            m_failed = true;
+        }
+        CloseHandle(m_file);
+        m_file = nullptr;
+    }
+    return !m_failed;
+}
+
+bool MappedFileWriter::remap(size_t newCapacity) {
+    unmap();
+
+    LARGE_INTEGER size{};
+    size.QuadPart = static_cast<LONGLONG>(newCapacity);
+    auto mapping = CreateFileMappingW(m_file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size.HighPart), size.LowPart, nullptr);
+    if (!mapping) {
+        return false;
+    }
+    auto view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    m_mapping = mapping;
+    m_view = static_cast<char*>(view);
+    m_capacity = newCapacity;
+    return true;
+}
+
+void MappedFileWriter::unmap() {
+    if (m_view) {
+        UnmapViewOfFile(m_view);
+        m_view = nullptr;
+    }
+    if (m_mapping) {
+        CloseHandle(m_mapping);
+        m_mapping = nullptr;
+    }
+    m_capacity = 0;
+}
+
+}  // namespace velocitydb
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace velocitydb {
+
+/// Memory-mapped output file for large exports. Appends copy formatted
+/// bytes straight into mapped page-cache pages, skipping the ostream
+/// buffer copy in between; on multi-gigabyte exports that saved memcpy is
+/// a measurable wall-clock win. The mapping grows by unmap-and-remap with
+/// doubling capacity, and finish() truncates the file to the bytes
+/// actually written.
+class MappedFileWriter {
+public:
+    explicit MappedFileWriter(const std::string& filepath);
+    ~MappedFileWriter();
+
+    MappedFileWriter(const MappedFileWriter&) = delete;
+    MappedFileWriter& operator=(const MappedFileWriter&) = delete;
+
+    [[nodiscard]] bool isOpen() const noexcept { return m_view != nullptr && !m_failed; }
+
+    void append(std::string_view bytes);
+
+    /// Unmaps, truncates the file to its logical size and closes it.
+    /// Returns false if opening, growing or writing failed at any point.
+    [[nodiscard]] bool finish();
+
+private:
+    [[nodiscard]] bool remap(size_t newCapacity);
+    void unmap();
+
+    void* m_file = nullptr;  // HANDLE, kept as void* to keep Windows.h out of the header
+    void* m_mapping = nullptr;
+    char* m_view = nullptr;
+    size_t m_capacity = 0;
+    size_t m_size = 0;
+    bool m_failed = false;
+    bool m_finished = false;
+};
+
+}  // namespace velocitydb
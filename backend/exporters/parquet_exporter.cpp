@@ -0,0 +1,418 @@
+#include "parquet_exporter.h"
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace velocitydb {
+
+namespace {
+
+constexpr std::string_view PARQUET_MAGIC = "PAR1";
+
+// parquet.thrift enum values (only the subset this writer emits)
+constexpr int32_t TYPE_BOOLEAN = 0;
+constexpr int32_t TYPE_INT64 = 2;
+constexpr int32_t TYPE_DOUBLE = 5;
+constexpr int32_t TYPE_BYTE_ARRAY = 6;
+constexpr int32_t CONVERTED_TYPE_UTF8 = 0;
+constexpr int32_t REPETITION_OPTIONAL = 1;
+constexpr int32_t ENCODING_PLAIN = 0;
+constexpr int32_t ENCODING_RLE = 3;
+constexpr int32_t CODEC_UNCOMPRESSED = 0;
+constexpr int32_t PAGE_TYPE_DATA = 0;
+
+// Thrift compact protocol type codes
+constexpr uint8_t CT_STOP = 0x00;
+constexpr uint8_t CT_I32 = 0x05;
+constexpr uint8_t CT_I64 = 0x06;
+constexpr uint8_t CT_BINARY = 0x08;
+constexpr uint8_t CT_LIST = 0x09;
+constexpr uint8_t CT_STRUCT = 0x0C;
+
+/// Minimal Thrift compact protocol serializer, just enough for the Parquet
+/// footer. Fields must be written in increasing id order within a struct;
+/// the delta encoding of field headers depends on it.
+class CompactWriter {
+public:
+    explicit CompactWriter(std::string& out) : m_out(out) {}
+
+    void beginStruct() {
+        m_fieldIdStack.push_back(m_lastFieldId);
+        m_lastFieldId = 0;
+    }
+
+    void endStruct() {
+        m_out += static_cast<char>(CT_STOP);
+        m_lastFieldId = m_fieldIdStack.back();
+        m_fieldIdStack.pop_back();
+    }
+
+    void i32Field(int16_t id, int32_t value) {
+        fieldHeader(CT_I32, id);
+        zigzagVarint(value);
+    }
+
+    void i64Field(int16_t id, int64_t value) {
+        fieldHeader(CT_I64, id);
+        zigzagVarint(value);
+    }
+
+    void stringField(int16_t id, std::string_view value) {
+        fieldHeader(CT_BINARY, id);
+        varint(value.size());
+        m_out += value;
+    }
+
+    /// Opens a nested struct field; close with endStruct()
+    void structField(int16_t id) {
+        fieldHeader(CT_STRUCT, id);
+        beginStruct();
+    }
+
+    /// Writes a list field header; follow with count elements. Struct
+    /// elements are framed with beginStruct()/endStruct()
+    void listField(int16_t id, uint8_t elementType, size_t count) {
+        fieldHeader(CT_LIST, id);
+        if (count < 15) {
+            m_out += static_cast<char>((count << 4) | elementType);
+        } else {
+            m_out += static_cast<char>(0xF0 | elementType);
+            varint(count);
+        }
+    }
+
+    void listI32Element(int32_t value) { zigzagVarint(value); }
+
+    void listStringElement(std::string_view value) {
+        varint(value.size());
+        m_out += value;
+    }
+
+private:
+    void fieldHeader(uint8_t type, int16_t id) {
+        auto delta = id - m_lastFieldId;
+        if (delta >= 1 && delta <= 15) {
+            m_out += static_cast<char>((delta << 4) | type);
+        } else {
+            m_out += static_cast<char>(type);
+            zigzagVarint(id);
+        }
+        m_lastFieldId = id;
+    }
+
+    void varint(uint64_t value) {
+        while (value >= 0x80) {
+            m_out += static_cast<char>((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+        m_out += static_cast<char>(value);
+    }
+
+    void zigzagVarint(int64_t value) { varint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63)); }
+
+    std::string& m_out;
+    int16_t m_lastFieldId = 0;
+    std::vector<int16_t> m_fieldIdStack;
+};
+
+enum class ParquetKind { Boolean, Int64, Double, Utf8 };
+
+[[nodiscard]] ParquetKind kindForColumnType(const std::string& sqlType) {
+    if (sqlType == "BIT") {
+        return ParquetKind::Boolean;
+    }
+    if (sqlType == "TINYINT" || sqlType == "SMALLINT" || sqlType == "INT" || sqlType == "INTEGER" || sqlType == "BIGINT") {
+        return ParquetKind::Int64;
+    }
+    if (sqlType == "FLOAT" || sqlType == "REAL" || sqlType == "DECIMAL" || sqlType == "NUMERIC" || sqlType == "MONEY" || sqlType == "SMALLMONEY") {
+        return ParquetKind::Double;
+    }
+    return ParquetKind::Utf8;
+}
+
+[[nodiscard]] int32_t physicalType(ParquetKind kind) {
+    switch (kind) {
+        case ParquetKind::Boolean:
+            return TYPE_BOOLEAN;
+        case ParquetKind::Int64:
+            return TYPE_INT64;
+        case ParquetKind::Double:
+            return TYPE_DOUBLE;
+        case ParquetKind::Utf8:
+            return TYPE_BYTE_ARRAY;
+    }
+    return TYPE_BYTE_ARRAY;
+}
+
+void appendLE32(std::string& out, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        out += static_cast<char>((value >> shift) & 0xFF);
+    }
+}
+
+void appendLE64(std::string& out, uint64_t value) {
+    for (int shift = 0; shift < 64; shift += 8) {
+        out += static_cast<char>((value >> shift) & 0xFF);
+    }
+}
+
+void appendDouble(std::string& out, double value) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    appendLE64(out, bits);
+}
+
+[[nodiscard]] std::optional<int64_t> parseInt64(std::string_view value) {
+    int64_t parsed = 0;
+    auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+    if (ec != std::errc{} || ptr != value.data() + value.size()) {
+        return std::nullopt;
+    }
+    return parsed;
+}
+
+[[nodiscard]] std::optional<double> parseDouble(std::string_view value) {
+    double parsed = 0.0;
+    auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+    if (ec != std::errc{} || ptr != value.data() + value.size()) {
+        return std::nullopt;
+    }
+    return parsed;
+}
+
+/// Data page v1 payload for one column over [rowBegin, rowEnd): bit-packed
+/// definition levels (4-byte length prefix, bit width 1) followed by
+/// PLAIN-encoded values for the non-null cells
+[[nodiscard]] std::string buildPageData(const ResultSet& data, size_t colIdx, size_t rowBegin, size_t rowEnd, ParquetKind kind) {
+    auto numRows = rowEnd - rowBegin;
+    std::vector<uint8_t> defined(numRows, 0);
+    std::string values;
+    uint8_t boolByte = 0;
+    int boolBits = 0;
+
+    for (size_t i = 0; i < numRows; ++i) {
+        const auto& row = data.rows[rowBegin + i];
+        if (colIdx >= row.values.size()) {
+            continue;
+        }
+        const auto& cell = row.values[colIdx];
+        if (cell.empty()) {
+            continue;
+        }
+
+        switch (kind) {
+            case ParquetKind::Boolean:
+                if (cell == "1" || cell == "true") {
+                    boolByte |= static_cast<uint8_t>(1 << boolBits);
+                }
+                if (++boolBits == 8) {
+                    values += static_cast<char>(boolByte);
+                    boolByte = 0;
+                    boolBits = 0;
+                }
+                defined[i] = 1;
+                break;
+            case ParquetKind::Int64:
+                if (auto parsed = parseInt64(cell)) {
+                    appendLE64(values, static_cast<uint64_t>(*parsed));
+                    defined[i] = 1;
+                }
+                break;
+            case ParquetKind::Double:
+                if (auto parsed = parseDouble(cell)) {
+                    appendDouble(values, *parsed);
+                    defined[i] = 1;
+                }
+                break;
+            case ParquetKind::Utf8:
+                appendLE32(values, static_cast<uint32_t>(cell.size()));
+                values += cell;
+                defined[i] = 1;
+                break;
+        }
+    }
+    if (boolBits > 0) {
+        values += static_cast<char>(boolByte);
+    }
+
+    // RLE/bit-packed hybrid, one bit-packed run covering every level
+    std::string levels;
+    auto groups = (numRows + 7) / 8;
+    auto header = static_cast<uint64_t>((groups << 1) | 1);
+    while (header >= 0x80) {
+        levels += static_cast<char>((header & 0x7F) | 0x80);
+        header >>= 7;
+    }
+    levels += static_cast<char>(header);
+    for (size_t group = 0; group < groups; ++group) {
+        uint8_t packed = 0;
+        for (size_t bit = 0; bit < 8; ++bit) {
+            auto i = group * 8 + bit;
+            if (i < numRows && defined[i]) {
+                packed |= static_cast<uint8_t>(1 << bit);
+            }
+        }
+        levels += static_cast<char>(packed);
+    }
+
+    std::string page;
+    page.reserve(4 + levels.size() + values.size());
+    appendLE32(page, static_cast<uint32_t>(levels.size()));
+    page += levels;
+    page += values;
+    return page;
+}
+
+[[nodiscard]] std::string buildPageHeader(size_t pageDataSize, size_t numValues) {
+    std::string out;
+    CompactWriter writer(out);
+    writer.beginStruct();
+    writer.i32Field(1, PAGE_TYPE_DATA);
+    writer.i32Field(2, static_cast<int32_t>(pageDataSize));
+    writer.i32Field(3, static_cast<int32_t>(pageDataSize));
+    writer.structField(5);  // data_page_header
+    writer.i32Field(1, static_cast<int32_t>(numValues));
+    writer.i32Field(2, ENCODING_PLAIN);
+    writer.i32Field(3, ENCODING_RLE);
+    writer.i32Field(4, ENCODING_RLE);
+    writer.endStruct();
+    writer.endStruct();
+    return out;
+}
+
+struct ColumnChunkLayout {
+    int64_t dataPageOffset = 0;
+    int64_t totalBytes = 0;
+    int64_t numValues = 0;
+};
+
+struct RowGroupLayout {
+    std::vector<ColumnChunkLayout> chunks;
+    int64_t totalBytes = 0;
+    int64_t numRows = 0;
+};
+
+[[nodiscard]] std::string buildFileMetaData(const ResultSet& data, const std::vector<ParquetKind>& kinds, const std::vector<RowGroupLayout>& rowGroups) {
+    std::string out;
+    CompactWriter writer(out);
+    writer.beginStruct();
+    writer.i32Field(1, 1);  // version
+
+    writer.listField(2, CT_STRUCT, data.columns.size() + 1);
+    writer.beginStruct();  // root schema element
+    writer.stringField(4, "schema");
+    writer.i32Field(5, static_cast<int32_t>(data.columns.size()));
+    writer.endStruct();
+    for (size_t colIdx = 0; colIdx < data.columns.size(); ++colIdx) {
+        writer.beginStruct();
+        writer.i32Field(1, physicalType(kinds[colIdx]));
+        writer.i32Field(3, REPETITION_OPTIONAL);
+        writer.stringField(4, data.columns[colIdx].name);
+        if (kinds[colIdx] == ParquetKind::Utf8) {
+            writer.i32Field(6, CONVERTED_TYPE_UTF8);
+        }
+        writer.endStruct();
+    }
+
+    writer.i64Field(3, static_cast<int64_t>(data.rows.size()));
+
+    writer.listField(4, CT_STRUCT, rowGroups.size());
+    for (const auto& rowGroup : rowGroups) {
+        writer.beginStruct();
+        writer.listField(1, CT_STRUCT, rowGroup.chunks.size());
+        for (size_t colIdx = 0; colIdx < rowGroup.chunks.size(); ++colIdx) {
+            const auto& chunk = rowGroup.chunks[colIdx];
+            writer.beginStruct();
+            writer.i64Field(2, chunk.dataPageOffset);  // file_offset
+            writer.structField(3);                     // meta_data
+            writer.i32Field(1, physicalType(kinds[colIdx]));
+            writer.listField(2, CT_I32, 2);
+            writer.listI32Element(ENCODING_PLAIN);
+            writer.listI32Element(ENCODING_RLE);
+            writer.listField(3, CT_BINARY, 1);
+            writer.listStringElement(data.columns[colIdx].name);
+            writer.i32Field(4, CODEC_UNCOMPRESSED);
+            writer.i64Field(5, chunk.numValues);
+            writer.i64Field(6, chunk.totalBytes);
+            writer.i64Field(7, chunk.totalBytes);
+            writer.i64Field(9, chunk.dataPageOffset);
+            writer.endStruct();
+            writer.endStruct();
+        }
+        writer.i64Field(2, rowGroup.totalBytes);
+        writer.i64Field(3, rowGroup.numRows);
+        writer.endStruct();
+    }
+
+    writer.stringField(6, "Velocity-DB");  // created_by
+    writer.endStruct();
+    return out;
+}
+
+}  // namespace
+
+bool ParquetExporter::exportData(const ResultSet& data, const std::string& filepath) {
+    return exportData(data, filepath, ExportOptions());
+}
+
+bool ParquetExporter::exportData(const ResultSet& data, const std::string& filepath, [[maybe_unused]] const ExportOptions& options) {
+    std::ofstream file(filepath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::vector<ParquetKind> kinds;
+    kinds.reserve(data.columns.size());
+    for (const auto& col : data.columns) {
+        kinds.push_back(kindForColumnType(col.type));
+    }
+
+    size_t offset = 0;
+    auto write = [&](std::string_view bytes) {
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        offset += bytes.size();
+    };
+
+    write(PARQUET_MAGIC);
+
+    std::vector<RowGroupLayout> rowGroups;
+    for (size_t rowBegin = 0; rowBegin < data.rows.size(); rowBegin += m_rowGroupRows) {
+        auto rowEnd = (std::min)(rowBegin + m_rowGroupRows, data.rows.size());
+        RowGroupLayout rowGroup;
+        rowGroup.numRows = static_cast<int64_t>(rowEnd - rowBegin);
+
+        for (size_t colIdx = 0; colIdx < data.columns.size(); ++colIdx) {
+            auto pageData = buildPageData(data, colIdx, rowBegin, rowEnd, kinds[colIdx]);
+            auto pageHeader = buildPageHeader(pageData.size(), rowEnd - rowBegin);
+
+            ColumnChunkLayout chunk{
+                .dataPageOffset = static_cast<int64_t>(offset),
+                .totalBytes = static_cast<int64_t>(pageHeader.size() + pageData.size()),
+                .numValues = static_cast<int64_t>(rowEnd - rowBegin),
+            };
+            write(pageHeader);
+            write(pageData);
+
+            rowGroup.totalBytes += chunk.totalBytes;
+            rowGroup.chunks.push_back(chunk);
+        }
+        rowGroups.push_back(std::move(rowGroup));
+    }
+
+    auto metadata = buildFileMetaData(data, kinds, rowGroups);
+    write(metadata);
+
+    std::string trailer;
+    appendLE32(trailer, static_cast<uint32_t>(metadata.size()));
+    trailer += PARQUET_MAGIC;
+    write(trailer);
+
+    return file.good();
+}
+
+}  // namespace velocitydb
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "data_exporter.h"
+
+namespace velocitydb {
+
+/// Writes result sets as Apache Parquet files so analysts can load exports
+/// directly into DuckDB / pandas with types intact. The writer is
+/// self-contained (Thrift compact footer, PLAIN-encoded pages, no external
+/// library): BIT maps to BOOLEAN, integer types to INT64, decimal types to
+/// DOUBLE, and everything else to UTF8 byte arrays. All columns are
+/// nullable; empty cells and unparseable numerics become nulls. Rows are
+/// split into row groups so downstream scans can parallelize and skip.
+class ParquetExporter : public DataExporter {
+public:
+    ParquetExporter() = default;
+    ~ParquetExporter() override = default;
+
+    bool exportData(const ResultSet& data, const std::string& filepath) override;
+    bool exportData(const ResultSet& data, const std::string& filepath, const ExportOptions& options) override;
+
+    /// Rows per row group. Smaller groups improve scan parallelism and
+    /// predicate skipping at the cost of per-group metadata overhead.
+    void setRowGroupRows(size_t rows) { m_rowGroupRows = rows > 0 ? rows : DEFAULT_ROW_GROUP_ROWS; }
+
+    static constexpr size_t DEFAULT_ROW_GROUP_ROWS = 100000;
+
+private:
+    size_t m_rowGroupRows = DEFAULT_ROW_GROUP_ROWS;
+};
+
+}  // namespace velocitydb
@@ -0,0 +1,133 @@
+#include "pipelined_file_writer.h"
+
+#include <Windows.h>
+
+#include <compressapi.h>
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace velocitydb {
+
+namespace {
+
+constexpr char FILE_MAGIC[4] = {'V', 'D', 'B', 'Z'};
+constexpr uint8_t FORMAT_VERSION = 1;
+constexpr uint8_t ALGORITHM_XPRESS_HUFF = 1;
+
+}  // namespace
+
+PipelinedFileWriter::PipelinedFileWriter(const std::string& filepath, bool compress) : m_file(filepath, std::ios::binary), m_compress(compress) {
+    m_open = m_file.is_open();
+    if (!m_open) {
+        return;
+    }
+
+    if (m_compress) {
+        m_file.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+        m_file.put(static_cast<char>(FORMAT_VERSION));
+        m_file.put(static_cast<char>(ALGORITHM_XPRESS_HUFF));
+        m_worker = std::thread([this] { compressLoop(); });
+    }
+}
+
+PipelinedFileWriter::~PipelinedFileWriter() {
+    if (!m_finished) {
+        static_cast<void>(finish());
+    }
+}
+
+void PipelinedFileWriter::write(std::string block) {
+    if (!m_open || block.empty() || m_failed.load()) {
+        return;
+    }
+
+    if (!m_compress) {
+        m_file.write(block.data(), static_cast<std::streamsize>(block.size()));
+        return;
+    }
+
+    std::unique_lock lock(m_mutex);
+    m_spaceAvailable.wait(lock, [this] { return m_queue.size() < QUEUE_CAPACITY || m_stopping; });
+    if (m_stopping) {
+        return;
+    }
+    m_queue.push_back(std::move(block));
+    m_workAvailable.notify_one();
+}
+
+bool PipelinedFileWriter::finish() {
+    m_finished = true;
+
+    if (m_worker.joinable()) {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_workAvailable.notify_one();
+        m_spaceAvailable.notify_all();
+        m_worker.join();
+    }
+
+    if (m_open) {
+        m_file.flush();
+        m_file.close();
+    }
+    return m_open && !m_failed.load() && m_file.good();
+}
+
+void PipelinedFileWriter::compressLoop() {
+    // On any failure the loop also flips m_stopping so a producer blocked
+    // on a full queue wakes up instead of waiting forever
+    auto fail = [this] {
+        m_failed.store(true);
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_spaceAvailable.notify_all();
+    };
+
+    COMPRESSOR_HANDLE compressor = nullptr;
+    if (!CreateCompressor(COMPRESS_ALGORITHM_XPRESS_HUFF, nullptr, &compressor)) {
+        fail();
+        return;
+    }
+
+    std::string compressed;
+    while (true) {
+        std::string block;
+        {
+            std::unique_lock lock(m_mutex);
+            m_workAvailable.wait(lock, [this] { return !m_queue.empty() || m_stopping; });
+            if (m_queue.empty()) {
+                break;  // Stopping with everything drained
+            }
+            block = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        m_spaceAvailable.notify_one();
+
+        // Two-call pattern: size query, then the actual compression
+        SIZE_T compressedSize = 0;
+        Compress(compressor, block.data(), block.size(), nullptr, 0, &compressedSize);
+        compressed.resize(compressedSize);
+        if (!Compress(compressor, block.data(), block.size(), compressed.data(), compressed.size(), &compressedSize)) {
+            fail();
+            break;
+        }
+
+        uint32_t sizes[2] = {static_cast<uint32_t>(compressedSize), static_cast<uint32_t>(block.size())};
+        m_file.write(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+        m_file.write(compressed.data(), static_cast<std::streamsize>(compressedSize));
+        if (!m_file.good()) {
+            fail();
+            break;
+        }
+    }
+
+    CloseCompressor(compressor);
+}
+
+}  // namespace velocitydb
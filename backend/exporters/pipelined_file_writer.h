@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace velocitydb {
+
+/// Two-stage file sink for export pipelines: the producer thread hands
+/// over filled blocks, a dedicated worker compresses and writes them,
+/// so compression and disk/network I/O overlap row formatting. The
+/// queue is bounded so formatting can never run unbounded ahead of a
+/// slow share.
+///
+/// Compressed files use the Windows Compression API (XPRESS+Huffman,
+/// the same codec as the result cache): a "VDBZ" + version + algorithm
+/// header, then per block a u32 compressed size, u32 uncompressed size
+/// and the block bytes. With compression off, writes go straight to the
+/// file on the calling thread.
+class PipelinedFileWriter {
+public:
+    PipelinedFileWriter(const std::string& filepath, bool compress);
+    ~PipelinedFileWriter();
+
+    PipelinedFileWriter(const PipelinedFileWriter&) = delete;
+    PipelinedFileWriter& operator=(const PipelinedFileWriter&) = delete;
+
+    [[nodiscard]] bool isOpen() const noexcept { return m_open; }
+
+    /// Hand a filled block to the pipeline. Blocks the caller while the
+    /// queue is full; the block is consumed.
+    void write(std::string block);
+
+    /// Drains the pipeline and closes the file. Returns overall success;
+    /// further writes are not allowed.
+    [[nodiscard]] bool finish();
+
+private:
+    void compressLoop();
+
+    // Blocks the formatter may run ahead of the compressor; at 4MB
+    // blocks this caps pipeline memory at ~16MB
+    static constexpr size_t QUEUE_CAPACITY = 4;
+
+    std::ofstream m_file;
+    bool m_open = false;
+    bool m_compress = false;
+    bool m_finished = false;
+    std::atomic<bool> m_failed{false};
+
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_spaceAvailable;
+    std::deque<std::string> m_queue;
+    bool m_stopping = false;
+    std::thread m_worker;
+};
+
+}  // namespace velocitydb
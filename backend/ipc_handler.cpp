@@ -1,8 +1,10 @@
 #include "ipc_handler.h"
 
+#include "contexts/export_context.h"
 #include "contexts/settings_context.h"
 #include "contexts/utility_context.h"
 #include "database/async_query_executor.h"
+#include "database/columnar_result.h"
 #include "database/connection_pool.h"
 #include "database/odbc_driver_detector.h"
 #include "database/query_history.h"
@@ -13,22 +15,35 @@
 #include "exporters/csv_exporter.h"
 #include "exporters/excel_exporter.h"
 #include "exporters/json_exporter.h"
+#include "exporters/parquet_exporter.h"
 #include "network/ssh_tunnel.h"
 #include "parsers/a5er_parser.h"
+#include "parsers/completion_index.h"
 #include "parsers/sql_formatter.h"
 #include "parsers/sql_parser.h"
 #include "simdjson.h"
+#include "exporters/ddl_exporter.h"
+#include "utils/binary_frame.h"
 #include "utils/file_dialog.h"
+#include "utils/file_utils.h"
 #include "utils/global_search.h"
 #include "utils/json_utils.h"
 #include "utils/logger.h"
+#include "utils/memory_budget.h"
+#include "utils/response_arena.h"
+#include "utils/result_aggregator.h"
+#include "utils/result_diff.h"
 #include "utils/session_manager.h"
 #include "utils/settings_manager.h"
 #include "utils/simd_filter.h"
+#include "utils/metrics.h"
+#include "utils/trace.h"
 
+#include <algorithm>
 #include <chrono>
 #include <format>
 #include <fstream>
+#include <optional>
 
 using namespace std::literals;
 
@@ -36,6 +51,27 @@ namespace velocitydb {
 
 namespace {
 
+/// Reusable per-thread parsers: simdjson keeps its internal buffers alive
+/// across parses, so steady-state dispatch allocates nothing for parsing.
+/// One instance per nesting level because two live documents cannot share a
+/// parser - the envelope document must survive while a handler parses its
+/// params, and the params document must survive the extract* helpers below
+/// parsing theirs.
+[[nodiscard]] simdjson::dom::parser& envelopeParser() {
+    static thread_local simdjson::dom::parser parser;
+    return parser;
+}
+
+[[nodiscard]] simdjson::dom::parser& paramsParser() {
+    static thread_local simdjson::dom::parser parser;
+    return parser;
+}
+
+[[nodiscard]] simdjson::dom::parser& helperParser() {
+    static thread_local simdjson::dom::parser parser;
+    return parser;
+}
+
 struct SshConnectionParams {
     bool enabled = false;
     std::string host;
@@ -47,8 +83,6 @@ struct SshConnectionParams {
     std::string keyPassphrase;
 };
 
-enum class DbType { SQLServer, PostgreSQL, MySQL };
-
 struct DatabaseConnectionParams {
     std::string server;
     std::string database;
@@ -120,8 +154,7 @@ struct DatabaseConnectionParams {
 
 [[nodiscard]] std::expected<DatabaseConnectionParams, std::string> extractConnectionParams(std::string_view jsonParams) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(jsonParams);
+        simdjson::dom::element doc = helperParser().parse(jsonParams);
 
         DatabaseConnectionParams result;
         auto serverResult = doc["server"].get_string();
@@ -191,8 +224,7 @@ struct DatabaseConnectionParams {
 
 [[nodiscard]] std::expected<std::string, std::string> extractConnectionId(std::string_view jsonParams) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(jsonParams);
+        simdjson::dom::element doc = helperParser().parse(jsonParams);
         auto result = doc["connectionId"].get_string();
         if (result.error()) {
             return std::unexpected("Missing connectionId field");
@@ -203,29 +235,237 @@ struct DatabaseConnectionParams {
     }
 }
 
+// How many alphabetical neighbors on each side of an expanded table get
+// their metadata warmed speculatively
+constexpr size_t PREFETCH_NEIGHBORS = 2;
+
+/// Catalog query behind getTableMetadata. Shared with the neighbor
+/// prefetch so speculative and on-demand fetches produce identical cache
+/// keys.
+[[nodiscard]] std::string buildTableMetadataQuery(std::string_view tableName) {
+    return std::format(R"(
+            SELECT
+                OBJECT_SCHEMA_NAME(o.object_id) AS SchemaName,
+                o.name AS TableName,
+                o.type_desc AS ObjectType,
+                ISNULL(p.rows, 0) AS RowCount,
+                CONVERT(varchar, o.create_date, 120) AS CreatedAt,
+                CONVERT(varchar, o.modify_date, 120) AS ModifiedAt,
+                ISNULL(USER_NAME(o.principal_id), 'dbo') AS Owner,
+                ISNULL(ep.value, '') AS Comment
+            FROM sys.objects o
+            LEFT JOIN sys.partitions p ON o.object_id = p.object_id AND p.index_id IN (0, 1)
+            LEFT JOIN sys.extended_properties ep ON ep.major_id = o.object_id AND ep.minor_id = 0 AND ep.name = 'MS_Description'
+            WHERE o.object_id = OBJECT_ID('{}')
+        )",
+                       JsonUtils::escapeString(tableName));
+}
+
+// Serializes one bookmark entry. The refresh fields are emitted only when
+// the bookmark opted into cache warming, so plain entries stay in the shape
+// older builds wrote.
+void appendBookmarkJson(std::string& json, std::string_view id, std::string_view name, std::string_view content, std::string_view connectionId, int64_t refreshIntervalSeconds) {
+    json += std::format("{{\"id\":\"{}\",\"name\":\"{}\",\"content\":\"{}\"", id, name, content);
+    if (refreshIntervalSeconds > 0 && !connectionId.empty()) {
+        json += std::format(",\"connectionId\":\"{}\",\"refreshIntervalSeconds\":{}", connectionId, refreshIntervalSeconds);
+    }
+    json += "}";
+}
+
+// Recursively parses the compound filter tree of a filterResultSet
+// request: {"combine":"and"|"or","conditions":[{columnIndex, filterType,
+// filterValue, filterValueMax?}],"groups":[...]}. False on any malformed
+// node or out-of-range column.
+bool parseCompoundFilter(simdjson::dom::element node, size_t columnCount, SIMDFilter::CompoundFilter& out) {
+    if (auto combine = node["combine"].get_string(); !combine.error() && combine.value() == "or") {
+        out.combine = SIMDFilter::CompoundFilter::Combine::Or;
+    }
+
+    if (auto conditions = node["conditions"].get_array(); !conditions.error()) {
+        for (auto entry : conditions.value()) {
+            auto columnIndex = entry["columnIndex"].get_uint64();
+            auto filterType = entry["filterType"].get_string();
+            auto filterValue = entry["filterValue"].get_string();
+            if (columnIndex.error() || filterType.error() || filterValue.error() || columnIndex.value() >= columnCount) {
+                return false;
+            }
+
+            SIMDFilter::FilterCondition condition;
+            condition.columnIndex = columnIndex.value();
+            condition.value = std::string(filterValue.value());
+            if (filterType.value() == "equals") {
+                condition.op = SIMDFilter::FilterCondition::Op::Equals;
+            } else if (filterType.value() == "contains") {
+                condition.op = SIMDFilter::FilterCondition::Op::Contains;
+            } else if (filterType.value() == "range") {
+                condition.op = SIMDFilter::FilterCondition::Op::Range;
+                if (auto maxValue = entry["filterValueMax"].get_string(); !maxValue.error()) {
+                    condition.valueMax = std::string(maxValue.value());
+                }
+            } else {
+                return false;
+            }
+            out.conditions.push_back(std::move(condition));
+        }
+    }
+
+    if (auto groups = node["groups"].get_array(); !groups.error()) {
+        for (auto child : groups.value()) {
+            SIMDFilter::CompoundFilter subGroup;
+            if (!parseCompoundFilter(child, columnCount, subGroup)) {
+                return false;
+            }
+            out.groups.push_back(std::move(subGroup));
+        }
+    }
+
+    return true;
+}
+
 }  // namespace
 
 IPCHandler::IPCHandler()
     : m_settingsContext(std::make_unique<SettingsContext>())
     , m_utilityContext(std::make_unique<UtilityContext>())
+    , m_exportContext(std::make_unique<ExportContext>())
     , m_connectionPool(std::make_unique<ConnectionPool>())
     , m_schemaInspector(std::make_unique<SchemaInspector>())
     , m_queryHistory(std::make_unique<QueryHistory>())
     , m_resultCache(std::make_unique<ResultCache>())
     , m_asyncExecutor(std::make_unique<AsyncQueryExecutor>()) {
     registerRequestRoutes();
+
+    // Replay the append-only history log beside settings.json; failure
+    // just means history starts empty this session
+    static_cast<void>(m_queryHistory->openLog((m_settingsContext->settingsManager().getSettingsPath().parent_path() / "query_history.ndjson").string()));
+
+    // Schema trees hydrated last session come back instantly; a background
+    // stamp check confirms them on first expand
+    m_schemaInspector->loadSnapshot(m_settingsContext->settingsManager().getSettingsPath().parent_path() / "schema_snapshot.json");
+
+    MemoryBudget::instance().setBudgetBytes(static_cast<size_t>(m_settingsContext->settingsManager().getSettings()->general.memoryBudgetMb) * 1024 * 1024);
+
+    m_asyncExecutor->setDefaultTimeout(std::chrono::seconds(m_settingsContext->settingsManager().getSettings()->general.queryTimeoutSeconds));
+
+    // Seed the ODBC driver cache from settings; a first run scans on a
+    // background thread and persists the result for the next startup.
+    initializeDriverDetection(m_settingsContext->settingsManager().getDetectedOdbcDriver(), [this](const std::string& driverName) {
+        m_settingsContext->settingsManager().setDetectedOdbcDriver(driverName);
+        static_cast<void>(m_settingsContext->settingsManager().save());
+    });
+
+    warmLastUsedProfile();
+
+    // Bookmarks that opted into cache warming start refreshing as soon as
+    // the handler is up, so the first manual run of the day is already warm
+    loadBookmarkRefreshSchedule();
+    m_bookmarkRefreshWorker = std::jthread([this] { bookmarkRefreshLoop(); });
+}
+
+IPCHandler::~IPCHandler() {
+    // The startup driver scan's completion callback touches the settings
+    // context; make sure it has finished before members are torn down
+    shutdownDriverDetection();
+
+    // The bookmark refresh worker executes on pool connections and writes
+    // into the result cache; stop it before either is torn down
+    {
+        std::lock_guard lock(m_bookmarkRefreshMutex);
+        m_bookmarkRefreshStopping = true;
+    }
+    m_bookmarkRefreshWake.notify_all();
+    if (m_bookmarkRefreshWorker.joinable()) {
+        m_bookmarkRefreshWorker.join();
+    }
+
+    // The metadata prefetch worker writes into the result cache; it must
+    // not outlive it
+    if (m_prefetchThread.joinable()) {
+        m_prefetchThread.join();
+    }
+
+    // Snapshot validation writes into the schema cache; join it before
+    // persisting the cache for the next startup
+    if (m_schemaRefreshThread.joinable()) {
+        m_schemaRefreshThread.join();
+    }
+    m_schemaInspector->saveSnapshot(m_settingsContext->settingsManager().getSettingsPath().parent_path() / "schema_snapshot.json");
+}
+
+void IPCHandler::setSharedBufferSink(std::function<bool(std::vector<uint8_t>& frame, std::string_view additionalDataJson)> sink) {
+    m_sharedBufferSink = std::move(sink);
 }
 
-IPCHandler::~IPCHandler() = default;
+void IPCHandler::setEventSink(std::function<void(std::string_view payload)> sink) {
+    m_eventSink = std::move(sink);
+
+    m_asyncExecutor->setCompletionCallback([this](const std::string& queryId, QueryStatus status) {
+        if (!m_eventSink) {
+            return;
+        }
+
+        std::string_view statusStr;
+        switch (status) {
+            case QueryStatus::Completed:
+                statusStr = "completed";
+                break;
+            case QueryStatus::Cancelled:
+                statusStr = "cancelled";
+                break;
+            case QueryStatus::Failed:
+                statusStr = "failed";
+                break;
+            case QueryStatus::Pending:
+            case QueryStatus::Running:
+                return;  // Only terminal states are pushed
+        }
+
+        m_eventSink(std::format(R"({{"event":"queryCompleted","queryId":"{}","status":"{}"}})", queryId, statusStr));
+    });
+
+    m_exportContext->setExportProgressCallback([this](const ExportJobState& state) {
+        if (!m_eventSink) {
+            return;
+        }
+        std::string_view statusStr;
+        switch (state.status) {
+            case ExportJobStatus::Pending:
+                return;  // Nothing useful to show yet
+            case ExportJobStatus::Running:
+                statusStr = "running";
+                break;
+            case ExportJobStatus::Completed:
+                statusStr = "completed";
+                break;
+            case ExportJobStatus::Cancelled:
+                statusStr = "cancelled";
+                break;
+            case ExportJobStatus::Failed:
+                statusStr = "failed";
+                break;
+        }
+        m_eventSink(std::format(R"({{"event":"exportProgress","jobId":"{}","status":"{}","rowsWritten":{},"error":"{}"}})", state.jobId, statusStr, state.rowsWritten, JsonUtils::escapeString(state.errorMessage)));
+    });
+}
 
 void IPCHandler::registerRequestRoutes() {
+    m_requestRoutes["batch"] = [this](std::string_view p) { return dispatchBatch(p); };
     m_requestRoutes["connect"] = [this](std::string_view p) { return openDatabaseConnection(p); };
     m_requestRoutes["disconnect"] = [this](std::string_view p) { return closeDatabaseConnection(p); };
     m_requestRoutes["testConnection"] = [this](std::string_view p) { return verifyDatabaseConnection(p); };
+    m_requestRoutes["refreshDrivers"] = [this](std::string_view p) { return refreshDetectedDrivers(p); };
+    m_requestRoutes["connectAsync"] = [this](std::string_view p) { return openDatabaseConnectionAsync(p); };
+    m_requestRoutes["getAsyncConnectResult"] = [this](std::string_view p) { return getAsyncConnectResult(p); };
     m_requestRoutes["executeQuery"] = [this](std::string_view p) { return executeSQL(p); };
+    m_requestRoutes["executeQueryBinary"] = [this](std::string_view p) { return executeSQLBinary(p); };
+    m_requestRoutes["executeQueryChunked"] = [this](std::string_view p) { return executeSQLChunked(p); };
     m_requestRoutes["executeQueryPaginated"] = [this](std::string_view p) { return executeSQLPaginated(p); };
     m_requestRoutes["getRowCount"] = [this](std::string_view p) { return getRowCount(p); };
+    m_requestRoutes["executeBulk"] = [this](std::string_view p) { return executeBulkDML(p); };
     m_requestRoutes["cancelQuery"] = [this](std::string_view p) { return cancelRunningQuery(p); };
+    m_requestRoutes["openCursor"] = [this](std::string_view p) { return openCursor(p); };
+    m_requestRoutes["fetchCursorChunk"] = [this](std::string_view p) { return fetchCursorChunk(p); };
+    m_requestRoutes["closeCursor"] = [this](std::string_view p) { return closeCursor(p); };
     m_requestRoutes["getTables"] = [this](std::string_view p) { return fetchTableList(p); };
     m_requestRoutes["getColumns"] = [this](std::string_view p) { return fetchColumnDefinitions(p); };
     m_requestRoutes["getDatabases"] = [this](std::string_view p) { return fetchDatabaseList(p); };
@@ -233,20 +473,36 @@ void IPCHandler::registerRequestRoutes() {
     m_requestRoutes["commit"] = [this](std::string_view p) { return commitTransaction(p); };
     m_requestRoutes["rollback"] = [this](std::string_view p) { return rollbackTransaction(p); };
     m_requestRoutes["exportCSV"] = [this](std::string_view p) { return exportToCSV(p); };
+    m_requestRoutes["exportDatabaseDDL"] = [this](std::string_view p) { return exportDatabaseDDL(p); };
+    m_requestRoutes["startExportJob"] = [this](std::string_view p) { return startExportJob(p); };
+    m_requestRoutes["exportTable"] = [this](std::string_view p) { return exportTable(p); };
+    m_requestRoutes["getExportJobStatus"] = [this](std::string_view p) { return getExportJobStatus(p); };
+    m_requestRoutes["cancelExportJob"] = [this](std::string_view p) { return cancelExportJob(p); };
+    m_requestRoutes["removeExportJob"] = [this](std::string_view p) { return removeExportJob(p); };
     m_requestRoutes["exportJSON"] = [this](std::string_view p) { return exportToJSON(p); };
     m_requestRoutes["exportExcel"] = [this](std::string_view p) { return exportToExcel(p); };
+    m_requestRoutes["exportParquet"] = [this](std::string_view p) { return exportToParquet(p); };
     m_requestRoutes["formatSQL"] = [this](std::string_view p) { return formatSQLQuery(p); };
     m_requestRoutes["uppercaseKeywords"] = [this](std::string_view p) { return uppercaseKeywords(p); };
+    m_requestRoutes["updateEditorBuffer"] = [this](std::string_view p) { return updateEditorBuffer(p); };
+    m_requestRoutes["getCompletionContext"] = [this](std::string_view p) { return getCompletionContext(p); };
+    m_requestRoutes["closeEditorBuffer"] = [this](std::string_view p) { return closeEditorBuffer(p); };
     m_requestRoutes["parseA5ER"] = [this](std::string_view p) { return parseA5ERFile(p); };
     m_requestRoutes["getQueryHistory"] = [this](std::string_view p) { return retrieveQueryHistory(p); };
+    m_requestRoutes["getQueryStatistics"] = [this](std::string_view p) { return getQueryStatistics(p); };
     m_requestRoutes["getExecutionPlan"] = [this](std::string_view p) { return getExecutionPlan(p); };
+    m_requestRoutes["getExecutionPlanResult"] = [this](std::string_view p) { return getExecutionPlanResult(p); };
     m_requestRoutes["getCacheStats"] = [this](std::string_view p) { return getCacheStats(p); };
     m_requestRoutes["clearCache"] = [this](std::string_view p) { return clearCache(p); };
     m_requestRoutes["executeAsyncQuery"] = [this](std::string_view p) { return executeAsyncQuery(p); };
     m_requestRoutes["getAsyncQueryResult"] = [this](std::string_view p) { return getAsyncQueryResult(p); };
+    m_requestRoutes["getResultRows"] = [this](std::string_view p) { return getResultRows(p); };
     m_requestRoutes["cancelAsyncQuery"] = [this](std::string_view p) { return cancelAsyncQuery(p); };
     m_requestRoutes["getActiveQueries"] = [this](std::string_view p) { return getActiveQueries(p); };
     m_requestRoutes["filterResultSet"] = [this](std::string_view p) { return filterResultSet(p); };
+    m_requestRoutes["aggregateResultSet"] = [this](std::string_view p) { return aggregateResultSet(p); };
+    m_requestRoutes["diffResultSets"] = [this](std::string_view p) { return diffResultSets(p); };
+    m_requestRoutes["sortResultSet"] = [this](std::string_view p) { return sortResultSet(p); };
     m_requestRoutes["getSettings"] = [this](std::string_view p) { return getSettings(p); };
     m_requestRoutes["updateSettings"] = [this](std::string_view p) { return updateSettings(p); };
     m_requestRoutes["getConnectionProfiles"] = [this](std::string_view p) { return getConnectionProfiles(p); };
@@ -257,6 +513,7 @@ void IPCHandler::registerRequestRoutes() {
     m_requestRoutes["getSshKeyPassphrase"] = [this](std::string_view p) { return getSshKeyPassphrase(p); };
     m_requestRoutes["getSessionState"] = [this](std::string_view p) { return getSessionState(p); };
     m_requestRoutes["saveSessionState"] = [this](std::string_view p) { return saveSessionState(p); };
+    m_requestRoutes["getSessionTabContent"] = [this](std::string_view p) { return getSessionTabContent(p); };
     m_requestRoutes["searchObjects"] = [this](std::string_view p) { return searchObjects(p); };
     m_requestRoutes["quickSearch"] = [this](std::string_view p) { return quickSearch(p); };
     m_requestRoutes["getIndexes"] = [this](std::string_view p) { return fetchIndexes(p); };
@@ -265,6 +522,7 @@ void IPCHandler::registerRequestRoutes() {
     m_requestRoutes["getReferencingForeignKeys"] = [this](std::string_view p) { return fetchReferencingForeignKeys(p); };
     m_requestRoutes["getTriggers"] = [this](std::string_view p) { return fetchTriggers(p); };
     m_requestRoutes["getTableMetadata"] = [this](std::string_view p) { return fetchTableMetadata(p); };
+    m_requestRoutes["getDatabaseSchema"] = [this](std::string_view p) { return fetchDatabaseSchema(p); };
     m_requestRoutes["getTableDDL"] = [this](std::string_view p) { return fetchTableDDL(p); };
     m_requestRoutes["writeFrontendLog"] = [this](std::string_view p) { return writeFrontendLog(p); };
     m_requestRoutes["saveQueryToFile"] = [this](std::string_view p) { return saveQueryToFile(p); };
@@ -273,12 +531,14 @@ void IPCHandler::registerRequestRoutes() {
     m_requestRoutes["getBookmarks"] = [this](std::string_view p) { return getBookmarks(p); };
     m_requestRoutes["saveBookmark"] = [this](std::string_view p) { return saveBookmark(p); };
     m_requestRoutes["deleteBookmark"] = [this](std::string_view p) { return deleteBookmark(p); };
+    m_requestRoutes["setTraceEnabled"] = [this](std::string_view p) { return setTraceEnabled(p); };
+    m_requestRoutes["dumpTrace"] = [this](std::string_view p) { return dumpTrace(p); };
 }
 
 std::string IPCHandler::dispatchRequest(std::string_view request) {
+    VDB_TRACE_SPAN("ipc", "dispatchRequest");
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(request);
+        simdjson::dom::element doc = envelopeParser().parse(request);
 
         auto methodResult = doc["method"].get_string();
         if (methodResult.error()) [[unlikely]] {
@@ -286,13 +546,23 @@ std::string IPCHandler::dispatchRequest(std::string_view request) {
         }
         std::string_view method = methodResult.value();
 
-        std::string params;
+        // Both views point into the envelope parser's buffers and stay
+        // valid while the handler runs; no intermediate copies
+        std::string_view params;
         if (auto paramsResult = doc["params"].get_string(); !paramsResult.error()) {
-            params = std::string(paramsResult.value());
+            params = paramsResult.value();
         }
 
-        if (auto route = m_requestRoutes.find(std::string(method)); route != m_requestRoutes.end()) [[likely]] {
-            return route->second(params);
+        // Deferred-formatting record: a few nanoseconds here, rendered
+        // on the logger's drain thread (compiled out in release builds)
+        log<LogLevel::DEBUG>("[IPC] dispatch {}", method);
+
+        if (auto route = m_requestRoutes.find(method); route != m_requestRoutes.end()) [[likely]] {
+            // Per-method latency histogram; three relaxed increments
+            const auto dispatchStart = std::chrono::steady_clock::now();
+            auto response = route->second(params);
+            Metrics::instance().ipcMethod(method).record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - dispatchStart).count());
+            return response;
         }
 
         return JsonUtils::errorResponse(std::format("Unknown method: {}", method));
@@ -301,6 +571,111 @@ std::string IPCHandler::dispatchRequest(std::string_view request) {
     }
 }
 
+std::string IPCHandler::dispatchBatch(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto requestsResult = doc["requests"].get_array();
+        if (requestsResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: requests");
+        }
+
+        // Copy the sub-requests out first: handlers reuse the params parser,
+        // so the batch document does not survive the first sub-dispatch
+        struct SubRequest {
+            std::string method;
+            std::string params;
+        };
+        std::vector<SubRequest> subRequests;
+        for (auto item : requestsResult.value()) {
+            auto methodResult = item["method"].get_string();
+            if (methodResult.error()) [[unlikely]] {
+                return JsonUtils::errorResponse("Each batch entry needs a method field");
+            }
+            SubRequest sub{.method = std::string(methodResult.value()), .params = {}};
+            if (auto subParams = item["params"].get_string(); !subParams.error()) {
+                sub.params = std::string(subParams.value());
+            }
+            subRequests.push_back(std::move(sub));
+        }
+
+        log<LogLevel::DEBUG>(std::format("Dispatching batch of {} sub-requests", subRequests.size()));
+
+        // One marshal in, one out. Sub-requests run sequentially: the
+        // typical burst (table metadata on tab open) targets one connection
+        // whose ODBC session serializes the queries anyway, and handlers
+        // share unsynchronized state. Results keep request order; each entry
+        // is the sub-handler's full response including its success flag.
+        std::string combined;  // Not the arena - sub-handlers use it themselves
+        combined += R"({"results":[)";
+        for (size_t i = 0; i < subRequests.size(); ++i) {
+            if (i > 0)
+                combined += ',';
+            if (auto route = m_requestRoutes.find(subRequests[i].method); route != m_requestRoutes.end()) [[likely]] {
+                combined += route->second(subRequests[i].params);
+            } else {
+                combined += JsonUtils::errorResponse(std::format("Unknown method: {}", subRequests[i].method));
+            }
+        }
+        combined += "]}";
+
+        return JsonUtils::successResponse(combined);
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+void IPCHandler::warmLastUsedProfile() {
+    const auto& session = m_settingsContext->sessionManager().getState();
+    if (session.activeConnectionId.empty()) {
+        return;
+    }
+
+    auto profile = m_settingsContext->settingsManager().getConnectionProfile(session.activeConnectionId);
+    if (!profile) {
+        return;
+    }
+
+    // Tunneled profiles need interactive SSH setup and SQL-auth profiles
+    // without a saved password would fail the login, so neither can be
+    // pre-connected unattended.
+    if (profile->ssh.enabled || (!profile->useWindowsAuth && !profile->savePassword)) {
+        return;
+    }
+
+    ConnectionInfo info{
+        .id = profile->id,
+        .name = profile->name,
+        .server = profile->server,
+        .database = profile->database,
+        .username = profile->username,
+        .useWindowsAuth = profile->useWindowsAuth,
+    };
+
+    if (profile->port > 0 && info.server.find(',') == std::string::npos) {
+        info.server = std::format("{},{}", profile->server, profile->port);
+    }
+
+    if (profile->dbType == "postgresql") {
+        info.dbType = DbType::PostgreSQL;
+    } else if (profile->dbType == "mysql") {
+        info.dbType = DbType::MySQL;
+    }
+
+    if (!profile->useWindowsAuth) {
+        auto password = m_settingsContext->settingsManager().getProfilePassword(profile->id);
+        if (!password) {
+            return;
+        }
+        info.password = *password;
+    }
+
+    // Registration queues the warm-up on the pool's background worker, so
+    // startup never blocks on a login handshake.
+    m_connectionPool->registerProfile(info);
+    log<LogLevel::DEBUG>(std::format("[IPC] Warming last-used profile: {}", profile->id));
+}
+
 std::string IPCHandler::openDatabaseConnection(std::string_view params) {
     auto connectionParams = extractConnectionParams(params);
     if (!connectionParams) {
@@ -364,6 +739,117 @@ std::string IPCHandler::openDatabaseConnection(std::string_view params) {
     return JsonUtils::successResponse(std::format(R"({{"connectionId":"{}"}})", connectionId));
 }
 
+std::string IPCHandler::openDatabaseConnectionAsync(std::string_view params) {
+    auto connectionParams = extractConnectionParams(params);
+    if (!connectionParams) {
+        return JsonUtils::errorResponse(connectionParams.error());
+    }
+
+    auto pendingId = std::format("connect_{}", m_pendingConnectionIdCounter++);
+    auto pending = std::make_shared<PendingConnection>();
+
+    // Tunnel setup and ODBC login (up to SQL_ATTR_LOGIN_TIMEOUT each) run on
+    // a worker thread so the IPC dispatch thread returns immediately
+    DatabaseConnectionParams paramsCopy = *connectionParams;
+    pending->future = std::async(std::launch::async, [pending, paramsCopy = std::move(paramsCopy)]() {
+        try {
+            std::unique_ptr<SshTunnel> sshTunnel;
+            DatabaseConnectionParams effectiveParams = paramsCopy;
+
+            if (paramsCopy.ssh.enabled) {
+                sshTunnel = std::make_unique<SshTunnel>();
+
+                SshTunnelConfig sshConfig;
+                sshConfig.host = paramsCopy.ssh.host;
+                sshConfig.port = paramsCopy.ssh.port;
+                sshConfig.username = paramsCopy.ssh.username;
+                sshConfig.authMethod = (paramsCopy.ssh.authType == "privateKey") ? SshAuthMethod::PublicKey : SshAuthMethod::Password;
+                sshConfig.password = paramsCopy.ssh.password;
+                sshConfig.privateKeyPath = paramsCopy.ssh.privateKeyPath;
+                sshConfig.keyPassphrase = paramsCopy.ssh.keyPassphrase;
+
+                std::string remoteHost = paramsCopy.server;
+                int remotePort = 1433;
+                if (auto commaPos = remoteHost.find(','); commaPos != std::string::npos) {
+                    remotePort = std::stoi(remoteHost.substr(commaPos + 1));
+                    remoteHost = remoteHost.substr(0, commaPos);
+                }
+                sshConfig.remoteHost = remoteHost;
+                sshConfig.remotePort = remotePort;
+
+                auto result = sshTunnel->connect(sshConfig);
+                if (!result) {
+                    pending->errorMessage = std::format("SSH tunnel failed: {}", result.error().message);
+                    pending->status = PendingConnection::Status::Failed;
+                    return;
+                }
+
+                effectiveParams.server = std::format("127.0.0.1,{}", sshTunnel->getLocalPort());
+            }
+
+            auto odbcString = buildODBCConnectionString(effectiveParams);
+            auto driver = std::make_shared<SQLServerDriver>();
+            if (!driver->connect(odbcString)) {
+                pending->errorMessage = std::format("Connection failed: {}", driver->getLastError());
+                pending->status = PendingConnection::Status::Failed;
+                return;
+            }
+
+            pending->driver = std::move(driver);
+            pending->tunnel = std::move(sshTunnel);
+            pending->status = PendingConnection::Status::Connected;
+        } catch (const std::exception& e) {
+            pending->errorMessage = e.what();
+            pending->status = PendingConnection::Status::Failed;
+        }
+    });
+
+    m_pendingConnections[pendingId] = std::move(pending);
+    return JsonUtils::successResponse(std::format(R"({{"pendingId":"{}","status":"pending"}})", pendingId));
+}
+
+std::string IPCHandler::getAsyncConnectResult(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto pendingIdResult = doc["pendingId"].get_string();
+        if (pendingIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: pendingId");
+        }
+        auto pendingId = std::string(pendingIdResult.value());
+
+        auto it = m_pendingConnections.find(pendingId);
+        if (it == m_pendingConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Pending connection not found: {}", pendingId));
+        }
+
+        auto& pending = it->second;
+        switch (pending->status.load()) {
+            case PendingConnection::Status::Pending:
+                return JsonUtils::successResponse(R"({"status":"pending"})");
+            case PendingConnection::Status::Failed: {
+                auto message = pending->errorMessage;
+                m_pendingConnections.erase(it);
+                return JsonUtils::errorResponse(message);
+            }
+            case PendingConnection::Status::Connected:
+                break;
+        }
+
+        // Promote the finished attempt to a live connection
+        auto connectionId = std::format("conn_{}", m_connectionIdCounter++);
+        m_activeConnections[connectionId] = std::move(pending->driver);
+        if (pending->tunnel) {
+            m_sshTunnels[connectionId] = std::move(pending->tunnel);
+        }
+        m_pendingConnections.erase(it);
+
+        return JsonUtils::successResponse(std::format(R"({{"status":"connected","connectionId":"{}"}})", connectionId));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
 std::string IPCHandler::closeDatabaseConnection(std::string_view params) {
     auto connectionIdResult = extractConnectionId(params);
     if (!connectionIdResult) {
@@ -372,10 +858,13 @@ std::string IPCHandler::closeDatabaseConnection(std::string_view params) {
     auto connectionId = *connectionIdResult;
 
     if (auto connection = m_activeConnections.find(connectionId); connection != m_activeConnections.end()) {
+        // Drop the search snapshot before the driver address can be reused
+        m_utilityContext->globalSearch().invalidateSnapshot(connection->second.get());
         connection->second->disconnect();
         m_activeConnections.erase(connection);
         // Clean up TransactionManager for this connection
         m_transactionManagers.erase(connectionId);
+        m_tableListOrder.erase(connectionId);
     }
 
     // Close SSH tunnel if exists
@@ -443,10 +932,22 @@ std::string IPCHandler::verifyDatabaseConnection(std::string_view params) {
     return JsonUtils::successResponse(std::format(R"({{"success":false,"message":"{}"}})", JsonUtils::escapeString(driver.getLastError())));
 }
 
+std::string IPCHandler::refreshDetectedDrivers(std::string_view) {
+    // Manual rescan for the rare case where drivers were (un)installed
+    // while the app is running; connection setup otherwise never rescans
+    auto driverName = refreshDriverDetection();
+
+    m_settingsContext->settingsManager().setDetectedOdbcDriver(driverName);
+    if (!m_settingsContext->settingsManager().save()) [[unlikely]] {
+        log<LogLevel::WARNING>("[IPC] Failed to persist detected ODBC driver");
+    }
+
+    return JsonUtils::successResponse(std::format(R"({{"driver":"{}"}})", JsonUtils::escapeString(driverName)));
+}
+
 std::string IPCHandler::executeSQL(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto sqlQueryResult = doc["sql"].get_string();
@@ -480,12 +981,50 @@ std::string IPCHandler::executeSQL(std::string_view params) {
             std::vector<StatementResult> allResults;
             auto startTime = std::chrono::high_resolution_clock::now();
 
+            // Auto-batching: wrap runs of consecutive DML statements in
+            // transactions of dmlBatchSize statements, so a bulk-load script
+            // pays one server log flush per batch instead of per statement.
+            // Disabled when the script controls transactions itself or the
+            // frontend already opened one on this connection - their
+            // commit/rollback decides, not ours
+            int batchSize = m_settingsContext->settingsManager().getSettings()->general.dmlBatchSize;
+            if (auto batchOpt = doc["batchSize"].get_int64(); !batchOpt.error() && batchOpt.value() >= 0) {
+                batchSize = static_cast<int>(batchOpt.value());
+            }
+            if (batchSize > 0) {
+                auto txIt = m_transactionManagers.find(connectionId);
+                const bool frontendTransaction = txIt != m_transactionManagers.end() && txIt->second->isInTransaction();
+                // BEGIN also matches BEGIN...END blocks; falling back to
+                // per-statement autocommit there is merely the old behavior
+                const bool scriptManagesTransactions = std::ranges::any_of(statements, [](std::string_view stmt) {
+                    const auto type = SQLParser::parseSQL(stmt).type;
+                    return type == "BEGIN" || type == "COMMIT" || type == "ROLLBACK";
+                });
+                if (frontendTransaction || scriptManagesTransactions) {
+                    batchSize = 0;
+                }
+            }
+
+            TransactionManager batchTx;
+            batchTx.setDriver(driver);
+            size_t batchStart = 0;  // Index of the first statement in the open batch
+            size_t inBatch = 0;
+            size_t currentIndex = 0;
+
             try {
-                for (const auto& stmt : statements) {
+                for (size_t i = 0; i < statements.size(); ++i) {
+                    const auto& stmt = statements[i];
+                    currentIndex = i;
                     ResultSet currentResult;
 
                     // Check if this is a USE statement
                     if (SQLParser::isUseStatement(stmt)) {
+                        // Close the open batch before switching databases
+                        if (inBatch > 0) {
+                            batchTx.commit();
+                            inBatch = 0;
+                        }
+
                         std::string dbName = SQLParser::extractDatabaseName(stmt);
                         [[maybe_unused]] auto _ = driver->execute(stmt);
                         log<LogLevel::INFO>(std::format("Database switched to '{}' for connection '{}'", dbName, connectionId));
@@ -493,23 +1032,49 @@ std::string IPCHandler::executeSQL(std::string_view params) {
                         // Create result for USE statement
                         currentResult.columns.push_back({.name = "Message", .type = "VARCHAR", .size = 255, .nullable = false, .isPrimaryKey = false});
                         ResultRow messageRow;
-                        messageRow.values.push_back(std::format("Database changed to {}", dbName));
+                        messageRow.values.emplace_back(std::format("Database changed to {}", dbName));
                         currentResult.rows.push_back(messageRow);
                         currentResult.affectedRows = 0;
                         currentResult.executionTimeMs = 0.0;
                     } else {
-                        // Execute regular statement
-                        currentResult = driver->execute(stmt);
+                        const auto type = SQLParser::parseSQL(stmt).type;
+                        const bool batchable = batchSize > 0 && (type == "INSERT" || type == "UPDATE" || type == "DELETE");
+                        if (batchable) {
+                            if (inBatch == 0) {
+                                batchTx.begin();
+                                batchStart = i;
+                            }
+                            currentResult = driver->execute(stmt);
+                            if (++inBatch == static_cast<size_t>(batchSize)) {
+                                batchTx.commit();
+                                inBatch = 0;
+                            }
+                        } else {
+                            // Anything else commits the pending batch first and
+                            // runs outside any transaction, as before
+                            if (inBatch > 0) {
+                                batchTx.commit();
+                                inBatch = 0;
+                            }
+                            currentResult = driver->execute(stmt);
+                        }
                     }
 
-                    allResults.push_back({.statement = stmt, .result = std::move(currentResult)});
+                    allResults.push_back({.statement = std::string(stmt), .result = std::move(currentResult)});
+                }
+
+                if (inBatch > 0) {
+                    batchTx.commit();
+                    inBatch = 0;
                 }
 
                 auto endTime = std::chrono::high_resolution_clock::now();
                 auto duration = std::chrono::duration<double, std::milli>(endTime - startTime);
 
-                // Construct JSON for multiple results
-                std::string jsonResponse = R"({"multipleResults":true,"results":[)";
+                // Construct JSON for multiple results in the per-thread
+                // arena: capacity survives across requests
+                auto& jsonResponse = ResponseArena::acquire();
+                jsonResponse += R"({"multipleResults":true,"results":[)";
                 for (size_t i = 0; i < allResults.size(); ++i) {
                     if (i > 0)
                         jsonResponse += ",";
@@ -517,9 +1082,9 @@ std::string IPCHandler::executeSQL(std::string_view params) {
                     allResults[i].result.executionTimeMs = duration.count() / static_cast<double>(allResults.size());
 
                     jsonResponse += R"({"statement":")";
-                    jsonResponse += JsonUtils::escapeString(allResults[i].statement);
+                    JsonUtils::appendEscaped(jsonResponse, allResults[i].statement);
                     jsonResponse += R"(","data":)";
-                    jsonResponse += JsonUtils::serializeResultSet(allResults[i].result, false);
+                    JsonUtils::serializeResultSetInto(jsonResponse, allResults[i].result, false);
                     jsonResponse += "}";
                 }
                 jsonResponse += "]}";
@@ -527,6 +1092,15 @@ std::string IPCHandler::executeSQL(std::string_view params) {
                 log<LogLevel::INFO>(std::format("Returning {} results from multi-statement execution", allResults.size()));
                 return JsonUtils::successResponse(jsonResponse);
             } catch (const std::exception& e) {
+                if (batchTx.isInTransaction()) {
+                    try {
+                        batchTx.rollback();
+                    } catch (...) {
+                        // The original execution error is the one worth reporting
+                    }
+                    return JsonUtils::errorResponse(std::format("Failed to execute statement {}: {}. Statements {}-{} were rolled back; earlier batches are already committed.", currentIndex + 1,
+                                                                e.what(), batchStart + 1, currentIndex + 1));
+                }
                 return JsonUtils::errorResponse(std::format("Failed to execute SQL: {}", e.what()));
             }
         }
@@ -543,12 +1117,12 @@ std::string IPCHandler::executeSQL(std::string_view params) {
                 ResultSet useResult;
                 useResult.columns.push_back({.name = "Message", .type = "VARCHAR", .size = 255, .nullable = false, .isPrimaryKey = false});
                 ResultRow messageRow;
-                messageRow.values.push_back(std::format("Database changed to {}", dbName));
+                messageRow.values.emplace_back(std::format("Database changed to {}", dbName));
                 useResult.rows.push_back(messageRow);
                 useResult.affectedRows = 0;
                 useResult.executionTimeMs = 0.0;
 
-                return JsonUtils::successResponse(JsonUtils::serializeResultSet(useResult, false));
+                return JsonUtils::resultSetResponse(useResult, false);
             } catch (const std::exception& e) {
                 return JsonUtils::errorResponse(std::format("Failed to switch database: {}", e.what()));
             }
@@ -561,108 +1135,389 @@ std::string IPCHandler::executeSQL(std::string_view params) {
         }
 
         // Generate cache key from connection + query
-        std::string cacheKey = connectionId + ":" + sqlQuery;
+        std::string cacheKey = resultCacheKey(connectionId, sqlQuery);
 
         // Check cache for SELECT queries
         bool isSelectQuery = sqlQuery.find("SELECT") != std::string::npos || sqlQuery.find("select") != std::string::npos;
         if (useCache && isSelectQuery) {
-            if (auto cachedResult = m_resultCache->get(cacheKey); cachedResult.has_value()) {
-                return JsonUtils::successResponse(JsonUtils::serializeResultSet(*cachedResult, true));
+            // Zero-copy hit: serialize straight from the shared cached result
+            if (auto cachedResult = m_resultCache->get(cacheKey)) {
+                return JsonUtils::resultSetResponse(*cachedResult, true);
             }
         }
 
-        ResultSet queryResult = driver->execute(sqlQuery);
+        auto queryResult = std::make_shared<const ResultSet>(driver->execute(sqlQuery));
 
-        // Store in cache for SELECT queries
+        // Store in cache for SELECT queries (shared ownership, no copy),
+        // tagged with the tables they read for dependency invalidation
         if (useCache && isSelectQuery) {
-            m_resultCache->put(cacheKey, queryResult);
+            m_resultCache->put(cacheKey, queryResult, SQLParser::extractTableNames(sqlQuery));
         }
 
-        std::string jsonResponse = JsonUtils::serializeResultSet(queryResult, false);
+        // DML invalidates only cached SELECTs on this connection that touch
+        // the modified tables, so unrelated entries keep their hits
+        auto parsedStatement = SQLParser::parseSQL(sqlQuery);
+        if (parsedStatement.type == "INSERT" || parsedStatement.type == "UPDATE" || parsedStatement.type == "DELETE" || parsedStatement.type == "ALTER" || parsedStatement.type == "DROP" ||
+            parsedStatement.type == "CREATE") {
+            m_resultCache->invalidateTables(SQLParser::extractTableNames(sqlQuery), connectionId + ":");
+            invalidateExecutionPlans(connectionId, parsedStatement.type);
+        }
 
         // Record in query history
         HistoryItem historyEntry{.id = std::format("hist_{}", std::chrono::system_clock::now().time_since_epoch().count()),
                                  .sql = sqlQuery,
-                                 .executionTimeMs = queryResult.executionTimeMs,
+                                 .executionTimeMs = queryResult->executionTimeMs,
                                  .success = true,
-                                 .affectedRows = static_cast<int64_t>(queryResult.affectedRows),
+                                 .affectedRows = static_cast<int64_t>(queryResult->affectedRows),
                                  .isFavorite = false};
         m_queryHistory->add(historyEntry);
 
-        return JsonUtils::successResponse(jsonResponse);
+        return JsonUtils::resultSetResponse(*queryResult, false);
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
     }
 }
 
-std::string IPCHandler::cancelRunningQuery(std::string_view params) {
-    auto connectionIdResult = extractConnectionId(params);
-    if (!connectionIdResult) {
-        return JsonUtils::errorResponse(connectionIdResult.error());
-    }
-    auto connectionId = *connectionIdResult;
-
-    if (auto connection = m_activeConnections.find(connectionId); connection != m_activeConnections.end()) {
-        connection->second->cancel();
-    }
-
-    return JsonUtils::successResponse("{}");
-}
-
-std::string IPCHandler::fetchTableList(std::string_view params) {
-    velocitydb::log<LogLevel::DEBUG>(std::format("IPCHandler::fetchTableList called with params: {}", params));
+std::string IPCHandler::executeSQLBinary(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
 
-    auto connectionIdResult = extractConnectionId(params);
-    if (!connectionIdResult) {
-        velocitydb::log<LogLevel::ERROR_LEVEL>(std::format("IPCHandler::fetchTableList: Failed to extract connection ID: {}", connectionIdResult.error()));
-        return JsonUtils::errorResponse(connectionIdResult.error());
-    }
-    auto connectionId = *connectionIdResult;
+        auto connectionIdResult = doc["connectionId"].get_string();
+        auto sqlQueryResult = doc["sql"].get_string();
+        if (connectionIdResult.error() || sqlQueryResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId or sql");
+        }
+        std::string connectionId = std::string(connectionIdResult.value());
+        std::string sqlQuery = std::string(sqlQueryResult.value());
 
-    try {
         auto connection = m_activeConnections.find(connectionId);
         if (connection == m_activeConnections.end()) [[unlikely]] {
-            velocitydb::log<LogLevel::ERROR_LEVEL>(std::format("IPCHandler::fetchTableList: Connection not found: {}", connectionId));
             return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
         }
-
         auto& driver = connection->second;
-        velocitydb::log<LogLevel::DEBUG>(std::format("IPCHandler::fetchTableList: Driver found for connection: {}", connectionId));
 
-        // Filter to only include user tables and views (exclude system tables)
-        // Include table comments from extended properties
-        constexpr auto tableListQuery = R"(
-            SELECT
-                t.TABLE_SCHEMA,
-                t.TABLE_NAME,
-                t.TABLE_TYPE,
-                CAST(ep.value AS NVARCHAR(MAX)) AS comment
-            FROM INFORMATION_SCHEMA.TABLES t
-            LEFT JOIN sys.extended_properties ep ON ep.major_id = OBJECT_ID(t.TABLE_SCHEMA + '.' + t.TABLE_NAME)
-                AND ep.minor_id = 0
-                AND ep.class = 1
-                AND ep.name = 'MS_Description'
-            WHERE t.TABLE_TYPE IN ('BASE TABLE', 'VIEW')
-            ORDER BY t.TABLE_SCHEMA, t.TABLE_NAME
-        )";
+        // Multi-statement scripts and USE keep their JSON path; the frame
+        // format targets the single-SELECT grid case where serialization
+        // dominates the time between query completion and paint
+        auto statements = SQLParser::splitStatements(sqlQuery);
+        if (statements.size() > 1 || SQLParser::isUseStatement(sqlQuery)) {
+            return executeSQL(params);
+        }
 
-        velocitydb::log<LogLevel::DEBUG>("IPCHandler::fetchTableList: Executing table list query"sv);
-        ResultSet queryResult = driver->execute(tableListQuery);
+        bool useCache = true;
+        if (auto useCacheOpt = doc["useCache"].get_bool(); !useCacheOpt.error()) {
+            useCache = useCacheOpt.value();
+        }
 
-        velocitydb::log<LogLevel::INFO>(std::format("IPCHandler::fetchTableList: Found {} tables/views", queryResult.rows.size()));
+        std::string cacheKey = resultCacheKey(connectionId, sqlQuery);
+        bool isSelectQuery = sqlQuery.find("SELECT") != std::string::npos || sqlQuery.find("select") != std::string::npos;
+        if (useCache && isSelectQuery) {
+            // Cache entries are row-oriented; one transpose, then encode
+            if (auto cachedResult = m_resultCache->get(cacheKey)) {
+                return binaryFrameResponse(ColumnarResultSet::fromRows(*cachedResult), true);
+            }
+        }
 
-        std::string jsonResponse = "[";
-        for (size_t i = 0; i < queryResult.rows.size(); ++i) {
-            if (i > 0)
-                jsonResponse += ',';
+        // executeColumnar fills the frame's column buffers directly from the
+        // fetch loop - no row materialization on the serialization path
+        auto columnarResult = driver->executeColumnar(sqlQuery);
 
-            std::string comment = queryResult.rows[i].values.size() >= 4 ? queryResult.rows[i].values[3] : "";
-            jsonResponse += std::format(R"({{"schema":"{}","name":"{}","type":"{}","comment":"{}"}})", JsonUtils::escapeString(queryResult.rows[i].values[0]),
-                                        JsonUtils::escapeString(queryResult.rows[i].values[1]), JsonUtils::escapeString(queryResult.rows[i].values[2]), JsonUtils::escapeString(comment));
+        if (useCache && isSelectQuery) {
+            m_resultCache->put(cacheKey, std::make_shared<const ResultSet>(columnarResult.toRows()), SQLParser::extractTableNames(sqlQuery));
         }
-        jsonResponse += ']';
 
-        velocitydb::log<LogLevel::DEBUG>("IPCHandler::fetchTableList: Returning JSON response"sv);
+        auto parsedStatement = SQLParser::parseSQL(sqlQuery);
+        if (parsedStatement.type == "INSERT" || parsedStatement.type == "UPDATE" || parsedStatement.type == "DELETE" || parsedStatement.type == "ALTER" || parsedStatement.type == "DROP" ||
+            parsedStatement.type == "CREATE") {
+            m_resultCache->invalidateTables(SQLParser::extractTableNames(sqlQuery), connectionId + ":");
+            invalidateExecutionPlans(connectionId, parsedStatement.type);
+        }
+
+        HistoryItem historyEntry{.id = std::format("hist_{}", std::chrono::system_clock::now().time_since_epoch().count()),
+                                 .sql = sqlQuery,
+                                 .executionTimeMs = columnarResult.executionTimeMs,
+                                 .success = true,
+                                 .affectedRows = columnarResult.affectedRows,
+                                 .isFavorite = false};
+        m_queryHistory->add(historyEntry);
+
+        return binaryFrameResponse(columnarResult, false);
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::resultCacheKey(std::string_view connectionId, std::string_view sql) {
+    return std::format("{}:{}", connectionId, SQLParser::canonicalize(sql));
+}
+
+std::string IPCHandler::binaryFrameResponse(const ColumnarResultSet& result, bool cached) {
+    if (m_sharedBufferSink) {
+        auto frame = BinaryFrame::encode(result, cached);
+        if (frame.size() >= SHARED_BUFFER_MIN_BYTES) {
+            const auto transferId = m_transferIdCounter++;
+            const auto frameBytes = frame.size();
+            // The descriptor travels on both channels: the response tells
+            // the caller a transfer is coming, the event carries the buffer
+            if (m_sharedBufferSink(frame, std::format(R"({{"event":"sharedResultBuffer","transferId":{},"byteLength":{}}})", transferId, frameBytes))) {
+                return JsonUtils::successResponse(std::format(R"({{"format":"vdbf-shared","transferId":{},"byteLength":{}}})", transferId, frameBytes));
+            }
+        }
+        // Transport unavailable or frame too small: same bytes, inline
+        return JsonUtils::successResponse(std::format(R"({{"format":"vdbf","frame":"{}"}})", BinaryFrame::frameToBase64(frame)));
+    }
+    return JsonUtils::successResponse(std::format(R"({{"format":"vdbf","frame":"{}"}})", BinaryFrame::encodeBase64(result, cached)));
+}
+
+std::string IPCHandler::executeSQLChunked(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto connectionIdResult = doc["connectionId"].get_string();
+        auto sqlQueryResult = doc["sql"].get_string();
+        if (connectionIdResult.error() || sqlQueryResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId or sql");
+        }
+        std::string connectionId = std::string(connectionIdResult.value());
+        std::string sqlQuery = std::string(sqlQueryResult.value());
+
+        // 4MB default keeps memory flat for 100MB results while staying far
+        // from the per-message overhead of tiny segments
+        size_t chunkSize = 4 * 1024 * 1024;
+        if (auto chunkSizeOpt = doc["chunkSize"].get_int64(); !chunkSizeOpt.error() && chunkSizeOpt.value() > 0) {
+            chunkSize = (std::max)(static_cast<size_t>(chunkSizeOpt.value()), static_cast<size_t>(64 * 1024));
+        }
+
+        bool useCache = true;
+        if (auto useCacheOpt = doc["useCache"].get_bool(); !useCacheOpt.error()) {
+            useCache = useCacheOpt.value();
+        }
+
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
+        }
+        auto& driver = connection->second;
+
+        // Chunks ride the push channel; without a sink (or for the script
+        // shapes the single-result chunk stream cannot express) the regular
+        // single-response path still serves the request
+        auto statements = SQLParser::splitStatements(sqlQuery);
+        if (!m_eventSink || statements.size() > 1 || SQLParser::isUseStatement(sqlQuery)) {
+            return executeSQL(params);
+        }
+
+        std::string cacheKey = resultCacheKey(connectionId, sqlQuery);
+        bool isSelectQuery = sqlQuery.find("SELECT") != std::string::npos || sqlQuery.find("select") != std::string::npos;
+
+        std::shared_ptr<const ResultSet> queryResult;
+        bool servedFromCache = false;
+        if (useCache && isSelectQuery) {
+            if (auto cachedResult = m_resultCache->get(cacheKey)) {
+                queryResult = cachedResult;
+                servedFromCache = true;
+            }
+        }
+
+        if (!queryResult) {
+            queryResult = std::make_shared<const ResultSet>(driver->execute(sqlQuery));
+
+            if (useCache && isSelectQuery) {
+                m_resultCache->put(cacheKey, queryResult, SQLParser::extractTableNames(sqlQuery));
+            }
+
+            auto parsedStatement = SQLParser::parseSQL(sqlQuery);
+            if (parsedStatement.type == "INSERT" || parsedStatement.type == "UPDATE" || parsedStatement.type == "DELETE" || parsedStatement.type == "ALTER" || parsedStatement.type == "DROP" ||
+                parsedStatement.type == "CREATE") {
+                m_resultCache->invalidateTables(SQLParser::extractTableNames(sqlQuery), connectionId + ":");
+                invalidateExecutionPlans(connectionId, parsedStatement.type);
+            }
+
+            HistoryItem historyEntry{.id = std::format("hist_{}", std::chrono::system_clock::now().time_since_epoch().count()),
+                                     .sql = sqlQuery,
+                                     .executionTimeMs = queryResult->executionTimeMs,
+                                     .success = true,
+                                     .affectedRows = static_cast<int64_t>(queryResult->affectedRows),
+                                     .isFavorite = false};
+            m_queryHistory->add(historyEntry);
+        }
+
+        // Segments are fragments of one serializeResultSet document; the
+        // frontend concatenates payloads per streamId and parses once the
+        // last segment arrives (or incrementally, since rows flush whole)
+        std::string streamId = std::format("stream_{}", std::chrono::system_clock::now().time_since_epoch().count());
+        size_t sequence = 0;
+        JsonUtils::serializeResultSetChunked(*queryResult, servedFromCache, chunkSize, [&](std::string_view chunk, bool isLast) {
+            m_eventSink(std::format(R"({{"event":"resultChunk","streamId":"{}","seq":{},"last":{},"payload":"{}"}})", streamId, sequence++, isLast ? "true" : "false", JsonUtils::escapeString(chunk)));
+        });
+
+        return JsonUtils::successResponse(std::format(R"({{"chunked":true,"streamId":"{}","chunks":{}}})", streamId, sequence));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::executeBulkDML(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto connectionIdResult = doc["connectionId"].get_string();
+        auto sqlResult = doc["sql"].get_string();
+        auto rowsResult = doc["rows"].get_array();
+        if (connectionIdResult.error() || sqlResult.error() || rowsResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId, sql or rows");
+        }
+        std::string connectionId = std::string(connectionIdResult.value());
+        std::string sqlQuery = std::string(sqlResult.value());
+
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse("Connection not found");
+        }
+        auto& driver = connection->second;
+
+        std::vector<BulkRow> rows;
+        for (auto rowElement : rowsResult.value()) {
+            auto cells = rowElement.get_array();
+            if (cells.error()) [[unlikely]] {
+                return JsonUtils::errorResponse("rows must be an array of arrays");
+            }
+            BulkRow row;
+            for (auto cellElement : cells.value()) {
+                if (cellElement.is_null()) {
+                    row.push_back(std::nullopt);
+                } else if (auto str = cellElement.get_string(); !str.error()) {
+                    row.emplace_back(std::string(str.value()));
+                } else if (auto num = cellElement.get_int64(); !num.error()) {
+                    row.emplace_back(std::format("{}", num.value()));
+                } else if (auto dbl = cellElement.get_double(); !dbl.error()) {
+                    row.emplace_back(std::format("{}", dbl.value()));
+                } else if (auto flag = cellElement.get_bool(); !flag.error()) {
+                    row.emplace_back(flag.value() ? "1" : "0");
+                } else {
+                    return JsonUtils::errorResponse("Unsupported cell type in rows");
+                }
+            }
+            rows.push_back(std::move(row));
+        }
+
+        log<LogLevel::INFO>(std::format("Bulk DML: {} rows on connection '{}'", rows.size(), connectionId));
+
+        // The whole batch commits or rolls back as one unit - unless the
+        // frontend already opened a transaction on this connection, in
+        // which case its commit/rollback decides
+        auto txIt = m_transactionManagers.find(connectionId);
+        const bool ownTransaction = txIt == m_transactionManagers.end() || !txIt->second->isInTransaction();
+
+        TransactionManager localTx;
+        if (ownTransaction) {
+            localTx.setDriver(driver);
+            localTx.begin();
+        }
+
+        int64_t affectedRows = 0;
+        try {
+            affectedRows = driver->executeBulk(sqlQuery, rows);
+            if (ownTransaction) {
+                localTx.commit();
+            }
+        } catch (const std::exception& e) {
+            if (ownTransaction && localTx.isInTransaction()) {
+                try {
+                    localTx.rollback();
+                } catch (...) {
+                    // The original execution error is the one worth reporting
+                }
+            }
+            return JsonUtils::errorResponse(std::format("Bulk execution failed: {}", e.what()));
+        }
+
+        // Bulk DML is still DML: drop cached SELECTs touching these tables
+        m_resultCache->invalidateTables(SQLParser::extractTableNames(sqlQuery), connectionId + ":");
+
+        return JsonUtils::successResponse(std::format(R"({{"affectedRows":{}}})", affectedRows));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::cancelRunningQuery(std::string_view params) {
+    auto connectionIdResult = extractConnectionId(params);
+    if (!connectionIdResult) {
+        return JsonUtils::errorResponse(connectionIdResult.error());
+    }
+    auto connectionId = *connectionIdResult;
+
+    if (auto connection = m_activeConnections.find(connectionId); connection != m_activeConnections.end()) {
+        connection->second->cancel();
+    }
+
+    return JsonUtils::successResponse("{}");
+}
+
+std::string IPCHandler::fetchTableList(std::string_view params) {
+    velocitydb::log<LogLevel::DEBUG>(std::format("IPCHandler::fetchTableList called with params: {}", params));
+
+    auto connectionIdResult = extractConnectionId(params);
+    if (!connectionIdResult) {
+        velocitydb::log<LogLevel::ERROR_LEVEL>(std::format("IPCHandler::fetchTableList: Failed to extract connection ID: {}", connectionIdResult.error()));
+        return JsonUtils::errorResponse(connectionIdResult.error());
+    }
+    auto connectionId = *connectionIdResult;
+
+    try {
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            velocitydb::log<LogLevel::ERROR_LEVEL>(std::format("IPCHandler::fetchTableList: Connection not found: {}", connectionId));
+            return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
+        }
+
+        auto& driver = connection->second;
+        velocitydb::log<LogLevel::DEBUG>(std::format("IPCHandler::fetchTableList: Driver found for connection: {}", connectionId));
+
+        // Filter to only include user tables and views (exclude system tables)
+        // Include table comments from extended properties
+        constexpr auto tableListQuery = R"(
+            SELECT
+                t.TABLE_SCHEMA,
+                t.TABLE_NAME,
+                t.TABLE_TYPE,
+                CAST(ep.value AS NVARCHAR(MAX)) AS comment
+            FROM INFORMATION_SCHEMA.TABLES t
+            LEFT JOIN sys.extended_properties ep ON ep.major_id = OBJECT_ID(t.TABLE_SCHEMA + '.' + t.TABLE_NAME)
+                AND ep.minor_id = 0
+                AND ep.class = 1
+                AND ep.name = 'MS_Description'
+            WHERE t.TABLE_TYPE IN ('BASE TABLE', 'VIEW')
+            ORDER BY t.TABLE_SCHEMA, t.TABLE_NAME
+        )";
+
+        velocitydb::log<LogLevel::DEBUG>("IPCHandler::fetchTableList: Executing table list query"sv);
+        ResultSet queryResult = driver->execute(tableListQuery);
+
+        velocitydb::log<LogLevel::INFO>(std::format("IPCHandler::fetchTableList: Found {} tables/views", queryResult.rows.size()));
+
+        // Remember the alphabetical order: the metadata prefetch uses it to
+        // pick which siblings to warm after a tree expand
+        auto& tableOrder = m_tableListOrder[connectionId];
+        tableOrder.clear();
+        tableOrder.reserve(queryResult.rows.size());
+        for (const auto& row : queryResult.rows) {
+            tableOrder.push_back(std::format("{}.{}", row.values[0], row.values[1]));
+        }
+
+        std::string jsonResponse = "[";
+        for (size_t i = 0; i < queryResult.rows.size(); ++i) {
+            if (i > 0)
+                jsonResponse += ',';
+
+            std::string comment = queryResult.rows[i].values.size() >= 4 ? std::string(queryResult.rows[i].values[3]) : "";
+            jsonResponse += std::format(R"({{"schema":"{}","name":"{}","type":"{}","comment":"{}"}})", JsonUtils::escapeString(queryResult.rows[i].values[0]),
+                                        JsonUtils::escapeString(queryResult.rows[i].values[1]), JsonUtils::escapeString(queryResult.rows[i].values[2]), JsonUtils::escapeString(comment));
+        }
+        jsonResponse += ']';
+
+        velocitydb::log<LogLevel::DEBUG>("IPCHandler::fetchTableList: Returning JSON response"sv);
         return JsonUtils::successResponse(jsonResponse);
     } catch (const std::exception& e) {
         velocitydb::log<LogLevel::ERROR_LEVEL>(std::format("IPCHandler::fetchTableList: Exception: {}", e.what()));
@@ -672,8 +1527,7 @@ std::string IPCHandler::fetchTableList(std::string_view params) {
 
 std::string IPCHandler::fetchColumnDefinitions(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto tableNameResult = doc["table"].get_string();
@@ -760,8 +1614,7 @@ std::string IPCHandler::fetchDatabaseList(std::string_view params) {
 
 std::string IPCHandler::startTransaction(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         if (connectionIdResult.error()) [[unlikely]] {
@@ -790,8 +1643,7 @@ std::string IPCHandler::startTransaction(std::string_view params) {
 
 std::string IPCHandler::commitTransaction(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         if (connectionIdResult.error()) [[unlikely]] {
@@ -813,8 +1665,7 @@ std::string IPCHandler::commitTransaction(std::string_view params) {
 
 std::string IPCHandler::rollbackTransaction(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         if (connectionIdResult.error()) [[unlikely]] {
@@ -836,8 +1687,7 @@ std::string IPCHandler::rollbackTransaction(std::string_view params) {
 
 std::string IPCHandler::exportToCSV(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto filepathResult = doc["filepath"].get_string();
@@ -855,7 +1705,6 @@ std::string IPCHandler::exportToCSV(std::string_view params) {
         }
 
         auto& driver = connection->second;
-        ResultSet queryResult = driver->execute(sqlQuery);
 
         ExportOptions options;
         if (auto delimiter = doc["delimiter"].get_string(); !delimiter.error()) {
@@ -867,8 +1716,23 @@ std::string IPCHandler::exportToCSV(std::string_view params) {
         if (auto nullValue = doc["nullValue"].get_string(); !nullValue.error()) {
             options.nullValue = std::string(nullValue.value());
         }
+        if (auto compress = doc["compress"].get_bool(); !compress.error()) {
+            options.compressOutput = compress.value();
+        }
 
         CSVExporter exporter;
+
+        // Stream rows from the block-fetch cursor straight to disk so the
+        // export never materializes the full result set. Falls back to the
+        // materialized path only if the driver's stream slot is taken.
+        if (!driver->hasOpenStream()) {
+            if (exporter.exportStream(*driver, sqlQuery, filepath, options)) {
+                return JsonUtils::successResponse(std::format(R"({{"filepath":"{}"}})", JsonUtils::escapeString(filepath)));
+            }
+            return JsonUtils::errorResponse("Failed to export CSV");
+        }
+
+        ResultSet queryResult = driver->execute(sqlQuery);
         if (exporter.exportData(queryResult, filepath, options)) {
             return JsonUtils::successResponse(std::format(R"({{"filepath":"{}"}})", JsonUtils::escapeString(filepath)));
         }
@@ -878,10 +1742,44 @@ std::string IPCHandler::exportToCSV(std::string_view params) {
     }
 }
 
+std::string IPCHandler::exportDatabaseDDL(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto connectionIdResult = doc["connectionId"].get_string();
+        auto filepathResult = doc["filepath"].get_string();
+        if (connectionIdResult.error() || filepathResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId or filepath");
+        }
+        std::string connectionId = std::string(connectionIdResult.value());
+        std::string filepath = std::string(filepathResult.value());
+
+        size_t parallelism = 4;
+        if (auto parallelismResult = doc["parallelism"].get_uint64(); !parallelismResult.error()) {
+            parallelism = parallelismResult.value();
+        }
+
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
+        }
+
+        // The exporter opens its own sibling connections so the UI
+        // connection stays free while the script is generated
+        DDLExporter exporter;
+        auto result = exporter.exportDatabaseDDL(std::string(connection->second->getConnectionString()), filepath, parallelism);
+        if (!result) {
+            return JsonUtils::errorResponse(result.error());
+        }
+        return JsonUtils::successResponse(std::format(R"({{"filepath":"{}","tableCount":{}}})", JsonUtils::escapeString(filepath), *result));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
 std::string IPCHandler::exportToJSON(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto filepathResult = doc["filepath"].get_string();
@@ -905,6 +1803,9 @@ std::string IPCHandler::exportToJSON(std::string_view params) {
         if (auto prettyPrint = doc["prettyPrint"].get_bool(); !prettyPrint.error()) {
             exporter.setPrettyPrint(prettyPrint.value());
         }
+        if (auto ndjson = doc["ndjson"].get_bool(); !ndjson.error() && ndjson.value()) {
+            exporter.setArrayFormat(false);
+        }
 
         ExportOptions options;
         if (exporter.exportData(queryResult, filepath, options)) {
@@ -918,8 +1819,7 @@ std::string IPCHandler::exportToJSON(std::string_view params) {
 
 std::string IPCHandler::exportToExcel(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto filepathResult = doc["filepath"].get_string();
@@ -944,7 +1844,226 @@ std::string IPCHandler::exportToExcel(std::string_view params) {
         if (exporter.exportData(queryResult, filepath, options)) {
             return JsonUtils::successResponse(std::format(R"({{"filepath":"{}"}})", JsonUtils::escapeString(filepath)));
         }
-        return JsonUtils::errorResponse("Excel export not yet implemented");
+        return JsonUtils::errorResponse("Failed to export Excel");
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::exportToParquet(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto connectionIdResult = doc["connectionId"].get_string();
+        auto filepathResult = doc["filepath"].get_string();
+        auto sqlQueryResult = doc["sql"].get_string();
+        if (connectionIdResult.error() || filepathResult.error() || sqlQueryResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId, filepath, or sql");
+        }
+        std::string connectionId = std::string(connectionIdResult.value());
+        std::string filepath = std::string(filepathResult.value());
+        std::string sqlQuery = std::string(sqlQueryResult.value());
+
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
+        }
+
+        auto& driver = connection->second;
+        ResultSet queryResult = driver->execute(sqlQuery);
+
+        ParquetExporter exporter;
+        if (auto rowGroupRows = doc["rowGroupRows"].get_uint64(); !rowGroupRows.error()) {
+            exporter.setRowGroupRows(rowGroupRows.value());
+        }
+
+        ExportOptions options;
+        if (exporter.exportData(queryResult, filepath, options)) {
+            return JsonUtils::successResponse(std::format(R"({{"filepath":"{}"}})", JsonUtils::escapeString(filepath)));
+        }
+        return JsonUtils::errorResponse("Failed to export Parquet");
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+namespace {
+
+[[nodiscard]] std::string_view exportJobStatusName(ExportJobStatus status) {
+    switch (status) {
+        case ExportJobStatus::Pending:
+            return "pending";
+        case ExportJobStatus::Running:
+            return "running";
+        case ExportJobStatus::Completed:
+            return "completed";
+        case ExportJobStatus::Cancelled:
+            return "cancelled";
+        case ExportJobStatus::Failed:
+            return "failed";
+    }
+    return "unknown";
+}
+
+/// Bracket-quotes one identifier part for the whole-table extract SQL,
+/// escaping embedded closing brackets
+[[nodiscard]] std::string bracketQuoteIdentifier(std::string_view part) {
+    std::string quoted;
+    quoted.reserve(part.size() + 2);
+    quoted += '[';
+    for (char c : part) {
+        if (c == ']') {
+            quoted += "]]";
+        } else {
+            quoted += c;
+        }
+    }
+    quoted += ']';
+    return quoted;
+}
+
+[[nodiscard]] std::string exportJobStateJson(const ExportJobState& state) {
+    return std::format(R"({{"jobId":"{}","status":"{}","rowsWritten":{},"filepath":"{}","format":"{}","error":"{}"}})", state.jobId, exportJobStatusName(state.status), state.rowsWritten,
+                       JsonUtils::escapeString(state.filepath), JsonUtils::escapeString(state.format), JsonUtils::escapeString(state.errorMessage));
+}
+
+}  // namespace
+
+std::string IPCHandler::startExportJob(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto connectionIdResult = doc["connectionId"].get_string();
+        auto filepathResult = doc["filepath"].get_string();
+        auto sqlQueryResult = doc["sql"].get_string();
+        auto formatResult = doc["format"].get_string();
+        if (connectionIdResult.error() || filepathResult.error() || sqlQueryResult.error() || formatResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId, filepath, sql, or format");
+        }
+        std::string connectionId = std::string(connectionIdResult.value());
+
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
+        }
+
+        ExportOptions options;
+        if (auto delimiter = doc["delimiter"].get_string(); !delimiter.error()) {
+            options.delimiter = std::string(delimiter.value());
+        }
+        if (auto includeHeader = doc["includeHeader"].get_bool(); !includeHeader.error()) {
+            options.includeHeader = includeHeader.value();
+        }
+        if (auto nullValue = doc["nullValue"].get_string(); !nullValue.error()) {
+            options.nullValue = std::string(nullValue.value());
+        }
+        if (auto compress = doc["compress"].get_bool(); !compress.error()) {
+            options.compressOutput = compress.value();
+        }
+
+        auto jobId = m_exportContext->startExportJob(connection->second, std::string(sqlQueryResult.value()), std::string(filepathResult.value()), std::string(formatResult.value()), std::move(options));
+        return JsonUtils::successResponse(std::format(R"({{"jobId":"{}"}})", jobId));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::exportTable(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto connectionIdResult = doc["connectionId"].get_string();
+        auto tableResult = doc["table"].get_string();
+        auto filepathResult = doc["filepath"].get_string();
+        if (connectionIdResult.error() || tableResult.error() || filepathResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId, table, or filepath");
+        }
+        std::string connectionId = std::string(connectionIdResult.value());
+
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
+        }
+
+        std::string schema = "dbo";
+        if (auto schemaResult = doc["schema"].get_string(); !schemaResult.error() && !schemaResult.value().empty()) {
+            schema = std::string(schemaResult.value());
+        }
+        std::string format = "csv";
+        if (auto formatResult = doc["format"].get_string(); !formatResult.error()) {
+            format = std::string(formatResult.value());
+        }
+
+        ExportOptions options;
+        if (auto delimiter = doc["delimiter"].get_string(); !delimiter.error()) {
+            options.delimiter = std::string(delimiter.value());
+        }
+        if (auto includeHeader = doc["includeHeader"].get_bool(); !includeHeader.error()) {
+            options.includeHeader = includeHeader.value();
+        }
+        if (auto nullValue = doc["nullValue"].get_string(); !nullValue.error()) {
+            options.nullValue = std::string(nullValue.value());
+        }
+        if (auto compress = doc["compress"].get_bool(); !compress.error()) {
+            options.compressOutput = compress.value();
+        }
+
+        // Whole-table extract: runs as a background job on a dedicated
+        // bulk connection, so the interactive session stays responsive
+        auto sql = std::format("SELECT * FROM {}.{}", bracketQuoteIdentifier(schema), bracketQuoteIdentifier(tableResult.value()));
+        auto jobId = m_exportContext->startExportJob(connection->second, std::move(sql), std::string(filepathResult.value()), std::move(format), std::move(options), true);
+        return JsonUtils::successResponse(std::format(R"({{"jobId":"{}"}})", jobId));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::getExportJobStatus(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto jobIdResult = doc["jobId"].get_string();
+        if (jobIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: jobId");
+        }
+
+        auto state = m_exportContext->getExportJobState(jobIdResult.value());
+        if (!state) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Export job not found: {}", jobIdResult.value()));
+        }
+        return JsonUtils::successResponse(exportJobStateJson(*state));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::cancelExportJob(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto jobIdResult = doc["jobId"].get_string();
+        if (jobIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: jobId");
+        }
+
+        bool cancelled = m_exportContext->cancelExportJob(jobIdResult.value());
+        return JsonUtils::successResponse(std::format(R"({{"cancelled":{}}})", cancelled ? "true" : "false"));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::removeExportJob(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto jobIdResult = doc["jobId"].get_string();
+        if (jobIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: jobId");
+        }
+
+        m_exportContext->removeExportJob(jobIdResult.value());
+        return JsonUtils::successResponse("{\"removed\":true}");
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
     }
@@ -952,8 +2071,7 @@ std::string IPCHandler::exportToExcel(std::string_view params) {
 
 std::string IPCHandler::formatSQLQuery(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto sqlResult = doc["sql"].get_string();
         if (sqlResult.error()) [[unlikely]] {
@@ -961,35 +2079,129 @@ std::string IPCHandler::formatSQLQuery(std::string_view params) {
         }
         std::string sqlQuery = std::string(sqlResult.value());
 
+        // Incremental mode: with an edited byte range, only the statements
+        // the edit touches are re-formatted and spliced back, so the size
+        // guard below does not apply
+        auto editStartResult = doc["editStart"].get_uint64();
+        auto editEndResult = doc["editEnd"].get_uint64();
+        if (!editStartResult.error() && !editEndResult.error()) {
+            auto rangeFormatted = m_utilityContext->formatSQLRange(sqlQuery, editStartResult.value(), editEndResult.value());
+            return JsonUtils::successResponse(std::format(R"({{"sql":"{}"}})", JsonUtils::escapeString(rangeFormatted)));
+        }
+
         // Prevent formatting very large SQL to avoid performance issues
         constexpr size_t MAX_SQL_SIZE = 100000;  // 100KB
         if (sqlQuery.size() > MAX_SQL_SIZE) [[unlikely]] {
             return JsonUtils::errorResponse(std::format("SQL too large ({} chars). Maximum size is {} chars.", sqlQuery.size(), MAX_SQL_SIZE));
         }
 
-        // Delegate to UtilityContext
-        auto finalSQL = m_utilityContext->formatSQL(sqlQuery);
+        // Delegate to UtilityContext
+        auto finalSQL = m_utilityContext->formatSQL(sqlQuery);
+
+        return JsonUtils::successResponse(std::format(R"({{"sql":"{}"}})", JsonUtils::escapeString(finalSQL)));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::uppercaseKeywords(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto sqlResult = doc["sql"].get_string();
+        if (sqlResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing sql field");
+        }
+        std::string sqlQuery = std::string(sqlResult.value());
+
+        // Delegate to UtilityContext
+        auto uppercasedSQL = m_utilityContext->uppercaseKeywords(sqlQuery);
+        return JsonUtils::successResponse(std::format(R"({{"sql":"{}"}})", JsonUtils::escapeString(uppercasedSQL)));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::updateEditorBuffer(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto bufferIdResult = doc["bufferId"].get_string();
+        if (bufferIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: bufferId");
+        }
+        auto bufferId = std::string(bufferIdResult.value());
+
+        auto& index = m_completionIndexes[bufferId];
+        if (!index) {
+            index = std::make_unique<CompletionIndex>();
+        }
+
+        // Full text replaces the buffer (initial tab load); otherwise the
+        // edit delta keeps the index current without a full reparse
+        auto textResult = doc["text"].get_string();
+        if (!textResult.error()) {
+            index->setBuffer(std::string(textResult.value()));
+        } else {
+            auto offsetResult = doc["offset"].get_uint64();
+            auto removedResult = doc["removedLength"].get_uint64();
+            auto insertedResult = doc["insertedText"].get_string();
+            if (offsetResult.error() || removedResult.error() || insertedResult.error()) [[unlikely]] {
+                return JsonUtils::errorResponse("Missing text or offset/removedLength/insertedText fields");
+            }
+            index->applyEdit(offsetResult.value(), removedResult.value(), insertedResult.value());
+        }
+
+        return JsonUtils::successResponse(std::format(R"({{"statementCount":{}}})", index->statementCount()));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::getCompletionContext(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto bufferIdResult = doc["bufferId"].get_string();
+        auto cursorResult = doc["cursorOffset"].get_uint64();
+        if (bufferIdResult.error() || cursorResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: bufferId or cursorOffset");
+        }
+        auto bufferId = std::string(bufferIdResult.value());
+
+        auto index = m_completionIndexes.find(bufferId);
+        if (index == m_completionIndexes.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Editor buffer not found: {}", bufferId));
+        }
 
-        return JsonUtils::successResponse(std::format(R"({{"sql":"{}"}})", JsonUtils::escapeString(finalSQL)));
+        auto refs = index->second->scopeAt(cursorResult.value());
+
+        std::string tablesJson = "[";
+        for (size_t i = 0; i < refs.size(); ++i) {
+            if (i > 0) {
+                tablesJson += ',';
+            }
+            tablesJson += std::format(R"({{"table":"{}","alias":"{}"}})", JsonUtils::escapeString(refs[i].table), JsonUtils::escapeString(refs[i].alias));
+        }
+        tablesJson += "]";
+
+        return JsonUtils::successResponse(std::format(R"({{"tables":{}}})", tablesJson));
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
     }
 }
 
-std::string IPCHandler::uppercaseKeywords(std::string_view params) {
+std::string IPCHandler::closeEditorBuffer(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
-        auto sqlResult = doc["sql"].get_string();
-        if (sqlResult.error()) [[unlikely]] {
-            return JsonUtils::errorResponse("Missing sql field");
+        auto bufferIdResult = doc["bufferId"].get_string();
+        if (bufferIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: bufferId");
         }
-        std::string sqlQuery = std::string(sqlResult.value());
 
-        // Delegate to UtilityContext
-        auto uppercasedSQL = m_utilityContext->uppercaseKeywords(sqlQuery);
-        return JsonUtils::successResponse(std::format(R"({{"sql":"{}"}})", JsonUtils::escapeString(uppercasedSQL)));
+        m_completionIndexes.erase(std::string(bufferIdResult.value()));
+        return JsonUtils::successResponse("{\"closed\":true}");
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
     }
@@ -997,8 +2209,7 @@ std::string IPCHandler::uppercaseKeywords(std::string_view params) {
 
 std::string IPCHandler::parseA5ERFile(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto filepathResult = doc["filepath"].get_string();
         if (filepathResult.error()) [[unlikely]] {
@@ -1092,10 +2303,60 @@ std::string IPCHandler::retrieveQueryHistory(std::string_view) {
     return JsonUtils::successResponse(jsonResponse);
 }
 
+std::string IPCHandler::getQueryStatistics(std::string_view params) {
+    try {
+        // The "what should we optimize on the server" report: runs grouped
+        // by statement fingerprint with latency percentiles, sorted by the
+        // requested axis
+        std::string sortBy = "totalTime";
+        size_t limit = 20;
+        if (!params.empty()) {
+            simdjson::dom::element doc = paramsParser().parse(params);
+            if (auto sortResult = doc["sortBy"].get_string(); !sortResult.error()) {
+                sortBy = std::string(sortResult.value());
+            }
+            if (auto limitResult = doc["limit"].get_uint64(); !limitResult.error() && limitResult.value() > 0) {
+                limit = limitResult.value();
+            }
+        }
+
+        auto stats = m_queryHistory->aggregateByFingerprint();
+
+        if (sortBy == "count") {
+            std::ranges::sort(stats, [](const auto& a, const auto& b) { return a.runCount > b.runCount; });
+        } else if (sortBy == "p95") {
+            std::ranges::sort(stats, [](const auto& a, const auto& b) { return a.p95Ms > b.p95Ms; });
+        } else if (sortBy == "totalTime") {
+            std::ranges::sort(stats, [](const auto& a, const auto& b) { return a.totalTimeMs > b.totalTimeMs; });
+        } else {
+            return JsonUtils::errorResponse(std::format("Unknown sortBy: {}", sortBy));
+        }
+        if (stats.size() > limit) {
+            stats.resize(limit);
+        }
+
+        auto& jsonResponse = ResponseArena::acquire();
+        jsonResponse += R"({"statistics":[)";
+        for (size_t i = 0; i < stats.size(); ++i) {
+            if (i > 0) {
+                jsonResponse += ',';
+            }
+            const auto& entry = stats[i];
+            jsonResponse += std::format(R"({{"fingerprint":"{}","exampleSql":"{}","runCount":{},"failureCount":{},"totalTimeMs":{:.3f},"avgMs":{:.3f},"p50Ms":{:.3f},"p95Ms":{:.3f},"maxMs":{:.3f},"totalAffectedRows":{}}})",
+                                        JsonUtils::escapeString(entry.fingerprint), JsonUtils::escapeString(entry.exampleSql), entry.runCount, entry.failureCount, entry.totalTimeMs,
+                                        entry.runCount > 0 ? entry.totalTimeMs / static_cast<double>(entry.runCount) : 0.0, entry.p50Ms, entry.p95Ms, entry.maxMs, entry.totalAffectedRows);
+        }
+        jsonResponse += "]}";
+
+        return JsonUtils::successResponse(jsonResponse);
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
 std::string IPCHandler::getExecutionPlan(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto sqlQueryResult = doc["sql"].get_string();
@@ -1109,13 +2370,18 @@ std::string IPCHandler::getExecutionPlan(std::string_view params) {
             actualPlan = actual.value();
         }
 
+        // Re-opening the plan pane for a statement the schema has not moved
+        // under is answered from the cache without touching the server
+        const auto cacheKey = std::format("{}:{}:{}", connectionId, actualPlan ? "actual" : "estimated", sqlQuery);
+        if (auto cached = m_planCache.find(cacheKey); cached != m_planCache.end()) {
+            return JsonUtils::successResponse(std::format(R"({{"plan":"{}","actual":{},"cached":true}})", JsonUtils::escapeString(cached->second), actualPlan));
+        }
+
         auto connection = m_activeConnections.find(connectionId);
         if (connection == m_activeConnections.end()) [[unlikely]] {
             return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
         }
 
-        auto& driver = connection->second;
-
         // Build execution plan query for SQL Server
         std::string planQuery;
         if (actualPlan) {
@@ -1126,33 +2392,94 @@ std::string IPCHandler::getExecutionPlan(std::string_view params) {
             planQuery = std::format("SET SHOWPLAN_TEXT ON;\nGO\n{}\nGO\nSET SHOWPLAN_TEXT OFF;", sqlQuery);
         }
 
-        ResultSet queryResult = driver->execute(planQuery);
+        // SHOWPLAN round trips run on the executor pool, never the dispatch
+        // thread; the frontend polls getExecutionPlanResult for completion
+        auto driver = connection->second;  // Copy shared_ptr to extend lifetime during async execution
+        std::string queryId = m_asyncExecutor->submitQuery(driver, planQuery, WorkPriority::Interactive);
+        m_pendingPlans[queryId] = {.cacheKey = cacheKey, .actual = actualPlan};
+
+        return JsonUtils::successResponse(std::format(R"({{"queryId":"{}"}})", queryId));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::getExecutionPlanResult(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto queryIdResult = doc["queryId"].get_string();
+        if (queryIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: queryId");
+        }
+        auto queryId = std::string(queryIdResult.value());
+
+        auto pending = m_pendingPlans.find(queryId);
+        if (pending == m_pendingPlans.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Unknown plan request: {}", queryId));
+        }
+
+        auto asyncResult = m_asyncExecutor->getQueryResult(queryId);
+        if (asyncResult.status == QueryStatus::Pending || asyncResult.status == QueryStatus::Running) {
+            return JsonUtils::successResponse(R"({"status":"running"})");
+        }
+
+        const auto [cacheKey, actualPlan] = std::move(pending->second);
+        m_pendingPlans.erase(pending);
+        m_asyncExecutor->removeQuery(queryId);
+
+        if (asyncResult.status != QueryStatus::Completed) {
+            return JsonUtils::errorResponse(asyncResult.errorMessage.empty() ? "Execution plan retrieval cancelled" : asyncResult.errorMessage);
+        }
 
-        // Collect plan text from result
+        // Collect plan text across statements (the SHOWPLAN script returns
+        // one result per batch)
         std::string planText;
-        for (const auto& row : queryResult.rows) {
-            for (const auto& value : row.values) {
-                if (!planText.empty()) {
-                    planText += "\n";
+        const auto appendRows = [&planText](const ResultSet& resultSet) {
+            for (const auto& row : resultSet.rows) {
+                for (const auto& value : row.values) {
+                    if (!planText.empty()) {
+                        planText += "\n";
+                    }
+                    planText += value;
                 }
-                planText += value;
             }
+        };
+        if (asyncResult.multipleResults) {
+            for (const auto& statementResult : asyncResult.results) {
+                appendRows(statementResult.result);
+            }
+        } else if (asyncResult.result) {
+            appendRows(*asyncResult.result);
         }
 
-        std::string planJson = "{\"plan\":\"" + JsonUtils::escapeString(planText) + "\",";
-        planJson += "\"actual\":" + std::string(actualPlan ? "true" : "false") + "}";
-        return JsonUtils::successResponse(planJson);
+        m_planCache[cacheKey] = planText;
+
+        return JsonUtils::successResponse(std::format(R"({{"status":"completed","plan":"{}","actual":{},"cached":false}})", JsonUtils::escapeString(planText), actualPlan));
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
     }
 }
 
+void IPCHandler::invalidateExecutionPlans(const std::string& connectionId, std::string_view statementType) {
+    // DML leaves cached plans valid; only schema changes make them lie
+    if (statementType != "CREATE" && statementType != "ALTER" && statementType != "DROP") {
+        return;
+    }
+    const auto prefix = connectionId + ":";
+    std::erase_if(m_planCache, [&prefix](const auto& entry) { return entry.first.starts_with(prefix); });
+}
+
 std::string IPCHandler::getCacheStats(std::string_view) {
     auto currentSize = m_resultCache->getCurrentSize();
     auto maxSize = m_resultCache->getMaxSize();
 
-    std::string jsonResponse = std::format(R"({{"currentSizeBytes":{},"maxSizeBytes":{},"usagePercent":{:.1f}}})", currentSize, maxSize,
-                                           maxSize > 0 ? (static_cast<double>(currentSize) / static_cast<double>(maxSize)) * 100.0 : 0.0);
+    // Cache size plus the process-wide metrics snapshot: per-method IPC
+    // latency histograms, query pipeline timings, pool acquire waits,
+    // cache hit ratio and async queue depth
+    std::string jsonResponse = std::format(R"({{"currentSizeBytes":{},"maxSizeBytes":{},"usagePercent":{:.1f},"metrics":{},"memoryBudget":{}}})", currentSize, maxSize,
+                                           maxSize > 0 ? (static_cast<double>(currentSize) / static_cast<double>(maxSize)) * 100.0 : 0.0, Metrics::instance().snapshotJson(),
+                                           MemoryBudget::instance().snapshotJson());
 
     return JsonUtils::successResponse(jsonResponse);
 }
@@ -1164,8 +2491,7 @@ std::string IPCHandler::clearCache(std::string_view) {
 
 std::string IPCHandler::executeAsyncQuery(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto sqlQueryResult = doc["sql"].get_string();
@@ -1180,8 +2506,50 @@ std::string IPCHandler::executeAsyncQuery(std::string_view params) {
             return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
         }
 
+        // Exports and schema refresh submit as "background" so they never
+        // delay an interactive grid query queued behind them
+        auto priority = WorkPriority::Interactive;
+        if (auto priorityResult = doc["priority"].get_string(); !priorityResult.error() && priorityResult.value() == "background") {
+            priority = WorkPriority::Background;
+        }
+
         auto driver = connection->second;  // Copy shared_ptr to extend lifetime during async execution
-        std::string queryId = m_asyncExecutor->submitQuery(driver, sqlQuery);
+
+        // Per-run watchdog override; absent means the settings default,
+        // an explicit 0 lets a known-long run opt out
+        std::optional<std::chrono::seconds> timeout;
+        if (auto timeoutResult = doc["timeoutSeconds"].get_int64(); !timeoutResult.error() && timeoutResult.value() >= 0) {
+            timeout = std::chrono::seconds(timeoutResult.value());
+        }
+
+        // Opt-in parallel script mode: a script of independent statements
+        // (50 index rebuilds) fans out across pool connections instead of
+        // running serially on one. Any statement that might carry session
+        // state keeps the whole script on the serial path.
+        if (auto parallelResult = doc["parallel"].get_bool(); !parallelResult.error() && parallelResult.value()) {
+            auto statements = SQLParser::splitStatements(sqlQuery);
+            const bool eligible = statements.size() > 1 && std::ranges::all_of(statements, [](std::string_view stmt) { return SQLParser::isParallelSafeStatement(stmt); });
+            if (eligible) {
+                static constexpr size_t MAX_PARALLEL_CONNECTIONS = 4;
+                std::vector<std::shared_ptr<SQLServerDriver>> drivers{driver};
+                const auto wanted = (std::min)(statements.size(), MAX_PARALLEL_CONNECTIONS);
+                while (drivers.size() < wanted) {
+                    auto extra = m_connectionPool->acquire(connectionId);
+                    if (!extra) {
+                        break;  // Pool exhausted; run with what we have
+                    }
+                    drivers.push_back(std::move(extra));
+                }
+                if (drivers.size() > 1) {
+                    auto releaseDriver = [this, connectionId](std::shared_ptr<SQLServerDriver> finished) { m_connectionPool->release(connectionId, std::move(finished)); };
+                    std::string queryId = m_asyncExecutor->submitParallelScript(std::move(drivers), sqlQuery, priority, std::move(releaseDriver));
+                    return JsonUtils::successResponse(std::format(R"({{"queryId":"{}","parallel":true}})", queryId));
+                }
+            }
+            // Not eligible or no spare connections: fall through to serial
+        }
+
+        std::string queryId = m_asyncExecutor->submitQuery(driver, sqlQuery, priority, timeout);
 
         return JsonUtils::successResponse(std::format(R"({{"queryId":"{}"}})", queryId));
     } catch (const std::exception& e) {
@@ -1191,8 +2559,7 @@ std::string IPCHandler::executeAsyncQuery(std::string_view params) {
 
 std::string IPCHandler::getAsyncQueryResult(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto queryIdResult = doc["queryId"].get_string();
         if (queryIdResult.error()) [[unlikely]] {
@@ -1221,9 +2588,18 @@ std::string IPCHandler::getAsyncQueryResult(std::string_view params) {
                 break;
         }
 
-        std::string jsonResponse = "{";
+        // Polled every frame while a query runs; the arena keeps its
+        // capacity so repeated polls allocate nothing for the body
+        auto& jsonResponse = ResponseArena::acquire();
+        jsonResponse += "{";
         jsonResponse += std::format(R"("queryId":"{}","status":"{}")", asyncResult.queryId, statusStr);
 
+        // Early rows of a still-running query; the full set replaces them
+        // on the completed poll
+        if (asyncResult.partial) {
+            jsonResponse += R"(,"partial":true)";
+        }
+
         if (!asyncResult.errorMessage.empty()) {
             jsonResponse += std::format(R"(,"error":"{}")", JsonUtils::escapeString(asyncResult.errorMessage));
         }
@@ -1237,9 +2613,9 @@ std::string IPCHandler::getAsyncQueryResult(std::string_view params) {
 
                 const auto& stmtResult = asyncResult.results[i];
                 jsonResponse += R"({"statement":")";
-                jsonResponse += JsonUtils::escapeString(stmtResult.statement);
+                JsonUtils::appendEscaped(jsonResponse, stmtResult.statement);
                 jsonResponse += R"(","data":)";
-                jsonResponse += JsonUtils::serializeResultSet(stmtResult.result, false);
+                JsonUtils::serializeResultSetInto(jsonResponse, stmtResult.result, false);
                 jsonResponse += "}";
             }
             jsonResponse += "]";
@@ -1263,7 +2639,9 @@ std::string IPCHandler::getAsyncQueryResult(std::string_view params) {
                 for (size_t colIndex = 0; colIndex < queryResult.rows[rowIndex].values.size(); ++colIndex) {
                     if (colIndex > 0)
                         jsonResponse += ',';
-                    jsonResponse += std::format(R"("{}")", JsonUtils::escapeString(queryResult.rows[rowIndex].values[colIndex]));
+                    jsonResponse += '"';
+                    JsonUtils::appendEscaped(jsonResponse, queryResult.rows[rowIndex].values[colIndex]);
+                    jsonResponse += '"';
                 }
                 jsonResponse += ']';
             }
@@ -1280,10 +2658,48 @@ std::string IPCHandler::getAsyncQueryResult(std::string_view params) {
     }
 }
 
+std::string IPCHandler::getResultRows(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto queryIdResult = doc["queryId"].get_string();
+        if (queryIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: queryId");
+        }
+        auto queryId = std::string(queryIdResult.value());
+
+        size_t offset = 0;
+        if (auto offsetOpt = doc["offset"].get_int64(); !offsetOpt.error() && offsetOpt.value() > 0) {
+            offset = static_cast<size_t>(offsetOpt.value());
+        }
+        size_t count = 100;
+        if (auto countOpt = doc["count"].get_int64(); !countOpt.error() && countOpt.value() > 0) {
+            count = static_cast<size_t>(countOpt.value());
+        }
+        size_t statementIndex = 0;
+        if (auto indexOpt = doc["statementIndex"].get_int64(); !indexOpt.error() && indexOpt.value() > 0) {
+            statementIndex = static_cast<size_t>(indexOpt.value());
+        }
+
+        auto window = m_asyncExecutor->getResultWindow(queryId, offset, count, statementIndex);
+        if (!window) {
+            return JsonUtils::errorResponse(std::format("No completed result for query: {}", queryId));
+        }
+
+        // Only the viewport crosses the bridge; totalRows sizes the scrollbar
+        auto& json = ResponseArena::acquire();
+        json += std::format(R"({{"queryId":"{}","offset":{},"totalRows":{},"data":)", queryId, window->offset, window->totalRows);
+        JsonUtils::serializeResultSetInto(json, window->rows, false);
+        json += '}';
+        return JsonUtils::successResponse(json);
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
 std::string IPCHandler::cancelAsyncQuery(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto queryIdResult = doc["queryId"].get_string();
         if (queryIdResult.error()) [[unlikely]] {
@@ -1315,38 +2731,74 @@ std::string IPCHandler::getActiveQueries(std::string_view) {
 
 std::string IPCHandler::filterResultSet(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto sqlQueryResult = doc["sql"].get_string();
-        auto columnIndexResult = doc["columnIndex"].get_uint64();
-        auto filterTypeResult = doc["filterType"].get_string();
-        auto filterValueResult = doc["filterValue"].get_string();
-        if (connectionIdResult.error() || sqlQueryResult.error() || columnIndexResult.error() || filterTypeResult.error() || filterValueResult.error()) [[unlikely]] {
-            return JsonUtils::errorResponse("Missing required fields: connectionId, sql, columnIndex, filterType, or filterValue");
+        if (connectionIdResult.error() || sqlQueryResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId or sql");
         }
         auto connectionId = std::string(connectionIdResult.value());
         auto sqlQuery = std::string(sqlQueryResult.value());
-        auto columnIndex = columnIndexResult.value();
-        auto filterType = std::string(filterTypeResult.value());
-        auto filterValue = std::string(filterValueResult.value());
+
+        // Compound mode carries its conditions in a "filter" tree; the
+        // original single-column fields stay required otherwise
+        auto compoundNode = doc["filter"];
+        size_t columnIndex = 0;
+        std::string filterType;
+        std::string filterValue;
+        if (compoundNode.error()) {
+            auto columnIndexResult = doc["columnIndex"].get_uint64();
+            auto filterTypeResult = doc["filterType"].get_string();
+            auto filterValueResult = doc["filterValue"].get_string();
+            if (columnIndexResult.error() || filterTypeResult.error() || filterValueResult.error()) [[unlikely]] {
+                return JsonUtils::errorResponse("Missing required fields: columnIndex, filterType, or filterValue");
+            }
+            columnIndex = columnIndexResult.value();
+            filterType = std::string(filterTypeResult.value());
+            filterValue = std::string(filterValueResult.value());
+        }
 
         auto connection = m_activeConnections.find(connectionId);
         if (connection == m_activeConnections.end()) [[unlikely]] {
             return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
         }
 
-        // First execute the query to get data
+        // Reuse the cached result across keystrokes; re-running the SELECT
+        // per filter character would dwarf any scan savings
         auto& driver = connection->second;
-        ResultSet queryResult = driver->execute(sqlQuery);
+        std::string cacheKey = resultCacheKey(connectionId, sqlQuery);
+        std::shared_ptr<const ResultSet> data = m_resultCache->get(cacheKey);
+        if (!data) {
+            data = std::make_shared<const ResultSet>(driver->execute(sqlQuery));
+            m_resultCache->put(cacheKey, data, SQLParser::extractTableNames(sqlQuery));
+        }
+        const ResultSet& queryResult = *data;
 
         // Apply SIMD-optimized filter
         std::vector<size_t> matchingIndices;
-        if (filterType == "equals") {
+        if (!compoundNode.error()) {
+            // AND/OR tree evaluated with selection vectors: one full pass
+            // for the first term, shrinking passes for the rest
+            SIMDFilter::CompoundFilter compound;
+            if (!parseCompoundFilter(compoundNode.value(), queryResult.columns.size(), compound)) {
+                return JsonUtils::errorResponse("Invalid compound filter");
+            }
+            matchingIndices = m_utilityContext->simdFilter().filterCompound(queryResult, compound);
+        } else if (filterType == "equals") {
             matchingIndices = m_utilityContext->simdFilter().filterEquals(queryResult, columnIndex, filterValue);
         } else if (filterType == "contains") {
-            matchingIndices = m_utilityContext->simdFilter().filterContains(queryResult, columnIndex, filterValue);
+            // Incremental refinement: if the new pattern contains the prior
+            // one over the same data, only prior matches can still match
+            const auto contextKey = std::format("{}:{}:{}", connectionId, columnIndex, sqlQuery);
+            const bool refinable = m_filterRefinement.contextKey == contextKey && m_filterRefinement.rowCount == queryResult.rows.size() && !m_filterRefinement.pattern.empty() &&
+                                   filterValue.size() > m_filterRefinement.pattern.size() && filterValue.find(m_filterRefinement.pattern) != std::string::npos;
+            if (refinable) {
+                matchingIndices = m_utilityContext->simdFilter().filterContains(queryResult, columnIndex, filterValue, m_filterRefinement.matches);
+            } else {
+                matchingIndices = m_utilityContext->simdFilter().filterContains(queryResult, columnIndex, filterValue);
+            }
+            m_filterRefinement = FilterRefinement{.contextKey = contextKey, .pattern = filterValue, .rowCount = queryResult.rows.size(), .matches = matchingIndices};
         } else if (filterType == "range") {
             std::string minValue = filterValue;
             std::string maxValue;
@@ -1359,7 +2811,8 @@ std::string IPCHandler::filterResultSet(std::string_view params) {
         }
 
         // Build filtered result
-        std::string jsonResponse = "{";
+        auto& jsonResponse = ResponseArena::acquire();
+        jsonResponse += "{";
 
         // Columns
         jsonResponse += R"("columns":[)";
@@ -1380,7 +2833,9 @@ std::string IPCHandler::filterResultSet(std::string_view params) {
             for (size_t colIndex = 0; colIndex < row.values.size(); ++colIndex) {
                 if (colIndex > 0)
                     jsonResponse += ',';
-                jsonResponse += std::format(R"("{}")", JsonUtils::escapeString(row.values[colIndex]));
+                jsonResponse += '"';
+                JsonUtils::appendEscaped(jsonResponse, row.values[colIndex]);
+                jsonResponse += '"';
             }
             jsonResponse += ']';
         }
@@ -1394,8 +2849,256 @@ std::string IPCHandler::filterResultSet(std::string_view params) {
     }
 }
 
+std::string IPCHandler::sortResultSet(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto connectionIdResult = doc["connectionId"].get_string();
+        auto sqlQueryResult = doc["sql"].get_string();
+        auto columnIndexResult = doc["columnIndex"].get_uint64();
+        if (connectionIdResult.error() || sqlQueryResult.error() || columnIndexResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId, sql, or columnIndex");
+        }
+        auto connectionId = std::string(connectionIdResult.value());
+        auto sqlQuery = std::string(sqlQueryResult.value());
+        auto columnIndex = columnIndexResult.value();
+
+        bool ascending = true;
+        if (auto asc = doc["ascending"].get_bool(); !asc.error()) {
+            ascending = asc.value();
+        }
+        size_t offset = 0;
+        if (auto offsetResult = doc["offset"].get_uint64(); !offsetResult.error()) {
+            offset = offsetResult.value();
+        }
+        size_t count = 100;
+        if (auto countResult = doc["count"].get_uint64(); !countResult.error()) {
+            count = countResult.value();
+        }
+
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
+        }
+
+        auto& driver = connection->second;
+        std::string cacheKey = resultCacheKey(connectionId, sqlQuery);
+        std::shared_ptr<const ResultSet> data = m_resultCache->get(cacheKey);
+        if (!data) {
+            data = std::make_shared<const ResultSet>(driver->execute(sqlQuery));
+            m_resultCache->put(cacheKey, data, SQLParser::extractTableNames(sqlQuery));
+        }
+        const ResultSet& queryResult = *data;
+        const size_t totalRows = queryResult.rows.size();
+
+        // Shallow windows (the common header-click-then-look case) only
+        // need the first offset+count rows in order; a full sort is worth
+        // it once the user has scrolled into the deep half
+        const size_t windowEnd = offset + count;
+        std::vector<size_t> order;
+        if (windowEnd < totalRows / 2) {
+            order = m_utilityContext->simdFilter().sortTopK(queryResult, columnIndex, windowEnd, ascending);
+        } else {
+            order = m_utilityContext->simdFilter().sortByColumn(queryResult, columnIndex, ascending);
+        }
+
+        const size_t first = (std::min)(offset, order.size());
+        const size_t last = (std::min)(windowEnd, order.size());
+
+        auto& jsonResponse = ResponseArena::acquire();
+        jsonResponse += std::format(R"({{"offset":{},"totalRows":{},"columns":[)", first, totalRows);
+        for (size_t i = 0; i < queryResult.columns.size(); ++i) {
+            if (i > 0) {
+                jsonResponse += ',';
+            }
+            jsonResponse += std::format(R"({{"name":"{}","type":"{}"}})", JsonUtils::escapeString(queryResult.columns[i].name), queryResult.columns[i].type);
+        }
+        jsonResponse += R"(],"rows":[)";
+        for (size_t i = first; i < last; ++i) {
+            if (i > first) {
+                jsonResponse += ',';
+            }
+            jsonResponse += '[';
+            const auto& row = queryResult.rows[order[i]];
+            for (size_t colIndex = 0; colIndex < row.values.size(); ++colIndex) {
+                if (colIndex > 0) {
+                    jsonResponse += ',';
+                }
+                jsonResponse += '"';
+                JsonUtils::appendEscaped(jsonResponse, row.values[colIndex]);
+                jsonResponse += '"';
+            }
+            jsonResponse += ']';
+        }
+        jsonResponse += "]}";
+
+        return JsonUtils::successResponse(jsonResponse);
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::aggregateResultSet(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto connectionIdResult = doc["connectionId"].get_string();
+        auto sqlQueryResult = doc["sql"].get_string();
+        auto columnIndexResult = doc["columnIndex"].get_uint64();
+        if (connectionIdResult.error() || sqlQueryResult.error() || columnIndexResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId, sql, or columnIndex");
+        }
+        auto connectionId = std::string(connectionIdResult.value());
+        auto sqlQuery = std::string(sqlQueryResult.value());
+        auto columnIndex = columnIndexResult.value();
+
+        // Optional: group the aggregation by another column
+        std::optional<size_t> groupByColumn;
+        if (auto groupBy = doc["groupByColumn"].get_uint64(); !groupBy.error()) {
+            groupByColumn = groupBy.value();
+        }
+
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
+        }
+
+        // Same cached-result reuse as filterResultSet: the stats panel
+        // recomputes on every column selection, not on every query
+        auto& driver = connection->second;
+        std::string cacheKey = resultCacheKey(connectionId, sqlQuery);
+        std::shared_ptr<const ResultSet> data = m_resultCache->get(cacheKey);
+        if (!data) {
+            data = std::make_shared<const ResultSet>(driver->execute(sqlQuery));
+            m_resultCache->put(cacheKey, data, SQLParser::extractTableNames(sqlQuery));
+        }
+
+        const auto& aggregator = m_utilityContext->resultAggregator();
+        auto stats = aggregator.columnStatistics(*data, columnIndex);
+
+        auto& jsonResponse = ResponseArena::acquire();
+        jsonResponse += std::format(R"({{"rowCount":{},"nonNullCount":{},"distinctCount":{},"numeric":{})", stats.rowCount, stats.nonNullCount, stats.distinctCount, stats.numeric ? "true" : "false");
+        if (stats.numeric) {
+            jsonResponse += std::format(R"(,"sum":{},"avg":{},"min":{},"max":{})", stats.sum, stats.average, stats.minimum, stats.maximum);
+        }
+
+        if (groupByColumn) {
+            // Cap the group list; the panel shows the top of the
+            // distribution, not every distinct key of a wide column
+            constexpr size_t MAX_GROUPS = 1000;
+            auto groups = aggregator.groupBy(*data, *groupByColumn, columnIndex);
+            jsonResponse += std::format(R"(,"groupCount":{},"groups":[)", groups.size());
+            const auto emitted = (std::min)(groups.size(), MAX_GROUPS);
+            for (size_t i = 0; i < emitted; ++i) {
+                if (i > 0) {
+                    jsonResponse += ',';
+                }
+                jsonResponse += R"({"key":")";
+                JsonUtils::appendEscaped(jsonResponse, groups[i].key);
+                jsonResponse += std::format(R"(","count":{},"sum":{},"min":{},"max":{}}})", groups[i].count, groups[i].sum, groups[i].minimum, groups[i].maximum);
+            }
+            jsonResponse += ']';
+        }
+        jsonResponse += '}';
+
+        return JsonUtils::successResponse(jsonResponse);
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::diffResultSets(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto beforeQueryIdResult = doc["beforeQueryId"].get_string();
+        auto afterQueryIdResult = doc["afterQueryId"].get_string();
+        if (beforeQueryIdResult.error() || afterQueryIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: beforeQueryId or afterQueryId");
+        }
+
+        // Key columns identify a row across the two runs; omitted = whole row
+        std::vector<size_t> keyColumns;
+        if (auto keys = doc["keyColumns"].get_array(); !keys.error()) {
+            for (auto key : keys.value()) {
+                if (auto index = key.get_uint64(); !index.error()) {
+                    keyColumns.push_back(index.value());
+                }
+            }
+        }
+
+        const auto fetchCompleted = [this](std::string_view queryId) -> std::expected<ResultSet, std::string> {
+            auto asyncResult = m_asyncExecutor->getQueryResult(queryId);
+            if (asyncResult.status != QueryStatus::Completed) {
+                return std::unexpected(std::format("Query {} is not completed", queryId));
+            }
+            if (asyncResult.multipleResults || !asyncResult.result.has_value()) {
+                return std::unexpected(std::format("Query {} did not produce a single result set", queryId));
+            }
+            return std::move(*asyncResult.result);
+        };
+
+        auto before = fetchCompleted(beforeQueryIdResult.value());
+        if (!before) {
+            return JsonUtils::errorResponse(before.error());
+        }
+        auto after = fetchCompleted(afterQueryIdResult.value());
+        if (!after) {
+            return JsonUtils::errorResponse(after.error());
+        }
+
+        const auto summary = m_utilityContext->resultDiffer().diff(*before, *after, keyColumns);
+
+        // Counts are always complete; the per-row index lists are capped so
+        // a diff of two wildly different sets cannot build a gigabyte reply
+        static constexpr size_t MAX_REPORTED_ROWS = 10000;
+        const bool truncated = summary.addedRows.size() > MAX_REPORTED_ROWS || summary.removedRows.size() > MAX_REPORTED_ROWS || summary.changedRows.size() > MAX_REPORTED_ROWS;
+
+        auto& jsonResponse = ResponseArena::acquire();
+        jsonResponse += std::format(R"({{"addedCount":{},"removedCount":{},"changedCount":{},"unchangedCount":{},"truncated":{})", summary.addedRows.size(), summary.removedRows.size(),
+                                    summary.changedRows.size(), summary.unchangedRows, truncated ? "true" : "false");
+
+        const auto appendIndexes = [&jsonResponse](std::string_view field, const std::vector<size_t>& indexes) {
+            jsonResponse += std::format(R"(,"{}":[)", field);
+            const auto emitted = (std::min)(indexes.size(), MAX_REPORTED_ROWS);
+            for (size_t i = 0; i < emitted; ++i) {
+                if (i > 0) {
+                    jsonResponse += ',';
+                }
+                jsonResponse += std::format("{}", indexes[i]);
+            }
+            jsonResponse += ']';
+        };
+        appendIndexes("added", summary.addedRows);
+        appendIndexes("removed", summary.removedRows);
+
+        jsonResponse += R"(,"changed":[)";
+        const auto emittedChanges = (std::min)(summary.changedRows.size(), MAX_REPORTED_ROWS);
+        for (size_t i = 0; i < emittedChanges; ++i) {
+            if (i > 0) {
+                jsonResponse += ',';
+            }
+            const auto& change = summary.changedRows[i];
+            jsonResponse += std::format(R"({{"beforeRow":{},"afterRow":{},"columns":[)", change.beforeRow, change.afterRow);
+            for (size_t c = 0; c < change.changedColumns.size(); ++c) {
+                if (c > 0) {
+                    jsonResponse += ',';
+                }
+                jsonResponse += std::format("{}", change.changedColumns[c]);
+            }
+            jsonResponse += "]}";
+        }
+        jsonResponse += "]}";
+
+        return JsonUtils::successResponse(jsonResponse);
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
 std::string IPCHandler::getSettings(std::string_view) {
-    const auto& settings = m_settingsContext->settingsManager().getSettings();
+    const auto snapshot = m_settingsContext->settingsManager().getSettings();
+    const auto& settings = *snapshot;
 
     std::string json = "{";
 
@@ -1437,10 +3140,9 @@ std::string IPCHandler::getSettings(std::string_view) {
 
 std::string IPCHandler::updateSettings(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
-        AppSettings settings = m_settingsContext->settingsManager().getSettings();
+        AppSettings settings = *m_settingsContext->settingsManager().getSettings();
 
         // Update general settings
         if (auto general = doc["general"]; !general.error()) {
@@ -1452,6 +3154,12 @@ std::string IPCHandler::updateSettings(std::string_view params) {
                 settings.general.maxQueryHistory = static_cast<int>(val.value());
             if (auto val = general["language"].get_string(); !val.error())
                 settings.general.language = std::string(val.value());
+            if (auto val = general["memoryBudgetMb"].get_int64(); !val.error() && val.value() > 0)
+                settings.general.memoryBudgetMb = static_cast<int>(val.value());
+            if (auto val = general["queryTimeoutSeconds"].get_int64(); !val.error() && val.value() >= 0)
+                settings.general.queryTimeoutSeconds = static_cast<int>(val.value());
+            if (auto val = general["dmlBatchSize"].get_int64(); !val.error() && val.value() >= 0)
+                settings.general.dmlBatchSize = static_cast<int>(val.value());
         }
 
         // Update editor settings
@@ -1495,6 +3203,13 @@ std::string IPCHandler::updateSettings(std::string_view params) {
         m_settingsContext->settingsManager().updateSettings(settings);
         m_settingsContext->settingsManager().save();
 
+        // A lowered budget evicts immediately
+        MemoryBudget::instance().setBudgetBytes(static_cast<size_t>(settings.general.memoryBudgetMb) * 1024 * 1024);
+
+        // New submissions pick up the new watchdog budget; running queries
+        // keep the budget they started with
+        m_asyncExecutor->setDefaultTimeout(std::chrono::seconds(settings.general.queryTimeoutSeconds));
+
         return JsonUtils::successResponse(R"({"saved":true})");
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
@@ -1541,8 +3256,7 @@ std::string IPCHandler::getConnectionProfiles(std::string_view) {
 
 std::string IPCHandler::saveConnectionProfile(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         ConnectionProfile profile;
         if (auto val = doc["id"].get_string(); !val.error())
@@ -1645,8 +3359,7 @@ std::string IPCHandler::saveConnectionProfile(std::string_view params) {
 
 std::string IPCHandler::deleteConnectionProfile(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto profileIdResult = doc["id"].get_string();
         if (profileIdResult.error()) [[unlikely]] {
@@ -1664,8 +3377,7 @@ std::string IPCHandler::deleteConnectionProfile(std::string_view params) {
 
 std::string IPCHandler::getProfilePassword(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto idResult = doc["id"].get_string();
         if (idResult.error()) [[unlikely]] {
@@ -1686,8 +3398,7 @@ std::string IPCHandler::getProfilePassword(std::string_view params) {
 
 std::string IPCHandler::getSshPassword(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto idResult = doc["id"].get_string();
         if (idResult.error()) [[unlikely]] {
@@ -1708,8 +3419,7 @@ std::string IPCHandler::getSshPassword(std::string_view params) {
 
 std::string IPCHandler::getSshKeyPassphrase(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto idResult = doc["id"].get_string();
         if (idResult.error()) [[unlikely]] {
@@ -1751,7 +3461,12 @@ std::string IPCHandler::getSessionState(std::string_view) {
         json += "{";
         json += std::format("\"id\":\"{}\",", JsonUtils::escapeString(tab.id));
         json += std::format("\"title\":\"{}\",", JsonUtils::escapeString(tab.title));
-        json += std::format("\"content\":\"{}\",", JsonUtils::escapeString(tab.content));
+        // Content is included only once loaded; background tabs restore
+        // as metadata and fetch it via getSessionTabContent on focus
+        if (tab.contentLoaded) {
+            json += std::format("\"content\":\"{}\",", JsonUtils::escapeString(tab.content));
+        }
+        json += std::format("\"contentLoaded\":{},", tab.contentLoaded ? "true" : "false");
         json += std::format("\"filePath\":\"{}\",", JsonUtils::escapeString(tab.filePath));
         json += std::format("\"isDirty\":{},", tab.isDirty ? "true" : "false");
         json += std::format("\"cursorLine\":{},", tab.cursorLine);
@@ -1776,8 +3491,7 @@ std::string IPCHandler::getSessionState(std::string_view) {
 
 std::string IPCHandler::saveSessionState(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         SessionState state = m_settingsContext->sessionManager().getState();
 
@@ -1809,8 +3523,13 @@ std::string IPCHandler::saveSessionState(std::string_view params) {
                     tab.id = std::string(val.value());
                 if (auto val = tabEl["title"].get_string(); !val.error())
                     tab.title = std::string(val.value());
-                if (auto val = tabEl["content"].get_string(); !val.error())
+                // A tab the frontend never focused comes back without
+                // content; SessionManager keeps its stored content
+                if (auto val = tabEl["content"].get_string(); !val.error()) {
                     tab.content = std::string(val.value());
+                } else {
+                    tab.contentLoaded = false;
+                }
                 if (auto val = tabEl["filePath"].get_string(); !val.error())
                     tab.filePath = std::string(val.value());
                 if (auto val = tabEl["isDirty"].get_bool(); !val.error())
@@ -1833,10 +3552,33 @@ std::string IPCHandler::saveSessionState(std::string_view params) {
             }
         }
 
-        m_settingsContext->sessionManager().updateState(state);
-        m_settingsContext->sessionManager().save();
+        m_settingsContext->sessionManager().updateState(state);
+        // Debounced differential save: updateState marked what changed,
+        // so a keystroke burst writes one small tab file once
+        m_settingsContext->sessionManager().requestSave();
+
+        return JsonUtils::successResponse(R"({"saved":true})");
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::getSessionTabContent(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto tabIdResult = doc["tabId"].get_string();
+        if (tabIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: tabId");
+        }
+        auto tabId = std::string(tabIdResult.value());
+
+        auto content = m_settingsContext->sessionManager().loadTabContent(tabId);
+        if (!content) {
+            return JsonUtils::errorResponse(std::format("Unknown tab: {}", tabId));
+        }
 
-        return JsonUtils::successResponse(R"({"saved":true})");
+        return JsonUtils::successResponse(std::format(R"({{"tabId":"{}","content":"{}"}})", JsonUtils::escapeString(tabId), JsonUtils::escapeString(*content)));
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
     }
@@ -1844,8 +3586,7 @@ std::string IPCHandler::saveSessionState(std::string_view params) {
 
 std::string IPCHandler::searchObjects(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto patternResult = doc["pattern"].get_string();
@@ -1900,8 +3641,7 @@ std::string IPCHandler::searchObjects(std::string_view params) {
 
 std::string IPCHandler::quickSearch(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto prefixResult = doc["prefix"].get_string();
@@ -1937,8 +3677,7 @@ std::string IPCHandler::quickSearch(std::string_view params) {
 
 std::string IPCHandler::fetchIndexes(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto tableNameResult = doc["table"].get_string();
@@ -1991,7 +3730,7 @@ std::string IPCHandler::fetchIndexes(std::string_view params) {
             // Convert comma-separated columns to array
             json += "\"columns\":[";
             if (!row.values[4].empty()) {
-                std::string cols = row.values[4];
+                std::string cols(row.values[4]);
                 size_t pos = 0;
                 bool first = true;
                 while ((pos = cols.find(',')) != std::string::npos || !cols.empty()) {
@@ -2024,8 +3763,7 @@ std::string IPCHandler::fetchIndexes(std::string_view params) {
 
 std::string IPCHandler::fetchConstraints(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto tableNameResult = doc["table"].get_string();
@@ -2078,7 +3816,7 @@ std::string IPCHandler::fetchConstraints(std::string_view params) {
             // Convert comma-separated columns to array
             json += "\"columns\":[";
             if (!row.values[2].empty()) {
-                std::string cols = row.values[2];
+                std::string cols(row.values[2]);
                 size_t pos = 0;
                 bool first = true;
                 while ((pos = cols.find(',')) != std::string::npos || !cols.empty()) {
@@ -2112,8 +3850,7 @@ std::string IPCHandler::fetchConstraints(std::string_view params) {
 
 std::string IPCHandler::fetchForeignKeys(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto tableNameResult = doc["table"].get_string();
@@ -2168,7 +3905,7 @@ std::string IPCHandler::fetchForeignKeys(std::string_view params) {
             // Columns array
             json += "\"columns\":[";
             if (!row.values[1].empty()) {
-                std::string cols = row.values[1];
+                std::string cols(row.values[1]);
                 size_t pos = 0;
                 bool first = true;
                 while ((pos = cols.find(',')) != std::string::npos || !cols.empty()) {
@@ -2193,7 +3930,7 @@ std::string IPCHandler::fetchForeignKeys(std::string_view params) {
             // Referenced columns array
             json += "\"referencedColumns\":[";
             if (!row.values[3].empty()) {
-                std::string cols = row.values[3];
+                std::string cols(row.values[3]);
                 size_t pos = 0;
                 bool first = true;
                 while ((pos = cols.find(',')) != std::string::npos || !cols.empty()) {
@@ -2228,8 +3965,7 @@ std::string IPCHandler::fetchForeignKeys(std::string_view params) {
 
 std::string IPCHandler::fetchReferencingForeignKeys(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto tableNameResult = doc["table"].get_string();
@@ -2285,7 +4021,7 @@ std::string IPCHandler::fetchReferencingForeignKeys(std::string_view params) {
             // Referencing columns array
             json += "\"referencingColumns\":[";
             if (!row.values[2].empty()) {
-                std::string cols = row.values[2];
+                std::string cols(row.values[2]);
                 size_t pos = 0;
                 bool first = true;
                 while ((pos = cols.find(',')) != std::string::npos || !cols.empty()) {
@@ -2309,7 +4045,7 @@ std::string IPCHandler::fetchReferencingForeignKeys(std::string_view params) {
             // Referenced columns (on this table)
             json += "\"columns\":[";
             if (!row.values[3].empty()) {
-                std::string cols = row.values[3];
+                std::string cols(row.values[3]);
                 size_t pos = 0;
                 bool first = true;
                 while ((pos = cols.find(',')) != std::string::npos || !cols.empty()) {
@@ -2344,8 +4080,7 @@ std::string IPCHandler::fetchReferencingForeignKeys(std::string_view params) {
 
 std::string IPCHandler::fetchTriggers(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto tableNameResult = doc["table"].get_string();
@@ -2401,7 +4136,7 @@ std::string IPCHandler::fetchTriggers(std::string_view params) {
             // Events array
             json += "\"events\":[";
             if (!row.values[2].empty()) {
-                std::string events = row.values[2];
+                std::string events(row.values[2]);
                 size_t pos = 0;
                 bool first = true;
                 while ((pos = events.find(',')) != std::string::npos || !events.empty()) {
@@ -2434,10 +4169,112 @@ std::string IPCHandler::fetchTriggers(std::string_view params) {
     }
 }
 
+std::string IPCHandler::fetchDatabaseSchema(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto connectionIdResult = doc["connectionId"].get_string();
+        if (connectionIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: connectionId");
+        }
+        auto connectionId = std::string(connectionIdResult.value());
+
+        std::string database;
+        if (auto databaseResult = doc["database"].get_string(); !databaseResult.error()) {
+            database = std::string(databaseResult.value());
+        }
+
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
+        }
+
+        m_schemaInspector->setDriver(connection->second);
+
+        // Snapshot persisted by a previous run: answer with zero round
+        // trips and confirm the stamp against sys.objects on a worker
+        // thread - a stale tree triggers an event so the frontend
+        // refetches, which re-hydrates for real
+        if (auto snapshot = m_schemaInspector->peekSnapshot(database); !snapshot.empty()) {
+            auto& jsonResponse = ResponseArena::acquire();
+            jsonResponse += R"({"tables":[)";
+            appendSchemaTablesJson(jsonResponse, snapshot);
+            jsonResponse += "]}";
+
+            auto connectionString = std::string(connection->second->getConnectionString());
+            if (m_schemaRefreshThread.joinable()) {
+                m_schemaRefreshThread.join();
+            }
+            m_schemaRefreshThread = std::thread([this, connectionId, connectionString = std::move(connectionString), database] {
+                if (!m_schemaInspector->validateSnapshot(connectionString, database) && m_eventSink) {
+                    m_eventSink(std::format(R"({{"event":"schemaSnapshotStale","connectionId":"{}","database":"{}"}})", connectionId, JsonUtils::escapeString(database)));
+                }
+            });
+
+            return JsonUtils::successResponse(jsonResponse);
+        }
+
+        auto schemas = m_schemaInspector->hydrateDatabaseSchema(database);
+
+        auto& jsonResponse = ResponseArena::acquire();
+        jsonResponse += R"({"tables":[)";
+        appendSchemaTablesJson(jsonResponse, schemas);
+        jsonResponse += "]}";
+
+        return JsonUtils::successResponse(jsonResponse);
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+void IPCHandler::appendSchemaTablesJson(std::string& json, const std::vector<TableSchema>& schemas) const {
+    for (size_t i = 0; i < schemas.size(); ++i) {
+        if (i > 0) {
+            json += ',';
+        }
+        const auto& schema = schemas[i];
+        json += std::format(R"({{"schema":"{}","name":"{}","type":"{}","comment":"{}","columns":[)", JsonUtils::escapeString(schema.table.schema), JsonUtils::escapeString(schema.table.name),
+                            JsonUtils::escapeString(schema.table.type), JsonUtils::escapeString(schema.table.comment));
+        for (size_t c = 0; c < schema.columns.size(); ++c) {
+            if (c > 0) {
+                json += ',';
+            }
+            const auto& col = schema.columns[c];
+            json += std::format(R"({{"name":"{}","type":"{}","size":{},"nullable":{},"isPrimaryKey":{},"comment":"{}"}})", JsonUtils::escapeString(col.name), JsonUtils::escapeString(col.type), col.size,
+                                col.nullable ? "true" : "false", col.isPrimaryKey ? "true" : "false", JsonUtils::escapeString(col.comment));
+        }
+        json += R"(],"indexes":[)";
+        for (size_t x = 0; x < schema.indexes.size(); ++x) {
+            if (x > 0) {
+                json += ',';
+            }
+            const auto& index = schema.indexes[x];
+            json += std::format(R"({{"name":"{}","type":"{}","isUnique":{},"isPrimaryKey":{},"columns":[)", JsonUtils::escapeString(index.name), JsonUtils::escapeString(index.type),
+                                index.isUnique ? "true" : "false", index.isPrimaryKey ? "true" : "false");
+            for (size_t k = 0; k < index.columns.size(); ++k) {
+                if (k > 0) {
+                    json += ',';
+                }
+                json += std::format(R"("{}")", JsonUtils::escapeString(index.columns[k]));
+            }
+            json += "]}";
+        }
+        json += R"(],"foreignKeys":[)";
+        for (size_t f = 0; f < schema.foreignKeys.size(); ++f) {
+            if (f > 0) {
+                json += ',';
+            }
+            const auto& fk = schema.foreignKeys[f];
+            json += std::format(R"({{"name":"{}","column":"{}","referencedTable":"{}","referencedColumn":"{}"}})", JsonUtils::escapeString(fk.name), JsonUtils::escapeString(fk.column),
+                                JsonUtils::escapeString(fk.referencedTable), JsonUtils::escapeString(fk.referencedColumn));
+        }
+        json += "]}";
+    }
+}
+
 std::string IPCHandler::fetchTableMetadata(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto tableNameResult = doc["table"].get_string();
@@ -2454,30 +4291,28 @@ std::string IPCHandler::fetchTableMetadata(std::string_view params) {
 
         auto& driver = connection->second;
 
-        auto metadataQuery = std::format(R"(
-            SELECT
-                OBJECT_SCHEMA_NAME(o.object_id) AS SchemaName,
-                o.name AS TableName,
-                o.type_desc AS ObjectType,
-                ISNULL(p.rows, 0) AS RowCount,
-                CONVERT(varchar, o.create_date, 120) AS CreatedAt,
-                CONVERT(varchar, o.modify_date, 120) AS ModifiedAt,
-                ISNULL(USER_NAME(o.principal_id), 'dbo') AS Owner,
-                ISNULL(ep.value, '') AS Comment
-            FROM sys.objects o
-            LEFT JOIN sys.partitions p ON o.object_id = p.object_id AND p.index_id IN (0, 1)
-            LEFT JOIN sys.extended_properties ep ON ep.major_id = o.object_id AND ep.minor_id = 0 AND ep.name = 'MS_Description'
-            WHERE o.object_id = OBJECT_ID('{}')
-        )",
-                                         JsonUtils::escapeString(tableName));
-
-        ResultSet queryResult = driver->execute(metadataQuery);
+        auto metadataQuery = buildTableMetadataQuery(tableName);
+
+        // The neighbor prefetch below populates the same cache keys, so an
+        // expand the prefetch predicted correctly never touches the server.
+        // No table tags: any DML on the connection invalidates the entry,
+        // since the row count would be stale.
+        std::string cacheKey = connectionId + ":" + metadataQuery;
+        auto data = m_resultCache->get(cacheKey);
+        if (!data) {
+            data = std::make_shared<const ResultSet>(driver->execute(metadataQuery));
+            if (!data->rows.empty()) {
+                m_resultCache->put(cacheKey, data);
+            }
+        }
 
-        if (queryResult.rows.empty()) {
+        if (data->rows.empty()) {
             return JsonUtils::errorResponse("Table not found");
         }
 
-        const auto& row = queryResult.rows[0];
+        prefetchNeighborMetadata(connectionId, tableName);
+
+        const auto& row = data->rows[0];
         std::string json = "{";
         json += std::format("\"schema\":\"{}\",", JsonUtils::escapeString(row.values[0]));
         json += std::format("\"name\":\"{}\",", JsonUtils::escapeString(row.values[1]));
@@ -2495,10 +4330,80 @@ std::string IPCHandler::fetchTableMetadata(std::string_view params) {
     }
 }
 
+void IPCHandler::prefetchNeighborMetadata(const std::string& connectionId, const std::string& tableName) {
+    auto listIt = m_tableListOrder.find(connectionId);
+    if (listIt == m_tableListOrder.end() || listIt->second.empty()) {
+        return;
+    }
+    auto connection = m_activeConnections.find(connectionId);
+    if (connection == m_activeConnections.end()) {
+        return;
+    }
+    if (m_prefetchBusy.load()) {
+        return;  // Best-effort: one speculation in flight is enough
+    }
+
+    // The tree passes either "schema.name" or a bare name; the stored list
+    // is always schema-qualified
+    const auto& order = listIt->second;
+    auto position = std::ranges::find_if(order, [&](const std::string& qualified) {
+        return qualified == tableName || (qualified.size() > tableName.size() + 1 && qualified.ends_with(tableName) && qualified[qualified.size() - tableName.size() - 1] == '.');
+    });
+    if (position == order.end()) {
+        return;
+    }
+
+    // Up to PREFETCH_NEIGHBORS on each side, skipping already-warm entries
+    auto index = static_cast<size_t>(position - order.begin());
+    std::vector<std::string> pending;
+    for (size_t distance = 1; distance <= PREFETCH_NEIGHBORS; ++distance) {
+        if (index >= distance) {
+            pending.push_back(order[index - distance]);
+        }
+        if (index + distance < order.size()) {
+            pending.push_back(order[index + distance]);
+        }
+    }
+    std::erase_if(pending, [&](const std::string& neighbor) { return m_resultCache->get(connectionId + ":" + buildTableMetadataQuery(neighbor)) != nullptr; });
+    if (pending.empty()) {
+        return;
+    }
+
+    auto connectionString = std::string(connection->second->getConnectionString());
+    if (connectionString.empty()) {
+        return;
+    }
+
+    velocitydb::log<LogLevel::DEBUG>(std::format("Metadata prefetch: warming {} neighbors of {}", pending.size(), tableName));
+
+    if (m_prefetchThread.joinable()) {
+        m_prefetchThread.join();
+    }
+    m_prefetchBusy.store(true);
+    m_prefetchThread = std::thread([this, connectionId, connectionString = std::move(connectionString), pending = std::move(pending)] {
+        // A sibling connection keeps speculation off the user's own
+        // connection; only the thread-safe result cache is shared back
+        auto sibling = std::make_shared<SQLServerDriver>();
+        if (sibling->connect(connectionString)) {
+            for (const auto& neighbor : pending) {
+                try {
+                    auto metadataQuery = buildTableMetadataQuery(neighbor);
+                    auto data = std::make_shared<const ResultSet>(sibling->execute(metadataQuery));
+                    if (!data->rows.empty()) {
+                        m_resultCache->put(connectionId + ":" + metadataQuery, data);
+                    }
+                } catch (const std::exception&) {
+                    break;  // Connection-level trouble; stop speculating
+                }
+            }
+        }
+        m_prefetchBusy.store(false);
+    });
+}
+
 std::string IPCHandler::fetchTableDDL(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto tableNameResult = doc["table"].get_string();
@@ -2598,8 +4503,7 @@ std::string IPCHandler::fetchTableDDL(std::string_view params) {
 
 std::string IPCHandler::executeSQLPaginated(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto sqlQueryResult = doc["sql"].get_string();
@@ -2656,18 +4560,15 @@ std::string IPCHandler::executeSQLPaginated(std::string_view params) {
 
         ResultSet queryResult = driver->execute(paginatedQuery);
 
-        std::string jsonResponse = JsonUtils::serializeResultSet(queryResult, false);
-
-        return JsonUtils::successResponse(jsonResponse);
+        return JsonUtils::resultSetResponse(queryResult, false);
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
     }
 }
 
-std::string IPCHandler::getRowCount(std::string_view params) {
+std::string IPCHandler::openCursor(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        simdjson::dom::element doc = parser.parse(params);
+        simdjson::dom::element doc = paramsParser().parse(params);
 
         auto connectionIdResult = doc["connectionId"].get_string();
         auto sqlQueryResult = doc["sql"].get_string();
@@ -2677,6 +4578,128 @@ std::string IPCHandler::getRowCount(std::string_view params) {
         auto connectionId = std::string(connectionIdResult.value());
         auto sqlQuery = std::string(sqlQueryResult.value());
 
+        // Optional ORDER BY from the grid sort model, applied once at open
+        std::string orderByClause;
+        if (auto sortModel = doc["sortModel"].get_array(); !sortModel.error()) {
+            std::string sortClauses;
+            for (auto item : sortModel.value()) {
+                auto colId = item["colId"].get_string();
+                auto sort = item["sort"].get_string();
+                if (!colId.error() && !sort.error()) {
+                    if (!sortClauses.empty())
+                        sortClauses += ", ";
+                    sortClauses += std::string(colId.value()) + " " + (sort.value() == std::string_view("asc") ? "ASC" : "DESC");
+                }
+            }
+            if (!sortClauses.empty()) {
+                orderByClause = " ORDER BY " + sortClauses;
+            }
+        }
+
+        auto connection = m_activeConnections.find(connectionId);
+        if (connection == m_activeConnections.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
+        }
+
+        auto& driver = connection->second;
+        if (!driver->openStream(sqlQuery + orderByClause)) {
+            return JsonUtils::errorResponse(driver->getLastError());
+        }
+
+        auto cursorId = std::format("cursor_{}", m_cursorIdCounter++);
+        m_cursorSessions[cursorId] = driver;
+
+        auto json = std::format("{{\"cursorId\":\"{}\"}}", cursorId);
+        return JsonUtils::successResponse(json);
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::fetchCursorChunk(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto cursorIdResult = doc["cursorId"].get_string();
+        if (cursorIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: cursorId");
+        }
+        auto cursorId = std::string(cursorIdResult.value());
+
+        int64_t rowCount = 100;
+        if (auto rowCountOpt = doc["rowCount"].get_int64(); !rowCountOpt.error()) {
+            rowCount = rowCountOpt.value();
+        }
+
+        auto session = m_cursorSessions.find(cursorId);
+        if (session == m_cursorSessions.end()) [[unlikely]] {
+            return JsonUtils::errorResponse(std::format("Cursor not found: {}", cursorId));
+        }
+
+        auto& driver = session->second;
+        auto chunk = driver->fetchStreamChunk(static_cast<size_t>(rowCount));
+        ResultSet chunkRows = chunk.toRows();
+
+        auto& json = ResponseArena::acquire();
+        json += R"({"result":)";
+        JsonUtils::serializeResultSetInto(json, chunkRows, false);
+        json += R"(,"exhausted":)";
+        json += driver->isStreamExhausted() ? "true" : "false";
+        json += '}';
+        return JsonUtils::successResponse(json);
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::closeCursor(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto cursorIdResult = doc["cursorId"].get_string();
+        if (cursorIdResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: cursorId");
+        }
+        auto cursorId = std::string(cursorIdResult.value());
+
+        if (auto session = m_cursorSessions.find(cursorId); session != m_cursorSessions.end()) {
+            session->second->closeStream();
+            m_cursorSessions.erase(session);
+        }
+
+        return JsonUtils::successResponse("{\"closed\":true}");
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::getRowCount(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto connectionIdResult = doc["connectionId"].get_string();
+        auto sqlQueryResult = doc["sql"].get_string();
+        auto tableResult = doc["table"].get_string();
+        if (connectionIdResult.error() || (sqlQueryResult.error() && tableResult.error())) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required fields: connectionId and sql or table");
+        }
+        auto connectionId = std::string(connectionIdResult.value());
+
+        // "exact" forces COUNT_BIG; the default for plain table grids is a
+        // partition-stats estimate, which only labels the scrollbar anyway
+        bool exact = false;
+        if (auto exactResult = doc["exact"].get_bool(); !exactResult.error()) {
+            exact = exactResult.value();
+        }
+
+        std::string cacheKey;
+        if (!tableResult.error()) {
+            cacheKey = std::format("{}:{}", connectionId, tableResult.value());
+            if (auto cached = m_rowCountCache.find(cacheKey); cached != m_rowCountCache.end() && !exact && std::chrono::steady_clock::now() - cached->second.fetchedAt < ROW_COUNT_TTL) {
+                return JsonUtils::successResponse(std::format("{{\"rowCount\":{},\"approximate\":{}}}", cached->second.rows, cached->second.approximate));
+            }
+        }
+
         auto connection = m_activeConnections.find(connectionId);
         if (connection == m_activeConnections.end()) [[unlikely]] {
             return JsonUtils::errorResponse(std::format("Connection not found: {}", connectionId));
@@ -2684,10 +4707,27 @@ std::string IPCHandler::getRowCount(std::string_view params) {
 
         auto& driver = connection->second;
 
+        if (!tableResult.error() && !exact) {
+            // Heap (index_id 0) or clustered index (1) partitions carry the
+            // table's row count; sub-millisecond regardless of table size
+            // and never touches the table's pages
+            auto estimateQuery = std::format(R"(SELECT SUM(p.row_count) FROM sys.dm_db_partition_stats p WHERE p.object_id = OBJECT_ID('{}') AND p.index_id IN (0, 1))", JsonUtils::escapeString(tableResult.value()));
+
+            ResultSet estimateResult = driver->execute(estimateQuery);
+            if (!estimateResult.rows.empty() && !estimateResult.rows[0].values.empty() && !estimateResult.rows[0].values[0].empty()) {
+                const auto estimatedRows = std::stoll(std::string(estimateResult.rows[0].values[0]));
+                m_rowCountCache[cacheKey] = {.rows = estimatedRows, .approximate = true, .fetchedAt = std::chrono::steady_clock::now()};
+                return JsonUtils::successResponse(std::format("{{\"rowCount\":{},\"approximate\":true}}", estimatedRows));
+            }
+            // NULL SUM (unknown object) or missing VIEW SERVER STATE
+            // permission: fall through to the exact count
+        }
+
         // Optimize COUNT query for better performance:
         // 1. Use COUNT_BIG(*) instead of COUNT(*) for large tables
         // 2. Add WITH(NOLOCK) hint to avoid locking issues
         // Note: NOLOCK may read uncommitted data, but this is acceptable for row count estimation
+        auto sqlQuery = sqlQueryResult.error() ? std::format("SELECT * FROM {}", tableResult.value()) : std::string(sqlQueryResult.value());
         auto countQuery = std::format("SELECT COUNT_BIG(*) AS total_rows FROM ({}) AS subquery WITH(NOLOCK)", sqlQuery);
 
         ResultSet queryResult = driver->execute(countQuery);
@@ -2696,10 +4736,12 @@ std::string IPCHandler::getRowCount(std::string_view params) {
             return JsonUtils::errorResponse("Failed to get row count");
         }
 
-        auto rowCount = queryResult.rows[0].values[0];
-        auto json = std::format("{{\"rowCount\":{}}}", rowCount);
+        const auto exactRows = std::stoll(std::string(queryResult.rows[0].values[0]));
+        if (!cacheKey.empty()) {
+            m_rowCountCache[cacheKey] = {.rows = exactRows, .approximate = false, .fetchedAt = std::chrono::steady_clock::now()};
+        }
 
-        return JsonUtils::successResponse(json);
+        return JsonUtils::successResponse(std::format("{{\"rowCount\":{},\"approximate\":false}}", exactRows));
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
     }
@@ -2707,8 +4749,7 @@ std::string IPCHandler::getRowCount(std::string_view params) {
 
 std::string IPCHandler::writeFrontendLog(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        auto doc = parser.parse(params);
+        auto doc = paramsParser().parse(params);
 
         std::string logContent = std::string(doc["content"].get_string().value());
 
@@ -2737,8 +4778,7 @@ std::string IPCHandler::writeFrontendLog(std::string_view params) {
 
 std::string IPCHandler::saveQueryToFile(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        auto doc = parser.parse(params);
+        auto doc = paramsParser().parse(params);
 
         std::string content = std::string(doc["content"].get_string().value());
         std::string defaultFileName = "";
@@ -2775,15 +4815,18 @@ std::string IPCHandler::loadQueryFromFile(std::string_view params) {
             return JsonUtils::errorResponse(result.error());
         }
 
-        // Read file
-        auto readResult = FileDialog::readFile(result.value());
-        if (!readResult) {
-            return JsonUtils::errorResponse(readResult.error());
+        // Map the file instead of slurping it: the content is escaped
+        // straight out of the page cache, so even a 100MB dump is never
+        // buffered through the heap on its way into the response
+        MappedFile mapped{result.value()};
+        if (!mapped.isMapped()) {
+            return JsonUtils::errorResponse(std::format("Failed to open file: {}", result.value().string()));
         }
 
         // Escape content for JSON
         std::string escapedContent;
-        for (auto c : readResult.value()) {
+        escapedContent.reserve(mapped.view().size());
+        for (auto c : mapped.view()) {
             if (c == '"') {
                 escapedContent += "\\\"";
             } else if (c == '\\') {
@@ -2808,8 +4851,7 @@ std::string IPCHandler::loadQueryFromFile(std::string_view params) {
 
 std::string IPCHandler::browseFile(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        auto doc = parser.parse(params);
+        auto doc = paramsParser().parse(params);
 
         // Get optional filter parameter
         std::string filter = "All Files (*.*)\0*.*\0";
@@ -2869,13 +4911,23 @@ std::string IPCHandler::getBookmarks(std::string_view params) {
 
 std::string IPCHandler::saveBookmark(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        auto doc = parser.parse(params);
+        auto doc = paramsParser().parse(params);
 
         std::string id = std::string(doc["id"].get_string().value());
         std::string name = std::string(doc["name"].get_string().value());
         std::string content = std::string(doc["content"].get_string().value());
 
+        // Optional cache-warming opt-in: re-run this bookmark on the given
+        // connection every refreshIntervalSeconds
+        std::string connectionId;
+        if (auto connection = doc["connectionId"].get_string(); !connection.error()) {
+            connectionId = std::string(connection.value());
+        }
+        int64_t refreshIntervalSeconds = 0;
+        if (auto interval = doc["refreshIntervalSeconds"].get_int64(); !interval.error()) {
+            refreshIntervalSeconds = interval.value();
+        }
+
         std::filesystem::path bookmarksPath("data/bookmarks.json");
         std::filesystem::create_directories(bookmarksPath.parent_path());
 
@@ -2902,14 +4954,22 @@ std::string IPCHandler::saveBookmark(std::string_view params) {
                 found = true;
                 if (!first)
                     json += ",";
-                json += std::format("{{\"id\":\"{}\",\"name\":\"{}\",\"content\":\"{}\"}}", id, name, content);
+                appendBookmarkJson(json, id, name, content, connectionId, refreshIntervalSeconds);
             } else {
-                // Keep existing bookmark
+                // Keep existing bookmark, including its refresh opt-in
                 if (!first)
                     json += ",";
                 std::string existingName = std::string(bookmark["name"].get_string().value());
                 std::string existingContent = std::string(bookmark["content"].get_string().value());
-                json += std::format("{{\"id\":\"{}\",\"name\":\"{}\",\"content\":\"{}\"}}", bookmarkId, existingName, existingContent);
+                std::string existingConnection;
+                if (auto connection = bookmark["connectionId"].get_string(); !connection.error()) {
+                    existingConnection = std::string(connection.value());
+                }
+                int64_t existingInterval = 0;
+                if (auto interval = bookmark["refreshIntervalSeconds"].get_int64(); !interval.error()) {
+                    existingInterval = interval.value();
+                }
+                appendBookmarkJson(json, bookmarkId, existingName, existingContent, existingConnection, existingInterval);
             }
             first = false;
         }
@@ -2918,7 +4978,7 @@ std::string IPCHandler::saveBookmark(std::string_view params) {
         if (!found) {
             if (!first)
                 json += ",";
-            json += std::format("{{\"id\":\"{}\",\"name\":\"{}\",\"content\":\"{}\"}}", id, name, content);
+            appendBookmarkJson(json, id, name, content, connectionId, refreshIntervalSeconds);
         }
 
         json += "]";
@@ -2929,6 +4989,12 @@ std::string IPCHandler::saveBookmark(std::string_view params) {
             return JsonUtils::errorResponse(writeResult.error());
         }
 
+        if (refreshIntervalSeconds > 0 && !connectionId.empty()) {
+            scheduleBookmarkRefresh(id, std::move(connectionId), std::move(content), std::chrono::seconds(refreshIntervalSeconds));
+        } else {
+            unscheduleBookmarkRefresh(id);
+        }
+
         return JsonUtils::successResponse("{}");
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
@@ -2937,8 +5003,7 @@ std::string IPCHandler::saveBookmark(std::string_view params) {
 
 std::string IPCHandler::deleteBookmark(std::string_view params) {
     try {
-        simdjson::dom::parser parser;
-        auto doc = parser.parse(params);
+        auto doc = paramsParser().parse(params);
 
         std::string id = std::string(doc["id"].get_string().value());
 
@@ -2969,7 +5034,15 @@ std::string IPCHandler::deleteBookmark(std::string_view params) {
                     json += ",";
                 std::string name = std::string(bookmark["name"].get_string().value());
                 std::string content = std::string(bookmark["content"].get_string().value());
-                json += std::format("{{\"id\":\"{}\",\"name\":\"{}\",\"content\":\"{}\"}}", bookmarkId, name, content);
+                std::string connectionId;
+                if (auto connection = bookmark["connectionId"].get_string(); !connection.error()) {
+                    connectionId = std::string(connection.value());
+                }
+                int64_t refreshIntervalSeconds = 0;
+                if (auto interval = bookmark["refreshIntervalSeconds"].get_int64(); !interval.error()) {
+                    refreshIntervalSeconds = interval.value();
+                }
+                appendBookmarkJson(json, bookmarkId, name, content, connectionId, refreshIntervalSeconds);
                 first = false;
             }
         }
@@ -2982,10 +5055,146 @@ std::string IPCHandler::deleteBookmark(std::string_view params) {
             return JsonUtils::errorResponse(writeResult.error());
         }
 
+        unscheduleBookmarkRefresh(id);
+
         return JsonUtils::successResponse("{}");
     } catch (const std::exception& e) {
         return JsonUtils::errorResponse(e.what());
     }
 }
 
+void IPCHandler::loadBookmarkRefreshSchedule() {
+    try {
+        std::filesystem::path bookmarksPath("data/bookmarks.json");
+        if (!std::filesystem::exists(bookmarksPath)) {
+            return;
+        }
+
+        auto readResult = FileDialog::readFile(bookmarksPath);
+        if (!readResult) {
+            return;
+        }
+
+        simdjson::dom::parser parser;
+        auto doc = parser.parse(readResult.value());
+        auto bookmarks = doc.get_array();
+        if (bookmarks.error()) {
+            return;
+        }
+
+        for (auto bookmark : bookmarks.value()) {
+            auto interval = bookmark["refreshIntervalSeconds"].get_int64();
+            auto connection = bookmark["connectionId"].get_string();
+            if (interval.error() || interval.value() <= 0 || connection.error()) {
+                continue;
+            }
+            std::string id = std::string(bookmark["id"].get_string().value());
+            std::string content = std::string(bookmark["content"].get_string().value());
+            scheduleBookmarkRefresh(id, std::string(connection.value()), std::move(content), std::chrono::seconds(interval.value()));
+        }
+    } catch (const std::exception& e) {
+        log<LogLevel::WARNING>(std::format("[BookmarkRefresh] Failed to load schedule: {}", e.what()));
+    }
+}
+
+void IPCHandler::scheduleBookmarkRefresh(const std::string& bookmarkId, std::string connectionId, std::string sql, std::chrono::seconds interval) {
+    // Warming only helps statements the ResultCache serves
+    bool isSelectQuery = sql.find("SELECT") != std::string::npos || sql.find("select") != std::string::npos;
+    if (!isSelectQuery || interval <= std::chrono::seconds(0)) {
+        unscheduleBookmarkRefresh(bookmarkId);
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_bookmarkRefreshMutex);
+        m_bookmarkRefreshes[bookmarkId] = BookmarkRefresh{
+            .connectionId = std::move(connectionId),
+            .sql = std::move(sql),
+            .interval = interval,
+            // Due immediately: saving a bookmark primes the cache on the
+            // next worker pass instead of waiting one full interval
+            .nextDue = std::chrono::steady_clock::now(),
+        };
+    }
+    m_bookmarkRefreshWake.notify_all();
+}
+
+void IPCHandler::unscheduleBookmarkRefresh(std::string_view bookmarkId) {
+    std::lock_guard lock(m_bookmarkRefreshMutex);
+    m_bookmarkRefreshes.erase(std::string(bookmarkId));
+}
+
+void IPCHandler::bookmarkRefreshLoop() {
+    while (true) {
+        std::vector<BookmarkRefresh> due;
+        {
+            std::unique_lock lock(m_bookmarkRefreshMutex);
+            if (m_bookmarkRefreshes.empty()) {
+                m_bookmarkRefreshWake.wait(lock, [this] { return m_bookmarkRefreshStopping || !m_bookmarkRefreshes.empty(); });
+            } else {
+                auto nextDue = std::chrono::steady_clock::time_point::max();
+                for (const auto& [id, entry] : m_bookmarkRefreshes) {
+                    nextDue = (std::min)(nextDue, entry.nextDue);
+                }
+                // A schedule change or shutdown wakes this early; the next
+                // iteration just recomputes the earliest due time
+                m_bookmarkRefreshWake.wait_until(lock, nextDue);
+            }
+            if (m_bookmarkRefreshStopping) {
+                return;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            for (auto& [id, entry] : m_bookmarkRefreshes) {
+                if (entry.nextDue <= now) {
+                    due.push_back(entry);
+                    entry.nextDue = now + entry.interval;
+                }
+            }
+        }
+
+        // Execute outside the lock: a slow refresh must not block
+        // saveBookmark/deleteBookmark on the dispatch thread
+        for (auto& entry : due) {
+            auto driver = m_connectionPool->acquire(entry.connectionId);
+            if (!driver) {
+                continue;  // Profile gone or connect failed; retried next cycle
+            }
+            try {
+                auto queryResult = std::make_shared<const ResultSet>(driver->execute(entry.sql));
+                m_resultCache->put(resultCacheKey(entry.connectionId, entry.sql), std::move(queryResult), SQLParser::extractTableNames(entry.sql));
+            } catch (const std::exception& e) {
+                log<LogLevel::WARNING>(std::format("[BookmarkRefresh] Refresh failed: {}", e.what()));
+            }
+            m_connectionPool->release(entry.connectionId, std::move(driver));
+        }
+    }
+}
+
+std::string IPCHandler::setTraceEnabled(std::string_view params) {
+    try {
+        simdjson::dom::element doc = paramsParser().parse(params);
+
+        auto enabledResult = doc["enabled"].get_bool();
+        if (enabledResult.error()) [[unlikely]] {
+            return JsonUtils::errorResponse("Missing required field: enabled");
+        }
+
+        Tracer::instance().setEnabled(enabledResult.value());
+        return JsonUtils::successResponse(std::format(R"({{"enabled":{}}})", enabledResult.value() ? "true" : "false"));
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
+std::string IPCHandler::dumpTrace(std::string_view) {
+    try {
+        // Drains every thread's span buffer; the payload loads directly
+        // into chrome://tracing or Perfetto
+        return JsonUtils::successResponse(Tracer::instance().dumpJson());
+    } catch (const std::exception& e) {
+        return JsonUtils::errorResponse(e.what());
+    }
+}
+
 }  // namespace velocitydb
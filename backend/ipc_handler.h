@@ -1,15 +1,23 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <expected>
 #include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace velocitydb {
 
 class SQLServerDriver;
+struct ColumnarResultSet;
 class ConnectionPool;
 class SchemaInspector;
 class TransactionManager;
@@ -17,10 +25,13 @@ class QueryHistory;
 class ResultCache;
 class AsyncQueryExecutor;
 class SshTunnel;
+class CompletionIndex;
+struct TableSchema;
 
 // Contexts
 class SettingsContext;
 class UtilityContext;
+class ExportContext;
 
 /// Dispatches IPC requests from the frontend to appropriate backend operations
 class IPCHandler {
@@ -36,26 +47,76 @@ public:
     /// Parses and dispatches an IPC request, returning a JSON response
     [[nodiscard]] std::string dispatchRequest(std::string_view request);
 
+    /// Registers a sink for backend-initiated events (e.g. async query
+    /// completion) pushed to the frontend without polling. Also wires the
+    /// async executor's completion callback to the sink.
+    void setEventSink(std::function<void(std::string_view payload)> sink);
+
+    /// Registers the shared-buffer transport for large binary result
+    /// frames. The sink posts the frame to the page out of band (moving it
+    /// out of the reference) and returns true; returning false - transport
+    /// unavailable - leaves the frame untouched so the caller can ship the
+    /// same bytes inline as base64.
+    void setSharedBufferSink(std::function<bool(std::vector<uint8_t>& frame, std::string_view additionalDataJson)> sink);
+
 private:
     void registerRequestRoutes();
 
+    // Runs an array of sub-requests from one marshal ("batch" method), so
+    // bursts like opening a table tab pay a single round trip
+    [[nodiscard]] std::string dispatchBatch(std::string_view params);
+
     using RequestProcessor = std::function<std::string(std::string_view)>;
-    std::unordered_map<std::string, RequestProcessor> m_requestRoutes;
+
+    // Transparent hashing so dispatch looks up methods by string_view
+    // without materializing a std::string per request
+    struct TransparentStringHash {
+        using is_transparent = void;
+        [[nodiscard]] size_t operator()(std::string_view value) const noexcept { return std::hash<std::string_view>{}(value); }
+    };
+    std::unordered_map<std::string, RequestProcessor, TransparentStringHash, std::equal_to<>> m_requestRoutes;
 
     // Database connection operations
+    void warmLastUsedProfile();
     [[nodiscard]] std::string openDatabaseConnection(std::string_view params);
     [[nodiscard]] std::string closeDatabaseConnection(std::string_view params);
     [[nodiscard]] std::string verifyDatabaseConnection(std::string_view params);
+    [[nodiscard]] std::string refreshDetectedDrivers(std::string_view params);
+
+    // Async connection establishment (returns a pending handle immediately;
+    // progress is reported through the same polling surface as async queries)
+    [[nodiscard]] std::string openDatabaseConnectionAsync(std::string_view params);
+    [[nodiscard]] std::string getAsyncConnectResult(std::string_view params);
 
     // Query execution operations
     [[nodiscard]] std::string executeSQL(std::string_view params);
+    [[nodiscard]] std::string executeSQLBinary(std::string_view params);
+
+    /// ResultCache key: connection scope plus the canonicalized SQL, so
+    /// trivially different text (case, whitespace, comments) from the
+    /// editor, history and bookmarks shares one entry. The "connectionId:"
+    /// prefix is what invalidateTables scopes on - keep them in sync.
+    [[nodiscard]] static std::string resultCacheKey(std::string_view connectionId, std::string_view sql);
+
+    /// Wraps a columnar result for executeSQLBinary: large frames go
+    /// through the shared-buffer sink (the response carries only the
+    /// transfer descriptor), everything else rides inline as base64
+    [[nodiscard]] std::string binaryFrameResponse(const ColumnarResultSet& result, bool cached);
+    [[nodiscard]] std::string executeSQLChunked(std::string_view params);
     [[nodiscard]] std::string executeSQLPaginated(std::string_view params);
     [[nodiscard]] std::string getRowCount(std::string_view params);
+    [[nodiscard]] std::string executeBulkDML(std::string_view params);
     [[nodiscard]] std::string cancelRunningQuery(std::string_view params);
 
+    // Streaming cursor operations (execute once, fetch incrementally)
+    [[nodiscard]] std::string openCursor(std::string_view params);
+    [[nodiscard]] std::string fetchCursorChunk(std::string_view params);
+    [[nodiscard]] std::string closeCursor(std::string_view params);
+
     // Async query operations
     [[nodiscard]] std::string executeAsyncQuery(std::string_view params);
     [[nodiscard]] std::string getAsyncQueryResult(std::string_view params);
+    [[nodiscard]] std::string getResultRows(std::string_view params);
     [[nodiscard]] std::string cancelAsyncQuery(std::string_view params);
     [[nodiscard]] std::string getActiveQueries(std::string_view params);
 
@@ -73,13 +134,27 @@ private:
     [[nodiscard]] std::string exportToCSV(std::string_view params);
     [[nodiscard]] std::string exportToJSON(std::string_view params);
     [[nodiscard]] std::string exportToExcel(std::string_view params);
+    [[nodiscard]] std::string exportToParquet(std::string_view params);
+    [[nodiscard]] std::string exportDatabaseDDL(std::string_view params);
+
+    // Background export jobs (progress + cancel, pushed via event sink)
+    [[nodiscard]] std::string startExportJob(std::string_view params);
+    [[nodiscard]] std::string exportTable(std::string_view params);
+    [[nodiscard]] std::string getExportJobStatus(std::string_view params);
+    [[nodiscard]] std::string cancelExportJob(std::string_view params);
+    [[nodiscard]] std::string removeExportJob(std::string_view params);
 
     // Utility operations
     [[nodiscard]] std::string formatSQLQuery(std::string_view params);
     [[nodiscard]] std::string uppercaseKeywords(std::string_view params);
+    [[nodiscard]] std::string updateEditorBuffer(std::string_view params);
+    [[nodiscard]] std::string getCompletionContext(std::string_view params);
+    [[nodiscard]] std::string closeEditorBuffer(std::string_view params);
     [[nodiscard]] std::string parseA5ERFile(std::string_view params);
     [[nodiscard]] std::string retrieveQueryHistory(std::string_view params);
+    [[nodiscard]] std::string getQueryStatistics(std::string_view params);
     [[nodiscard]] std::string getExecutionPlan(std::string_view params);
+    [[nodiscard]] std::string getExecutionPlanResult(std::string_view params);
     [[nodiscard]] std::string writeFrontendLog(std::string_view params);
 
     // Cache operations
@@ -89,6 +164,16 @@ private:
     // Filter operations
     [[nodiscard]] std::string filterResultSet(std::string_view params);
 
+    // Aggregation operations (stats panel)
+    [[nodiscard]] std::string aggregateResultSet(std::string_view params);
+
+    // Diff operations (release validation: same query before/after deploy)
+    [[nodiscard]] std::string diffResultSets(std::string_view params);
+
+    // Sort operations (client-side column sort over the cached result;
+    // shallow windows use a top-K partial sort)
+    [[nodiscard]] std::string sortResultSet(std::string_view params);
+
     // Settings operations
     [[nodiscard]] std::string getSettings(std::string_view params);
     [[nodiscard]] std::string updateSettings(std::string_view params);
@@ -102,6 +187,7 @@ private:
     // Session operations
     [[nodiscard]] std::string getSessionState(std::string_view params);
     [[nodiscard]] std::string saveSessionState(std::string_view params);
+    [[nodiscard]] std::string getSessionTabContent(std::string_view params);
 
     // Search operations
     [[nodiscard]] std::string searchObjects(std::string_view params);
@@ -114,8 +200,18 @@ private:
     [[nodiscard]] std::string fetchReferencingForeignKeys(std::string_view params);
     [[nodiscard]] std::string fetchTriggers(std::string_view params);
     [[nodiscard]] std::string fetchTableMetadata(std::string_view params);
+    [[nodiscard]] std::string fetchDatabaseSchema(std::string_view params);
     [[nodiscard]] std::string fetchTableDDL(std::string_view params);
 
+    // Shared serializer for hydrated schemas: used for both live hydration
+    // and the boot-time disk snapshot
+    void appendSchemaTablesJson(std::string& json, const std::vector<TableSchema>& schemas) const;
+
+    // Speculatively hydrates metadata for the expanded table's alphabetical
+    // neighbors on a background sibling connection, so the next tree expand
+    // is usually a cache hit
+    void prefetchNeighborMetadata(const std::string& connectionId, const std::string& tableName);
+
     // File operations
     [[nodiscard]] std::string saveQueryToFile(std::string_view params);
     [[nodiscard]] std::string loadQueryFromFile(std::string_view params);
@@ -126,9 +222,23 @@ private:
     [[nodiscard]] std::string saveBookmark(std::string_view params);
     [[nodiscard]] std::string deleteBookmark(std::string_view params);
 
+    // Bookmark cache warming: bookmarks the team re-runs on a cadence can
+    // opt into a refresh interval. A background worker re-executes them on
+    // pool connections and deposits the results in the ResultCache, so the
+    // manual run is a warm hit instead of the full round trip.
+    void loadBookmarkRefreshSchedule();
+    void scheduleBookmarkRefresh(const std::string& bookmarkId, std::string connectionId, std::string sql, std::chrono::seconds interval);
+    void unscheduleBookmarkRefresh(std::string_view bookmarkId);
+    void bookmarkRefreshLoop();
+
+    // Tracing operations
+    [[nodiscard]] std::string setTraceEnabled(std::string_view params);
+    [[nodiscard]] std::string dumpTrace(std::string_view params);
+
     // Contexts (new architecture)
     std::unique_ptr<SettingsContext> m_settingsContext;
     std::unique_ptr<UtilityContext> m_utilityContext;
+    std::unique_ptr<ExportContext> m_exportContext;
 
     // Database-related members (to be migrated to DatabaseContext)
     std::unique_ptr<ConnectionPool> m_connectionPool;
@@ -141,6 +251,99 @@ private:
     std::unordered_map<std::string, std::shared_ptr<SQLServerDriver>> m_activeConnections;
     std::unordered_map<std::string, std::unique_ptr<SshTunnel>> m_sshTunnels;
     int m_connectionIdCounter = 1;
+
+    // Open cursor sessions: cursorId -> driver holding the open statement
+    std::unordered_map<std::string, std::shared_ptr<SQLServerDriver>> m_cursorSessions;
+    int m_cursorIdCounter = 1;
+
+    // Previous "contains" filter selection: when the typed pattern extends
+    // the prior one over the same data, only prior matches can still match,
+    // so each keystroke rescans an ever-shrinking set instead of the table
+    struct FilterRefinement {
+        std::string contextKey;  // connectionId : columnIndex : sql
+        std::string pattern;
+        size_t rowCount = 0;  // Guards against the underlying data changing
+        std::vector<size_t> matches;
+    };
+    FilterRefinement m_filterRefinement;
+
+    // Row counts per connectionId:table with a short TTL. The grid only
+    // needs the number for the scrollbar, so estimates from
+    // sys.dm_db_partition_stats (milliseconds) stand in for COUNT(*)
+    // (minutes on billion-row tables); exact counts land here too once
+    // explicitly requested.
+    struct CachedRowCount {
+        int64_t rows = 0;
+        bool approximate = true;
+        std::chrono::steady_clock::time_point fetchedAt;
+    };
+    static constexpr auto ROW_COUNT_TTL = std::chrono::seconds(30);
+    std::unordered_map<std::string, CachedRowCount> m_rowCountCache;
+
+    // Execution plans keyed by connectionId:mode:sql. SHOWPLAN round trips
+    // used to run on the dispatch thread and froze the UI while the plan
+    // pane loaded; misses now go through the async executor and completed
+    // plans are served from here. Plans only go stale when the schema
+    // moves, so DDL on the connection drops its entries.
+    std::unordered_map<std::string, std::string> m_planCache;
+    struct PendingPlan {
+        std::string cacheKey;
+        bool actual = false;
+    };
+    std::unordered_map<std::string, PendingPlan> m_pendingPlans;
+    void invalidateExecutionPlans(const std::string& connectionId, std::string_view statementType);
+
+    // Per-editor-tab token indexes for autocomplete: bufferId -> index
+    // kept current via edit deltas, so cursor-scope lookups never reparse
+    // the whole buffer
+    std::unordered_map<std::string, std::unique_ptr<CompletionIndex>> m_completionIndexes;
+
+    // Last getTables result per connection, schema-qualified and in the
+    // list's alphabetical order - the neighbor source for metadata prefetch
+    std::unordered_map<std::string, std::vector<std::string>> m_tableListOrder;
+    std::thread m_prefetchThread;
+    std::atomic<bool> m_prefetchBusy{false};
+
+    // Validates a snapshot-served schema tree against sys.objects on a
+    // sibling connection while the user already sees the tree
+    std::thread m_schemaRefreshThread;
+
+    // In-flight async connection attempts. The worker writes only the task
+    // struct; the dispatch thread reads it after the status flag flips.
+    struct PendingConnection {
+        enum class Status { Pending, Connected, Failed };
+        std::atomic<Status> status{Status::Pending};
+        std::string errorMessage;
+        std::shared_ptr<SQLServerDriver> driver;
+        std::unique_ptr<SshTunnel> tunnel;
+        std::future<void> future;
+    };
+    std::unordered_map<std::string, std::shared_ptr<PendingConnection>> m_pendingConnections;
+    int m_pendingConnectionIdCounter = 1;
+
+    // Scheduled bookmark refreshes keyed by bookmark id. The worker only
+    // refreshes SELECTs - the only statements the ResultCache serves - and
+    // a failed refresh just waits for the next due time.
+    struct BookmarkRefresh {
+        std::string connectionId;
+        std::string sql;
+        std::chrono::seconds interval{0};
+        std::chrono::steady_clock::time_point nextDue;
+    };
+    std::mutex m_bookmarkRefreshMutex;
+    std::condition_variable m_bookmarkRefreshWake;
+    std::unordered_map<std::string, BookmarkRefresh> m_bookmarkRefreshes;
+    bool m_bookmarkRefreshStopping = false;
+    std::jthread m_bookmarkRefreshWorker;
+
+    std::function<void(std::string_view)> m_eventSink;
+
+    // Shared-buffer descriptors pair the IPC response with the out-of-band
+    // 'sharedbufferreceived' event; frames below the threshold are not
+    // worth a buffer create + two thread hops
+    static constexpr size_t SHARED_BUFFER_MIN_BYTES = 256 * 1024;
+    std::function<bool(std::vector<uint8_t>&, std::string_view)> m_sharedBufferSink;
+    std::atomic<uint64_t> m_transferIdCounter{1};
 };
 
 }  // namespace velocitydb
@@ -8,8 +8,10 @@
 #pragma comment(lib, "ws2_32.lib")
 #else
 #include <arpa/inet.h>
+#include <fcntl.h>
 #include <netdb.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <unistd.h>
 #endif
@@ -17,9 +19,15 @@
 #include "../utils/logger.h"
 
 #include <atomic>
+#include <chrono>
 #include <format>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace velocitydb {
 
@@ -54,26 +62,114 @@ inline int getLastSocketError() {
 }
 #endif
 
-constexpr int BUFFER_SIZE = 16384;
+#ifdef _WIN32
+using pollfd_t = WSAPOLLFD;
+// WSAPoll rejects POLLPRI-bearing masks, so use the NORM flags explicitly
+constexpr short POLL_READ = POLLRDNORM;
+constexpr short POLL_WRITE = POLLWRNORM;
+inline int pollSockets(pollfd_t* fds, ULONG count, INT timeoutMs) {
+    return WSAPoll(fds, count, timeoutMs);
+}
+#else
+using pollfd_t = pollfd;
+constexpr short POLL_READ = POLLIN;
+constexpr short POLL_WRITE = POLLOUT;
+inline int pollSockets(pollfd_t* fds, nfds_t count, int timeoutMs) {
+    return poll(fds, count, timeoutMs);
+}
+#endif
 
-}  // namespace
+// Per-direction ring capacity. Large enough that a bulk fetch keeps whole
+// TDS result packets in flight; both rings are allocated once per tunnel
+// and reused across client connections — no allocation on the data path.
+constexpr size_t RING_CAPACITY = 1024 * 1024;
 
-class SshTunnel::Impl {
+// Upper bound on a forwarding stall: the loop re-checks the shutdown flag
+// at least this often even when both peers are idle
+constexpr int POLL_TIMEOUT_MS = 100;
+
+// Server-replied keepalive probe cadence. A dead bastion link is detected
+// within roughly this window instead of surfacing as the next query
+// sitting out the full ODBC login timeout.
+constexpr int KEEPALIVE_INTERVAL_S = 5;
+
+// How often an idle tunnel checks its listener and transport health
+constexpr int ACCEPT_POLL_TIMEOUT_MS = 500;
+
+// Pause between reconnect attempts while the bastion stays unreachable
+constexpr auto RECONNECT_BACKOFF = std::chrono::seconds(3);
+
+/// Fixed-capacity byte ring for the forwarding loop. Producer and consumer
+/// run on the same thread, so there is no synchronization; spans are
+/// contiguous so recv/send and the libssh2 calls operate on the ring
+/// storage in place.
+class RingBuffer {
 public:
-    Impl() = default;
-    ~Impl() { disconnect(); }
+    explicit RingBuffer(size_t capacity) : m_data(capacity) {}
 
-    std::expected<void, SshTunnelError> connect(const SshTunnelConfig& config) {
-        log<LogLevel::INFO>("[SSH] Starting SSH tunnel connection...");
-        log<LogLevel::INFO>(std::format("[SSH] SSH Host: {}:{}", config.host, config.port));
-        log<LogLevel::INFO>(std::format("[SSH] Remote target: {}:{}", config.remoteHost, config.remotePort));
-        log<LogLevel::INFO>(std::format("[SSH] Username: {}", config.username));
-        log<LogLevel::INFO>(std::format("[SSH] Auth method: {}", config.authMethod == SshAuthMethod::Password ? "password" : "publickey"));
-        log_flush();
+    void reset() noexcept {
+        m_head = 0;
+        m_size = 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] size_t freeSpace() const noexcept { return m_data.size() - m_size; }
+
+    /// Contiguous writable region at the ring's tail (may be shorter than
+    /// freeSpace() when the free region wraps)
+    [[nodiscard]] std::pair<char*, size_t> writeSpan() noexcept {
+        const size_t writePos = (m_head + m_size) % m_data.size();
+        return {m_data.data() + writePos, (std::min)(m_data.size() - writePos, freeSpace())};
+    }
+
+    void commitWrite(size_t bytes) noexcept { m_size += bytes; }
+
+    /// Contiguous readable region at the ring's head
+    [[nodiscard]] std::pair<const char*, size_t> readSpan() const noexcept { return {m_data.data() + m_head, (std::min)(m_data.size() - m_head, m_size)}; }
+
+    void commitRead(size_t bytes) noexcept {
+        m_head = (m_head + bytes) % m_data.size();
+        m_size -= bytes;
+    }
+
+private:
+    std::vector<char> m_data;
+    size_t m_head = 0;
+    size_t m_size = 0;
+};
+
+/// One authenticated SSH transport (socket + handshake + auth) shared by
+/// every tunnel to the same bastion. Each tunnel opens its own forwarded
+/// channel over the shared session, so warming a pool of drivers costs a
+/// single key exchange instead of one per connection. libssh2 sessions
+/// are not thread-safe, so tunnels serialize every session and channel
+/// call through mutex().
+class SshTransport {
+public:
+    SshTransport() = default;
+    ~SshTransport() {
+        m_monitorRunning = false;
+        if (m_monitorThread.joinable()) {
+            m_monitorThread.join();
+        }
+        teardown();
+    }
+
+    SshTransport(const SshTransport&) = delete;
+    SshTransport& operator=(const SshTransport&) = delete;
+
+    /// Connects and authenticates on first use; subsequent tunnels to the
+    /// same bastion return immediately and share the session
+    std::expected<void, SshTunnelError> ensureConnected(const SshTunnelConfig& config) {
+        std::lock_guard lock(m_mutex);
+        if (m_connected) {
+            log<LogLevel::INFO>(std::format("[SSH] Reusing established SSH session for {}@{}:{}", config.username, config.host, config.port));
+            return {};
+        }
 
         initWsa();
 
-        // Initialize libssh2
+        // Initialize libssh2 (reference-counted internally)
         log<LogLevel::DEBUG>("[SSH] Initializing libssh2...");
         if (libssh2_init(0) != 0) {
             log<LogLevel::ERROR_LEVEL>("[SSH] Failed to initialize libssh2");
@@ -87,6 +183,7 @@ public:
         m_sshSocket = socket(AF_INET, SOCK_STREAM, 0);
         if (m_sshSocket == INVALID_SOCK) {
             log<LogLevel::ERROR_LEVEL>("[SSH] Failed to create socket");
+            teardown();
             return std::unexpected(SshTunnelError{SshTunnelError::Code::SocketError, "Failed to create socket"});
         }
         log<LogLevel::DEBUG>("[SSH] Socket created successfully");
@@ -101,6 +198,7 @@ public:
         auto portStr = std::to_string(config.port);
         if (getaddrinfo(config.host.c_str(), portStr.c_str(), &hints, &result) != 0 || !result) {
             log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Failed to resolve hostname: {}", config.host));
+            teardown();
             return std::unexpected(SshTunnelError{SshTunnelError::Code::ConnectionFailed, std::format("Failed to resolve hostname: {}", config.host)});
         }
         log<LogLevel::DEBUG>("[SSH] Hostname resolved successfully");
@@ -112,6 +210,7 @@ public:
         if (connectResult != 0) {
             int err = getLastSocketError();
             log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Failed to connect to {}:{}, error: {}", config.host, config.port, err));
+            teardown();
             return std::unexpected(SshTunnelError{SshTunnelError::Code::ConnectionFailed, std::format("Failed to connect to {}:{}", config.host, config.port)});
         }
         log<LogLevel::INFO>("[SSH] Connected to SSH server successfully");
@@ -121,6 +220,7 @@ public:
         m_session = libssh2_session_init();
         if (!m_session) {
             log<LogLevel::ERROR_LEVEL>("[SSH] Failed to create SSH session");
+            teardown();
             return std::unexpected(SshTunnelError{SshTunnelError::Code::Unknown, "Failed to create SSH session"});
         }
         log<LogLevel::DEBUG>("[SSH] SSH session created");
@@ -134,8 +234,10 @@ public:
         if (libssh2_session_handshake(m_session, m_sshSocket) != 0) {
             char* errMsg = nullptr;
             libssh2_session_last_error(m_session, &errMsg, nullptr, 0);
-            log<LogLevel::ERROR_LEVEL>(std::format("[SSH] SSH handshake failed: {}", errMsg ? errMsg : "unknown"));
-            return std::unexpected(SshTunnelError{SshTunnelError::Code::ConnectionFailed, std::format("SSH handshake failed: {}", errMsg ? errMsg : "unknown")});
+            auto message = std::format("SSH handshake failed: {}", errMsg ? errMsg : "unknown");
+            log<LogLevel::ERROR_LEVEL>(std::format("[SSH] {}", message));
+            teardown();
+            return std::unexpected(SshTunnelError{SshTunnelError::Code::ConnectionFailed, std::move(message)});
         }
         log<LogLevel::INFO>("[SSH] SSH handshake completed successfully");
 
@@ -145,11 +247,199 @@ public:
         auto authResult = authenticate(config);
         if (!authResult) {
             log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Authentication failed: {}", authResult.error().message));
+            teardown();
             return authResult;
         }
         log<LogLevel::INFO>("[SSH] Authentication successful");
 
-        // Store remote target info
+        // From here the session is shared between tunnel threads: both
+        // the session and its socket go non-blocking so no channel call
+        // made under the mutex can stall the other tunnels
+#ifdef _WIN32
+        u_long mode = 1;
+        ioctlsocket(m_sshSocket, FIONBIO, &mode);
+#else
+        int flags = fcntl(m_sshSocket, F_GETFL, 0);
+        fcntl(m_sshSocket, F_SETFL, flags | O_NONBLOCK);
+#endif
+        libssh2_session_set_blocking(m_session, 0);
+
+        // Keepalive probes (server-replied) detect a dead bastion link in
+        // seconds; the monitor thread drives them and flags the loss
+        libssh2_keepalive_config(m_session, 1, KEEPALIVE_INTERVAL_S);
+        m_connected = true;
+        m_monitorRunning = true;
+        m_monitorThread = std::thread(&SshTransport::monitorLoop, this);
+
+        return {};
+    }
+
+    [[nodiscard]] LIBSSH2_SESSION* session() const noexcept { return m_session; }
+    [[nodiscard]] socket_t transportSocket() const noexcept { return m_sshSocket; }
+    [[nodiscard]] std::mutex& mutex() noexcept { return m_mutex; }
+
+    /// True once a keepalive probe has failed. A lost transport is never
+    /// revived in place (tunnels hold channels into its session); tunnels
+    /// drop their reference and dial a fresh one through the registry.
+    [[nodiscard]] bool isLost() const noexcept { return m_lost.load(std::memory_order_relaxed); }
+
+    /// Last session error text; takes the session mutex itself
+    [[nodiscard]] std::string lastError() {
+        std::lock_guard lock(m_mutex);
+        char* errMsg = nullptr;
+        libssh2_session_last_error(m_session, &errMsg, nullptr, 0);
+        return errMsg ? errMsg : "unknown";
+    }
+
+private:
+    std::expected<void, SshTunnelError> authenticate(const SshTunnelConfig& config) {
+        int rc = 0;
+
+        if (config.authMethod == SshAuthMethod::Password) {
+            log<LogLevel::DEBUG>("[SSH] Attempting password authentication...");
+            rc = libssh2_userauth_password(m_session, config.username.c_str(), config.password.c_str());
+        } else {
+            // Public key authentication
+            std::string publicKeyPath = config.privateKeyPath + ".pub";
+            const char* passphrase = config.keyPassphrase.empty() ? nullptr : config.keyPassphrase.c_str();
+
+            log<LogLevel::DEBUG>(std::format("[SSH] Attempting public key authentication with key: {}", config.privateKeyPath));
+            log<LogLevel::DEBUG>(std::format("[SSH] Looking for public key at: {}", publicKeyPath));
+
+            rc = libssh2_userauth_publickey_fromfile(m_session, config.username.c_str(), publicKeyPath.c_str(), config.privateKeyPath.c_str(), passphrase);
+
+            // If public key file doesn't exist, try with just private key
+            if (rc != 0) {
+                log<LogLevel::DEBUG>("[SSH] Public key auth with .pub failed, trying without .pub file...");
+                rc = libssh2_userauth_publickey_fromfile(m_session, config.username.c_str(), nullptr, config.privateKeyPath.c_str(), passphrase);
+            }
+        }
+
+        if (rc != 0) {
+            char* errMsg = nullptr;
+            libssh2_session_last_error(m_session, &errMsg, nullptr, 0);
+            log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Authentication failed (rc={}): {}", rc, errMsg ? errMsg : "unknown"));
+            return std::unexpected(SshTunnelError{SshTunnelError::Code::AuthenticationFailed, std::format("Authentication failed: {}", errMsg ? errMsg : "unknown")});
+        }
+
+        return {};
+    }
+
+    void monitorLoop() {
+        while (m_monitorRunning) {
+            {
+                std::lock_guard lock(m_mutex);
+                if (!m_connected) {
+                    break;
+                }
+                // Sends only when a probe is due per keepalive_config, so
+                // calling faster than the interval is cheap
+                int secondsToNext = KEEPALIVE_INTERVAL_S;
+                int rc = libssh2_keepalive_send(m_session, &secondsToNext);
+                if (rc != 0 && rc != LIBSSH2_ERROR_EAGAIN) {
+                    log<LogLevel::WARNING>(std::format("[SSH] Keepalive probe failed (rc={}), marking SSH transport lost", rc));
+                    log_flush();
+                    m_lost.store(true, std::memory_order_relaxed);
+                    break;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+    }
+
+    // Callers: ensureConnected failure paths (mutex held) and the
+    // destructor (sole owner by definition)
+    void teardown() {
+        if (m_session) {
+            libssh2_session_disconnect(m_session, "Disconnecting");
+            libssh2_session_free(m_session);
+            m_session = nullptr;
+        }
+
+        if (m_sshSocket != INVALID_SOCK) {
+            closeSocket(m_sshSocket);
+            m_sshSocket = INVALID_SOCK;
+        }
+
+        if (m_libssh2Initialized) {
+            libssh2_exit();
+            m_libssh2Initialized = false;
+        }
+
+        m_connected = false;
+    }
+
+    std::mutex m_mutex;
+    socket_t m_sshSocket = INVALID_SOCK;
+    LIBSSH2_SESSION* m_session = nullptr;
+    bool m_libssh2Initialized = false;
+    bool m_connected = false;
+    std::atomic<bool> m_lost{false};
+    std::atomic<bool> m_monitorRunning{false};
+    std::thread m_monitorThread;
+};
+
+/// Live transports keyed by "host:port:username". Entries are weak: when
+/// the last tunnel over a bastion disconnects the transport tears itself
+/// down, and the next connection performs a fresh handshake.
+class SshTransportRegistry {
+public:
+    [[nodiscard]] static SshTransportRegistry& instance() {
+        static SshTransportRegistry registry;
+        return registry;
+    }
+
+    [[nodiscard]] std::shared_ptr<SshTransport> acquire(const SshTunnelConfig& config) {
+        auto key = std::format("{}:{}:{}", config.host, config.port, config.username);
+        std::lock_guard lock(m_mutex);
+
+        if (auto it = m_transports.find(key); it != m_transports.end()) {
+            // Lost transports are left for their remaining holders to
+            // release; new acquires get a fresh handshake instead
+            if (auto existing = it->second.lock(); existing && !existing->isLost()) {
+                return existing;
+            }
+        }
+
+        auto transport = std::make_shared<SshTransport>();
+        m_transports[key] = transport;
+        std::erase_if(m_transports, [](const auto& entry) { return entry.second.expired(); });
+        return transport;
+    }
+
+private:
+    SshTransportRegistry() = default;
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::weak_ptr<SshTransport>> m_transports;
+};
+
+}  // namespace
+
+class SshTunnel::Impl {
+public:
+    Impl() = default;
+    ~Impl() { disconnect(); }
+
+    std::expected<void, SshTunnelError> connect(const SshTunnelConfig& config) {
+        log<LogLevel::INFO>("[SSH] Starting SSH tunnel connection...");
+        log<LogLevel::INFO>(std::format("[SSH] SSH Host: {}:{}", config.host, config.port));
+        log<LogLevel::INFO>(std::format("[SSH] Remote target: {}:{}", config.remoteHost, config.remotePort));
+        log<LogLevel::INFO>(std::format("[SSH] Username: {}", config.username));
+        log<LogLevel::INFO>(std::format("[SSH] Auth method: {}", config.authMethod == SshAuthMethod::Password ? "password" : "publickey"));
+        log_flush();
+
+        // One SSH transport per (host, port, user): the first tunnel pays
+        // for the handshake, later ones multiplex channels over it
+        m_transport = SshTransportRegistry::instance().acquire(config);
+        if (auto transportResult = m_transport->ensureConnected(config); !transportResult) {
+            m_transport.reset();
+            return transportResult;
+        }
+
+        // Store remote target info, plus the full config for transparent
+        // reconnection when a keepalive probe declares the transport lost
+        m_config = config;
         m_remoteHost = config.remoteHost;
         m_remotePort = config.remotePort;
 
@@ -192,6 +482,16 @@ public:
         }
         log<LogLevel::DEBUG>("[SSH] Listening on local port");
 
+        // Non-blocking listener: the proxy loop polls it so it can also
+        // watch transport health and reconnect between clients
+#ifdef _WIN32
+        u_long listenerMode = 1;
+        ioctlsocket(m_listenerSocket, FIONBIO, &listenerMode);
+#else
+        int listenerFlags = fcntl(m_listenerSocket, F_GETFL, 0);
+        fcntl(m_listenerSocket, F_SETFL, listenerFlags | O_NONBLOCK);
+#endif
+
         m_running = true;
         m_connected = true;
 
@@ -229,29 +529,16 @@ public:
         }
 
         // Clean up SSH channel
-        if (m_channel) {
+        if (m_channel && m_transport) {
+            std::lock_guard lock(m_transport->mutex());
             libssh2_channel_close(m_channel);
             libssh2_channel_free(m_channel);
             m_channel = nullptr;
         }
 
-        // Clean up SSH session
-        if (m_session) {
-            libssh2_session_disconnect(m_session, "Disconnecting");
-            libssh2_session_free(m_session);
-            m_session = nullptr;
-        }
-
-        // Close SSH socket
-        if (m_sshSocket != INVALID_SOCK) {
-            closeSocket(m_sshSocket);
-            m_sshSocket = INVALID_SOCK;
-        }
-
-        if (m_libssh2Initialized) {
-            libssh2_exit();
-            m_libssh2Initialized = false;
-        }
+        // Release the shared transport; the last tunnel over a bastion
+        // tears down the SSH session itself
+        m_transport.reset();
 
         m_connected = false;
         m_localPort = 0;
@@ -269,13 +556,25 @@ private:
         log_flush();
 
         while (m_running) {
+            // Keep the shared transport healthy between clients: a
+            // probe-detected loss reconnects here, in the background,
+            // before the next driver needs the tunnel
+            if (m_transport->isLost() && !reestablishTransport()) {
+                std::this_thread::sleep_for(RECONNECT_BACKOFF);
+                continue;
+            }
+
+            pollfd_t listenerPoll{};
+            listenerPoll.fd = m_listenerSocket;
+            listenerPoll.events = POLL_READ;
+            if (pollSockets(&listenerPoll, 1, ACCEPT_POLL_TIMEOUT_MS) <= 0) {
+                continue;
+            }
+
             // Accept client connection
             sockaddr_in clientAddr{};
             socklen_t clientAddrLen = sizeof(clientAddr);
 
-            log<LogLevel::DEBUG>("[SSH] Waiting for client connection on accept()...");
-            log_flush();
-
             socket_t client = accept(m_listenerSocket, reinterpret_cast<sockaddr*>(&clientAddr), &clientAddrLen);
             if (client == INVALID_SOCK) {
                 if (!m_running) {
@@ -283,10 +582,28 @@ private:
                     break;  // Normal shutdown
                 }
                 int err = getLastSocketError();
+#ifdef _WIN32
+                if (err == WSAEWOULDBLOCK) {
+                    continue;
+                }
+#else
+                if (err == EAGAIN || err == EWOULDBLOCK) {
+                    continue;
+                }
+#endif
                 log<LogLevel::WARNING>(std::format("[SSH] Accept failed with error: {}", err));
                 continue;
             }
 
+            // A lost transport fails the client immediately instead of
+            // letting the driver sit out its full login timeout
+            if (m_transport->isLost()) {
+                log<LogLevel::ERROR_LEVEL>("[SSH] SSH transport lost, refusing tunnel client");
+                log_flush();
+                closeSocket(client);
+                continue;
+            }
+
             log<LogLevel::INFO>("[SSH] Client connected to tunnel!");
             log_flush();
 
@@ -296,12 +613,8 @@ private:
             log<LogLevel::DEBUG>(std::format("[SSH] Opening direct-tcpip channel to {}:{}...", m_remoteHost, m_remotePort));
             log_flush();
 
-            m_channel = libssh2_channel_direct_tcpip(m_session, m_remoteHost.c_str(), m_remotePort);
+            m_channel = openForwardChannel();
             if (!m_channel) {
-                char* errMsg = nullptr;
-                libssh2_session_last_error(m_session, &errMsg, nullptr, 0);
-                log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Failed to open direct-tcpip channel: {}", errMsg ? errMsg : "unknown"));
-                log_flush();
                 closeSocket(client);
                 m_clientSocket = INVALID_SOCK;
                 continue;
@@ -310,10 +623,8 @@ private:
             log<LogLevel::INFO>("[SSH] SSH channel opened successfully");
             log_flush();
 
-            // Set non-blocking mode for data transfer
-            libssh2_channel_set_blocking(m_channel, 0);
-
-            // Set socket to non-blocking
+            // Set socket to non-blocking (the shared session is already
+            // non-blocking for all tunnels)
 #ifdef _WIN32
             u_long mode = 1;
             ioctlsocket(client, FIONBIO, &mode);
@@ -332,6 +643,7 @@ private:
 
             // Cleanup
             if (m_channel) {
+                std::lock_guard lock(m_transport->mutex());
                 libssh2_channel_close(m_channel);
                 libssh2_channel_free(m_channel);
                 m_channel = nullptr;
@@ -345,165 +657,223 @@ private:
         log_flush();
     }
 
+    // Event-driven forwarding: both sockets are polled and each direction
+    // moves through its own ring buffer, so slow and fast peers decouple
+    // without sleeps or per-chunk allocation. The loop drains every edge
+    // until it would block, then polls only for the events that can make
+    // progress (read when a ring has space, write when a ring has data).
     void proxyData(socket_t client) {
-        char buffer[BUFFER_SIZE];
-        int loopCount = 0;
-        int totalBytesFromClient = 0;
-        int totalBytesFromServer = 0;
+        m_upRing.reset();    // client -> remote
+        m_downRing.reset();  // remote -> client
+        bool clientEof = false;
+        bool channelEof = false;
+        size_t totalBytesFromClient = 0;
+        size_t totalBytesFromServer = 0;
 
         while (m_running) {
-            bool activity = false;
-            loopCount++;
+            // Client -> up ring
+            while (!clientEof && m_upRing.freeSpace() > 0) {
+                auto [dst, span] = m_upRing.writeSpan();
+                int bytesRead = recv(client, dst, static_cast<int>(span), 0);
+                if (bytesRead > 0) {
+                    m_upRing.commitWrite(static_cast<size_t>(bytesRead));
+                    totalBytesFromClient += static_cast<size_t>(bytesRead);
+                    continue;
+                }
+                if (bytesRead == 0) {
+                    clientEof = true;
+                    break;
+                }
+                int err = getLastSocketError();
+#ifdef _WIN32
+                if (err == WSAEWOULDBLOCK) {
+                    break;
+                }
+#else
+                if (err == EAGAIN || err == EWOULDBLOCK) {
+                    break;
+                }
+#endif
+                log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Recv error: {}", err));
+                log_flush();
+                return;
+            }
 
-            // Log periodically
-            if (loopCount % 1000 == 0) {
-                log<LogLevel::DEBUG>(std::format("[SSH] Proxy loop iteration {}, client->server: {} bytes, server->client: {} bytes", loopCount, totalBytesFromClient, totalBytesFromServer));
+            // Up ring -> SSH channel. Each channel call holds the session
+            // mutex only for the non-blocking call itself, so concurrent
+            // tunnels interleave rather than serialize whole transfers.
+            while (!m_upRing.empty()) {
+                auto [src, span] = m_upRing.readSpan();
+                const auto written = [&] {
+                    std::lock_guard lock(m_transport->mutex());
+                    return libssh2_channel_write(m_channel, src, span);
+                }();
+                if (written > 0) {
+                    m_upRing.commitRead(static_cast<size_t>(written));
+                    continue;
+                }
+                if (written == LIBSSH2_ERROR_EAGAIN) {
+                    break;
+                }
+                log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Channel write error: {} ({})", written, m_transport->lastError()));
                 log_flush();
+                return;
             }
 
-            // Read from client, write to SSH channel
-            int bytesRead = recv(client, buffer, BUFFER_SIZE, 0);
-            if (bytesRead > 0) {
-                activity = true;
-                totalBytesFromClient += bytesRead;
-                log<LogLevel::DEBUG>(std::format("[SSH] Received {} bytes from client", bytesRead));
-
-                int totalWritten = 0;
-                while (totalWritten < bytesRead && m_running) {
-                    int written = static_cast<int>(libssh2_channel_write(m_channel, buffer + totalWritten, bytesRead - totalWritten));
-                    if (written > 0) {
-                        totalWritten += written;
-                        log<LogLevel::DEBUG>(std::format("[SSH] Wrote {} bytes to SSH channel (total: {})", written, totalWritten));
-                    } else if (written == LIBSSH2_ERROR_EAGAIN) {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                    } else {
-                        char* errMsg = nullptr;
-                        libssh2_session_last_error(m_session, &errMsg, nullptr, 0);
-                        log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Channel write error: {} ({})", written, errMsg ? errMsg : "unknown"));
-                        log_flush();
-                        return;  // Error
+            // SSH channel -> down ring
+            while (!channelEof && m_downRing.freeSpace() > 0) {
+                auto [dst, span] = m_downRing.writeSpan();
+                const auto channelRead = [&] {
+                    std::lock_guard lock(m_transport->mutex());
+                    return libssh2_channel_read(m_channel, dst, span);
+                }();
+                if (channelRead > 0) {
+                    m_downRing.commitWrite(static_cast<size_t>(channelRead));
+                    totalBytesFromServer += static_cast<size_t>(channelRead);
+                    continue;
+                }
+                if (channelRead == LIBSSH2_ERROR_EAGAIN) {
+                    break;
+                }
+                if (channelRead == 0) {
+                    std::lock_guard lock(m_transport->mutex());
+                    if (libssh2_channel_eof(m_channel)) {
+                        channelEof = true;
                     }
+                    break;
                 }
-            } else if (bytesRead == 0) {
-                log<LogLevel::INFO>("[SSH] Client disconnected (recv returned 0)");
+                log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Channel read error: {} ({})", channelRead, m_transport->lastError()));
                 log_flush();
-                return;  // Client disconnected
-            } else {
+                return;
+            }
+
+            // Down ring -> client
+            while (!m_downRing.empty()) {
+                auto [src, span] = m_downRing.readSpan();
+                int sent = send(client, src, static_cast<int>(span), 0);
+                if (sent > 0) {
+                    m_downRing.commitRead(static_cast<size_t>(sent));
+                    continue;
+                }
+                int err = getLastSocketError();
 #ifdef _WIN32
-                int err = WSAGetLastError();
-                if (err != WSAEWOULDBLOCK) {
-                    log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Recv error: {}", err));
-                    log_flush();
-                    return;
+                if (err == WSAEWOULDBLOCK) {
+                    break;
                 }
 #else
-                if (errno != EAGAIN && errno != EWOULDBLOCK) {
-                    log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Recv error: {}", errno));
-                    log_flush();
-                    return;
+                if (err == EAGAIN || err == EWOULDBLOCK) {
+                    break;
                 }
 #endif
+                log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Send error: {}", err));
+                log_flush();
+                return;
             }
 
-            // Read from SSH channel, write to client
-            ssize_t channelRead = libssh2_channel_read(m_channel, buffer, BUFFER_SIZE);
-            if (channelRead > 0) {
-                activity = true;
-                totalBytesFromServer += static_cast<int>(channelRead);
-                log<LogLevel::DEBUG>(std::format("[SSH] Received {} bytes from SSH channel", channelRead));
-
-                int totalSent = 0;
-                while (totalSent < channelRead && m_running) {
-                    int sent = send(client, buffer + totalSent, static_cast<int>(channelRead - totalSent), 0);
-                    if (sent > 0) {
-                        totalSent += sent;
-                        log<LogLevel::DEBUG>(std::format("[SSH] Sent {} bytes to client (total: {})", sent, totalSent));
-                    } else if (sent < 0) {
-#ifdef _WIN32
-                        int err = WSAGetLastError();
-                        if (err == WSAEWOULDBLOCK) {
-                            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                            continue;
-                        }
-                        log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Send error: {}", err));
-#else
-                        if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                            continue;
-                        }
-                        log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Send error: {}", errno));
-#endif
-                        log_flush();
-                        return;  // Error
-                    }
-                }
-            } else if (channelRead == 0 || libssh2_channel_eof(m_channel)) {
+            // A side is done once its peer hit EOF and its ring is drained
+            if (clientEof && m_upRing.empty()) {
+                log<LogLevel::INFO>("[SSH] Client disconnected");
+                log_flush();
+                break;
+            }
+            if (channelEof && m_downRing.empty()) {
                 log<LogLevel::INFO>("[SSH] SSH channel closed (EOF)");
                 log_flush();
-                return;  // Channel closed
-            } else if (channelRead != LIBSSH2_ERROR_EAGAIN) {
-                char* errMsg = nullptr;
-                libssh2_session_last_error(m_session, &errMsg, nullptr, 0);
-                log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Channel read error: {} ({})", channelRead, errMsg ? errMsg : "unknown"));
+                break;
+            }
+
+            // A silently dead link keeps returning EAGAIN; once the
+            // keepalive probe flags it, drop the client right away so the
+            // driver fails fast instead of hanging
+            if (m_transport->isLost()) {
+                log<LogLevel::WARNING>("[SSH] SSH transport lost, dropping tunnel client");
                 log_flush();
-                return;  // Error
+                break;
             }
 
-            // Avoid busy loop
-            if (!activity) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            // Block until one of the pending edges can progress. In every
+            // stalled state at least one event is registered: a full ring
+            // waits for its consumer's write readiness.
+            pollfd_t fds[2]{};
+            fds[0].fd = client;
+            fds[1].fd = m_transport->transportSocket();
+            if (!clientEof && m_upRing.freeSpace() > 0) {
+                fds[0].events |= POLL_READ;
+            }
+            if (!m_downRing.empty()) {
+                fds[0].events |= POLL_WRITE;
+            }
+            if (!channelEof && m_downRing.freeSpace() > 0) {
+                fds[1].events |= POLL_READ;
+            }
+            if (!m_upRing.empty()) {
+                fds[1].events |= POLL_WRITE;
             }
+            pollSockets(fds, 2, POLL_TIMEOUT_MS);
         }
 
         log<LogLevel::DEBUG>(std::format("[SSH] Proxy data loop ended. Total: client->server: {} bytes, server->client: {} bytes", totalBytesFromClient, totalBytesFromServer));
         log_flush();
     }
 
-    std::expected<void, SshTunnelError> authenticate(const SshTunnelConfig& config) {
-        int rc = 0;
-
-        if (config.authMethod == SshAuthMethod::Password) {
-            log<LogLevel::DEBUG>("[SSH] Attempting password authentication...");
-            rc = libssh2_userauth_password(m_session, config.username.c_str(), config.password.c_str());
-        } else {
-            // Public key authentication
-            std::string publicKeyPath = config.privateKeyPath + ".pub";
-            const char* passphrase = config.keyPassphrase.empty() ? nullptr : config.keyPassphrase.c_str();
-
-            log<LogLevel::DEBUG>(std::format("[SSH] Attempting public key authentication with key: {}", config.privateKeyPath));
-            log<LogLevel::DEBUG>(std::format("[SSH] Looking for public key at: {}", publicKeyPath));
-
-            rc = libssh2_userauth_publickey_fromfile(m_session, config.username.c_str(), publicKeyPath.c_str(), config.privateKeyPath.c_str(), passphrase);
+    // Swaps a lost transport for a fresh one through the registry. Other
+    // tunnels sharing the old session make the same swap on their side;
+    // the dead session frees once the last of them lets go.
+    [[nodiscard]] bool reestablishTransport() {
+        log<LogLevel::INFO>("[SSH] Reconnecting lost SSH transport...");
+        log_flush();
+        m_transport.reset();
+        m_transport = SshTransportRegistry::instance().acquire(m_config);
+        if (auto result = m_transport->ensureConnected(m_config); !result) {
+            log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Reconnect failed: {}", result.error().message));
+            log_flush();
+            return false;
+        }
+        log<LogLevel::INFO>("[SSH] SSH transport re-established");
+        log_flush();
+        return true;
+    }
 
-            // If public key file doesn't exist, try with just private key
-            if (rc != 0) {
-                log<LogLevel::DEBUG>("[SSH] Public key auth with .pub failed, trying without .pub file...");
-                rc = libssh2_userauth_publickey_fromfile(m_session, config.username.c_str(), nullptr, config.privateKeyPath.c_str(), passphrase);
+    // The shared session is non-blocking, so opening a channel can take
+    // several exchanges with the server; retry on EAGAIN until the channel
+    // is up or the tunnel shuts down.
+    [[nodiscard]] LIBSSH2_CHANNEL* openForwardChannel() {
+        while (m_running) {
+            {
+                std::lock_guard lock(m_transport->mutex());
+                if (auto* channel = libssh2_channel_direct_tcpip(m_transport->session(), m_remoteHost.c_str(), m_remotePort)) {
+                    return channel;
+                }
+                if (libssh2_session_last_errno(m_transport->session()) != LIBSSH2_ERROR_EAGAIN) {
+                    char* errMsg = nullptr;
+                    libssh2_session_last_error(m_transport->session(), &errMsg, nullptr, 0);
+                    log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Failed to open direct-tcpip channel: {}", errMsg ? errMsg : "unknown"));
+                    log_flush();
+                    return nullptr;
+                }
             }
-        }
 
-        if (rc != 0) {
-            char* errMsg = nullptr;
-            libssh2_session_last_error(m_session, &errMsg, nullptr, 0);
-            log<LogLevel::ERROR_LEVEL>(std::format("[SSH] Authentication failed (rc={}): {}", rc, errMsg ? errMsg : "unknown"));
-            return std::unexpected(SshTunnelError{SshTunnelError::Code::AuthenticationFailed, std::format("Authentication failed: {}", errMsg ? errMsg : "unknown")});
+            pollfd_t pfd{};
+            pfd.fd = m_transport->transportSocket();
+            pfd.events = POLL_READ | POLL_WRITE;
+            pollSockets(&pfd, 1, POLL_TIMEOUT_MS);
         }
-
-        return {};
+        return nullptr;
     }
 
-    socket_t m_sshSocket = INVALID_SOCK;
+    std::shared_ptr<SshTransport> m_transport;
     socket_t m_listenerSocket = INVALID_SOCK;
     socket_t m_clientSocket = INVALID_SOCK;
-    LIBSSH2_SESSION* m_session = nullptr;
     LIBSSH2_CHANNEL* m_channel = nullptr;
-    bool m_libssh2Initialized = false;
     std::atomic<bool> m_connected{false};
     std::atomic<bool> m_running{false};
     int m_localPort = 0;
+    SshTunnelConfig m_config;
     std::string m_remoteHost;
     int m_remotePort = 0;
     std::thread m_proxyThread;
+    RingBuffer m_upRing{RING_CAPACITY};
+    RingBuffer m_downRing{RING_CAPACITY};
 };
 
 SshTunnel::SshTunnel() : m_impl(std::make_unique<Impl>()) {}
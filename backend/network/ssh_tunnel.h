@@ -38,7 +38,9 @@ public:
     SshTunnel(SshTunnel&&) noexcept;
     SshTunnel& operator=(SshTunnel&&) noexcept;
 
-    // Establish SSH connection and create tunnel
+    // Establish SSH connection and create tunnel. Tunnels to the same
+    // (host, port, user) multiplex forwarded channels over one shared SSH
+    // session, so only the first connection pays for the handshake.
     [[nodiscard]] std::expected<void, SshTunnelError> connect(const SshTunnelConfig& config);
 
     // Close the tunnel and SSH connection
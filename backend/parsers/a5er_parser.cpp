@@ -1,33 +1,44 @@
 #include "a5er_parser.h"
 
-#include <fstream>
+#include <Windows.h>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <iterator>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
 
 #include "pugixml.hpp"
+#include "utils/file_utils.h"
 
 namespace velocitydb {
 
-A5ERModel A5ERParser::parse(const std::string& filepath) {
-    pugi::xml_document doc;
-    pugi::xml_parse_result result = doc.load_file(filepath.c_str());
-
-    if (!result) {
-        throw std::runtime_error("Failed to parse A5:ER file: " + std::string(result.description()));
-    }
+namespace {
 
-    A5ERModel model;
+constexpr size_t MAX_DDL_WORKERS = 8;
+constexpr size_t MIN_TABLES_FOR_PARALLEL_DDL = 16;  // Below this, thread startup costs more than the scripting
 
+// Shared DOM walk for both the file and the string entry points. Records
+// are built in place and moved into the model; vectors are reserved from
+// the child counts so a big model grows each vector once.
+A5ERModel modelFromDocument(const pugi::xml_document& doc) {
     auto root = doc.child("A5ER");
     if (!root) {
         throw std::runtime_error("Invalid A5:ER file format");
     }
 
+    A5ERModel model;
     model.name = root.attribute("Name").as_string();
     model.databaseType = root.attribute("DatabaseType").as_string();
 
+    auto entities = root.children("Entity");
+    model.tables.reserve(static_cast<size_t>(std::distance(entities.begin(), entities.end())));
+
     // Parse tables
-    for (auto entityNode : root.children("Entity")) {
+    for (auto entityNode : entities) {
         A5ERTable table;
         table.name = entityNode.attribute("Name").as_string();
         table.logicalName = entityNode.attribute("LogicalName").as_string();
@@ -36,7 +47,9 @@ A5ERModel A5ERParser::parse(const std::string& filepath) {
         table.posY = entityNode.attribute("Y").as_double();
 
         // Parse columns
-        for (auto attrNode : entityNode.children("Attribute")) {
+        auto attributes = entityNode.children("Attribute");
+        table.columns.reserve(static_cast<size_t>(std::distance(attributes.begin(), attributes.end())));
+        for (auto attrNode : attributes) {
             A5ERColumn col;
             col.name = attrNode.attribute("Name").as_string();
             col.logicalName = attrNode.attribute("LogicalName").as_string();
@@ -47,7 +60,7 @@ A5ERModel A5ERParser::parse(const std::string& filepath) {
             col.isPrimaryKey = attrNode.attribute("PK").as_bool(false);
             col.defaultValue = attrNode.attribute("Default").as_string();
             col.comment = attrNode.attribute("Comment").as_string();
-            table.columns.push_back(col);
+            table.columns.push_back(std::move(col));
         }
 
         // Parse indexes
@@ -56,16 +69,22 @@ A5ERModel A5ERParser::parse(const std::string& filepath) {
             idx.name = indexNode.attribute("Name").as_string();
             idx.isUnique = indexNode.attribute("Unique").as_bool(false);
 
-            std::string cols = indexNode.attribute("Columns").as_string();
-            std::istringstream iss(cols);
-            std::string colName;
-            while (std::getline(iss, colName, ',')) {
-                idx.columns.push_back(colName);
+            // Comma-separated column list, split without a stream
+            std::string_view cols = indexNode.attribute("Columns").as_string();
+            for (size_t start = 0; start <= cols.size();) {
+                auto comma = cols.find(',', start);
+                if (comma == std::string_view::npos) {
+                    comma = cols.size();
+                }
+                if (comma > start) {
+                    idx.columns.emplace_back(cols.substr(start, comma - start));
+                }
+                start = comma + 1;
             }
-            table.indexes.push_back(idx);
+            table.indexes.push_back(std::move(idx));
         }
 
-        model.tables.push_back(table);
+        model.tables.push_back(std::move(table));
     }
 
     // Parse relations
@@ -77,78 +96,81 @@ A5ERModel A5ERParser::parse(const std::string& filepath) {
         rel.parentColumn = relNode.attribute("ParentAttribute").as_string();
         rel.childColumn = relNode.attribute("ChildAttribute").as_string();
         rel.cardinality = relNode.attribute("Cardinality").as_string("1:N");
-        model.relations.push_back(rel);
+        model.relations.push_back(std::move(rel));
     }
 
     return model;
 }
 
-A5ERModel A5ERParser::parseFromString(const std::string& content) {
-    pugi::xml_document doc;
-    pugi::xml_parse_result result = doc.load_string(content.c_str());
-
-    if (!result) {
-        throw std::runtime_error("Failed to parse A5:ER content: " + std::string(result.description()));
-    }
+}  // namespace
 
-    // Same parsing logic as parse()
-    A5ERModel model;
-    auto root = doc.child("A5ER");
-    if (!root) {
-        throw std::runtime_error("Invalid A5:ER format");
+A5ERModel A5ERParser::parse(const std::string& filepath) {
+    MappedFile mapped{std::filesystem::path(filepath)};
+    if (!mapped.isMapped()) {
+        throw std::runtime_error("Failed to open A5:ER file: " + filepath);
     }
 
-    model.name = root.attribute("Name").as_string();
-    model.databaseType = root.attribute("DatabaseType").as_string();
+    // Parse straight from the mapping: pugixml copies only what the DOM
+    // keeps, the input itself is never duplicated
+    pugi::xml_document doc;
+    pugi::xml_parse_result result = doc.load_buffer(mapped.view().data(), mapped.view().size());
 
-    for (auto entityNode : root.children("Entity")) {
-        A5ERTable table;
-        table.name = entityNode.attribute("Name").as_string();
-        table.logicalName = entityNode.attribute("LogicalName").as_string();
-        table.comment = entityNode.attribute("Comment").as_string();
-        table.posX = entityNode.attribute("X").as_double();
-        table.posY = entityNode.attribute("Y").as_double();
+    if (!result) {
+        throw std::runtime_error("Failed to parse A5:ER file: " + std::string(result.description()));
+    }
 
-        for (auto attrNode : entityNode.children("Attribute")) {
-            A5ERColumn col;
-            col.name = attrNode.attribute("Name").as_string();
-            col.logicalName = attrNode.attribute("LogicalName").as_string();
-            col.type = attrNode.attribute("Type").as_string();
-            col.size = attrNode.attribute("Size").as_int();
-            col.scale = attrNode.attribute("Scale").as_int();
-            col.nullable = attrNode.attribute("Nullable").as_bool(true);
-            col.isPrimaryKey = attrNode.attribute("PK").as_bool(false);
-            col.defaultValue = attrNode.attribute("Default").as_string();
-            col.comment = attrNode.attribute("Comment").as_string();
-            table.columns.push_back(col);
-        }
+    return modelFromDocument(doc);
+}
 
-        model.tables.push_back(table);
-    }
+A5ERModel A5ERParser::parseFromString(const std::string& content) {
+    pugi::xml_document doc;
+    pugi::xml_parse_result result = doc.load_buffer(content.data(), content.size());
 
-    for (auto relNode : root.children("Relation")) {
-        A5ERRelation rel;
-        rel.name = relNode.attribute("Name").as_string();
-        rel.parentTable = relNode.attribute("ParentEntity").as_string();
-        rel.childTable = relNode.attribute("ChildEntity").as_string();
-        rel.parentColumn = relNode.attribute("ParentAttribute").as_string();
-        rel.childColumn = relNode.attribute("ChildAttribute").as_string();
-        rel.cardinality = relNode.attribute("Cardinality").as_string("1:N");
-        model.relations.push_back(rel);
+    if (!result) {
+        throw std::runtime_error("Failed to parse A5:ER content: " + std::string(result.description()));
     }
 
-    return model;
+    return modelFromDocument(doc);
 }
 
 std::string A5ERParser::generateDDL(const A5ERModel& model, const std::string& targetDatabase) {
+    // Table DDL generation is independent per table, so a large model is
+    // scripted in parallel into per-table buffers and joined in diagram
+    // order below. Small models stay on the calling thread.
+    std::vector<std::string> tableDDLs(model.tables.size());
+    auto workerCount = (std::min)({static_cast<size_t>(std::thread::hardware_concurrency()), model.tables.size(), MAX_DDL_WORKERS});
+
+    if (workerCount > 1 && model.tables.size() >= MIN_TABLES_FOR_PARALLEL_DDL) {
+        std::atomic<size_t> nextTable{0};
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+        for (size_t w = 0; w < workerCount; ++w) {
+            workers.emplace_back([&] {
+                while (true) {
+                    auto i = nextTable.fetch_add(1, std::memory_order_relaxed);
+                    if (i >= model.tables.size()) {
+                        break;
+                    }
+                    tableDDLs[i] = generateTableDDL(model.tables[i], targetDatabase);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    } else {
+        for (size_t i = 0; i < model.tables.size(); ++i) {
+            tableDDLs[i] = generateTableDDL(model.tables[i], targetDatabase);
+        }
+    }
+
     std::ostringstream ddl;
 
     ddl << "-- Generated from A5:ER model: " << model.name << "\n";
     ddl << "-- Target database: " << targetDatabase << "\n\n";
 
-    // Generate table DDLs
-    for (const auto& table : model.tables) {
-        ddl << generateTableDDL(table, targetDatabase) << "\n\n";
+    for (const auto& tableDDL : tableDDLs) {
+        ddl << tableDDL << "\n\n";
     }
 
     // Generate foreign keys
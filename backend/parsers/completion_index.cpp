@@ -0,0 +1,288 @@
+#include "completion_index.h"
+
+#include "sql_parser.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <iterator>
+#include <ranges>
+
+namespace velocitydb {
+
+namespace {
+
+using namespace std::literals;
+
+// Words that can follow a table reference but never act as its alias.
+// ASCII-sorted for binary search.
+constexpr std::array RESERVED_AFTER_TABLE = {
+    "AS"sv,     "CROSS"sv, "EXCEPT"sv, "FOR"sv,   "FULL"sv,  "GROUP"sv,  "HAVING"sv, "INNER"sv, "INTERSECT"sv, "JOIN"sv,  "LEFT"sv, "ON"sv,
+    "OPTION"sv, "ORDER"sv, "OUTER"sv,  "PIVOT"sv, "RIGHT"sv, "SELECT"sv, "SET"sv,    "UNION"sv, "UNPIVOT"sv,   "WHERE"sv, "WITH"sv,
+};
+static_assert(std::ranges::is_sorted(RESERVED_AFTER_TABLE));
+
+[[nodiscard]] bool isWordStart(char c) {
+    return std::isalpha(static_cast<unsigned char>(c)) || c == '_' || c == '#' || c == '@';
+}
+
+[[nodiscard]] bool isWordChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '#' || c == '@' || c == '$';
+}
+
+[[nodiscard]] std::string toUpperCopy(std::string_view str) {
+    std::string upper;
+    upper.reserve(str.size());
+    for (char c : str) {
+        upper += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return upper;
+}
+
+[[nodiscard]] bool isReservedAfterTable(std::string_view upper) {
+    return std::ranges::binary_search(RESERVED_AFTER_TABLE, upper);
+}
+
+/// Minimal token scanner for a single statement: yields words, bracketed
+/// identifiers (brackets stripped) and single punctuation characters,
+/// skipping whitespace, comments and string literals
+class TokenScanner {
+public:
+    explicit TokenScanner(std::string_view statement) : m_sql(statement) {}
+
+    /// Next token, empty view at end of statement
+    [[nodiscard]] std::string_view next() {
+        skipToToken();
+        if (m_pos >= m_sql.size()) {
+            return {};
+        }
+        char c = m_sql[m_pos];
+        if (c == '[') {
+            auto close = m_sql.find(']', m_pos + 1);
+            if (close == std::string_view::npos) {
+                close = m_sql.size();
+            }
+            auto token = m_sql.substr(m_pos + 1, close - m_pos - 1);
+            m_pos = (std::min)(close + 1, m_sql.size());
+            return token;
+        }
+        if (c == '"') {
+            auto close = m_sql.find('"', m_pos + 1);
+            if (close == std::string_view::npos) {
+                close = m_sql.size();
+            }
+            auto token = m_sql.substr(m_pos + 1, close - m_pos - 1);
+            m_pos = (std::min)(close + 1, m_sql.size());
+            return token;
+        }
+        if (isWordChar(c)) {
+            auto start = m_pos;
+            while (m_pos < m_sql.size() && isWordChar(m_sql[m_pos])) {
+                ++m_pos;
+            }
+            return m_sql.substr(start, m_pos - start);
+        }
+        return m_sql.substr(m_pos++, 1);
+    }
+
+    [[nodiscard]] size_t position() const noexcept { return m_pos; }
+    void seek(size_t pos) noexcept { m_pos = pos; }
+
+private:
+    void skipToToken() {
+        while (m_pos < m_sql.size()) {
+            char c = m_sql[m_pos];
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                ++m_pos;
+            } else if (c == '-' && m_pos + 1 < m_sql.size() && m_sql[m_pos + 1] == '-') {
+                auto eol = m_sql.find('\n', m_pos);
+                m_pos = eol == std::string_view::npos ? m_sql.size() : eol + 1;
+            } else if (c == '/' && m_pos + 1 < m_sql.size() && m_sql[m_pos + 1] == '*') {
+                m_pos += 2;
+                for (int depth = 1; m_pos < m_sql.size() && depth > 0; ++m_pos) {
+                    if (m_sql[m_pos] == '/' && m_pos + 1 < m_sql.size() && m_sql[m_pos + 1] == '*') {
+                        ++depth;
+                        ++m_pos;
+                    } else if (m_sql[m_pos] == '*' && m_pos + 1 < m_sql.size() && m_sql[m_pos + 1] == '/') {
+                        --depth;
+                        ++m_pos;
+                    }
+                }
+            } else if (c == '\'') {
+                ++m_pos;
+                while (m_pos < m_sql.size()) {
+                    if (m_sql[m_pos] == '\'') {
+                        if (m_pos + 1 < m_sql.size() && m_sql[m_pos + 1] == '\'') {
+                            m_pos += 2;
+                            continue;
+                        }
+                        ++m_pos;
+                        break;
+                    }
+                    ++m_pos;
+                }
+            } else {
+                break;
+            }
+        }
+    }
+
+    std::string_view m_sql;
+    size_t m_pos = 0;
+};
+
+/// Collect the table references a statement binds: the targets of
+/// FROM/JOIN/UPDATE/INTO plus comma-separated FROM-list entries, each
+/// with its alias if one follows. Scopes are flat per statement, which
+/// is what alias completion needs.
+[[nodiscard]] std::vector<CompletionTableRef> extractTableRefs(std::string_view statement) {
+    std::vector<CompletionTableRef> refs;
+    TokenScanner scanner(statement);
+    bool inFromList = false;
+
+    while (true) {
+        auto token = scanner.next();
+        if (token.empty()) {
+            break;
+        }
+        auto upper = toUpperCopy(token);
+        bool startsRef = upper == "FROM" || upper == "JOIN" || upper == "UPDATE" || upper == "INTO";
+        if (!startsRef && !(inFromList && token == ",")) {
+            if (token != "," && !isWordStart(token.front()) && token != "." ) {
+                // Punctuation other than the FROM-list comma (e.g. a
+                // closing subquery paren) ends the comma continuation
+                inFromList = false;
+            } else if (isReservedAfterTable(upper)) {
+                inFromList = false;
+            }
+            continue;
+        }
+
+        auto name = scanner.next();
+        if (name.empty()) {
+            break;
+        }
+        if (!isWordStart(name.front())) {
+            // Derived table or table-valued expression: no simple name to bind
+            inFromList = false;
+            continue;
+        }
+
+        std::string table(name);
+        while (true) {
+            auto save = scanner.position();
+            if (scanner.next() != ".") {
+                scanner.seek(save);
+                break;
+            }
+            auto part = scanner.next();
+            if (part.empty()) {
+                break;
+            }
+            table += '.';
+            table += part;
+        }
+
+        std::string alias;
+        auto save = scanner.position();
+        auto following = scanner.next();
+        auto followingUpper = toUpperCopy(following);
+        if (followingUpper == "AS") {
+            auto aliasToken = scanner.next();
+            if (!aliasToken.empty() && isWordStart(aliasToken.front())) {
+                alias = aliasToken;
+            }
+        } else if (!following.empty() && isWordStart(following.front()) && !isReservedAfterTable(followingUpper)) {
+            alias = following;
+        } else {
+            scanner.seek(save);
+        }
+
+        refs.push_back({.table = std::move(table), .alias = std::move(alias)});
+        inFromList = upper == "FROM" || (inFromList && token == ",");
+    }
+
+    return refs;
+}
+
+}  // namespace
+
+void CompletionIndex::setBuffer(std::string text) {
+    m_buffer = std::move(text);
+    reindexAll();
+}
+
+void CompletionIndex::reindexAll() {
+    m_statements.clear();
+    auto views = SQLParser::splitStatements(m_buffer);
+    m_statements.reserve(views.size());
+    for (auto view : views) {
+        auto begin = static_cast<size_t>(view.data() - m_buffer.data());
+        m_statements.push_back({.begin = begin, .end = begin + view.size(), .tables = extractTableRefs(view)});
+    }
+}
+
+void CompletionIndex::applyEdit(size_t offset, size_t removedLength, std::string_view insertedText) {
+    offset = (std::min)(offset, m_buffer.size());
+    removedLength = (std::min)(removedLength, m_buffer.size() - offset);
+    const size_t editEnd = offset + removedLength;
+    const auto delta = static_cast<ptrdiff_t>(insertedText.size()) - static_cast<ptrdiff_t>(removedLength);
+
+    m_buffer.replace(offset, removedLength, insertedText);
+
+    if (m_statements.empty()) {
+        reindexAll();
+        return;
+    }
+
+    // Dirty window: from the statement containing or preceding the edit
+    // through the statement containing or following it, so edits that
+    // merge neighbours (deleting a ';') or split one (typing a ';') are
+    // always re-scanned whole
+    size_t firstDirty = 0;
+    for (size_t i = 0; i < m_statements.size(); ++i) {
+        if (m_statements[i].begin > offset) {
+            break;
+        }
+        firstDirty = i;
+    }
+    size_t lastDirty = m_statements.size();  // "none" sentinel
+    for (size_t i = firstDirty; i < m_statements.size(); ++i) {
+        if (m_statements[i].end >= editEnd) {
+            lastDirty = i;
+            break;
+        }
+    }
+
+    size_t regionBegin = (std::min)(m_statements[firstDirty].begin, offset);
+    size_t regionEnd = m_buffer.size();
+    if (lastDirty < m_statements.size()) {
+        regionEnd = static_cast<size_t>(static_cast<ptrdiff_t>(m_statements[lastDirty].end) + delta);
+        regionEnd = (std::min)(regionEnd, m_buffer.size());
+    }
+
+    std::vector<StatementScope> reindexed;
+    auto region = std::string_view(m_buffer).substr(regionBegin, regionEnd - regionBegin);
+    for (auto view : SQLParser::splitStatements(region)) {
+        auto begin = regionBegin + static_cast<size_t>(view.data() - region.data());
+        reindexed.push_back({.begin = begin, .end = begin + view.size(), .tables = extractTableRefs(view)});
+    }
+
+    const size_t spliceEnd = lastDirty < m_statements.size() ? lastDirty + 1 : m_statements.size();
+    for (size_t i = spliceEnd; i < m_statements.size(); ++i) {
+        m_statements[i].begin = static_cast<size_t>(static_cast<ptrdiff_t>(m_statements[i].begin) + delta);
+        m_statements[i].end = static_cast<size_t>(static_cast<ptrdiff_t>(m_statements[i].end) + delta);
+    }
+    m_statements.erase(m_statements.begin() + static_cast<ptrdiff_t>(firstDirty), m_statements.begin() + static_cast<ptrdiff_t>(spliceEnd));
+    m_statements.insert(m_statements.begin() + static_cast<ptrdiff_t>(firstDirty), std::make_move_iterator(reindexed.begin()), std::make_move_iterator(reindexed.end()));
+}
+
+std::vector<CompletionTableRef> CompletionIndex::scopeAt(size_t cursorOffset) const {
+    auto it = std::ranges::upper_bound(m_statements, cursorOffset, {}, &StatementScope::begin);
+    if (it == m_statements.begin()) {
+        return {};
+    }
+    return std::prev(it)->tables;
+}
+
+}  // namespace velocitydb
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace velocitydb {
+
+/// One table reference in scope at a cursor position
+struct CompletionTableRef {
+    std::string table;  ///< Referenced table name (dot-qualified, brackets stripped)
+    std::string alias;  ///< Alias bound to the table, empty if none
+};
+
+/// Incremental token index over an editor buffer for autocomplete.
+///
+/// Keeps the current buffer text plus a per-statement index of the table
+/// references (FROM/JOIN/UPDATE/INTO targets with their aliases) each
+/// statement binds. Edits are applied as deltas: only the statements the
+/// edit touches are re-split and re-scanned, mirroring the splice logic
+/// of SQLFormatter::formatRange, so keystrokes on large buffers stay
+/// cheap. Not thread-safe; callers serialize access per buffer.
+class CompletionIndex {
+public:
+    /// Replace the whole buffer and rebuild the index (initial load)
+    void setBuffer(std::string text);
+
+    /// Apply an editor delta: removedLength bytes at offset are replaced
+    /// by insertedText. Statements outside the edited window keep their
+    /// cached scopes with shifted offsets.
+    void applyEdit(size_t offset, size_t removedLength, std::string_view insertedText);
+
+    /// Table references in scope at a byte offset. The statement the
+    /// cursor is in (or the nearest one before it, while typing in the
+    /// gap after a statement) provides the scope.
+    [[nodiscard]] std::vector<CompletionTableRef> scopeAt(size_t cursorOffset) const;
+
+    [[nodiscard]] const std::string& buffer() const noexcept { return m_buffer; }
+    [[nodiscard]] size_t statementCount() const noexcept { return m_statements.size(); }
+
+private:
+    /// Index entry for one statement: its byte span and bound tables
+    struct StatementScope {
+        size_t begin;
+        size_t end;  ///< One past the last byte of the statement
+        std::vector<CompletionTableRef> tables;
+    };
+
+    /// Split and scan the whole buffer from scratch
+    void reindexAll();
+
+    std::string m_buffer;
+    std::vector<StatementScope> m_statements;  ///< Sorted by begin offset
+};
+
+}  // namespace velocitydb
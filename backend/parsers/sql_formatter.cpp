@@ -1,32 +1,79 @@
 #include "sql_formatter.h"
 
+#include "sql_parser.h"
+
+#include "utils/file_utils.h"
+
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <filesystem>
-#include <fstream>
 #include <ranges>
-#include <sstream>
-#include <unordered_set>
 #include <vector>
 
 namespace velocitydb {
 
 namespace {
 
+using namespace std::literals;
+
+// Compile-time default keyword tables, sorted so classification is a
+// binary search over string_views with no hashing and no allocation.
+// A config-file overlay replaces them wholesale when present.
+constexpr std::array DEFAULT_KEYWORDS = {
+    "ADD"sv, "ALL"sv, "ALTER"sv, "AND"sv, "AS"sv, "ASC"sv, "AVG"sv, "BETWEEN"sv, "BY"sv, "CASE"sv, "CAST"sv, "CHECK"sv, "COALESCE"sv, "COLUMN"sv,
+    "COUNT"sv, "CREATE"sv, "CROSS"sv, "DATE_TRUNC"sv, "DEFAULT"sv, "DELETE"sv, "DENSE_RANK"sv, "DESC"sv, "DISTINCT"sv, "DROP"sv, "ELSE"sv, "END"sv,
+    "EXCEPT"sv, "EXISTS"sv, "FETCH"sv, "FIRST"sv, "FOREIGN"sv, "FROM"sv, "FULL"sv, "GROUP"sv, "HAVING"sv, "IN"sv, "INDEX"sv, "INNER"sv, "INSERT"sv,
+    "INTERSECT"sv, "INTO"sv, "IS"sv, "JOIN"sv, "KEY"sv, "LAG"sv, "LAST"sv, "LEAD"sv, "LEFT"sv, "LIKE"sv, "LIMIT"sv, "MAX"sv, "MIN"sv, "NEXT"sv, "NOT"sv,
+    "NULL"sv, "NULLS"sv, "OFFSET"sv, "ON"sv, "ONLY"sv, "OR"sv, "ORDER"sv, "OUTER"sv, "OVER"sv, "PARTITION"sv, "PERCENT_RANK"sv, "PRIMARY"sv, "RANK"sv,
+    "RECURSIVE"sv, "RIGHT"sv, "ROUND"sv, "ROWS"sv, "ROW_NUMBER"sv, "SELECT"sv, "SET"sv, "STRING_AGG"sv, "SUM"sv, "TABLE"sv, "THEN"sv, "TOP"sv, "UNION"sv,
+    "UNIQUE"sv, "UPDATE"sv, "VALUES"sv, "VIEW"sv, "WHEN"sv, "WHERE"sv, "WITH"sv};
+
+constexpr std::array DEFAULT_MAJOR_CLAUSES = {"EXCEPT"sv, "FROM"sv, "GROUP"sv, "HAVING"sv, "INTERSECT"sv, "ORDER"sv, "SELECT"sv, "UNION"sv, "WHERE"sv};
+
+constexpr std::array DEFAULT_JOIN_KEYWORDS = {"CROSS"sv, "FULL"sv, "INNER"sv, "JOIN"sv, "LEFT"sv, "OUTER"sv, "RIGHT"sv};
+
+static_assert(std::ranges::is_sorted(DEFAULT_KEYWORDS));
+static_assert(std::ranges::is_sorted(DEFAULT_MAJOR_CLAUSES));
+static_assert(std::ranges::is_sorted(DEFAULT_JOIN_KEYWORDS));
+
+/// Routes token classification to the file overlay when one is loaded,
+/// otherwise to the compile-time tables. Lookups take the uppercased
+/// token as a string_view either way - the sets hash transparently, the
+/// arrays binary-search.
+struct KeywordClassifier {
+    const KeywordSet* overlayKeywords = nullptr;
+    const KeywordSet* overlayMajorClauses = nullptr;
+    const KeywordSet* overlayJoinKeywords = nullptr;
+
+    [[nodiscard]] bool isKeyword(std::string_view upper) const { return overlayKeywords ? overlayKeywords->contains(upper) : std::ranges::binary_search(DEFAULT_KEYWORDS, upper); }
+    [[nodiscard]] bool isMajorClause(std::string_view upper) const { return overlayMajorClauses ? overlayMajorClauses->contains(upper) : std::ranges::binary_search(DEFAULT_MAJOR_CLAUSES, upper); }
+    [[nodiscard]] bool isJoinKeyword(std::string_view upper) const { return overlayJoinKeywords ? overlayJoinKeywords->contains(upper) : std::ranges::binary_search(DEFAULT_JOIN_KEYWORDS, upper); }
+};
+
 enum class TokenType { Keyword, Identifier, Operator, Comma, OpenParen, CloseParen, Semicolon, String, Number };
 
+// Tokens are views over the input buffer: tokenizing a 300KB script
+// allocates the token vector and nothing per token
 struct Token {
     TokenType type;
-    std::string value;
-    std::string upperValue;
+    std::string_view value;
+    bool isMajorClause = false;
+    bool isJoinKeyword = false;
 };
 
+[[nodiscard]] bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) { return std::toupper(static_cast<unsigned char>(x)) == std::toupper(static_cast<unsigned char>(y)); });
+}
+
 class Tokenizer {
 public:
-    explicit Tokenizer(std::string_view sql, const std::unordered_set<std::string>& keywords) : m_sql(sql), m_keywords(keywords), m_pos(0) {}
+    Tokenizer(std::string_view sql, const KeywordClassifier& classifier) : m_sql(sql), m_classifier(classifier), m_pos(0) {}
 
     std::vector<Token> tokenize() {
         std::vector<Token> tokens;
+        tokens.reserve(m_sql.size() / 4);  // Tokens average a few characters plus whitespace
+
         while (m_pos < m_sql.length()) {
             skipWhitespace();
             if (m_pos >= m_sql.length())
@@ -37,16 +84,16 @@ public:
             if (c == '\'' || c == '"') {
                 tokens.push_back(readString());
             } else if (c == '(') {
-                tokens.push_back({TokenType::OpenParen, "(", "("});
+                tokens.push_back({TokenType::OpenParen, m_sql.substr(m_pos, 1)});
                 ++m_pos;
             } else if (c == ')') {
-                tokens.push_back({TokenType::CloseParen, ")", ")"});
+                tokens.push_back({TokenType::CloseParen, m_sql.substr(m_pos, 1)});
                 ++m_pos;
             } else if (c == ',') {
-                tokens.push_back({TokenType::Comma, ",", ","});
+                tokens.push_back({TokenType::Comma, m_sql.substr(m_pos, 1)});
                 ++m_pos;
             } else if (c == ';') {
-                tokens.push_back({TokenType::Semicolon, ";", ";"});
+                tokens.push_back({TokenType::Semicolon, m_sql.substr(m_pos, 1)});
                 ++m_pos;
             } else if (isOperatorChar(c)) {
                 tokens.push_back(readOperator());
@@ -61,8 +108,9 @@ public:
 
 private:
     std::string_view m_sql;
-    const std::unordered_set<std::string>& m_keywords;
+    const KeywordClassifier& m_classifier;
     size_t m_pos;
+    std::string m_upperScratch;  // Reused for keyword lookups, no steady-state allocation
 
     void skipWhitespace() {
         while (m_pos < m_sql.length() && std::isspace(static_cast<unsigned char>(m_sql[m_pos]))) {
@@ -72,82 +120,85 @@ private:
 
     Token readString() {
         char quote = m_sql[m_pos];
-        std::string value;
-        value += quote;
+        size_t start = m_pos;
         ++m_pos;
 
         while (m_pos < m_sql.length()) {
             char c = m_sql[m_pos];
-            value += c;
             ++m_pos;
 
             if (c == quote) {
                 if (m_pos < m_sql.length() && m_sql[m_pos] == quote) {
-                    value += quote;
-                    ++m_pos;
+                    ++m_pos;  // Doubled quote stays inside the literal
                 } else {
                     break;
                 }
             }
         }
 
-        return {TokenType::String, value, value};
+        return {TokenType::String, m_sql.substr(start, m_pos - start)};
     }
 
     Token readNumber() {
-        std::string value;
+        size_t start = m_pos;
         while (m_pos < m_sql.length() && (std::isdigit(static_cast<unsigned char>(m_sql[m_pos])) || m_sql[m_pos] == '.')) {
-            value += m_sql[m_pos];
             ++m_pos;
         }
-        return {TokenType::Number, value, value};
+        return {TokenType::Number, m_sql.substr(start, m_pos - start)};
     }
 
     Token readWord() {
-        std::string value;
+        size_t start = m_pos;
         while (m_pos < m_sql.length() && (std::isalnum(static_cast<unsigned char>(m_sql[m_pos])) || m_sql[m_pos] == '_' || m_sql[m_pos] == '.')) {
-            value += m_sql[m_pos];
             ++m_pos;
         }
+        auto value = m_sql.substr(start, m_pos - start);
 
-        std::string upper = value;
-        std::ranges::transform(upper, upper.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+        m_upperScratch.assign(value);
+        std::ranges::transform(m_upperScratch, m_upperScratch.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
 
-        TokenType type = m_keywords.contains(upper) ? TokenType::Keyword : TokenType::Identifier;
-        return {type, value, upper};
+        std::string_view upper = m_upperScratch;
+        if (!m_classifier.isKeyword(upper)) {
+            return {TokenType::Identifier, value};
+        }
+        return {TokenType::Keyword, value, m_classifier.isMajorClause(upper), m_classifier.isJoinKeyword(upper)};
     }
 
     bool isOperatorChar(char c) const { return c == '=' || c == '<' || c == '>' || c == '+' || c == '-' || c == '*' || c == '/' || c == '!'; }
 
     Token readOperator() {
-        std::string value;
-        value += m_sql[m_pos];
+        size_t start = m_pos;
         ++m_pos;
 
         if (m_pos < m_sql.length()) {
+            char first = m_sql[start];
             char next = m_sql[m_pos];
-            if ((value[0] == '<' && (next == '=' || next == '>')) || (value[0] == '>' && next == '=') || (value[0] == '!' && next == '=')) {
-                value += next;
+            if ((first == '<' && (next == '=' || next == '>')) || (first == '>' && next == '=') || (first == '!' && next == '=')) {
                 ++m_pos;
             }
         }
 
-        return {TokenType::Operator, value, value};
+        return {TokenType::Operator, m_sql.substr(start, m_pos - start)};
     }
 };
 
+// Single pass over the token stream, writing straight into one output
+// buffer reserved up front (formatting adds newlines and indent, so
+// ~input x 1.3 covers it without regrowth)
 class SQLFormatterImpl {
 public:
-    explicit SQLFormatterImpl(const SQLFormatter::FormatOptions& options, const std::unordered_set<std::string>& majorClauses, const std::unordered_set<std::string>& joinKeywords)
-        : m_options(options), m_majorClauses(majorClauses), m_joinKeywords(joinKeywords) {}
+    explicit SQLFormatterImpl(const SQLFormatter::FormatOptions& options) : m_options(options) {}
 
-    std::string format(const std::vector<Token>& tokens) {
-        m_result.clear();
+    std::string format(const std::vector<Token>& tokens, size_t inputSize) {
+        m_tokens = tokens.data();
+        m_tokenCount = tokens.size();
         m_indentLevel = 0;
         m_pos = 0;
-        m_tokens = tokens;
 
-        while (m_pos < m_tokens.size()) {
+        m_result.clear();
+        m_result.reserve(inputSize + inputSize / 3 + 64);
+
+        while (m_pos < m_tokenCount) {
             formatStatement();
         }
 
@@ -156,34 +207,37 @@ public:
             m_result.pop_back();
         }
 
-        return m_result;
+        return std::move(m_result);
     }
 
 private:
     const SQLFormatter::FormatOptions& m_options;
-    const std::unordered_set<std::string>& m_majorClauses;
-    const std::unordered_set<std::string>& m_joinKeywords;
     std::string m_result;
-    int m_indentLevel;
-    size_t m_pos;
-    std::vector<Token> m_tokens;
+    int m_indentLevel = 0;
+    size_t m_pos = 0;
+    const Token* m_tokens = nullptr;
+    size_t m_tokenCount = 0;
+
+    [[nodiscard]] const Token& at(size_t index) const { return m_tokens[index]; }
+
+    [[nodiscard]] bool currentIs(std::string_view upperKeyword) const { return m_pos < m_tokenCount && at(m_pos).type == TokenType::Keyword && equalsIgnoreCase(at(m_pos).value, upperKeyword); }
 
     void formatStatement() {
-        if (m_pos >= m_tokens.size())
+        if (m_pos >= m_tokenCount)
             return;
 
-        const auto& token = m_tokens[m_pos];
-
-        if (token.type == TokenType::Keyword && token.upperValue == "SELECT") {
+        if (currentIs("SELECT")) {
             formatSelectStatement();
         } else {
-            // Fallback: just output the token
-            appendToken(token);
+            // Fallback: pass the token through
+            appendCased(at(m_pos));
+            m_result += ' ';
             ++m_pos;
         }
 
         // Handle semicolon
-        if (m_pos < m_tokens.size() && m_tokens[m_pos].type == TokenType::Semicolon) {
+        if (m_pos < m_tokenCount && at(m_pos).type == TokenType::Semicolon) {
+            trimTrailingSpaces();
             m_result += ";\n\n";
             ++m_pos;
         }
@@ -199,341 +253,262 @@ private:
     }
 
     void formatSelectClause() {
-        if (m_pos >= m_tokens.size() || m_tokens[m_pos].upperValue != "SELECT")
+        if (!currentIs("SELECT"))
             return;
 
-        appendToken(m_tokens[m_pos]);
+        appendCased(at(m_pos));
         m_result += ' ';
         ++m_pos;
 
         // Handle DISTINCT
-        if (m_pos < m_tokens.size() && m_tokens[m_pos].upperValue == "DISTINCT") {
-            appendToken(m_tokens[m_pos]);
+        if (currentIs("DISTINCT")) {
+            appendCased(at(m_pos));
             m_result += ' ';
             ++m_pos;
         }
 
-        // Collect all select items until FROM/WHERE/GROUP/ORDER
-        std::vector<std::string> selectItems;
-        std::string currentItem;
+        // Select items go straight to the output: top-level commas break
+        // the line, everything else joins with single spaces
         int parenDepth = 0;
 
-        while (m_pos < m_tokens.size()) {
-            const auto& token = m_tokens[m_pos];
+        while (m_pos < m_tokenCount) {
+            const auto& token = at(m_pos);
 
-            if (parenDepth == 0 && token.type == TokenType::Keyword && m_majorClauses.contains(token.upperValue)) {
+            if (parenDepth == 0 && token.isMajorClause) {
                 break;
             }
 
             if (token.type == TokenType::OpenParen) {
                 ++parenDepth;
-                currentItem += token.value;
+                m_result += '(';
             } else if (token.type == TokenType::CloseParen) {
                 --parenDepth;
-                currentItem += token.value;
+                m_result += ')';
             } else if (parenDepth == 0 && token.type == TokenType::Comma) {
-                selectItems.push_back(currentItem);
-                currentItem.clear();
+                trimTrailingSpaces();
+                m_result += ",\n";
+                appendIndent(1);
             } else {
-                // Add space before token if needed (not after '(' or at the start)
-                if (!currentItem.empty() && !std::isspace(static_cast<unsigned char>(currentItem.back())) && currentItem.back() != '(') {
-                    currentItem += ' ';
+                // Space before the token if needed (not after '(' or at the
+                // start of an item)
+                if (char back = m_result.back(); back != '(' && !std::isspace(static_cast<unsigned char>(back))) {
+                    m_result += ' ';
                 }
-                currentItem += formatToken(token);
-                // Add space after keyword (e.g., WITH, UNION, CASE, etc.)
-                // BUT NOT before opening parenthesis (e.g., COUNT(, SUM(, etc.)
-                if (token.type == TokenType::Keyword) {
-                    // Check if next token is '('
-                    size_t nextPos = m_pos + 1;
-                    if (nextPos >= m_tokens.size() || m_tokens[nextPos].type != TokenType::OpenParen) {
-                        currentItem += ' ';
-                    }
+                appendCased(token);
+                // Space after a keyword (WITH, UNION, CASE, ...) but not
+                // before an opening parenthesis (COUNT(, SUM(, ...)
+                if (token.type == TokenType::Keyword && (m_pos + 1 >= m_tokenCount || at(m_pos + 1).type != TokenType::OpenParen)) {
+                    m_result += ' ';
                 }
             }
 
             ++m_pos;
         }
 
-        if (!currentItem.empty()) {
-            selectItems.push_back(currentItem);
-        }
-
-        // Output select items with alignment
-        for (size_t i = 0; i < selectItems.size(); ++i) {
-            if (i > 0) {
-                m_result += ",\n" + getIndent(1);
-            }
-            m_result += trim(selectItems[i]);
-        }
+        trimTrailingSpaces();
         m_result += '\n';
     }
 
     void formatFromClause() {
-        if (m_pos >= m_tokens.size() || m_tokens[m_pos].upperValue != "FROM")
+        if (!currentIs("FROM"))
             return;
 
-        appendToken(m_tokens[m_pos]);
+        appendCased(at(m_pos));
         m_result += ' ';
         ++m_pos;
 
         // First table
-        while (m_pos < m_tokens.size()) {
-            const auto& token = m_tokens[m_pos];
+        while (m_pos < m_tokenCount) {
+            const auto& token = at(m_pos);
 
-            if (token.type == TokenType::Keyword && (m_joinKeywords.contains(token.upperValue) || m_majorClauses.contains(token.upperValue))) {
+            if (token.type == TokenType::Keyword && (token.isJoinKeyword || token.isMajorClause)) {
                 break;
             }
 
-            m_result += formatToken(token);
+            appendCased(token);
             m_result += ' ';
             ++m_pos;
         }
 
+        trimTrailingSpaces();
         m_result += '\n';
 
         // JOINs
-        while (m_pos < m_tokens.size() && m_tokens[m_pos].type == TokenType::Keyword) {
-            const auto& token = m_tokens[m_pos];
-
-            if (!m_joinKeywords.contains(token.upperValue))
-                break;
-
-            m_result += getIndent(1);
+        while (m_pos < m_tokenCount && at(m_pos).isJoinKeyword) {
+            appendIndent(1);
 
             // JOIN keywords (INNER JOIN, LEFT JOIN, etc.)
-            while (m_pos < m_tokens.size() && m_joinKeywords.contains(m_tokens[m_pos].upperValue)) {
-                m_result += formatToken(m_tokens[m_pos]);
+            while (m_pos < m_tokenCount && at(m_pos).isJoinKeyword) {
+                appendCased(at(m_pos));
                 m_result += ' ';
                 ++m_pos;
             }
 
             // Table name and alias
-            while (m_pos < m_tokens.size()) {
-                const auto& t = m_tokens[m_pos];
+            while (m_pos < m_tokenCount) {
+                const auto& t = at(m_pos);
 
-                if (t.type == TokenType::Keyword && (t.upperValue == "ON" || m_joinKeywords.contains(t.upperValue) || m_majorClauses.contains(t.upperValue))) {
+                if (t.type == TokenType::Keyword && (equalsIgnoreCase(t.value, "ON") || t.isJoinKeyword || t.isMajorClause)) {
                     break;
                 }
 
-                m_result += formatToken(t);
+                appendCased(t);
                 m_result += ' ';
                 ++m_pos;
             }
 
             // ON condition
-            if (m_pos < m_tokens.size() && m_tokens[m_pos].upperValue == "ON") {
-                appendToken(m_tokens[m_pos]);
+            if (currentIs("ON")) {
+                appendCased(at(m_pos));
                 m_result += ' ';
                 ++m_pos;
 
-                while (m_pos < m_tokens.size()) {
-                    const auto& t = m_tokens[m_pos];
+                while (m_pos < m_tokenCount) {
+                    const auto& t = at(m_pos);
 
-                    if (t.type == TokenType::Keyword && (m_joinKeywords.contains(t.upperValue) || m_majorClauses.contains(t.upperValue))) {
+                    if (t.type == TokenType::Keyword && (t.isJoinKeyword || t.isMajorClause)) {
                         break;
                     }
 
-                    m_result += formatToken(t);
+                    appendCased(t);
                     m_result += ' ';
                     ++m_pos;
                 }
             }
 
+            trimTrailingSpaces();
             m_result += '\n';
         }
     }
 
     void formatWhereClause() {
-        if (m_pos >= m_tokens.size() || m_tokens[m_pos].upperValue != "WHERE")
+        if (!currentIs("WHERE"))
             return;
 
-        appendToken(m_tokens[m_pos]);
+        appendCased(at(m_pos));
         m_result += ' ';
         ++m_pos;
 
-        bool firstCondition = true;
         int parenDepth = 0;
 
-        while (m_pos < m_tokens.size()) {
-            const auto& token = m_tokens[m_pos];
+        while (m_pos < m_tokenCount) {
+            const auto& token = at(m_pos);
 
-            if (parenDepth == 0 && token.type == TokenType::Keyword && m_majorClauses.contains(token.upperValue)) {
+            if (parenDepth == 0 && token.isMajorClause) {
                 break;
             }
 
             if (token.type == TokenType::OpenParen) {
                 ++parenDepth;
-                m_result += token.value;
+                m_result += '(';
             } else if (token.type == TokenType::CloseParen) {
                 --parenDepth;
-                m_result += token.value;
-            } else if (parenDepth == 0 && token.type == TokenType::Keyword && (token.upperValue == "AND" || token.upperValue == "OR")) {
-                m_result += "\n  " + formatToken(token) + ' ';
-                firstCondition = false;
+                m_result += ')';
+            } else if (parenDepth == 0 && token.type == TokenType::Keyword && (equalsIgnoreCase(token.value, "AND") || equalsIgnoreCase(token.value, "OR"))) {
+                trimTrailingSpaces();
+                m_result += "\n  ";
+                appendCased(token);
+                m_result += ' ';
             } else {
-                m_result += formatToken(token);
+                appendCased(token);
                 m_result += ' ';
             }
 
             ++m_pos;
         }
 
+        trimTrailingSpaces();
         m_result += '\n';
     }
 
-    void formatGroupByClause() {
-        if (m_pos >= m_tokens.size() || m_tokens[m_pos].upperValue != "GROUP")
-            return;
-
-        appendToken(m_tokens[m_pos]);
-        m_result += ' ';
-        ++m_pos;
-
-        // Skip BY
-        if (m_pos < m_tokens.size() && m_tokens[m_pos].upperValue == "BY") {
-            appendToken(m_tokens[m_pos]);
-            m_result += ' ';
-            ++m_pos;
-        }
-
-        while (m_pos < m_tokens.size()) {
-            const auto& token = m_tokens[m_pos];
-
-            if (token.type == TokenType::Keyword && m_majorClauses.contains(token.upperValue)) {
-                break;
-            }
+    void formatGroupByClause() { formatKeywordListClause("GROUP"); }
 
-            appendTokenWithSpace(token);
-            ++m_pos;
-        }
+    void formatHavingClause() { formatKeywordListClause("HAVING"); }
 
-        m_result += '\n';
-    }
+    void formatOrderByClause() { formatKeywordListClause("ORDER"); }
 
-    void formatHavingClause() {
-        if (m_pos >= m_tokens.size() || m_tokens[m_pos].upperValue != "HAVING")
+    // GROUP BY / HAVING / ORDER BY share the same shape: the clause
+    // keyword(s), then space-joined tokens until the next major clause
+    void formatKeywordListClause(std::string_view clauseKeyword) {
+        if (!currentIs(clauseKeyword))
             return;
 
-        appendToken(m_tokens[m_pos]);
+        appendCased(at(m_pos));
         m_result += ' ';
         ++m_pos;
 
-        while (m_pos < m_tokens.size()) {
-            const auto& token = m_tokens[m_pos];
-
-            if (token.type == TokenType::Keyword && m_majorClauses.contains(token.upperValue)) {
-                break;
-            }
-
-            appendTokenWithSpace(token);
-            ++m_pos;
-        }
-
-        m_result += '\n';
-    }
-
-    void formatOrderByClause() {
-        if (m_pos >= m_tokens.size() || m_tokens[m_pos].upperValue != "ORDER")
-            return;
-
-        appendToken(m_tokens[m_pos]);
-        m_result += ' ';
-        ++m_pos;
-
-        // Skip BY
-        if (m_pos < m_tokens.size() && m_tokens[m_pos].upperValue == "BY") {
-            appendToken(m_tokens[m_pos]);
+        if (currentIs("BY")) {
+            appendCased(at(m_pos));
             m_result += ' ';
             ++m_pos;
         }
 
-        while (m_pos < m_tokens.size()) {
-            const auto& token = m_tokens[m_pos];
+        while (m_pos < m_tokenCount) {
+            const auto& token = at(m_pos);
 
-            if (token.type == TokenType::Keyword && m_majorClauses.contains(token.upperValue)) {
+            if (token.isMajorClause) {
                 break;
             }
 
-            appendTokenWithSpace(token);
+            appendCased(token);
+            if (token.type != TokenType::OpenParen) {
+                m_result += ' ';
+            }
             ++m_pos;
         }
 
+        trimTrailingSpaces();
         m_result += '\n';
     }
 
-    std::string formatToken(const Token& token) const {
-        if (token.type == TokenType::Keyword) {
-            return applyKeywordCase(token.value);
-        }
-        return token.value;
-    }
-
-    void appendToken(const Token& token) { m_result += formatToken(token); }
-
-    bool needsSpaceAfter(const Token& token) const {
-        // Don't add space after open paren or before close paren
-        return token.type != TokenType::OpenParen;
-    }
-
-    bool needsSpaceBefore(const Token& token) const {
-        // Don't add space before close paren or comma
-        return token.type != TokenType::CloseParen && token.type != TokenType::Comma;
-    }
-
-    void appendTokenWithSpace(const Token& token, bool addSpaceAfter = true) {
-        m_result += formatToken(token);
-        if (addSpaceAfter && needsSpaceAfter(token)) {
-            m_result += ' ';
+    // Writes the token with keyword casing applied, character by character
+    // - no temporary strings
+    void appendCased(const Token& token) {
+        if (token.type != TokenType::Keyword || m_options.keywordCase == KeywordCase::Unchanged) {
+            m_result += token.value;
+            return;
         }
-    }
-
-    std::string applyKeywordCase(std::string_view word) const {
-        std::string result(word);
-        switch (m_options.keywordCase) {
-            case KeywordCase::Upper:
-                std::ranges::transform(result, result.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
-                break;
-            case KeywordCase::Lower:
-                std::ranges::transform(result, result.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-                break;
-            case KeywordCase::Unchanged:
-                break;
+        if (m_options.keywordCase == KeywordCase::Upper) {
+            for (char c : token.value) {
+                m_result += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+            }
+        } else {
+            for (char c : token.value) {
+                m_result += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
         }
-        return result;
     }
 
-    std::string getIndent(int level) const {
+    void appendIndent(int level) {
         if (m_options.useTab) {
-            return std::string(static_cast<size_t>(level), '\t');
+            m_result.append(static_cast<size_t>(level), '\t');
+        } else {
+            m_result.append(static_cast<size_t>(level * m_options.indentSize), ' ');
         }
-        return std::string(static_cast<size_t>(level * m_options.indentSize), ' ');
     }
 
-    std::string trim(const std::string& str) const {
-        auto start = str.find_first_not_of(" \t\n\r");
-        if (start == std::string::npos)
-            return "";
-        auto end = str.find_last_not_of(" \t\n\r");
-        return str.substr(start, end - start + 1);
+    void trimTrailingSpaces() {
+        while (!m_result.empty() && m_result.back() == ' ') {
+            m_result.pop_back();
+        }
     }
 };
 
 }  // namespace
 
 SQLFormatter::SQLFormatter() {
-    // Try to load keywords from external file first
+    // An external keyword file overlays the compile-time defaults; without
+    // one the overlay sets stay empty and the constexpr tables classify
     std::filesystem::path exePath = std::filesystem::current_path();
     std::filesystem::path configPath = exePath / "config" / "sql_keywords.txt";
-
-    if (!loadKeywordsFromFile(configPath.string())) {
-        // Fallback to default keywords if file doesn't exist
-        loadDefaultKeywords();
-    }
+    static_cast<void>(loadKeywordsFromFile(configPath.string()));
 }
 
 bool SQLFormatter::loadKeywordsFromFile(const std::string& filePath) {
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
+    // Scan the file straight out of the page cache; only the keywords
+    // themselves are copied into the overlay sets
+    MappedFile mapped{std::filesystem::path(filePath)};
+    if (!mapped.isMapped()) {
         return false;
     }
 
@@ -541,11 +516,18 @@ bool SQLFormatter::loadKeywordsFromFile(const std::string& filePath) {
     m_majorClauses.clear();
     m_joinKeywords.clear();
 
-    std::string line;
-    while (std::getline(file, line)) {
+    auto content = mapped.view();
+    for (size_t start = 0; start <= content.size();) {
+        auto end = content.find('\n', start);
+        auto line = content.substr(start, (end == std::string_view::npos ? content.size() : end) - start);
+        start = (end == std::string_view::npos) ? content.size() + 1 : end + 1;
+
         // Trim whitespace
-        line.erase(0, line.find_first_not_of(" \t\r\n"));
-        line.erase(line.find_last_not_of(" \t\r\n") + 1);
+        if (auto first = line.find_first_not_of(" \t\r\n"); first != std::string_view::npos) {
+            line = line.substr(first, line.find_last_not_of(" \t\r\n") - first + 1);
+        } else {
+            line = {};
+        }
 
         // Skip empty lines and comments
         if (line.empty() || line[0] == '#') {
@@ -553,7 +535,7 @@ bool SQLFormatter::loadKeywordsFromFile(const std::string& filePath) {
         }
 
         // Convert to uppercase for storage
-        std::string upper = line;
+        std::string upper(line);
         std::ranges::transform(upper, upper.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
 
         m_keywords.insert(upper);
@@ -571,26 +553,51 @@ bool SQLFormatter::loadKeywordsFromFile(const std::string& filePath) {
     return !m_keywords.empty();
 }
 
-void SQLFormatter::loadDefaultKeywords() {
-    // Default SQL keywords as fallback
-    m_keywords = {"SELECT",     "FROM",   "WHERE",      "AND",          "OR",     "NOT",     "IN",         "EXISTS",     "JOIN",      "INNER",     "LEFT",   "RIGHT",    "OUTER",
-                  "FULL",       "CROSS",  "ON",         "GROUP",        "BY",     "HAVING",  "ORDER",      "ASC",        "DESC",      "NULLS",     "FIRST",  "LAST",     "INSERT",
-                  "INTO",       "VALUES", "UPDATE",     "SET",          "DELETE", "CREATE",  "TABLE",      "INDEX",      "VIEW",      "DROP",      "ALTER",  "ADD",      "COLUMN",
-                  "PRIMARY",    "KEY",    "FOREIGN",    "UNIQUE",       "CHECK",  "DEFAULT", "NULL",       "AS",         "DISTINCT",  "TOP",       "LIMIT",  "OFFSET",   "FETCH",
-                  "NEXT",       "ROWS",   "ONLY",       "UNION",        "ALL",    "CASE",    "WHEN",       "THEN",       "ELSE",      "END",       "LIKE",   "BETWEEN",  "IS",
-                  "COUNT",      "SUM",    "AVG",        "MIN",          "MAX",    "OVER",    "PARTITION",  "WITH",       "RECURSIVE", "INTERSECT", "EXCEPT", "COALESCE", "CAST",
-                  "ROW_NUMBER", "RANK",   "DENSE_RANK", "PERCENT_RANK", "LAG",    "LEAD",    "STRING_AGG", "DATE_TRUNC", "ROUND"};
-
-    m_majorClauses = {"SELECT", "FROM", "WHERE", "GROUP", "HAVING", "ORDER", "UNION", "INTERSECT", "EXCEPT"};
-    m_joinKeywords = {"JOIN", "INNER", "LEFT", "RIGHT", "FULL", "CROSS", "OUTER"};
-}
-
 std::string SQLFormatter::format(std::string_view sql, const FormatOptions& options) {
-    Tokenizer tokenizer(sql, m_keywords);
+    const KeywordClassifier classifier = m_keywords.empty() ? KeywordClassifier{} : KeywordClassifier{&m_keywords, &m_majorClauses, &m_joinKeywords};
+    Tokenizer tokenizer(sql, classifier);
     auto tokens = tokenizer.tokenize();
 
-    SQLFormatterImpl formatter(options, m_majorClauses, m_joinKeywords);
-    return formatter.format(tokens);
+    SQLFormatterImpl formatter(options);
+    return formatter.format(tokens, sql.size());
+}
+
+std::string SQLFormatter::formatRange(std::string_view sql, size_t editStart, size_t editEnd, const FormatOptions& options) {
+    auto statements = SQLParser::splitStatements(sql);
+    if (statements.empty()) {
+        return std::string(sql);
+    }
+
+    editEnd = (std::min)(editEnd, sql.size());
+    editStart = (std::min)(editStart, editEnd);
+
+    // The statement views slice the input, so pointer arithmetic recovers
+    // their byte offsets; the splice region is the union of every
+    // statement the edit touches (a boundary touch counts)
+    size_t spliceBegin = std::string_view::npos;
+    size_t spliceEnd = 0;
+    for (auto statement : statements) {
+        auto begin = static_cast<size_t>(statement.data() - sql.data());
+        auto end = begin + statement.size();
+        if (begin <= editEnd && editStart <= end) {
+            spliceBegin = (std::min)(spliceBegin, begin);
+            spliceEnd = (std::max)(spliceEnd, end);
+        }
+    }
+
+    // Edit landed entirely in separator whitespace - nothing to re-format
+    if (spliceBegin == std::string_view::npos) {
+        return std::string(sql);
+    }
+
+    auto formatted = format(sql.substr(spliceBegin, spliceEnd - spliceBegin), options);
+
+    std::string result;
+    result.reserve(spliceBegin + formatted.size() + (sql.size() - spliceEnd));
+    result.append(sql.substr(0, spliceBegin));
+    result.append(formatted);
+    result.append(sql.substr(spliceEnd));
+    return result;
 }
 
 std::string SQLFormatter::applyKeywordCase(std::string_view word, KeywordCase keywordCase) const {
@@ -611,14 +618,18 @@ std::string SQLFormatter::applyKeywordCase(std::string_view word, KeywordCase ke
 bool SQLFormatter::isKeyword(std::string_view word) const {
     std::string upper(word);
     std::ranges::transform(upper, upper.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
-    return m_keywords.contains(upper);
+    const KeywordClassifier classifier = m_keywords.empty() ? KeywordClassifier{} : KeywordClassifier{&m_keywords, &m_majorClauses, &m_joinKeywords};
+    return classifier.isKeyword(upper);
 }
 
 std::string SQLFormatter::uppercaseKeywords(std::string_view sql) {
-    Tokenizer tokenizer(sql, m_keywords);
+    const KeywordClassifier classifier = m_keywords.empty() ? KeywordClassifier{} : KeywordClassifier{&m_keywords, &m_majorClauses, &m_joinKeywords};
+    Tokenizer tokenizer(sql, classifier);
     auto tokens = tokenizer.tokenize();
 
     std::string result;
+    result.reserve(sql.size() + 16);
+
     for (size_t i = 0; i < tokens.size(); ++i) {
         const auto& token = tokens[i];
 
@@ -631,7 +642,9 @@ std::string SQLFormatter::uppercaseKeywords(std::string_view sql) {
         }
 
         if (token.type == TokenType::Keyword) {
-            result += applyKeywordCase(token.value, KeywordCase::Upper);
+            for (char c : token.value) {
+                result += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+            }
         } else {
             result += token.value;
         }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string>
 #include <string_view>
 #include <unordered_set>
@@ -8,6 +9,14 @@ namespace velocitydb {
 
 enum class KeywordCase { Upper, Lower, Unchanged };
 
+// Transparent hashing so keyword sets can be probed with a string_view
+// without materializing a std::string per token
+struct KeywordSetHash {
+    using is_transparent = void;
+    [[nodiscard]] size_t operator()(std::string_view value) const noexcept { return std::hash<std::string_view>{}(value); }
+};
+using KeywordSet = std::unordered_set<std::string, KeywordSetHash, std::equal_to<>>;
+
 class SQLFormatter {
 public:
     struct FormatOptions {
@@ -23,6 +32,13 @@ public:
     ~SQLFormatter() = default;
 
     [[nodiscard]] std::string format(std::string_view sql, const FormatOptions& options = FormatOptions{});
+
+    /// Incremental mode: re-formats only the statement(s) overlapping the
+    /// edited byte range [editStart, editEnd) and splices the result back
+    /// into the untouched rest of the buffer, so format-on-save cost
+    /// scales with the edit, not the file
+    [[nodiscard]] std::string formatRange(std::string_view sql, size_t editStart, size_t editEnd, const FormatOptions& options = FormatOptions{});
+
     [[nodiscard]] std::string uppercaseKeywords(std::string_view sql);
 
     // Load keywords from external file (returns true on success)
@@ -32,11 +48,12 @@ private:
     [[nodiscard]] std::string applyKeywordCase(std::string_view word, KeywordCase keywordCase) const;
     [[nodiscard]] bool isKeyword(std::string_view word) const;
     [[nodiscard]] static std::string getIndent(int level, const FormatOptions& options);
-    void loadDefaultKeywords();
 
-    std::unordered_set<std::string> m_keywords;
-    std::unordered_set<std::string> m_majorClauses;
-    std::unordered_set<std::string> m_joinKeywords;
+    // Overlay from config/sql_keywords.txt. Empty means the compile-time
+    // default tables classify tokens instead.
+    KeywordSet m_keywords;
+    KeywordSet m_majorClauses;
+    KeywordSet m_joinKeywords;
 };  // class SQLFormatter
 
 }  // namespace velocitydb
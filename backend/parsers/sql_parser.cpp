@@ -105,29 +105,469 @@ std::string SQLParser::extractDatabaseName(std::string_view sql) {
     return parsed.database;
 }
 
-std::vector<std::string> SQLParser::splitStatements(std::string_view sql) {
-    std::vector<std::string> statements;
+std::string SQLParser::canonicalize(std::string_view sql) {
+    std::string canonical;
+    canonical.reserve(sql.size());
+
+    const auto isIdentChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '#' || c == '@' || c == '$'; };
+
+    // Collapsed whitespace is emitted only where dropping it would merge
+    // two identifiers ("SELECT 1" stays, "a = 1" becomes "a=1")
+    bool pendingSpace = false;
+    const auto emit = [&](char c) {
+        if (pendingSpace) {
+            if (!canonical.empty() && isIdentChar(canonical.back()) && isIdentChar(c)) {
+                canonical += ' ';
+            }
+            pendingSpace = false;
+        }
+        canonical += c;
+    };
+
+    size_t i = 0;
+    while (i < sql.size()) {
+        const char c = sql[i];
+
+        if (c == '-' && i + 1 < sql.size() && sql[i + 1] == '-') {
+            while (i < sql.size() && sql[i] != '\n') {
+                ++i;
+            }
+            pendingSpace = true;
+            continue;
+        }
+
+        if (c == '/' && i + 1 < sql.size() && sql[i + 1] == '*') {
+            // Block comments nest in T-SQL, same as splitStatements
+            size_t depth = 1;
+            i += 2;
+            while (i < sql.size() && depth > 0) {
+                if (sql[i] == '/' && i + 1 < sql.size() && sql[i + 1] == '*') {
+                    ++depth;
+                    i += 2;
+                } else if (sql[i] == '*' && i + 1 < sql.size() && sql[i + 1] == '/') {
+                    --depth;
+                    i += 2;
+                } else {
+                    ++i;
+                }
+            }
+            pendingSpace = true;
+            continue;
+        }
+
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            pendingSpace = true;
+            ++i;
+            continue;
+        }
+
+        if (c == '\'' || c == '"') {
+            // Literals and quoted identifiers verbatim; doubled quotes stay
+            // inside the run
+            emit(c);
+            ++i;
+            while (i < sql.size()) {
+                canonical += sql[i];
+                if (sql[i] == c) {
+                    if (i + 1 < sql.size() && sql[i + 1] == c) {
+                        canonical += sql[i + 1];
+                        i += 2;
+                        continue;
+                    }
+                    ++i;
+                    break;
+                }
+                ++i;
+            }
+            continue;
+        }
+
+        if (c == '[') {
+            emit(c);
+            ++i;
+            while (i < sql.size()) {
+                canonical += sql[i];
+                if (sql[i] == ']') {
+                    ++i;
+                    break;
+                }
+                ++i;
+            }
+            continue;
+        }
+
+        emit(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+        ++i;
+    }
+
+    while (!canonical.empty() && canonical.back() == ';') {
+        canonical.pop_back();
+    }
+    return canonical;
+}
+
+std::string SQLParser::fingerprint(std::string_view sql) {
+    // Second pass over the canonical form: comments and whitespace are
+    // already gone, so only literal replacement remains
+    const std::string canonical = canonicalize(sql);
+
+    const auto isIdentChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '#' || c == '@' || c == '$'; };
+
+    std::string result;
+    result.reserve(canonical.size());
+
+    size_t i = 0;
+    while (i < canonical.size()) {
+        const char c = canonical[i];
+
+        if (c == '\'') {
+            // String literal (doubled quotes included) collapses to one '?'
+            ++i;
+            while (i < canonical.size()) {
+                if (canonical[i] == '\'') {
+                    if (i + 1 < canonical.size() && canonical[i + 1] == '\'') {
+                        i += 2;
+                        continue;
+                    }
+                    ++i;
+                    break;
+                }
+                ++i;
+            }
+            result += '?';
+            continue;
+        }
+
+        if (c == '"' || c == '[') {
+            // Quoted/bracketed identifiers pass through verbatim - digits
+            // inside them are names, not literals
+            const char closer = c == '[' ? ']' : '"';
+            result += c;
+            ++i;
+            while (i < canonical.size()) {
+                result += canonical[i];
+                if (canonical[i] == closer) {
+                    if (closer == '"' && i + 1 < canonical.size() && canonical[i + 1] == '"') {
+                        result += canonical[i + 1];
+                        i += 2;
+                        continue;
+                    }
+                    ++i;
+                    break;
+                }
+                ++i;
+            }
+            continue;
+        }
+
+        if (std::isdigit(static_cast<unsigned char>(c)) && (result.empty() || !isIdentChar(result.back()))) {
+            // Numeric literal: the run covers fractions, exponents and hex
+            // (T1 is untouched - the digit follows an identifier there)
+            ++i;
+            while (i < canonical.size() && (std::isalnum(static_cast<unsigned char>(canonical[i])) || canonical[i] == '.')) {
+                ++i;
+            }
+            result += '?';
+            continue;
+        }
+
+        result += c;
+        ++i;
+    }
+
+    return result;
+}
+
+bool SQLParser::isParallelSafeStatement(std::string_view sql) {
+    const auto trimmed = trim(sql);
+    if (trimmed.empty()) {
+        return false;
+    }
+
+    // Temp tables and variables live on one session; a statement mentioning
+    // either may depend on (or feed) a sibling statement. A '#' or '@'
+    // inside a string literal is an acceptable false negative.
+    if (trimmed.find('#') != std::string_view::npos || trimmed.find('@') != std::string_view::npos) {
+        return false;
+    }
+
+    // USE changes the session database, SET changes session options, and
+    // transaction control only makes sense on a single connection. BEGIN is
+    // excluded wholesale: distinguishing BEGIN TRAN from a BEGIN...END
+    // block is not worth the risk here.
+    const auto type = parseSQL(trimmed).type;
+    if (type == "USE" || type == "BEGIN" || type == "COMMIT" || type == "ROLLBACK") {
+        return false;
+    }
+
+    const auto upperPrefix = toUpper(trimmed.substr(0, (std::min)(trimmed.size(), size_t{5})));
+    return !upperPrefix.starts_with("SET") && !upperPrefix.starts_with("SAVE");
+}
+
+std::vector<std::string> SQLParser::extractTableNames(std::string_view sql) {
+    // Tokenize into identifiers (including [bracketed], schema.qualified and
+    // #temp names) and single-character punctuation so comma-separated FROM
+    // lists can be followed
+    std::vector<std::string> tokens;
     std::string current;
+    auto isIdentChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '[' || c == ']' || c == '.' || c == '#'; };
 
     for (char ch : sql) {
-        if (ch == ';') {
-            // Found semicolon - end of statement
-            std::string_view trimmed = trim(current);
-            if (!trimmed.empty()) {
-                statements.push_back(std::string(trimmed));
-            }
-            current.clear();
-        } else {
+        if (isIdentChar(ch)) {
             current += ch;
+        } else {
+            if (!current.empty()) {
+                tokens.push_back(std::move(current));
+                current.clear();
+            }
+            if (ch == ',' || ch == '(' || ch == ')') {
+                tokens.push_back(std::string(1, ch));
+            }
         }
     }
+    if (!current.empty()) {
+        tokens.push_back(std::move(current));
+    }
+
+    auto normalize = [](std::string_view name) {
+        std::string normalized;
+        normalized.reserve(name.size());
+        for (char c : name) {
+            if (c != '[' && c != ']') {
+                normalized += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+        }
+        return normalized;
+    };
+
+    auto isKeyword = [](const std::string& upperToken) {
+        static const std::vector<std::string> keywords = {"SELECT", "WHERE", "GROUP", "ORDER", "HAVING", "ON",  "SET",   "VALUES", "AS",    "INNER", "OUTER",
+                                                          "LEFT",   "RIGHT", "FULL",  "CROSS", "JOIN",   "AND", "OR",    "NOT",    "UNION", "ALL",   "WITH",
+                                                          "FROM",   "INTO",  "USING", "TOP",   "NOLOCK", "DUAL", "EXISTS"};
+        return std::ranges::find(keywords, upperToken) != keywords.end();
+    };
+
+    std::vector<std::string> tables;
+    auto addTable = [&](const std::string& token) {
+        auto name = normalize(token);
+        if (!name.empty() && std::ranges::find(tables, name) == tables.end()) {
+            tables.push_back(name);
+        }
+    };
+
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        auto upperToken = toUpper(tokens[i]);
+
+        const bool introducesTable = upperToken == "FROM" || upperToken == "JOIN" || upperToken == "INTO" || (upperToken == "UPDATE" && (i == 0 || toUpper(tokens[i - 1]) != "FOR"));
+        if (!introducesTable) {
+            continue;
+        }
+
+        // Capture the following identifier, then comma-separated siblings
+        // (skipping aliases). A '(' means a subquery or VALUES list - skip.
+        size_t j = i + 1;
+        while (j < tokens.size()) {
+            if (tokens[j] == "(") {
+                break;
+            }
+            auto upperCandidate = toUpper(tokens[j]);
+            if (isKeyword(upperCandidate) || tokens[j] == "," || tokens[j] == ")") {
+                break;
+            }
+            addTable(tokens[j]);
+
+            // Skip an alias if present, then continue on comma
+            size_t next = j + 1;
+            if (next < tokens.size() && tokens[next] != "," && !isKeyword(toUpper(tokens[next])) && tokens[next] != "(" && tokens[next] != ")") {
+                ++next;  // Alias consumed
+            }
+            if (next < tokens.size() && tokens[next] == ",") {
+                j = next + 1;
+                continue;
+            }
+            break;
+        }
+    }
+
+    return tables;
+}
+
+std::vector<std::string_view> SQLParser::splitStatements(std::string_view sql) {
+    std::vector<std::string_view> statements;
+
+    auto emit = [&](size_t begin, size_t end) {
+        auto statement = trim(sql.substr(begin, end - begin));
+        if (!statement.empty()) {
+            statements.push_back(statement);
+        }
+    };
+
+    auto equalsIgnoreCase = [](std::string_view a, std::string_view b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) { return std::toupper(static_cast<unsigned char>(x)) == std::toupper(static_cast<unsigned char>(y)); });
+    };
+
+    const size_t length = sql.size();
+    size_t statementStart = 0;
+    int blockDepth = 0;          // BEGIN...END / CASE...END nesting
+    bool lineHasToken = false;   // GO only separates as the first token on its line
+
+    for (size_t i = 0; i < length;) {
+        char c = sql[i];
+
+        if (c == '\n') {
+            lineHasToken = false;
+            ++i;
+            continue;
+        }
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            ++i;
+            continue;
+        }
+
+        // -- line comment: runs to end of line, semicolons inside are text
+        if (c == '-' && i + 1 < length && sql[i + 1] == '-') {
+            i = sql.find('\n', i);
+            if (i == std::string_view::npos) {
+                i = length;
+            }
+            continue;
+        }
+
+        // /* block comment */, nested per T-SQL rules
+        if (c == '/' && i + 1 < length && sql[i + 1] == '*') {
+            int commentDepth = 1;
+            i += 2;
+            while (i + 1 < length && commentDepth > 0) {
+                if (sql[i] == '/' && sql[i + 1] == '*') {
+                    ++commentDepth;
+                    i += 2;
+                } else if (sql[i] == '*' && sql[i + 1] == '/') {
+                    --commentDepth;
+                    i += 2;
+                } else {
+                    ++i;
+                }
+            }
+            if (commentDepth > 0) {
+                i = length;  // Unterminated comment swallows the rest
+            }
+            lineHasToken = true;
+            continue;
+        }
+
+        // 'string literal' with '' escapes (the N of N'...' is consumed as
+        // a word token, so unicode literals land here too)
+        if (c == '\'') {
+            ++i;
+            while (i < length) {
+                if (sql[i] == '\'') {
+                    if (i + 1 < length && sql[i + 1] == '\'') {
+                        i += 2;
+                    } else {
+                        ++i;
+                        break;
+                    }
+                } else {
+                    ++i;
+                }
+            }
+            lineHasToken = true;
+            continue;
+        }
+
+        // "quoted identifier"
+        if (c == '"') {
+            ++i;
+            while (i < length && sql[i] != '"') {
+                ++i;
+            }
+            if (i < length) {
+                ++i;
+            }
+            lineHasToken = true;
+            continue;
+        }
+
+        // [bracketed identifier] with ]] escapes
+        if (c == '[') {
+            ++i;
+            while (i < length) {
+                if (sql[i] == ']') {
+                    if (i + 1 < length && sql[i + 1] == ']') {
+                        i += 2;
+                    } else {
+                        ++i;
+                        break;
+                    }
+                } else {
+                    ++i;
+                }
+            }
+            lineHasToken = true;
+            continue;
+        }
+
+        if (c == ';') {
+            // Semicolons inside BEGIN...END terminate inner statements of
+            // a procedure/trigger body, not the batch being split
+            if (blockDepth == 0) {
+                emit(statementStart, i);
+                statementStart = i + 1;
+            }
+            lineHasToken = true;
+            ++i;
+            continue;
+        }
+
+        // Word token: BEGIN/CASE open a block, END closes one, GO first on
+        // its line is a batch separator
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            size_t wordStart = i;
+            while (i < length && (std::isalnum(static_cast<unsigned char>(sql[i])) || sql[i] == '_')) {
+                ++i;
+            }
+            auto word = sql.substr(wordStart, i - wordStart);
+
+            if (!lineHasToken && equalsIgnoreCase(word, "GO")) {
+                emit(statementStart, wordStart);
+                // Skip the rest of the GO line (repeat counts, comments)
+                i = sql.find('\n', i);
+                if (i == std::string_view::npos) {
+                    i = length;
+                }
+                statementStart = i;
+                blockDepth = 0;  // GO ends the batch regardless of nesting
+                continue;
+            }
+
+            if (equalsIgnoreCase(word, "BEGIN")) {
+                // BEGIN TRAN/TRANSACTION is a statement, not a block opener
+                size_t peek = i;
+                while (peek < length && std::isspace(static_cast<unsigned char>(sql[peek]))) {
+                    ++peek;
+                }
+                size_t peekEnd = peek;
+                while (peekEnd < length && (std::isalnum(static_cast<unsigned char>(sql[peekEnd])) || sql[peekEnd] == '_')) {
+                    ++peekEnd;
+                }
+                auto nextWord = sql.substr(peek, peekEnd - peek);
+                if (!equalsIgnoreCase(nextWord, "TRAN") && !equalsIgnoreCase(nextWord, "TRANSACTION") && !equalsIgnoreCase(nextWord, "DISTRIBUTED")) {
+                    ++blockDepth;
+                }
+            } else if (equalsIgnoreCase(word, "CASE")) {
+                ++blockDepth;
+            } else if (equalsIgnoreCase(word, "END") && blockDepth > 0) {
+                --blockDepth;
+            }
+            lineHasToken = true;
+            continue;
+        }
 
-    // Add last statement if no trailing semicolon
-    std::string_view trimmed = trim(current);
-    if (!trimmed.empty()) {
-        statements.push_back(std::string(trimmed));
+        lineHasToken = true;
+        ++i;
     }
 
+    emit(statementStart, length);
     return statements;
 }
 
@@ -31,10 +31,51 @@ public:
     /// @return The database name, or empty string if not a valid USE statement
     [[nodiscard]] static std::string extractDatabaseName(std::string_view sql);
 
-    /// Split SQL text into individual statements separated by semicolons
-    /// @param sql The SQL text containing one or more statements
-    /// @return Vector of individual SQL statements (trimmed, non-empty)
-    [[nodiscard]] static std::vector<std::string> splitStatements(std::string_view sql);
+    /// Split SQL text into individual statements in a single pass. Splits
+    /// on semicolons and GO batch separators, ignoring semicolons inside
+    /// string literals, quoted/bracketed identifiers, comments (including
+    /// nested block comments) and BEGIN...END / CASE...END blocks.
+    /// @param sql The SQL text containing one or more statements. The views
+    ///            returned slice this buffer, so it must outlive them.
+    /// @return Zero-copy views of the individual statements (trimmed, non-empty)
+    [[nodiscard]] static std::vector<std::string_view> splitStatements(std::string_view sql);
+
+    /// Canonical form of a statement for cache keying: comments stripped,
+    /// whitespace collapsed (kept only between identifier characters),
+    /// keywords and unquoted identifiers upper-cased, trailing semicolons
+    /// dropped. String literals, "quoted" and [bracketed] identifiers are
+    /// preserved verbatim. The editor, history re-run and bookmarks emit
+    /// trivially different text for the same query; canonicalizing the key
+    /// lets them share one ResultCache entry.
+    /// @param sql The SQL statement to normalize
+    /// @return The canonical key text
+    [[nodiscard]] static std::string canonicalize(std::string_view sql);
+
+    /// Statement fingerprint for performance analytics: the canonical form
+    /// with every string and numeric literal replaced by '?', so all runs
+    /// of the same statement shape ("WHERE id = 7" and "WHERE id = 42")
+    /// aggregate under one key. Quoted and [bracketed] identifiers are
+    /// kept verbatim; IN-lists of different lengths stay distinct.
+    /// @param sql The SQL statement to fingerprint
+    /// @return The fingerprint text
+    [[nodiscard]] static std::string fingerprint(std::string_view sql);
+
+    /// Conservative screen for the parallel script mode: true only when the
+    /// statement visibly carries no cross-statement session state. Temp
+    /// tables (#), variables (@), USE, SET, and transaction control all
+    /// disqualify - false negatives just fall back to serial execution,
+    /// so the scan does not bother excluding string literals.
+    /// @param sql A single statement as produced by splitStatements
+    /// @return true if the statement may run on a different connection
+    [[nodiscard]] static bool isParallelSafeStatement(std::string_view sql);
+
+    /// Extract the table names a statement references (FROM/JOIN/INTO/UPDATE
+    /// targets, including comma-separated FROM lists). Names are lowercased
+    /// with brackets stripped and deduplicated. Used for table-dependency-
+    /// aware cache invalidation.
+    /// @param sql The SQL statement to scan
+    /// @return Normalized table names, empty if none were found
+    [[nodiscard]] static std::vector<std::string> extractTableNames(std::string_view sql);
 
 private:
     /// Trim whitespace from both ends of a string view
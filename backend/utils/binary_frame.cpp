@@ -0,0 +1,136 @@
+#include "binary_frame.h"
+
+#include "database/columnar_result.h"
+
+#include <cstring>
+
+namespace velocitydb {
+
+namespace {
+
+template <typename T>
+void appendScalar(std::vector<uint8_t>& out, T value) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+void appendBytes(std::vector<uint8_t>& out, const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+void appendLengthPrefixed(std::vector<uint8_t>& out, const std::string& value) {
+    appendScalar(out, static_cast<uint32_t>(value.size()));
+    appendBytes(out, value.data(), value.size());
+}
+
+constexpr char BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::string toBase64(const std::vector<uint8_t>& bytes) {
+    std::string encoded;
+    encoded.reserve(((bytes.size() + 2) / 3) * 4);
+
+    size_t i = 0;
+    for (; i + 3 <= bytes.size(); i += 3) {
+        const uint32_t chunk = (static_cast<uint32_t>(bytes[i]) << 16) | (static_cast<uint32_t>(bytes[i + 1]) << 8) | bytes[i + 2];
+        encoded += BASE64_ALPHABET[(chunk >> 18) & 0x3F];
+        encoded += BASE64_ALPHABET[(chunk >> 12) & 0x3F];
+        encoded += BASE64_ALPHABET[(chunk >> 6) & 0x3F];
+        encoded += BASE64_ALPHABET[chunk & 0x3F];
+    }
+
+    const size_t remaining = bytes.size() - i;
+    if (remaining == 1) {
+        const uint32_t chunk = static_cast<uint32_t>(bytes[i]) << 16;
+        encoded += BASE64_ALPHABET[(chunk >> 18) & 0x3F];
+        encoded += BASE64_ALPHABET[(chunk >> 12) & 0x3F];
+        encoded += "==";
+    } else if (remaining == 2) {
+        const uint32_t chunk = (static_cast<uint32_t>(bytes[i]) << 16) | (static_cast<uint32_t>(bytes[i + 1]) << 8);
+        encoded += BASE64_ALPHABET[(chunk >> 18) & 0x3F];
+        encoded += BASE64_ALPHABET[(chunk >> 12) & 0x3F];
+        encoded += BASE64_ALPHABET[(chunk >> 6) & 0x3F];
+        encoded += '=';
+    }
+
+    return encoded;
+}
+
+}  // namespace
+
+std::vector<uint8_t> BinaryFrame::encode(const ColumnarResultSet& result, bool cached) {
+    // Frame size is known exactly up front; one reserve, no reallocation
+    size_t frameSize = 4 + sizeof(uint16_t) * 2 + sizeof(uint64_t) + sizeof(uint32_t) + sizeof(int64_t) + sizeof(double);
+    for (size_t col = 0; col < result.columns.size(); ++col) {
+        const auto& buffer = result.columnData[col];
+        frameSize += sizeof(uint32_t) + result.columns[col].name.size();
+        frameSize += sizeof(uint32_t) + result.columns[col].type.size();
+        frameSize += 2 + buffer.nullFlags.size();
+        if (buffer.isDictionary()) {
+            frameSize += sizeof(uint32_t) + buffer.dictIds.size() * sizeof(uint32_t);
+        }
+        frameSize += buffer.offsets.size() * sizeof(uint64_t);
+        frameSize += sizeof(uint64_t) + buffer.data.size();
+        frameSize += buffer.intValues.size() * sizeof(int64_t) + buffer.doubleValues.size() * sizeof(double);
+    }
+
+    std::vector<uint8_t> frame;
+    frame.reserve(frameSize);
+
+    appendBytes(frame, "VDBF", 4);
+    appendScalar(frame, FORMAT_VERSION);
+    appendScalar(frame, static_cast<uint16_t>(cached ? 1 : 0));
+    appendScalar(frame, static_cast<uint64_t>(result.rowCount));
+    appendScalar(frame, static_cast<uint32_t>(result.columns.size()));
+    appendScalar(frame, result.affectedRows);
+    appendScalar(frame, result.executionTimeMs);
+
+    for (size_t col = 0; col < result.columns.size(); ++col) {
+        const auto& buffer = result.columnData[col];
+
+        appendLengthPrefixed(frame, result.columns[col].name);
+        appendLengthPrefixed(frame, result.columns[col].type);
+        appendScalar(frame, static_cast<uint8_t>(buffer.valueType));
+        appendScalar(frame, static_cast<uint8_t>(buffer.isDictionary() ? 1 : 0));
+
+        appendBytes(frame, buffer.nullFlags.data(), buffer.nullFlags.size());
+        if (buffer.isDictionary()) {
+            // Ship the dictionary as-is: distinct values once, 4-byte ids
+            // per row. An interned status column crosses the bridge 5-10x
+            // smaller than the repeated cell bytes would.
+            appendScalar(frame, static_cast<uint32_t>(buffer.offsets.size() - 1));
+            appendBytes(frame, buffer.offsets.data(), buffer.offsets.size() * sizeof(uint64_t));
+            appendScalar(frame, static_cast<uint64_t>(buffer.data.size()));
+            appendBytes(frame, buffer.data.data(), buffer.data.size());
+            appendBytes(frame, buffer.dictIds.data(), buffer.dictIds.size() * sizeof(uint32_t));
+            continue;
+        }
+        appendBytes(frame, buffer.offsets.data(), buffer.offsets.size() * sizeof(uint64_t));
+        appendScalar(frame, static_cast<uint64_t>(buffer.data.size()));
+        appendBytes(frame, buffer.data.data(), buffer.data.size());
+
+        switch (buffer.valueType) {
+            case ColumnValueType::Int64:
+            case ColumnValueType::Bool:
+                appendBytes(frame, buffer.intValues.data(), buffer.intValues.size() * sizeof(int64_t));
+                break;
+            case ColumnValueType::Double:
+                appendBytes(frame, buffer.doubleValues.data(), buffer.doubleValues.size() * sizeof(double));
+                break;
+            case ColumnValueType::String:
+                break;
+        }
+    }
+
+    return frame;
+}
+
+std::string BinaryFrame::encodeBase64(const ColumnarResultSet& result, bool cached) {
+    return toBase64(encode(result, cached));
+}
+
+std::string BinaryFrame::frameToBase64(const std::vector<uint8_t>& frame) {
+    return toBase64(frame);
+}
+
+}  // namespace velocitydb
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace velocitydb {
+
+struct ColumnarResultSet;
+
+/// Binary columnar wire format for result sets ("VDBF" frames).
+///
+/// serializeResultSet pays escape + parse + GC churn on both sides of the
+/// bridge for every cell; a frame instead ships the columnar buffers the
+/// driver already built — length-prefixed per column, Arrow-style — so the
+/// frontend can wrap them in typed arrays without re-parsing cell text.
+///
+/// Layout (little-endian, matching the only platform we ship on):
+///   "VDBF" magic, u16 version (2), u16 flags (bit 0 = cached),
+///   u64 rowCount, u32 columnCount, i64 affectedRows, f64 executionTimeMs,
+///   then per column:
+///     u32 nameLen + UTF-8 name, u32 typeLen + UTF-8 type name,
+///     u8 valueType (ColumnValueType), u8 encoding (0 plain, 1 dictionary),
+///     nullFlags (rowCount bytes), then:
+///     plain: offsets ((rowCount + 1) u64), u64 dataLen + UTF-8 cell bytes,
+///            typed columns only: native values (rowCount i64 or f64);
+///     dictionary: u32 distinctCount, offsets ((distinctCount + 1) u64),
+///            u64 dataLen + distinct UTF-8 bytes, ids (rowCount u32).
+///
+/// The webview message channel is string-only, so frames ride base64 inside
+/// the JSON envelope until a shared-buffer transport exists; decode on the
+/// frontend is one atob + DataView pass instead of a full JSON.parse.
+class BinaryFrame {
+public:
+    static constexpr uint16_t FORMAT_VERSION = 2;
+
+    /// Encodes the result set as one contiguous frame, sized up front
+    [[nodiscard]] static std::vector<uint8_t> encode(const ColumnarResultSet& result, bool cached);
+
+    /// encode() + base64, ready to embed in a JSON response
+    [[nodiscard]] static std::string encodeBase64(const ColumnarResultSet& result, bool cached);
+
+    /// Base64 of an already-encoded frame; the inline fallback when a
+    /// shared-buffer transfer is declined re-encodes nothing
+    [[nodiscard]] static std::string frameToBase64(const std::vector<uint8_t>& frame);
+};
+
+}  // namespace velocitydb
@@ -85,6 +85,54 @@ std::string CredentialProtector::base64Encode(const std::vector<unsigned char>&
     return encoded;
 }
 
+CredentialCache& CredentialCache::instance() {
+    static CredentialCache cache;
+    return cache;
+}
+
+CredentialCache::~CredentialCache() {
+    wipe();
+}
+
+std::expected<std::string, std::string> CredentialCache::decrypt(std::string_view encryptedBase64) {
+    if (encryptedBase64.empty()) {
+        return std::string{};  // Empty encrypted string returns empty password
+    }
+
+    std::string key(encryptedBase64);
+    std::lock_guard lock(m_mutex);
+
+    if (auto it = m_cache.find(key); it != m_cache.end()) {
+        return it->second;
+    }
+
+    auto decrypted = CredentialProtector::decrypt(encryptedBase64);
+    if (!decrypted) {
+        return decrypted;
+    }
+
+    auto [it, inserted] = m_cache.emplace(std::move(key), decrypted.value());
+    if (inserted && !it->second.empty()) {
+        // Pin the cached plaintext so it never pages to disk; best
+        // effort - a failed lock still leaves the cache functional
+        VirtualLock(it->second.data(), it->second.size());
+    }
+
+    return decrypted;
+}
+
+void CredentialCache::wipe() {
+    std::lock_guard lock(m_mutex);
+
+    for (auto& [ciphertext, plaintext] : m_cache) {
+        if (!plaintext.empty()) {
+            SecureZeroMemory(plaintext.data(), plaintext.size());
+            VirtualUnlock(plaintext.data(), plaintext.size());
+        }
+    }
+    m_cache.clear();
+}
+
 std::expected<std::vector<unsigned char>, std::string> CredentialProtector::base64Decode(std::string_view encoded) {
     if (encoded.empty()) {
         return std::vector<unsigned char>{};
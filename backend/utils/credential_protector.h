@@ -1,8 +1,10 @@
 #pragma once
 
 #include <expected>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace velocitydb {
@@ -27,4 +29,34 @@ private:
     [[nodiscard]] static std::expected<std::vector<unsigned char>, std::string> base64Decode(std::string_view encoded);
 };
 
+/// Session-scoped cache of decrypted secrets, keyed by their ciphertext.
+/// Repeated connects, pool warm-up and tunnel reconnects all ask for the
+/// same password; the first request pays the DPAPI round trip, the rest
+/// are a map lookup. Cached plaintext is pinned with VirtualLock so it
+/// never pages to disk, and wipe() SecureZeroMemory-erases everything -
+/// it runs automatically at exit and whenever a password is rewritten.
+class CredentialCache {
+public:
+    [[nodiscard]] static CredentialCache& instance();
+
+    ~CredentialCache();
+
+    CredentialCache(const CredentialCache&) = delete;
+    CredentialCache& operator=(const CredentialCache&) = delete;
+
+    /// Decrypt through the cache; identical ciphertext hits the cached
+    /// plaintext. Failures are not cached.
+    [[nodiscard]] std::expected<std::string, std::string> decrypt(std::string_view encryptedBase64);
+
+    /// Zero and drop every cached secret (called on exit and whenever
+    /// stored credentials change)
+    void wipe();
+
+private:
+    CredentialCache() = default;
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::string> m_cache;
+};
+
 }  // namespace velocitydb
@@ -10,6 +10,45 @@
 
 namespace velocitydb {
 
+MappedFile::MappedFile(const std::filesystem::path& filepath) {
+    auto file = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    m_file = file;
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size)) {
+        return;
+    }
+    if (size.QuadPart == 0) {
+        // Zero-size files cannot be mapped; expose them as an empty view
+        m_empty = true;
+        return;
+    }
+
+    m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m_mapping) {
+        return;
+    }
+    m_view = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (m_view) {
+        m_size = static_cast<size_t>(size.QuadPart);
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (m_view) {
+        UnmapViewOfFile(const_cast<void*>(m_view));
+    }
+    if (m_mapping) {
+        CloseHandle(m_mapping);
+    }
+    if (m_file) {
+        CloseHandle(m_file);
+    }
+}
+
 std::optional<std::string> FileUtils::readFile(const std::string& filepath) {
     std::ifstream file(filepath, std::ios::binary);
     if (!file.is_open()) {
@@ -1,11 +1,37 @@
 #pragma once
 
+#include <filesystem>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace velocitydb {
 
+/// Read-only memory-mapped view of a file. Reading through the mapping
+/// streams the file out of the page cache as a string_view instead of
+/// copying it into a heap buffer first; opening a 100MB dump costs no
+/// allocation at all. Zero-size files map to an empty view. The view is
+/// valid for the lifetime of the MappedFile.
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& filepath);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] bool isMapped() const noexcept { return m_view != nullptr || m_empty; }
+    [[nodiscard]] std::string_view view() const noexcept { return {static_cast<const char*>(m_view), m_size}; }
+
+private:
+    void* m_file = nullptr;  // HANDLE, kept as void* to keep Windows.h out of the header
+    void* m_mapping = nullptr;
+    const void* m_view = nullptr;
+    size_t m_size = 0;
+    bool m_empty = false;
+};
+
 class FileUtils {
 public:
     static std::optional<std::string> readFile(const std::string& filepath);
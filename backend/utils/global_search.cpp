@@ -1,10 +1,79 @@
 #include "global_search.h"
 
 #include <algorithm>
+#include <cctype>
 #include <format>
+#include <set>
 
 namespace velocitydb {
 
+namespace {
+
+// One unfiltered catalog query covering every searchable object type;
+// the per-keystroke filtering happens locally against this snapshot
+constexpr const char* SNAPSHOT_QUERY = R"(
+    SELECT 'TABLE' as object_type, TABLE_SCHEMA as schema_name, TABLE_NAME as object_name, '' as parent_name
+    FROM INFORMATION_SCHEMA.TABLES WHERE TABLE_TYPE = 'BASE TABLE'
+    UNION ALL
+    SELECT 'VIEW', TABLE_SCHEMA, TABLE_NAME, '' FROM INFORMATION_SCHEMA.VIEWS
+    UNION ALL
+    SELECT 'PROCEDURE', ROUTINE_SCHEMA, ROUTINE_NAME, '' FROM INFORMATION_SCHEMA.ROUTINES WHERE ROUTINE_TYPE = 'PROCEDURE'
+    UNION ALL
+    SELECT 'FUNCTION', ROUTINE_SCHEMA, ROUTINE_NAME, '' FROM INFORMATION_SCHEMA.ROUTINES WHERE ROUTINE_TYPE = 'FUNCTION'
+    UNION ALL
+    SELECT 'COLUMN', TABLE_SCHEMA, COLUMN_NAME, TABLE_NAME FROM INFORMATION_SCHEMA.COLUMNS
+    UNION ALL
+    SELECT 'INDEX', OBJECT_SCHEMA_NAME(object_id), name, OBJECT_NAME(object_id) FROM sys.indexes WHERE name IS NOT NULL
+)";
+
+[[nodiscard]] std::string toLower(std::string_view text) {
+    std::string lowered(text);
+    std::ranges::transform(lowered, lowered.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return lowered;
+}
+
+// Whether the snapshot entry's type is enabled by the search options
+[[nodiscard]] bool typeEnabled(const std::string& objectType, const SearchOptions& options) {
+    if (objectType == "TABLE") {
+        return options.searchTables;
+    }
+    if (objectType == "VIEW") {
+        return options.searchViews;
+    }
+    if (objectType == "PROCEDURE") {
+        return options.searchProcedures;
+    }
+    if (objectType == "FUNCTION") {
+        return options.searchFunctions;
+    }
+    if (objectType == "COLUMN") {
+        return options.searchColumns;
+    }
+    if (objectType == "INDEX") {
+        return options.searchIndexes;
+    }
+    return false;
+}
+
+}  // namespace
+
+GlobalSearch::~GlobalSearch() {
+    // Collect under the lock, join outside it: the threads take
+    // m_snapshotMutex to publish their results
+    std::vector<std::thread> pending;
+    {
+        std::lock_guard lock(m_snapshotMutex);
+        for (auto& [driver, snapshot] : m_snapshots) {
+            if (snapshot.refreshThread.joinable()) {
+                pending.push_back(std::move(snapshot.refreshThread));
+            }
+        }
+    }
+    for (auto& thread : pending) {
+        thread.join();
+    }
+}
+
 std::vector<SearchResult> GlobalSearch::searchObjects(SQLServerDriver* driver, const std::string& pattern, const SearchOptions& options) {
     std::vector<SearchResult> results;
 
@@ -12,6 +81,33 @@ std::vector<SearchResult> GlobalSearch::searchObjects(SQLServerDriver* driver, c
         return results;
     }
 
+    // Serve from the local snapshot when one is ready; kick off a
+    // background refresh when it is missing or past its TTL
+    {
+        std::lock_guard lock(m_snapshotMutex);
+        auto it = m_snapshots.find(driver);
+        const bool ready = it != m_snapshots.end() && it->second.ready;
+        const bool fresh = ready && std::chrono::steady_clock::now() - it->second.refreshedAt < SNAPSHOT_TTL;
+        if (!fresh) {
+            startSnapshotRefresh(driver);
+        }
+        if (ready) {
+            // A stale snapshot still answers this keystroke; the refresh
+            // replaces it for the next one
+            for (const auto& object : it->second.objects) {
+                if (results.size() >= static_cast<size_t>(options.maxResults)) {
+                    break;
+                }
+                if (typeEnabled(object.objectType, options) && matchesPattern(object.objectName, pattern, options.caseSensitive)) {
+                    results.push_back(object);
+                }
+            }
+            return results;
+        }
+    }
+
+    // First search on this connection: one server round trip while the
+    // snapshot builds in the background
     std::string query = buildSearchQuery(pattern, options);
     ResultSet queryResult = driver->execute(query);
 
@@ -32,6 +128,91 @@ std::vector<SearchResult> GlobalSearch::searchObjects(SQLServerDriver* driver, c
     return results;
 }
 
+void GlobalSearch::invalidateSnapshot(SQLServerDriver* driver) {
+    // Wait out a running refresh before erasing: it would otherwise
+    // re-insert a snapshot for the dead connection when it publishes
+    std::thread refresh;
+    {
+        std::lock_guard lock(m_snapshotMutex);
+        auto it = m_snapshots.find(driver);
+        if (it == m_snapshots.end()) {
+            return;
+        }
+        refresh = std::move(it->second.refreshThread);
+    }
+    if (refresh.joinable()) {
+        refresh.join();
+    }
+    std::lock_guard lock(m_snapshotMutex);
+    m_snapshots.erase(driver);
+}
+
+void GlobalSearch::startSnapshotRefresh(SQLServerDriver* driver) {
+    // Caller holds m_snapshotMutex
+    auto& snapshot = m_snapshots[driver];
+    if (snapshot.refreshing) {
+        return;
+    }
+    snapshot.refreshing = true;
+
+    // Join only this driver's previous thread, never another driver's: a
+    // still-running refresh needs m_snapshotMutex - held here - to
+    // publish, so joining it would deadlock. With refreshing false the
+    // previous thread is merely unwinding and the join is immediate
+    if (snapshot.refreshThread.joinable()) {
+        snapshot.refreshThread.join();
+    }
+    snapshot.refreshThread = std::thread([this, driver] { refreshSnapshot(driver); });
+}
+
+void GlobalSearch::refreshSnapshot(SQLServerDriver* driver) {
+    std::vector<SearchResult> objects;
+    try {
+        ResultSet catalog = driver->execute(SNAPSHOT_QUERY);
+        objects.reserve(catalog.rows.size());
+        for (const auto& row : catalog.rows) {
+            if (row.values.size() < 4) {
+                continue;
+            }
+            objects.push_back({.objectType = std::string(row.values[0]),
+                               .schemaName = std::string(row.values[1]),
+                               .objectName = std::string(row.values[2]),
+                               .parentName = std::string(row.values[3]),
+                               .matchedText = std::string(row.values[2])});
+        }
+
+        // Matches the server-side ORDER BY of the fallback query
+        std::ranges::sort(objects, [](const SearchResult& a, const SearchResult& b) { return a.objectType != b.objectType ? a.objectType < b.objectType : a.objectName < b.objectName; });
+
+        // Autocomplete array: table and column names, deduplicated, the
+        // same scope as quickSearch's server query
+        std::set<std::string> uniqueNames;
+        for (const auto& object : objects) {
+            if (object.objectType == "TABLE" || object.objectType == "COLUMN") {
+                uniqueNames.insert(object.objectName);
+            }
+        }
+        std::vector<std::pair<std::string, std::string>> sortedNames;
+        sortedNames.reserve(uniqueNames.size());
+        for (const auto& name : uniqueNames) {
+            sortedNames.emplace_back(toLower(name), name);
+        }
+        std::ranges::sort(sortedNames);
+
+        std::lock_guard lock(m_snapshotMutex);
+        auto& snapshot = m_snapshots[driver];
+        snapshot.objects = std::move(objects);
+        snapshot.sortedNames = std::move(sortedNames);
+        snapshot.refreshedAt = std::chrono::steady_clock::now();
+        snapshot.ready = true;
+        snapshot.refreshing = false;
+    } catch (...) {
+        // Keep whatever snapshot exists; the fallback query still works
+        std::lock_guard lock(m_snapshotMutex);
+        m_snapshots[driver].refreshing = false;
+    }
+}
+
 std::vector<SearchResult> GlobalSearch::searchQueryHistory(const std::vector<std::string>& history, const std::string& pattern, bool caseSensitive) {
     std::vector<SearchResult> results;
 
@@ -55,6 +236,31 @@ std::vector<std::string> GlobalSearch::quickSearch(SQLServerDriver* driver, cons
         return results;
     }
 
+    // Local path: binary-search the sorted name array of the snapshot;
+    // completion must land well inside the ~30ms typing budget, which a
+    // tunneled round trip never does
+    {
+        std::lock_guard lock(m_snapshotMutex);
+        auto it = m_snapshots.find(driver);
+        const bool ready = it != m_snapshots.end() && it->second.ready;
+        const bool fresh = ready && std::chrono::steady_clock::now() - it->second.refreshedAt < SNAPSHOT_TTL;
+        if (!fresh) {
+            startSnapshotRefresh(driver);
+        }
+        if (ready) {
+            const auto& names = it->second.sortedNames;
+            auto lowerPrefix = toLower(prefix);
+            auto first = std::ranges::lower_bound(names, lowerPrefix, {}, [](const auto& entry) -> const std::string& { return entry.first; });
+            for (; first != names.end() && results.size() < static_cast<size_t>(limit); ++first) {
+                if (!first->first.starts_with(lowerPrefix)) {
+                    break;
+                }
+                results.push_back(first->second);
+            }
+            return results;
+        }
+    }
+
     // Quick search for table and column names
     std::string query = std::format(R"(
         SELECT TOP {} name FROM (
@@ -70,7 +276,7 @@ std::vector<std::string> GlobalSearch::quickSearch(SQLServerDriver* driver, cons
 
     results.reserve(queryResult.rows.size());
     for (const auto& row : queryResult.rows) {
-        results.push_back(row.values[0]);
+        results.emplace_back(row.values[0]);
     }
 
     return results;
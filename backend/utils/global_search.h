@@ -2,7 +2,11 @@
 
 #include "../database/sqlserver_driver.h"
 
+#include <chrono>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace velocitydb {
@@ -30,7 +34,7 @@ struct SearchOptions {
 class GlobalSearch {
 public:
     GlobalSearch() = default;
-    ~GlobalSearch() = default;
+    ~GlobalSearch();
 
     GlobalSearch(const GlobalSearch&) = delete;
     GlobalSearch& operator=(const GlobalSearch&) = delete;
@@ -44,9 +48,39 @@ public:
     /// Quick search for object names (autocomplete)
     [[nodiscard]] std::vector<std::string> quickSearch(SQLServerDriver* driver, const std::string& prefix, int limit = 20);
 
+    /// Drops the cached object snapshot for a driver (call on disconnect;
+    /// a new connection could otherwise hit a stale snapshot through a
+    /// reused driver address)
+    void invalidateSnapshot(SQLServerDriver* driver);
+
 private:
+    // All object names of one connection, fetched in a single catalog
+    // query so search-as-you-type filters locally instead of hitting the
+    // server per keystroke
+    struct SchemaSnapshot {
+        std::vector<SearchResult> objects;
+        // Table and column names sorted by lowercased key: autocomplete
+        // binary-searches the prefix instead of paying a server LIKE
+        std::vector<std::pair<std::string, std::string>> sortedNames;
+        std::chrono::steady_clock::time_point refreshedAt{};
+        bool ready = false;
+        bool refreshing = false;
+        // One refresh thread per driver. Once refreshing is false the
+        // thread is past its last use of m_snapshotMutex, so joining it
+        // with the mutex held cannot deadlock
+        std::thread refreshThread;
+    };
+
+    static constexpr std::chrono::minutes SNAPSHOT_TTL{5};
+
+    void startSnapshotRefresh(SQLServerDriver* driver);
+    void refreshSnapshot(SQLServerDriver* driver);
+
     [[nodiscard]] std::string buildSearchQuery(const std::string& pattern, const SearchOptions& options) const;
     [[nodiscard]] bool matchesPattern(const std::string& text, const std::string& pattern, bool caseSensitive) const;
+
+    mutable std::mutex m_snapshotMutex;
+    std::unordered_map<SQLServerDriver*, SchemaSnapshot> m_snapshots;
 };
 
 }  // namespace velocitydb
@@ -1,12 +1,111 @@
 #include "json_utils.h"
 
 #include "database/sqlserver_driver.h"
+#include "response_arena.h"
+#include "simd_filter.h"
+#include "metrics.h"
+#include "trace.h"
 
+#include <chrono>
 #include <format>
 #include <sstream>
 
+#ifdef _MSC_VER
+#include <immintrin.h>
+#endif
+
 namespace velocitydb {
 
+namespace {
+
+/// Returns the index of the first byte that needs a JSON escape (quote,
+/// backslash, or control character below 0x20), or len if the run is clean.
+/// >99% of cells contain none, so the scanner is the whole cost of escaping
+/// for typical data: 32 bytes per AVX2 step, 16 per SSE2 step.
+[[nodiscard]] size_t findFirstEscapable(const char* data, size_t len) {
+    size_t i = 0;
+
+#ifdef _MSC_VER
+    static const bool hasAvx2 = SIMDFilter::isAVX2Available();
+
+    if (hasAvx2) {
+        const __m256i quote = _mm256_set1_epi8('"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i maxControl = _mm256_set1_epi8(0x1F);
+
+        for (; i + 32 <= len; i += 32) {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            // Unsigned "chunk <= 0x1F" via min: avoids flagging bytes >= 0x80,
+            // which compare negative in epi8
+            const __m256i isControl = _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, maxControl), chunk);
+            const __m256i needsEscape = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)), isControl);
+            const int mask = _mm256_movemask_epi8(needsEscape);
+            if (mask != 0) {
+                unsigned long pos;
+                _BitScanForward(&pos, static_cast<unsigned long>(mask));
+                return i + pos;
+            }
+        }
+    } else {
+        // SSE2 baseline: guaranteed on every x64 CPU
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i maxControl = _mm_set1_epi8(0x1F);
+
+        for (; i + 16 <= len; i += 16) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const __m128i isControl = _mm_cmpeq_epi8(_mm_min_epu8(chunk, maxControl), chunk);
+            const __m128i needsEscape = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)), isControl);
+            const int mask = _mm_movemask_epi8(needsEscape);
+            if (mask != 0) {
+                unsigned long pos;
+                _BitScanForward(&pos, static_cast<unsigned long>(mask));
+                return i + pos;
+            }
+        }
+    }
+#endif
+
+    for (; i < len; ++i) {
+        const auto c = static_cast<unsigned char>(data[i]);
+        if (c == '"' || c == '\\' || c < 0x20) {
+            return i;
+        }
+    }
+    return len;
+}
+
+void appendEscapedChar(std::string& out, char c) {
+    switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\b':
+            out += "\\b";
+            break;
+        case '\f':
+            out += "\\f";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            out += std::format("\\u{:04x}", static_cast<int>(c));
+            break;
+    }
+}
+
+}  // namespace
+
 std::string JsonUtils::successResponse(std::string_view data) {
     return std::format(R"({{"success":true,"data":{}}})", data);
 }
@@ -16,60 +115,53 @@ std::string JsonUtils::errorResponse(std::string_view message) {
 }
 
 std::string JsonUtils::escapeString(std::string_view str) {
-    // Fast path: check if string needs escaping
-    bool needsEscape = false;
-    for (char c : str) {
-        if (c == '"' || c == '\\' || c == '\b' || c == '\f' || c == '\n' || c == '\r' || c == '\t' || static_cast<unsigned char>(c) < 0x20) {
-            needsEscape = true;
-            break;
-        }
-    }
+    std::string result;
+    appendEscaped(result, str);
+    return result;
+}
 
-    // If no special characters, return as-is (avoid allocation)
-    if (!needsEscape) {
-        return std::string(str);
+void JsonUtils::appendEscaped(std::string& out, std::string_view str) {
+    // Fast path: the vectorized scanner clears the whole cell in one pass
+    // and the append is a single bulk copy
+    const size_t firstSpecial = findFirstEscapable(str.data(), str.size());
+    if (firstSpecial == str.size()) {
+        out.append(str);
+        return;
     }
 
-    // Slow path: escape special characters
-    std::string result;
-    result.reserve(str.size() + str.size() / 8);
-
-    for (char c : str) {
-        switch (c) {
-            case '"':
-                result += "\\\"";
-                break;
-            case '\\':
-                result += "\\\\";
-                break;
-            case '\b':
-                result += "\\b";
-                break;
-            case '\f':
-                result += "\\f";
-                break;
-            case '\n':
-                result += "\\n";
-                break;
-            case '\r':
-                result += "\\r";
-                break;
-            case '\t':
-                result += "\\t";
-                break;
-            default:
-                if (static_cast<unsigned char>(c) < 0x20) {
-                    result += std::format("\\u{:04x}", static_cast<int>(c));
-                } else {
-                    result += c;
-                }
-                break;
-        }
+    // Slow path: escape one character, then bulk-copy the next clean run;
+    // cells with a single embedded quote still move mostly via memcpy
+    out.reserve(out.size() + str.size() + str.size() / 8);
+    out.append(str.data(), firstSpecial);
+
+    size_t i = firstSpecial;
+    while (i < str.size()) {
+        appendEscapedChar(out, str[i]);
+        ++i;
+
+        const size_t cleanRun = findFirstEscapable(str.data() + i, str.size() - i);
+        out.append(str.data() + i, cleanRun);
+        i += cleanRun;
     }
-    return result;
 }
 
 std::string JsonUtils::serializeResultSet(const ResultSet& result, bool cached) {
+    std::string json;
+    serializeResultSetInto(json, result, cached);
+    return json;
+}
+
+std::string JsonUtils::resultSetResponse(const ResultSet& result, bool cached) {
+    auto& buffer = ResponseArena::acquire();
+    buffer += R"({"success":true,"data":)";
+    serializeResultSetInto(buffer, result, cached);
+    buffer += '}';
+    return buffer;  // One copy out; the arena keeps its capacity for reuse
+}
+
+void JsonUtils::serializeResultSetInto(std::string& out, const ResultSet& result, bool cached) {
+    VDB_TRACE_SPAN("serialize", "serializeResultSet");
+    const auto serializeStart = std::chrono::steady_clock::now();
     // Improved buffer size estimation to minimize reallocations
     // Base structure: ~150 bytes
     // Per column: name (avg 20) + type (avg 15) + JSON overhead (30) = ~65 bytes
@@ -83,8 +175,8 @@ std::string JsonUtils::serializeResultSet(const ResultSet& result, bool cached)
         }
     }
 
-    std::string json;
-    json.reserve(estimatedSize);
+    auto& json = out;
+    json.reserve(json.size() + estimatedSize);
 
     json += R"({"columns":[)";
 
@@ -93,7 +185,7 @@ std::string JsonUtils::serializeResultSet(const ResultSet& result, bool cached)
         if (i > 0)
             json += ',';
         json += R"({"name":")";
-        json += escapeString(result.columns[i].name);
+        appendEscaped(json, result.columns[i].name);
         json += R"(","type":")";
         json += result.columns[i].type;  // Type names don't need escaping (SQL types are safe)
         json += R"("})";
@@ -110,7 +202,7 @@ std::string JsonUtils::serializeResultSet(const ResultSet& result, bool cached)
             if (colIndex > 0)
                 json += ',';
             json += '"';
-            json += escapeString(row.values[colIndex]);
+            appendEscaped(json, row.values[colIndex]);
             json += '"';
         }
         json += ']';
@@ -125,7 +217,60 @@ std::string JsonUtils::serializeResultSet(const ResultSet& result, bool cached)
     json += cached ? "true" : "false";
     json += '}';
 
-    return json;
+    Metrics::instance().serialize().record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - serializeStart).count());
+}
+
+void JsonUtils::serializeResultSetChunked(const ResultSet& result, bool cached, size_t chunkSize, const std::function<void(std::string_view chunk, bool isLast)>& emit) {
+    // Same document shape as serializeResultSet, but the buffer never grows
+    // past roughly one chunk: it flushes at row boundaries once chunkSize is
+    // crossed, so a 100MB result serializes in ~chunkSize memory
+    std::string buffer;
+    buffer.reserve(chunkSize + chunkSize / 4);
+
+    auto flushIfFull = [&] {
+        if (buffer.size() >= chunkSize) {
+            emit(buffer, false);
+            buffer.clear();
+        }
+    };
+
+    buffer += R"({"columns":[)";
+    for (size_t i = 0; i < result.columns.size(); ++i) {
+        if (i > 0)
+            buffer += ',';
+        buffer += R"({"name":")";
+        appendEscaped(buffer, result.columns[i].name);
+        buffer += R"(","type":")";
+        buffer += result.columns[i].type;
+        buffer += R"("})";
+    }
+    buffer += R"(],"rows":[)";
+
+    for (size_t rowIndex = 0; rowIndex < result.rows.size(); ++rowIndex) {
+        if (rowIndex > 0)
+            buffer += ',';
+        buffer += '[';
+        const auto& row = result.rows[rowIndex];
+        for (size_t colIndex = 0; colIndex < row.values.size(); ++colIndex) {
+            if (colIndex > 0)
+                buffer += ',';
+            buffer += '"';
+            appendEscaped(buffer, row.values[colIndex]);
+            buffer += '"';
+        }
+        buffer += ']';
+        flushIfFull();
+    }
+
+    buffer += R"(],"affectedRows":)";
+    buffer += std::to_string(result.affectedRows);
+    buffer += R"(,"executionTimeMs":)";
+    buffer += std::to_string(result.executionTimeMs);
+    buffer += R"(,"cached":)";
+    buffer += cached ? "true" : "false";
+    buffer += '}';
+
+    emit(buffer, true);
 }
 
 }  // namespace velocitydb
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -18,11 +19,36 @@ public:
     [[nodiscard]] static std::string errorResponse(std::string_view message);
     [[nodiscard]] static std::string escapeString(std::string_view str);
 
+    /// Appends str to out with JSON escaping, vectorized: a SIMD scanner
+    /// (AVX2 when available, SSE2 otherwise) finds the first byte needing an
+    /// escape, clean runs are bulk-copied, and only cells containing quotes,
+    /// backslashes or control characters take the per-character slow path.
+    /// The serializers call this per cell; escapeString delegates here.
+    static void appendEscaped(std::string& out, std::string_view str);
+
     /// Serialize a ResultSet to JSON with pre-allocated buffer for performance.
     /// @param result The query result to serialize
     /// @param cached Whether the result was from cache
     /// @return JSON string representation
     [[nodiscard]] static std::string serializeResultSet(const ResultSet& result, bool cached);
+
+    /// serializeResultSet appending into an existing buffer (reserves the
+    /// size estimate on top), so composite responses and arena users avoid
+    /// the intermediate string
+    static void serializeResultSetInto(std::string& out, const ResultSet& result, bool cached);
+
+    /// Builds the complete success envelope around a serialized result in
+    /// the per-thread ResponseArena: one reused buffer instead of a fresh
+    /// serialize allocation plus an envelope-sized copy per request
+    [[nodiscard]] static std::string resultSetResponse(const ResultSet& result, bool cached);
+
+    /// Serializes the same JSON as serializeResultSet but in fixed-size
+    /// segments: the working buffer flushes to emit whenever it crosses
+    /// chunkSize, so peak memory stays near one chunk regardless of result
+    /// size and the frontend can start rendering while the tail is still
+    /// serializing. Segments concatenate to exactly the serializeResultSet
+    /// output; emit is called at least once, with isLast on the final call.
+    static void serializeResultSetChunked(const ResultSet& result, bool cached, size_t chunkSize, const std::function<void(std::string_view chunk, bool isLast)>& emit);
 };
 
 }  // namespace velocitydb
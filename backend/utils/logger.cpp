@@ -1,15 +1,107 @@
 #include "logger.h"
 
+#include <atomic>
 #include <chrono>
+#include <cstring>
 #include <filesystem>
 #include <format>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <type_traits>
 
 namespace velocitydb {
 
+namespace {
+
+[[nodiscard]] std::string format_timestamp(std::chrono::system_clock::time_point when) {
+    auto time_t = std::chrono::system_clock::to_time_t(when);
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(when.time_since_epoch()) % 1000;
+
+    std::tm tm{};
+#ifdef _WIN32
+    localtime_s(&tm, &time_t);
+#else
+    localtime_r(&time_t, &tm);
+#endif
+
+    return std::format("{:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}.{:03d}", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, static_cast<int>(ms.count()));
+}
+
+}  // namespace
+
+std::string LogRecord::render() const {
+    std::string out;
+    out.reserve(fmt_length_ + payload_size_);
+
+    std::string_view fmt(fmt_, fmt_length_);
+    size_t cursor = 0;
+    uint8_t next_argument = 0;
+
+    for (size_t i = 0; i < fmt.size(); ++i) {
+        auto c = fmt[i];
+        if (c == '{' && i + 1 < fmt.size() && fmt[i + 1] == '{') {
+            out += '{';
+            ++i;
+        } else if (c == '}' && i + 1 < fmt.size() && fmt[i + 1] == '}') {
+            out += '}';
+            ++i;
+        } else if (c == '{' && i + 1 < fmt.size() && fmt[i + 1] == '}' && next_argument < arg_count_) {
+            append_argument(out, next_argument, cursor);
+            ++next_argument;
+            ++i;
+        } else {
+            out += c;
+        }
+    }
+
+    return out;
+}
+
+void LogRecord::append_argument(std::string& out, uint8_t index, size_t& cursor) const {
+    switch (types_[index]) {
+        case ArgType::Int64: {
+            int64_t value = 0;
+            std::memcpy(&value, &payload_[cursor], sizeof(value));
+            cursor += sizeof(value);
+            out += std::format("{}", value);
+            break;
+        }
+        case ArgType::Uint64: {
+            uint64_t value = 0;
+            std::memcpy(&value, &payload_[cursor], sizeof(value));
+            cursor += sizeof(value);
+            out += std::format("{}", value);
+            break;
+        }
+        case ArgType::Double: {
+            double value = 0.0;
+            std::memcpy(&value, &payload_[cursor], sizeof(value));
+            cursor += sizeof(value);
+            out += std::format("{}", value);
+            break;
+        }
+        case ArgType::Bool: {
+            bool value = false;
+            std::memcpy(&value, &payload_[cursor], sizeof(value));
+            cursor += sizeof(value);
+            out += value ? "true" : "false";
+            break;
+        }
+        case ArgType::String: {
+            uint16_t length = 0;
+            std::memcpy(&length, &payload_[cursor], sizeof(length));
+            cursor += sizeof(length);
+            out.append(&payload_[cursor], length);
+            cursor += length;
+            break;
+        }
+    }
+}
+
 /**
  * @brief File log output implementation
  *
@@ -22,21 +114,6 @@ private:
     std::ofstream file_;
     std::mutex mutex_;
 
-    [[nodiscard]] std::string get_timestamp() const {
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-
-        std::tm tm{};
-#ifdef _WIN32
-        localtime_s(&tm, &time_t);
-#else
-        localtime_r(&time_t, &tm);
-#endif
-
-        return std::format("{:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}.{:03d}", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, static_cast<int>(ms.count()));
-    }
-
 public:
     explicit FileLogOutput(std::string_view filepath) {
         // Create log directory if it doesn't exist
@@ -59,18 +136,23 @@ public:
     }
 
     void write(LogLevel level, std::string_view message) override {
-        std::lock_guard lock(mutex_);
+        auto log_message = std::format("[{}] [{}] {}\n", format_timestamp(std::chrono::system_clock::now()), log_level_to_string(level), message);
+        write_formatted(log_message);
+    }
 
-        auto timestamp = get_timestamp();
-        auto level_str = log_level_to_string(level);
-        auto log_message = std::format("[{}] [{}] {}\n", timestamp, level_str, message);
+    /**
+     * @brief Write an already formatted log line (used by the async drain
+     * thread, which formats with the timestamp captured at enqueue)
+     */
+    void write_formatted(std::string_view line) {
+        std::lock_guard lock(mutex_);
 
         // Output to both file and console
         if (file_.is_open()) {
-            file_ << log_message;
+            file_ << line;
         }
 
-        std::cout << log_message;
+        std::cout << line;
     }
 
     void flush() override {
@@ -82,12 +164,207 @@ public:
     }
 };
 
-// Global log output instance
+/**
+ * @brief Asynchronous log output
+ *
+ * Producers enqueue raw records (level, enqueue-time timestamp, message
+ * bytes) into a fixed lock-free MPSC ring buffer; a background thread
+ * formats and writes them through the wrapped FileLogOutput, flushing
+ * whenever the queue drains. A log call on a hot path costs one CAS and
+ * a memcpy - no formatting, no file I/O, no lock.
+ *
+ * When the ring is full the record is dropped and counted; the drain
+ * thread reports the drop count once it catches up. Messages longer
+ * than a slot are truncated. Structured LogRecords are enqueued raw and
+ * rendered on the drain thread, so the caller never formats at all.
+ */
+class AsyncLogOutput : public LogOutput {
+private:
+    // Slot payload capacity; longer messages get truncated
+    static constexpr size_t MAX_MESSAGE_CHARS = 512;
+    // Ring capacity (power of two); ~2MB resident
+    static constexpr uint64_t SLOT_COUNT = 4096;
+
+    struct Record {
+        std::atomic<uint64_t> sequence;
+        std::chrono::system_clock::time_point timestamp;
+        LogLevel level = LogLevel::INFO;
+        uint16_t length = 0;
+        bool structured = false;  // text holds a serialized LogRecord
+        char text[MAX_MESSAGE_CHARS];
+    };
+
+    static_assert(sizeof(LogRecord) <= MAX_MESSAGE_CHARS, "LogRecord must fit in a ring slot");
+    static_assert(std::is_trivially_copyable_v<LogRecord>);
+
+    FileLogOutput* sink_;
+    std::unique_ptr<Record[]> ring_;
+    std::atomic<uint64_t> enqueue_pos_{0};
+    uint64_t dequeue_pos_ = 0;  // Drain thread only
+    std::atomic<uint64_t> flushed_pos_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> wake_{0};
+    std::atomic<bool> stop_{false};
+    std::thread drain_thread_;
+
+public:
+    explicit AsyncLogOutput(FileLogOutput* sink) : sink_(sink), ring_(std::make_unique<Record[]>(SLOT_COUNT)) {
+        for (uint64_t i = 0; i < SLOT_COUNT; ++i) {
+            ring_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        drain_thread_ = std::thread(&AsyncLogOutput::drain_loop, this);
+    }
+
+    ~AsyncLogOutput() override {
+        stop_.store(true, std::memory_order_release);
+        wake_.fetch_add(1, std::memory_order_release);
+        wake_.notify_one();
+        if (drain_thread_.joinable()) {
+            drain_thread_.join();  // Drains and flushes the remainder
+        }
+    }
+
+    void write(LogLevel level, std::string_view message) override {
+        uint64_t pos = 0;
+        auto* record = claim_slot(pos);
+        if (record == nullptr) {
+            return;
+        }
+
+        record->timestamp = std::chrono::system_clock::now();
+        record->level = level;
+        record->structured = false;
+        record->length = static_cast<uint16_t>((std::min)(message.size(), MAX_MESSAGE_CHARS));
+        std::memcpy(record->text, message.data(), record->length);
+
+        publish_slot(record, pos);
+    }
+
+    void write_record(LogLevel level, const LogRecord& deferred) override {
+        uint64_t pos = 0;
+        auto* record = claim_slot(pos);
+        if (record == nullptr) {
+            return;
+        }
+
+        record->timestamp = std::chrono::system_clock::now();
+        record->level = level;
+        record->structured = true;
+        record->length = sizeof(LogRecord);
+        std::memcpy(record->text, &deferred, sizeof(LogRecord));
+
+        publish_slot(record, pos);
+    }
+
+    /**
+     * @brief Block until everything enqueued so far is on disk
+     */
+    void flush() override {
+        const auto target = enqueue_pos_.load(std::memory_order_acquire);
+        while (flushed_pos_.load(std::memory_order_acquire) < target && !stop_.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+private:
+    /**
+     * @brief Claim a free slot (Vyukov bounded queue)
+     *
+     * The slot's sequence tells whether it is free for this lap of the
+     * ring. Returns nullptr when the ring is full: dropping beats
+     * blocking the caller; the drain thread reports the count.
+     */
+    [[nodiscard]] Record* claim_slot(uint64_t& out_pos) {
+        auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            auto* record = &ring_[pos & (SLOT_COUNT - 1)];
+            auto seq = record->sequence.load(std::memory_order_acquire);
+            auto dif = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+            if (dif == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out_pos = pos;
+                    return record;
+                }
+            } else if (dif < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void publish_slot(Record* record, uint64_t pos) {
+        record->sequence.store(pos + 1, std::memory_order_release);
+        wake_.fetch_add(1, std::memory_order_release);
+        wake_.notify_one();
+    }
+
+    void drain_loop() {
+        std::string line;
+        for (;;) {
+            bool wrote = false;
+
+            // Drain everything currently ready
+            for (;;) {
+                Record& record = ring_[dequeue_pos_ & (SLOT_COUNT - 1)];
+                auto seq = record.sequence.load(std::memory_order_acquire);
+                if (seq != dequeue_pos_ + 1) {
+                    break;  // Next record not published yet
+                }
+
+                line.clear();
+                line += std::format("[{}] [{}] ", format_timestamp(record.timestamp), log_level_to_string(record.level));
+                if (record.structured) {
+                    // Deferred formatting: the slot holds a raw LogRecord
+                    LogRecord deferred;
+                    std::memcpy(&deferred, record.text, sizeof(deferred));
+                    line += deferred.render();
+                } else {
+                    line.append(record.text, record.length);
+                }
+                line += '\n';
+                sink_->write_formatted(line);
+
+                // Free the slot for the next lap
+                record.sequence.store(dequeue_pos_ + SLOT_COUNT, std::memory_order_release);
+                ++dequeue_pos_;
+                wrote = true;
+            }
+
+            if (auto dropped = dropped_.exchange(0, std::memory_order_relaxed); dropped > 0) {
+                sink_->write(LogLevel::WARNING, std::format("[Logger] Dropped {} log records (ring buffer full)", dropped));
+                wrote = true;
+            }
+
+            // Queue is empty: land the burst on disk, then publish how
+            // far durability reached so flush() callers can return
+            if (wrote) {
+                sink_->flush();
+            }
+            flushed_pos_.store(dequeue_pos_, std::memory_order_release);
+
+            if (stop_.load(std::memory_order_acquire)) {
+                return;
+            }
+
+            auto seen = wake_.load(std::memory_order_acquire);
+            if (ring_[dequeue_pos_ & (SLOT_COUNT - 1)].sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1) {
+                wake_.wait(seen);
+            }
+        }
+    }
+};
+
+// Global log output instances: producers enqueue into the async ring,
+// the drain thread writes through the file output. Declaration order
+// matters - the async output must be destroyed (drained) first.
 static FileLogOutput global_log_output("log/backend.log");
+static AsyncLogOutput global_async_output(&global_log_output);
 
 // Initialization function (call at the beginning of main())
 void initialize_logger() {
-    get_logger().set_output(&global_log_output);
+    get_logger().set_output(&global_async_output);
     get_logger().set_min_level(LogLevel::DEBUG);
 }
 
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <concepts>
 #include <cstdint>
+#include <cstring>
+#include <string>
 #include <string_view>
 
 namespace velocitydb {
@@ -18,6 +22,106 @@ enum class LogLevel : uint8_t {
     CRITICAL      ///< Critical error (system cannot continue)
 };
 
+/**
+ * @brief Deferred-formatting log record
+ *
+ * Captures the format string and the arguments by value into a small
+ * trivially-copyable record (type tags + binary payload) so that
+ * std::format never runs on the caller's thread; render() reconstructs
+ * the message wherever the record is consumed (e.g. the async drain
+ * thread).
+ *
+ * Only plain `{}` placeholders are substituted ({{ and }} escape as in
+ * std::format); format specs like {:.2f} are not supported here.
+ * Oversized format strings or payloads are truncated.
+ */
+class LogRecord {
+public:
+    /// Maximum captured arguments per record
+    static constexpr size_t MAX_ARGS = 8;
+    /// Format string capacity (characters)
+    static constexpr size_t MAX_FORMAT_CHARS = 160;
+    /// Argument payload capacity (bytes)
+    static constexpr size_t MAX_PAYLOAD_BYTES = 256;
+
+    /// Supported argument encodings
+    enum class ArgType : uint8_t { Int64, Uint64, Double, Bool, String };
+
+    /**
+     * @brief Capture a format string and arguments into a record
+     * @tparam Args Argument types (integral, floating-point, bool, string-like)
+     * @param fmt Format string with plain `{}` placeholders
+     * @param args Arguments, copied by value into the record
+     */
+    template <class... Args>
+    [[nodiscard]] static LogRecord capture(std::string_view fmt, const Args&... args) {
+        static_assert(sizeof...(Args) <= MAX_ARGS, "Too many log arguments");
+        LogRecord record;
+        record.fmt_length_ = static_cast<uint16_t>((std::min)(fmt.size(), MAX_FORMAT_CHARS));
+        std::memcpy(record.fmt_, fmt.data(), record.fmt_length_);
+        (record.encode(args), ...);
+        return record;
+    }
+
+    /**
+     * @brief Reconstruct the formatted message from the captured payload
+     */
+    [[nodiscard]] std::string render() const;
+
+private:
+    void encode(bool value) { encode_scalar(ArgType::Bool, &value, sizeof(value)); }
+
+    void encode(double value) { encode_scalar(ArgType::Double, &value, sizeof(value)); }
+
+    void encode(float value) { encode(static_cast<double>(value)); }
+
+    template <std::signed_integral T>
+    void encode(T value) {
+        auto widened = static_cast<int64_t>(value);
+        encode_scalar(ArgType::Int64, &widened, sizeof(widened));
+    }
+
+    template <std::unsigned_integral T>
+    void encode(T value) {
+        auto widened = static_cast<uint64_t>(value);
+        encode_scalar(ArgType::Uint64, &widened, sizeof(widened));
+    }
+
+    void encode(std::string_view value) {
+        if (arg_count_ >= MAX_ARGS || payload_size_ + sizeof(uint16_t) > MAX_PAYLOAD_BYTES) {
+            return;
+        }
+        auto length = static_cast<uint16_t>((std::min)(value.size(), MAX_PAYLOAD_BYTES - payload_size_ - sizeof(uint16_t)));
+        std::memcpy(&payload_[payload_size_], &length, sizeof(length));
+        payload_size_ += sizeof(length);
+        std::memcpy(&payload_[payload_size_], value.data(), length);
+        payload_size_ += length;
+        types_[arg_count_++] = ArgType::String;
+    }
+
+    void encode(const char* value) { encode(std::string_view(value)); }
+
+    void encode(const std::string& value) { encode(std::string_view(value)); }
+
+    void encode_scalar(ArgType type, const void* bytes, size_t size) {
+        if (arg_count_ >= MAX_ARGS || payload_size_ + size > MAX_PAYLOAD_BYTES) {
+            return;
+        }
+        std::memcpy(&payload_[payload_size_], bytes, size);
+        payload_size_ += static_cast<uint16_t>(size);
+        types_[arg_count_++] = type;
+    }
+
+    void append_argument(std::string& out, uint8_t index, size_t& cursor) const;
+
+    char fmt_[MAX_FORMAT_CHARS]{};
+    char payload_[MAX_PAYLOAD_BYTES]{};
+    uint16_t fmt_length_ = 0;
+    uint16_t payload_size_ = 0;
+    uint8_t arg_count_ = 0;
+    ArgType types_[MAX_ARGS]{};
+};
+
 /**
  * @brief Log output interface
  *
@@ -35,6 +139,18 @@ public:
      */
     virtual void write(LogLevel level, std::string_view message) = 0;
 
+    /**
+     * @brief Write a structured record
+     *
+     * The default renders immediately; asynchronous outputs override
+     * this to enqueue the raw record and defer formatting to their
+     * drain thread.
+     *
+     * @param level Log level
+     * @param record Captured record
+     */
+    virtual void write_record(LogLevel level, const LogRecord& record) { write(level, record.render()); }
+
     /**
      * @brief Flush buffer
      */
@@ -114,6 +230,43 @@ public:
         }
     }
 
+    /**
+     * @brief Structured log output with deferred formatting
+     *
+     * Arguments are captured by value into a LogRecord; formatting is
+     * deferred to the output (the async output renders on its drain
+     * thread). A filtered-out statement costs only the level check -
+     * no capture, no formatting.
+     *
+     * @tparam Level Log level
+     * @param fmt Format string with plain `{}` placeholders
+     * @param args Arguments (integral, floating-point, bool, string-like)
+     *
+     * @par Example
+     * @code
+     * logger.log<LogLevel::INFO>("Executed {} in {}ms", name, elapsed);
+     * @endcode
+     */
+    template <LogLevel Level, class... Args>
+        requires(sizeof...(Args) > 0)
+    void log(std::string_view fmt, const Args&... args) const {
+#ifdef _DEBUG
+        constexpr bool is_debug_build = true;
+#else
+        constexpr bool is_debug_build = false;
+#endif
+
+        if constexpr (Level == LogLevel::DEBUG && !is_debug_build) {
+            // DEBUG logs are completely removed in release builds
+            (void)fmt;
+            ((void)args, ...);
+        } else {
+            if (Level >= min_level_ && output_ != nullptr) {
+                output_->write_record(Level, LogRecord::capture(fmt, args...));
+            }
+        }
+    }
+
     /**
      * @brief Set minimum log level
      * @param level New minimum log level
@@ -212,6 +365,27 @@ void log(std::string_view message) {
     get_logger().log<Level>(message);
 }
 
+/**
+ * @brief Structured log output to global logger
+ *
+ * Captures arguments by value and defers formatting to the output;
+ * prefer this over log<Level>(std::format(...)) on hot paths.
+ *
+ * @tparam Level Log level
+ * @param fmt Format string with plain `{}` placeholders
+ * @param args Arguments (integral, floating-point, bool, string-like)
+ *
+ * @par Example
+ * @code
+ * log<LogLevel::DEBUG>("[IPC] dispatch {}", method);
+ * @endcode
+ */
+template <LogLevel Level, class... Args>
+    requires(sizeof...(Args) > 0)
+void log(std::string_view fmt, const Args&... args) {
+    get_logger().log<Level>(fmt, args...);
+}
+
 /**
  * @brief Flush global logger
  */
@@ -0,0 +1,122 @@
+#include "memory_budget.h"
+
+#include "logger.h"
+
+#include <format>
+
+namespace velocitydb {
+
+MemoryBudget::ScopedDelta::~ScopedDelta() {
+    if (delta != 0) {
+        MemoryBudget::instance().record(m_slot, delta);
+    }
+}
+
+MemoryBudget& MemoryBudget::instance() {
+    static MemoryBudget budget;
+    return budget;
+}
+
+size_t MemoryBudget::registerSubsystem(std::string name, Priority priority, ShrinkCallback shrink) {
+    std::lock_guard lock(m_registryMutex);
+    for (size_t i = 0; i < MAX_SUBSYSTEMS; ++i) {
+        auto& slot = m_subsystems[i];
+        if (slot.active.load(std::memory_order_relaxed)) {
+            continue;
+        }
+        slot.name = std::move(name);
+        slot.priority = priority;
+        slot.shrink = std::move(shrink);
+        slot.bytes.store(0, std::memory_order_relaxed);
+        slot.active.store(true, std::memory_order_relaxed);
+        return i;
+    }
+
+    // All slots taken - account nowhere rather than crash; record()
+    // ignores the out-of-range id
+    velocitydb::log<LogLevel::WARNING>("MemoryBudget: subsystem slots exhausted");
+    return MAX_SUBSYSTEMS;
+}
+
+void MemoryBudget::unregisterSubsystem(size_t id) {
+    if (id >= MAX_SUBSYSTEMS) [[unlikely]] {
+        return;
+    }
+
+    std::lock_guard lock(m_registryMutex);
+    auto& slot = m_subsystems[id];
+    m_totalBytes.fetch_sub(slot.bytes.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    slot.shrink = nullptr;
+    slot.active.store(false, std::memory_order_relaxed);
+}
+
+void MemoryBudget::record(size_t id, int64_t deltaBytes) {
+    if (id >= MAX_SUBSYSTEMS) [[unlikely]] {
+        return;
+    }
+
+    m_subsystems[id].bytes.fetch_add(deltaBytes, std::memory_order_relaxed);
+    const auto total = m_totalBytes.fetch_add(deltaBytes, std::memory_order_relaxed) + deltaBytes;
+    if (deltaBytes > 0 && total > static_cast<int64_t>(m_budgetBytes.load(std::memory_order_relaxed))) {
+        relievePressure();
+    }
+}
+
+void MemoryBudget::setBudgetBytes(size_t bytes) {
+    m_budgetBytes.store(bytes, std::memory_order_relaxed);
+    if (m_totalBytes.load(std::memory_order_relaxed) > static_cast<int64_t>(bytes)) {
+        relievePressure();
+    }
+}
+
+void MemoryBudget::relievePressure() {
+    if (m_relieving.exchange(true)) {
+        return;  // Another thread is already evicting
+    }
+
+    {
+        std::lock_guard lock(m_registryMutex);
+        for (auto priority : {Priority::Cache, Priority::ResultWindows}) {
+            for (auto& slot : m_subsystems) {
+                if (!slot.active.load(std::memory_order_relaxed) || slot.priority != priority || !slot.shrink) {
+                    continue;
+                }
+
+                const auto budget = static_cast<int64_t>(m_budgetBytes.load(std::memory_order_relaxed));
+                const auto total = m_totalBytes.load(std::memory_order_relaxed);
+                if (total <= budget) {
+                    m_relieving.store(false);
+                    return;
+                }
+
+                auto freed = slot.shrink(static_cast<size_t>(total - budget));
+                if (freed > 0) {
+                    velocitydb::log<LogLevel::DEBUG>(std::format("MemoryBudget: '{}' freed {} bytes under pressure", slot.name, freed));
+                }
+            }
+        }
+    }
+
+    m_relieving.store(false);
+}
+
+std::string MemoryBudget::snapshotJson() const {
+    std::string json = std::format(R"({{"budgetBytes":{},"totalBytes":{},"subsystems":{{)", budgetBytes(), totalBytes());
+
+    std::lock_guard lock(m_registryMutex);
+    bool first = true;
+    for (const auto& slot : m_subsystems) {
+        if (!slot.active.load(std::memory_order_relaxed)) {
+            continue;
+        }
+        if (!first) {
+            json += ',';
+        }
+        first = false;
+        json += std::format(R"("{}":{})", slot.name, slot.bytes.load(std::memory_order_relaxed));
+    }
+    json += "}}";
+    return json;
+}
+
+}  // namespace velocitydb
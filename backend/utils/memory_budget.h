@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace velocitydb {
+
+/// Central memory accountant. Subsystems register once with an eviction
+/// priority and a shrink callback, then report allocation deltas through
+/// record() - a relaxed atomic add, safe from any thread. When a positive
+/// delta pushes the process total over the configured budget, the shrink
+/// callbacks run in priority order (caches first, then retained result
+/// windows) until the total is back under; Pinned subsystems only
+/// account and are never asked to shrink.
+class MemoryBudget {
+public:
+    enum class Priority : uint8_t { Cache = 0, ResultWindows = 1, Pinned = 2 };
+
+    /// Frees up to bytesWanted and returns the bytes actually freed. Runs
+    /// on whichever thread crossed the budget; it must not call back into
+    /// registerSubsystem or unregisterSubsystem.
+    using ShrinkCallback = std::function<size_t(size_t bytesWanted)>;
+
+    static constexpr size_t MAX_SUBSYSTEMS = 16;
+    static constexpr size_t DEFAULT_BUDGET_BYTES = size_t{1536} * 1024 * 1024;
+
+    /// Flushes an accounting delta when it goes out of scope. Declare one
+    /// BEFORE taking a subsystem's own lock: a positive delta can trigger
+    /// that subsystem's shrink callback, which would self-deadlock if the
+    /// lock were still held.
+    class ScopedDelta {
+    public:
+        explicit ScopedDelta(size_t slot) noexcept : m_slot(slot) {}
+        ~ScopedDelta();
+
+        ScopedDelta(const ScopedDelta&) = delete;
+        ScopedDelta& operator=(const ScopedDelta&) = delete;
+
+        int64_t delta = 0;
+
+    private:
+        size_t m_slot;
+    };
+
+    [[nodiscard]] static MemoryBudget& instance();
+
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+    /// Returns the slot id to pass to record(); inactive slots are reused
+    [[nodiscard]] size_t registerSubsystem(std::string name, Priority priority, ShrinkCallback shrink);
+
+    /// Releases the slot and removes its bytes from the process total
+    void unregisterSubsystem(size_t id);
+
+    /// Reports an allocation (positive) or release (negative); crossing
+    /// the budget on a positive delta triggers pressure relief inline
+    void record(size_t id, int64_t deltaBytes);
+
+    /// Lowering the budget below the current total evicts immediately
+    void setBudgetBytes(size_t bytes);
+    [[nodiscard]] size_t budgetBytes() const noexcept { return m_budgetBytes.load(std::memory_order_relaxed); }
+    [[nodiscard]] int64_t totalBytes() const noexcept { return m_totalBytes.load(std::memory_order_relaxed); }
+
+    /// {"budgetBytes":N,"totalBytes":N,"subsystems":{"name":bytes,...}}
+    [[nodiscard]] std::string snapshotJson() const;
+
+private:
+    MemoryBudget() = default;
+
+    void relievePressure();
+
+    struct Subsystem {
+        std::string name;
+        Priority priority = Priority::Pinned;
+        ShrinkCallback shrink;
+        std::atomic<int64_t> bytes{0};
+        std::atomic<bool> active{false};
+    };
+
+    std::atomic<size_t> m_budgetBytes{DEFAULT_BUDGET_BYTES};
+    std::atomic<int64_t> m_totalBytes{0};
+    // One relief pass at a time; concurrent crossers skip rather than pile up
+    std::atomic<bool> m_relieving{false};
+
+    // Fixed slots so record() indexes without a lock; the mutex guards
+    // registration and the pressure walk
+    mutable std::mutex m_registryMutex;
+    std::array<Subsystem, MAX_SUBSYSTEMS> m_subsystems;
+};
+
+}  // namespace velocitydb
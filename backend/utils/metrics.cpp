@@ -0,0 +1,87 @@
+#include "metrics.h"
+
+#include <format>
+#include <mutex>
+
+namespace velocitydb {
+
+std::string LatencyHistogram::snapshotJson() const {
+    // Relaxed loads: the snapshot is advisory, slight skew between the
+    // counters during a concurrent record() is acceptable
+    std::array<uint64_t, BUCKET_COUNT> buckets{};
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+    }
+    const auto count = m_count.load(std::memory_order_relaxed);
+    const auto sumUs = m_sumUs.load(std::memory_order_relaxed);
+
+    const auto avgUs = count > 0 ? static_cast<double>(sumUs) / static_cast<double>(count) : 0.0;
+    return std::format(R"({{"count":{},"avgUs":{:.1f},"p50Us":{},"p95Us":{},"p99Us":{}}})", count, avgUs, percentileUpperBoundUs(buckets, count, 0.50), percentileUpperBoundUs(buckets, count, 0.95),
+                       percentileUpperBoundUs(buckets, count, 0.99));
+}
+
+uint64_t LatencyHistogram::percentileUpperBoundUs(const std::array<uint64_t, BUCKET_COUNT>& buckets, uint64_t count, double quantile) const noexcept {
+    if (count == 0) {
+        return 0;
+    }
+
+    const auto target = static_cast<uint64_t>(static_cast<double>(count) * quantile);
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        cumulative += buckets[i];
+        if (cumulative > target) {
+            // Bucket i holds [2^(i-1), 2^i); report the upper bound
+            return uint64_t{1} << i;
+        }
+    }
+    return uint64_t{1} << (BUCKET_COUNT - 1);
+}
+
+Metrics& Metrics::instance() {
+    static Metrics metrics;
+    return metrics;
+}
+
+LatencyHistogram& Metrics::ipcMethod(std::string_view method) {
+    {
+        std::shared_lock lock(m_ipcMutex);
+        if (auto it = m_ipcMethods.find(method); it != m_ipcMethods.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(m_ipcMutex);
+    return m_ipcMethods[std::string(method)];
+}
+
+std::string Metrics::snapshotJson() const {
+    std::string json = "{";
+    json += std::format(R"("cacheHits":{},"cacheMisses":{},)", m_cacheHits.load(std::memory_order_relaxed), m_cacheMisses.load(std::memory_order_relaxed));
+
+    const auto hits = m_cacheHits.load(std::memory_order_relaxed);
+    const auto misses = m_cacheMisses.load(std::memory_order_relaxed);
+    const auto total = hits + misses;
+    json += std::format(R"("cacheHitRatio":{:.3f},)", total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0);
+
+    json += std::format(R"("asyncQueueDepth":{},)", m_asyncQueueDepth.load(std::memory_order_relaxed));
+
+    json += std::format(R"("queryExecute":{},"queryFetch":{},"serialize":{},"poolAcquire":{},)", m_queryExecute.snapshotJson(), m_queryFetch.snapshotJson(), m_serialize.snapshotJson(),
+                        m_poolAcquire.snapshotJson());
+
+    json += R"("ipcMethods":{)";
+    {
+        std::shared_lock lock(m_ipcMutex);
+        bool first = true;
+        for (const auto& [method, histogram] : m_ipcMethods) {
+            if (!first) {
+                json += ',';
+            }
+            first = false;
+            json += std::format(R"("{}":{})", method, histogram.snapshotJson());
+        }
+    }
+    json += "}}";
+    return json;
+}
+
+}  // namespace velocitydb
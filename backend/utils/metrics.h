@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+
+namespace velocitydb {
+
+/// Fixed power-of-two bucket latency histogram. record() is three relaxed
+/// atomic increments - safe from any thread, no lock, no allocation - and
+/// snapshots approximate percentiles from the bucket counts (a percentile
+/// reports its bucket's upper bound, so worst-case error is 2x at the
+/// resolution of interest).
+class LatencyHistogram {
+public:
+    // Bucket i counts samples in [2^(i-1), 2^i) microseconds; the last
+    // bucket absorbs everything from ~67s up
+    static constexpr size_t BUCKET_COUNT = 28;
+
+    void record(int64_t durationUs) noexcept {
+        const auto clamped = static_cast<uint64_t>((std::max)(durationUs, int64_t{0}));
+        const auto bucket = (std::min)(static_cast<size_t>(std::bit_width(clamped)), BUCKET_COUNT - 1);
+        m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sumUs.fetch_add(clamped, std::memory_order_relaxed);
+    }
+
+    /// {"count":N,"avgUs":x,"p50Us":y,"p95Us":z,"p99Us":w}
+    [[nodiscard]] std::string snapshotJson() const;
+
+private:
+    [[nodiscard]] uint64_t percentileUpperBoundUs(const std::array<uint64_t, BUCKET_COUNT>& buckets, uint64_t count, double quantile) const noexcept;
+
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_buckets{};
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<uint64_t> m_sumUs{0};
+};
+
+/// Process-wide performance metrics, updated with relaxed atomics on the
+/// hot path and snapshotted on request through getCacheStats. Fixed
+/// histograms cover the query pipeline (ODBC execute, fetch, result
+/// serialization, pool acquire); per-IPC-method histograms are created
+/// lazily on first dispatch and live forever, so the read path is a
+/// shared-lock map lookup.
+class Metrics {
+public:
+    [[nodiscard]] static Metrics& instance();
+
+    Metrics(const Metrics&) = delete;
+    Metrics& operator=(const Metrics&) = delete;
+
+    /// Latency histogram for one IPC method (created on first use)
+    [[nodiscard]] LatencyHistogram& ipcMethod(std::string_view method);
+
+    [[nodiscard]] LatencyHistogram& queryExecute() noexcept { return m_queryExecute; }
+    [[nodiscard]] LatencyHistogram& queryFetch() noexcept { return m_queryFetch; }
+    [[nodiscard]] LatencyHistogram& serialize() noexcept { return m_serialize; }
+    [[nodiscard]] LatencyHistogram& poolAcquire() noexcept { return m_poolAcquire; }
+
+    void recordCacheHit() noexcept { m_cacheHits.fetch_add(1, std::memory_order_relaxed); }
+    void recordCacheMiss() noexcept { m_cacheMisses.fetch_add(1, std::memory_order_relaxed); }
+
+    void incrementQueueDepth() noexcept { m_asyncQueueDepth.fetch_add(1, std::memory_order_relaxed); }
+    void decrementQueueDepth() noexcept { m_asyncQueueDepth.fetch_sub(1, std::memory_order_relaxed); }
+
+    /// One JSON object with every counter and histogram
+    [[nodiscard]] std::string snapshotJson() const;
+
+private:
+    Metrics() = default;
+
+    LatencyHistogram m_queryExecute;
+    LatencyHistogram m_queryFetch;
+    LatencyHistogram m_serialize;
+    LatencyHistogram m_poolAcquire;
+
+    std::atomic<uint64_t> m_cacheHits{0};
+    std::atomic<uint64_t> m_cacheMisses{0};
+    std::atomic<int64_t> m_asyncQueueDepth{0};
+
+    // std::map keeps node addresses stable, so a reference handed out
+    // under the shared lock stays valid across later insertions
+    mutable std::shared_mutex m_ipcMutex;
+    std::map<std::string, LatencyHistogram, std::less<>> m_ipcMethods;
+};
+
+}  // namespace velocitydb
@@ -0,0 +1,15 @@
+#include "response_arena.h"
+
+namespace velocitydb {
+
+std::string& ResponseArena::acquire() {
+    static thread_local std::string arena;
+
+    if (arena.capacity() > MAX_RETAINED_BYTES) {
+        arena = std::string{};
+    }
+    arena.clear();
+    return arena;
+}
+
+}  // namespace velocitydb
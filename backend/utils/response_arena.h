@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+namespace velocitydb {
+
+/// Per-thread grow-only buffer for IPC response building.
+///
+/// Every dispatch used to allocate fresh strings for the serialized result
+/// and the response envelope, then free them — under sustained grid
+/// scrolling the allocator, not ODBC, topped the profiles. The arena keeps
+/// one buffer per thread whose capacity survives across requests: acquire()
+/// hands it back emptied, so steady-state response building reallocates
+/// nothing and only the final copy out to the IPC reply remains.
+///
+/// The reference stays valid until the same thread's next acquire(), which
+/// cannot happen before the response has been copied out — handlers run to
+/// completion on their dispatch thread.
+class ResponseArena {
+public:
+    /// Returns the calling thread's arena, cleared but with capacity kept.
+    /// A buffer left oversized by an exceptional response (past 16MB) is
+    /// released first so one huge result does not pin memory forever.
+    [[nodiscard]] static std::string& acquire();
+
+private:
+    // Covers any realistic grid page; larger responses come from full-result
+    // fetches that are rare enough to re-grow on demand
+    static constexpr size_t MAX_RETAINED_BYTES = 16 * 1024 * 1024;
+};
+
+}  // namespace velocitydb
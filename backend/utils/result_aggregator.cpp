@@ -0,0 +1,146 @@
+#include "result_aggregator.h"
+
+#include "simd_filter.h"
+
+#include <algorithm>
+#include <charconv>
+#include <unordered_map>
+#include <unordered_set>
+
+#ifdef _MSC_VER
+#include <immintrin.h>
+#endif
+
+namespace velocitydb {
+
+namespace {
+
+// Full-string numeric parse; partial parses ("12abc") do not count
+[[nodiscard]] bool parseNumber(std::string_view text, double& value) {
+    if (text.empty()) {
+        return false;
+    }
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return ec == std::errc{} && end == text.data() + text.size();
+}
+
+// Accumulates sum/min/max over a contiguous double array, four lanes per
+// AVX2 step with a horizontal reduce at the end
+void accumulate(const std::vector<double>& values, double& sum, double& minimum, double& maximum) {
+    sum = 0.0;
+    minimum = values.front();
+    maximum = values.front();
+    size_t i = 0;
+
+#ifdef _MSC_VER
+    if (SIMDFilter::isAVX2Available() && values.size() >= 4) {
+        __m256d sumVec = _mm256_setzero_pd();
+        __m256d minVec = _mm256_set1_pd(values.front());
+        __m256d maxVec = minVec;
+        for (; i + 4 <= values.size(); i += 4) {
+            __m256d chunk = _mm256_loadu_pd(values.data() + i);
+            sumVec = _mm256_add_pd(sumVec, chunk);
+            minVec = _mm256_min_pd(minVec, chunk);
+            maxVec = _mm256_max_pd(maxVec, chunk);
+        }
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, sumVec);
+        sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        _mm256_store_pd(lanes, minVec);
+        minimum = (std::min)({lanes[0], lanes[1], lanes[2], lanes[3]});
+        _mm256_store_pd(lanes, maxVec);
+        maximum = (std::max)({lanes[0], lanes[1], lanes[2], lanes[3]});
+    }
+#endif
+
+    for (; i < values.size(); ++i) {
+        sum += values[i];
+        minimum = (std::min)(minimum, values[i]);
+        maximum = (std::max)(maximum, values[i]);
+    }
+}
+
+}  // namespace
+
+ColumnStatistics ResultAggregator::columnStatistics(const ResultSet& data, size_t columnIndex) const {
+    ColumnStatistics stats{.rowCount = data.rows.size()};
+
+    // Distinct values view into the cells; the strings outlive the call
+    std::unordered_set<std::string_view> distinct;
+    distinct.reserve(data.rows.size() / 4);
+
+    std::vector<double> values;
+    values.reserve(data.rows.size());
+    bool allNumeric = true;
+
+    for (const auto& row : data.rows) {
+        if (columnIndex >= row.values.size()) {
+            continue;
+        }
+        const auto& cellValue = row.values[columnIndex];
+        if (cellValue.empty()) {
+            continue;  // Null cell: excluded from counts and accumulators
+        }
+        ++stats.nonNullCount;
+        distinct.insert(cellValue);
+
+        double parsed = 0.0;
+        if (allNumeric && parseNumber(cellValue, parsed)) {
+            values.push_back(parsed);
+        } else {
+            allNumeric = false;
+        }
+    }
+
+    stats.distinctCount = distinct.size();
+    stats.numeric = allNumeric && !values.empty();
+    if (stats.numeric) {
+        accumulate(values, stats.sum, stats.minimum, stats.maximum);
+        stats.average = stats.sum / static_cast<double>(values.size());
+    }
+    return stats;
+}
+
+std::vector<GroupAggregate> ResultAggregator::groupBy(const ResultSet& data, size_t keyColumn, size_t valueColumn) const {
+    struct Accumulator {
+        GroupAggregate group;
+        bool hasValue = false;
+    };
+    std::unordered_map<std::string_view, Accumulator> groups;
+    groups.reserve(data.rows.size() / 4);
+
+    for (const auto& row : data.rows) {
+        if (keyColumn >= row.values.size()) {
+            continue;
+        }
+        const auto& key = row.values[keyColumn];
+        auto [entry, inserted] = groups.try_emplace(key);
+        auto& accumulator = entry->second;
+        if (inserted) {
+            accumulator.group.key = key;
+        }
+        ++accumulator.group.count;
+
+        double parsed = 0.0;
+        if (valueColumn < row.values.size() && parseNumber(row.values[valueColumn], parsed)) {
+            accumulator.group.sum += parsed;
+            if (!accumulator.hasValue || parsed < accumulator.group.minimum) {
+                accumulator.group.minimum = parsed;
+            }
+            if (!accumulator.hasValue || parsed > accumulator.group.maximum) {
+                accumulator.group.maximum = parsed;
+            }
+            accumulator.hasValue = true;
+        }
+    }
+
+    std::vector<GroupAggregate> result;
+    result.reserve(groups.size());
+    for (auto& [key, accumulator] : groups) {
+        result.push_back(std::move(accumulator.group));
+    }
+    std::ranges::sort(result, [](const GroupAggregate& a, const GroupAggregate& b) { return a.count != b.count ? a.count > b.count : a.key < b.key; });
+    return result;
+}
+
+}  // namespace velocitydb
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "../database/sqlserver_driver.h"
+
+#include <string>
+#include <vector>
+
+namespace velocitydb {
+
+/// Summary statistics for one result column. Empty cells count as nulls
+/// and are excluded from the numeric accumulators; `numeric` is true only
+/// when every non-null cell parsed as a number.
+struct ColumnStatistics {
+    size_t rowCount = 0;
+    size_t nonNullCount = 0;
+    size_t distinctCount = 0;
+    bool numeric = false;
+    double sum = 0.0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    double average = 0.0;
+};
+
+/// One group of a group-by aggregation: the key value plus COUNT and,
+/// when the value column is numeric, SUM/MIN/MAX over the group
+struct GroupAggregate {
+    std::string key;
+    size_t count = 0;
+    double sum = 0.0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+};
+
+/// Aggregation over loaded result sets for the stats panel. Lives in the
+/// backend beside SIMDFilter because the accumulation has to stay
+/// interactive on millions of rows, which rules out doing it per-cell in
+/// TypeScript across the IPC boundary.
+class ResultAggregator {
+public:
+    ResultAggregator() = default;
+    ~ResultAggregator() = default;
+
+    // SUM/COUNT/AVG/MIN/MAX plus distinct count for a single column,
+    // accumulated with AVX2 kernels when the column is numeric
+    [[nodiscard]] ColumnStatistics columnStatistics(const ResultSet& data, size_t columnIndex) const;
+
+    // Groups rows by the key column and aggregates the value column per
+    // group, ordered by descending count then key
+    [[nodiscard]] std::vector<GroupAggregate> groupBy(const ResultSet& data, size_t keyColumn, size_t valueColumn) const;
+};
+
+}  // namespace velocitydb
@@ -0,0 +1,126 @@
+#include "result_diff.h"
+
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace velocitydb {
+
+namespace {
+
+/// FNV-1a over the selected cells with a separator byte per cell, so
+/// ("ab","c") and ("a","bc") hash differently. Collisions are tolerated:
+/// hash buckets are verified cell-by-cell before rows are paired.
+[[nodiscard]] uint64_t hashCells(const ResultRow& row, const std::vector<size_t>& columns) {
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    uint64_t hash = FNV_OFFSET;
+    const auto mix = [&hash](std::string_view cell) {
+        for (const char c : cell) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= FNV_PRIME;
+        }
+        hash ^= 0xFFu;  // Cell boundary
+        hash *= FNV_PRIME;
+    };
+
+    if (columns.empty()) {
+        for (const auto& cell : row.values) {
+            mix(cell);
+        }
+    } else {
+        for (const auto column : columns) {
+            mix(row.values[column]);
+        }
+    }
+    return hash;
+}
+
+[[nodiscard]] bool cellsEqual(const ResultRow& left, const ResultRow& right, const std::vector<size_t>& columns) {
+    if (columns.empty()) {
+        return left.values == right.values;
+    }
+    for (const auto column : columns) {
+        if (std::string_view(left.values[column]) != std::string_view(right.values[column])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+ResultDiffSummary ResultDiffer::diff(const ResultSet& before, const ResultSet& after, const std::vector<size_t>& keyColumns) const {
+    if (before.columns.size() != after.columns.size()) {
+        throw std::invalid_argument("Result sets have different column counts");
+    }
+    for (const auto column : keyColumns) {
+        if (column >= before.columns.size()) {
+            throw std::invalid_argument("Key column index out of range");
+        }
+    }
+
+    // One pass over "before" builds key-hash buckets; each bucket keeps
+    // its row indexes in order so duplicate keys pair up deterministically
+    std::unordered_map<uint64_t, std::vector<size_t>> beforeByKey;
+    beforeByKey.reserve(before.rows.size());
+    for (size_t row = 0; row < before.rows.size(); ++row) {
+        beforeByKey[hashCells(before.rows[row], keyColumns)].push_back(row);
+    }
+
+    ResultDiffSummary summary;
+    std::vector<bool> beforeMatched(before.rows.size(), false);
+
+    for (size_t afterRow = 0; afterRow < after.rows.size(); ++afterRow) {
+        const auto bucket = beforeByKey.find(hashCells(after.rows[afterRow], keyColumns));
+
+        size_t matchedBefore = before.rows.size();  // Sentinel: no match
+        if (bucket != beforeByKey.end()) {
+            for (const auto beforeRow : bucket->second) {
+                if (!beforeMatched[beforeRow] && cellsEqual(before.rows[beforeRow], after.rows[afterRow], keyColumns)) {
+                    matchedBefore = beforeRow;
+                    break;
+                }
+            }
+        }
+
+        if (matchedBefore == before.rows.size()) {
+            summary.addedRows.push_back(afterRow);
+            continue;
+        }
+        beforeMatched[matchedBefore] = true;
+
+        // Whole-row keys already compared every cell; with explicit keys
+        // the non-key columns decide changed versus unchanged
+        if (keyColumns.empty()) {
+            ++summary.unchangedRows;
+            continue;
+        }
+
+        std::vector<size_t> changedColumns;
+        const auto& beforeValues = before.rows[matchedBefore].values;
+        const auto& afterValues = after.rows[afterRow].values;
+        for (size_t column = 0; column < beforeValues.size(); ++column) {
+            if (std::string_view(beforeValues[column]) != std::string_view(afterValues[column])) {
+                changedColumns.push_back(column);
+            }
+        }
+
+        if (changedColumns.empty()) {
+            ++summary.unchangedRows;
+        } else {
+            summary.changedRows.push_back({.beforeRow = matchedBefore, .afterRow = afterRow, .changedColumns = std::move(changedColumns)});
+        }
+    }
+
+    for (size_t beforeRow = 0; beforeRow < before.rows.size(); ++beforeRow) {
+        if (!beforeMatched[beforeRow]) {
+            summary.removedRows.push_back(beforeRow);
+        }
+    }
+
+    return summary;
+}
+
+}  // namespace velocitydb
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "../database/sqlserver_driver.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace velocitydb {
+
+/// Outcome of diffing two result sets. Row indexes refer to the input
+/// sets: addedRows index into "after", removedRows into "before", and a
+/// ChangedRow pairs the matched rows and lists the columns that differ.
+struct ResultDiffSummary {
+    struct ChangedRow {
+        size_t beforeRow = 0;
+        size_t afterRow = 0;
+        std::vector<size_t> changedColumns;
+    };
+
+    std::vector<size_t> addedRows;
+    std::vector<size_t> removedRows;
+    std::vector<ChangedRow> changedRows;
+    size_t unchangedRows = 0;
+};
+
+/// Hash-based diff over two loaded ResultSets for release validation
+/// (same query before and after a deployment). Lives in the backend
+/// beside ResultAggregator because hashing millions of rows has to stay
+/// in C++; the previous workflow exported both sets to CSV and diffed
+/// them externally, minutes instead of seconds.
+class ResultDiffer {
+public:
+    ResultDiffer() = default;
+    ~ResultDiffer() = default;
+
+    /// Diffs "before" against "after". keyColumns identify a row across
+    /// the two sets; matched rows are compared cell by cell to classify
+    /// them as changed or unchanged. An empty key list hashes whole rows,
+    /// in which case a modified row reports as one removed plus one added.
+    /// Duplicate keys pair up in row order. Both sets must have the same
+    /// column count; key indexes must be in range.
+    [[nodiscard]] ResultDiffSummary diff(const ResultSet& before, const ResultSet& after, const std::vector<size_t>& keyColumns = {}) const;
+};
+
+}  // namespace velocitydb
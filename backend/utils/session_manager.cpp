@@ -5,6 +5,8 @@
 
 #include <Windows.h>
 
+#include <algorithm>
+#include <cctype>
 #include <format>
 #include <fstream>
 #include <sstream>
@@ -13,6 +15,15 @@
 
 namespace velocitydb {
 
+namespace {
+
+// Quiet period after the last requestSave() before the flush thread
+// writes. Long enough to coalesce a typing burst, short enough that a
+// crash loses at most a moment of work.
+constexpr auto SAVE_DEBOUNCE = std::chrono::milliseconds(500);
+
+}  // namespace
+
 SessionManager::SessionManager() {
     // Get AppData\Local path
     wchar_t* localAppData = nullptr;
@@ -23,8 +34,27 @@ SessionManager::SessionManager() {
         m_sessionPath = std::filesystem::current_path() / ".velocitydb";
     }
 
-    std::filesystem::create_directories(m_sessionPath);
+    m_tabsDir = m_sessionPath / "tabs";
+
+    std::error_code ec;
+    std::filesystem::create_directories(m_tabsDir, ec);
     m_sessionPath /= "session.json";
+
+    m_flushThread = std::thread(&SessionManager::flushLoop, this);
+}
+
+SessionManager::~SessionManager() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopFlush = true;
+    }
+    m_flushCv.notify_all();
+    if (m_flushThread.joinable()) {
+        m_flushThread.join();
+    }
+
+    // Final flush so nothing pending is lost on shutdown
+    save();
 }
 
 bool SessionManager::load() {
@@ -41,38 +71,148 @@ bool SessionManager::load() {
 
     std::stringstream buffer;
     buffer << file.rdbuf();
-    return deserializeSession(buffer.str());
+
+    std::vector<std::string> tabIds;
+    if (!deserializeMeta(buffer.str(), tabIds)) {
+        return false;
+    }
+
+    // openTabIds fallback (intermediate format without inline metadata):
+    // the per-tab files must be read for their titles, so these tabs
+    // restore eagerly. A missing or corrupt tab file drops that tab
+    // rather than the whole session.
+    for (const auto& tabId : tabIds) {
+        std::ifstream tabFile(tabFilePath(tabId));
+        if (!tabFile.is_open()) {
+            continue;
+        }
+        std::stringstream tabBuffer;
+        tabBuffer << tabFile.rdbuf();
+        if (EditorTab tab; deserializeTab(tabBuffer.str(), tab)) {
+            m_state.openTabs.push_back(std::move(tab));
+        }
+    }
+
+    // Only the focused tab needs its content for first paint; the rest
+    // stream in on focus via loadTabContent()
+    if (!m_state.activeTabId.empty()) {
+        loadTabContentLocked(m_state.activeTabId);
+    }
+
+    return true;
 }
 
-bool SessionManager::save() {
+std::optional<std::string> SessionManager::loadTabContent(const std::string& tabId) {
     std::lock_guard lock(m_mutex);
+    return loadTabContentLocked(tabId);
+}
 
-    m_state.lastSaved = std::chrono::system_clock::now();
+std::optional<std::string> SessionManager::loadTabContentLocked(const std::string& tabId) {
+    auto tab = std::ranges::find_if(m_state.openTabs, [&tabId](const EditorTab& t) { return t.id == tabId; });
+    if (tab == m_state.openTabs.end()) {
+        return std::nullopt;
+    }
+    if (tab->contentLoaded) {
+        return tab->content;
+    }
 
-    std::ofstream file(m_sessionPath);
-    if (!file.is_open()) {
-        return false;
+    std::ifstream file(tabFilePath(tabId));
+    if (file.is_open()) {
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        if (EditorTab loaded; deserializeTab(buffer.str(), loaded)) {
+            tab->content = std::move(loaded.content);
+        }
     }
 
-    file << serializeSession();
-    return file.good();
+    // A missing or corrupt tab file restores as empty rather than
+    // re-reading on every focus
+    tab->contentLoaded = true;
+    return tab->content;
+}
+
+bool SessionManager::save() {
+    std::lock_guard lock(m_mutex);
+    return flushLocked();
+}
+
+void SessionManager::requestSave() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_flushDeadline = std::chrono::steady_clock::now() + SAVE_DEBOUNCE;
+        m_flushRequested = true;
+    }
+    m_flushCv.notify_all();
 }
 
 void SessionManager::updateState(const SessionState& state) {
     std::lock_guard lock(m_mutex);
-    m_state = state;
+
+    SessionState incoming = state;
+
+    // A tab whose content was never streamed to the frontend comes back
+    // without it; keep what we have instead of clobbering the file
+    for (auto& tab : incoming.openTabs) {
+        if (tab.contentLoaded) {
+            continue;
+        }
+        auto existing = std::ranges::find_if(m_state.openTabs, [&tab](const EditorTab& t) { return t.id == tab.id; });
+        if (existing != m_state.openTabs.end()) {
+            tab.content = existing->content;
+            tab.contentLoaded = existing->contentLoaded;
+        }
+    }
+
+    // Diff against the current state so an unchanged tab costs nothing
+    // on the next flush
+    for (const auto& tab : incoming.openTabs) {
+        auto existing = std::ranges::find_if(m_state.openTabs, [&tab](const EditorTab& t) { return t.id == tab.id; });
+        if (existing == m_state.openTabs.end() || existing->content != tab.content || existing->title != tab.title || existing->filePath != tab.filePath || existing->isDirty != tab.isDirty ||
+            existing->cursorLine != tab.cursorLine || existing->cursorColumn != tab.cursorColumn) {
+            m_dirtyTabIds.insert(tab.id);
+            m_removedTabIds.erase(tab.id);
+        }
+    }
+    for (const auto& tab : m_state.openTabs) {
+        if (std::ranges::none_of(incoming.openTabs, [&tab](const EditorTab& t) { return t.id == tab.id; })) {
+            m_removedTabIds.insert(tab.id);
+            m_dirtyTabIds.erase(tab.id);
+        }
+    }
+
+    auto sameTabOrder =
+        m_state.openTabs.size() == incoming.openTabs.size() && std::ranges::equal(m_state.openTabs, incoming.openTabs, [](const EditorTab& a, const EditorTab& b) { return a.id == b.id; });
+    if (!sameTabOrder || m_state.activeConnectionId != incoming.activeConnectionId || m_state.activeTabId != incoming.activeTabId || m_state.expandedTreeNodes != incoming.expandedTreeNodes ||
+        m_state.windowX != incoming.windowX || m_state.windowY != incoming.windowY || m_state.windowWidth != incoming.windowWidth || m_state.windowHeight != incoming.windowHeight ||
+        m_state.isMaximized != incoming.isMaximized || m_state.leftPanelWidth != incoming.leftPanelWidth || m_state.bottomPanelHeight != incoming.bottomPanelHeight) {
+        m_metaDirty = true;
+    }
+
+    m_state = std::move(incoming);
 }
 
 void SessionManager::addTab(const EditorTab& tab) {
     std::lock_guard lock(m_mutex);
     m_state.openTabs.push_back(tab);
+    m_dirtyTabIds.insert(tab.id);
+    m_removedTabIds.erase(tab.id);
+    m_metaDirty = true;
 }
 
 void SessionManager::updateTab(const EditorTab& tab) {
     std::lock_guard lock(m_mutex);
     for (auto& existing : m_state.openTabs) {
         if (existing.id == tab.id) {
-            existing = tab;
+            EditorTab merged = tab;
+            if (!merged.contentLoaded) {
+                merged.content = existing.content;
+                merged.contentLoaded = existing.contentLoaded;
+            }
+            if (existing.content != merged.content || existing.title != merged.title || existing.filePath != merged.filePath || existing.isDirty != merged.isDirty ||
+                existing.cursorLine != merged.cursorLine || existing.cursorColumn != merged.cursorColumn) {
+                m_dirtyTabIds.insert(merged.id);
+            }
+            existing = std::move(merged);
             return;
         }
     }
@@ -81,37 +221,58 @@ void SessionManager::updateTab(const EditorTab& tab) {
 void SessionManager::removeTab(const std::string& tabId) {
     std::lock_guard lock(m_mutex);
     auto& tabs = m_state.openTabs;
-    tabs.erase(std::remove_if(tabs.begin(), tabs.end(), [&tabId](const EditorTab& t) { return t.id == tabId; }), tabs.end());
+    auto removed = std::remove_if(tabs.begin(), tabs.end(), [&tabId](const EditorTab& t) { return t.id == tabId; });
+    if (removed != tabs.end()) {
+        tabs.erase(removed, tabs.end());
+        m_removedTabIds.insert(tabId);
+        m_dirtyTabIds.erase(tabId);
+        m_metaDirty = true;
+    }
 }
 
 void SessionManager::setActiveTab(const std::string& tabId) {
     std::lock_guard lock(m_mutex);
-    m_state.activeTabId = tabId;
+    if (m_state.activeTabId != tabId) {
+        m_state.activeTabId = tabId;
+        m_metaDirty = true;
+    }
 }
 
 void SessionManager::updateWindowState(int x, int y, int width, int height, bool maximized) {
     std::lock_guard lock(m_mutex);
-    m_state.windowX = x;
-    m_state.windowY = y;
-    m_state.windowWidth = width;
-    m_state.windowHeight = height;
-    m_state.isMaximized = maximized;
+    if (m_state.windowX != x || m_state.windowY != y || m_state.windowWidth != width || m_state.windowHeight != height || m_state.isMaximized != maximized) {
+        m_state.windowX = x;
+        m_state.windowY = y;
+        m_state.windowWidth = width;
+        m_state.windowHeight = height;
+        m_state.isMaximized = maximized;
+        m_metaDirty = true;
+    }
 }
 
 void SessionManager::updatePanelSizes(int leftWidth, int bottomHeight) {
     std::lock_guard lock(m_mutex);
-    m_state.leftPanelWidth = leftWidth;
-    m_state.bottomPanelHeight = bottomHeight;
+    if (m_state.leftPanelWidth != leftWidth || m_state.bottomPanelHeight != bottomHeight) {
+        m_state.leftPanelWidth = leftWidth;
+        m_state.bottomPanelHeight = bottomHeight;
+        m_metaDirty = true;
+    }
 }
 
 void SessionManager::setActiveConnection(const std::string& connectionId) {
     std::lock_guard lock(m_mutex);
-    m_state.activeConnectionId = connectionId;
+    if (m_state.activeConnectionId != connectionId) {
+        m_state.activeConnectionId = connectionId;
+        m_metaDirty = true;
+    }
 }
 
 void SessionManager::setExpandedNodes(const std::vector<std::string>& nodeIds) {
     std::lock_guard lock(m_mutex);
-    m_state.expandedTreeNodes = nodeIds;
+    if (m_state.expandedTreeNodes != nodeIds) {
+        m_state.expandedTreeNodes = nodeIds;
+        m_metaDirty = true;
+    }
 }
 
 void SessionManager::enableAutoSave(int intervalSeconds) {
@@ -127,7 +288,74 @@ std::filesystem::path SessionManager::getSessionPath() const {
     return m_sessionPath;
 }
 
-std::string SessionManager::serializeSession() const {
+std::filesystem::path SessionManager::tabFilePath(const std::string& tabId) const {
+    // Tab ids come from the frontend; keep only filename-safe characters
+    std::string safeName = tabId;
+    std::ranges::replace_if(safeName, [](char c) { return !std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_'; }, '_');
+    return m_tabsDir / (safeName + ".json");
+}
+
+bool SessionManager::flushLocked() {
+    bool ok = true;
+
+    // Changed tabs: one small file each. A tab whose content was never
+    // loaded can't have changed on disk, so it's never rewritten.
+    for (const auto& tabId : m_dirtyTabIds) {
+        auto tab = std::ranges::find_if(m_state.openTabs, [&tabId](const EditorTab& t) { return t.id == tabId; });
+        if (tab == m_state.openTabs.end() || !tab->contentLoaded) {
+            continue;
+        }
+        std::ofstream file(tabFilePath(tabId));
+        if (!file.is_open()) {
+            ok = false;
+            continue;
+        }
+        file << serializeTab(*tab);
+        ok = ok && file.good();
+    }
+    m_dirtyTabIds.clear();
+
+    // Closed tabs: drop their files
+    for (const auto& tabId : m_removedTabIds) {
+        std::error_code ec;
+        std::filesystem::remove(tabFilePath(tabId), ec);
+    }
+    m_removedTabIds.clear();
+
+    // Geometry, tree state and tab order live in the small meta file
+    if (m_metaDirty) {
+        m_state.lastSaved = std::chrono::system_clock::now();
+        std::ofstream file(m_sessionPath);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << serializeMeta();
+        ok = ok && file.good();
+        m_metaDirty = false;
+    }
+
+    return ok;
+}
+
+void SessionManager::flushLoop() {
+    std::unique_lock lock(m_mutex);
+    while (!m_stopFlush) {
+        m_flushCv.wait(lock, [this] { return m_stopFlush || m_flushRequested; });
+
+        // Wait out the debounce window; new requests push the deadline
+        while (!m_stopFlush && std::chrono::steady_clock::now() < m_flushDeadline) {
+            m_flushCv.wait_until(lock, m_flushDeadline);
+        }
+        if (m_stopFlush) {
+            break;  // Destructor runs the final flush
+        }
+
+        m_flushRequested = false;
+        flushLocked();
+    }
+}
+
+std::string SessionManager::serializeMeta() const {
     std::string json = "{\n";
 
     // Basic state
@@ -147,14 +375,14 @@ std::string SessionManager::serializeSession() const {
     auto timestamp = std::chrono::duration_cast<std::chrono::seconds>(m_state.lastSaved.time_since_epoch()).count();
     json += std::format("  \"lastSaved\": {},\n", timestamp);
 
-    // Open tabs
+    // Tab metadata in order; contents live in tabs/<id>.json so restore
+    // can show every tab without reading any content
     json += "  \"openTabs\": [\n";
     for (size_t i = 0; i < m_state.openTabs.size(); ++i) {
         const auto& tab = m_state.openTabs[i];
         json += "    {\n";
         json += std::format("      \"id\": \"{}\",\n", JsonUtils::escapeString(tab.id));
         json += std::format("      \"title\": \"{}\",\n", JsonUtils::escapeString(tab.title));
-        json += std::format("      \"content\": \"{}\",\n", JsonUtils::escapeString(tab.content));
         json += std::format("      \"filePath\": \"{}\",\n", JsonUtils::escapeString(tab.filePath));
         json += std::format("      \"isDirty\": {},\n", tab.isDirty ? "true" : "false");
         json += std::format("      \"cursorLine\": {},\n", tab.cursorLine);
@@ -176,7 +404,20 @@ std::string SessionManager::serializeSession() const {
     return json;
 }
 
-bool SessionManager::deserializeSession(std::string_view jsonStr) {
+std::string SessionManager::serializeTab(const EditorTab& tab) {
+    std::string json = "{\n";
+    json += std::format("  \"id\": \"{}\",\n", JsonUtils::escapeString(tab.id));
+    json += std::format("  \"title\": \"{}\",\n", JsonUtils::escapeString(tab.title));
+    json += std::format("  \"content\": \"{}\",\n", JsonUtils::escapeString(tab.content));
+    json += std::format("  \"filePath\": \"{}\",\n", JsonUtils::escapeString(tab.filePath));
+    json += std::format("  \"isDirty\": {},\n", tab.isDirty ? "true" : "false");
+    json += std::format("  \"cursorLine\": {},\n", tab.cursorLine);
+    json += std::format("  \"cursorColumn\": {}\n", tab.cursorColumn);
+    json += "}\n";
+    return json;
+}
+
+bool SessionManager::deserializeMeta(std::string_view jsonStr, std::vector<std::string>& outTabIds) {
     try {
         simdjson::dom::parser parser;
         simdjson::dom::element doc = parser.parse(jsonStr);
@@ -208,8 +449,13 @@ bool SessionManager::deserializeSession(std::string_view jsonStr) {
             m_state.lastSaved = std::chrono::system_clock::time_point(std::chrono::seconds(val.value()));
         }
 
-        // Open tabs
         m_state.openTabs.clear();
+        outTabIds.clear();
+
+        // Tab list. Three formats coexist: metadata-only entries (current;
+        // content stays on disk until first focus), entries with inline
+        // content (legacy single-file sessions, migrated on next flush),
+        // and a bare id manifest whose per-tab files the caller reads.
         if (auto tabs = doc["openTabs"].get_array(); !tabs.error()) {
             for (auto tabEl : tabs.value()) {
                 EditorTab tab;
@@ -217,8 +463,13 @@ bool SessionManager::deserializeSession(std::string_view jsonStr) {
                     tab.id = std::string(val.value());
                 if (auto val = tabEl["title"].get_string(); !val.error())
                     tab.title = std::string(val.value());
-                if (auto val = tabEl["content"].get_string(); !val.error())
+                if (auto val = tabEl["content"].get_string(); !val.error()) {
                     tab.content = std::string(val.value());
+                    m_dirtyTabIds.insert(tab.id);
+                    m_metaDirty = true;
+                } else {
+                    tab.contentLoaded = false;
+                }
                 if (auto val = tabEl["filePath"].get_string(); !val.error())
                     tab.filePath = std::string(val.value());
                 if (auto val = tabEl["isDirty"].get_bool(); !val.error())
@@ -227,7 +478,13 @@ bool SessionManager::deserializeSession(std::string_view jsonStr) {
                     tab.cursorLine = static_cast<int>(val.value());
                 if (auto val = tabEl["cursorColumn"].get_int64(); !val.error())
                     tab.cursorColumn = static_cast<int>(val.value());
-                m_state.openTabs.push_back(tab);
+                m_state.openTabs.push_back(std::move(tab));
+            }
+        } else if (auto tabIds = doc["openTabIds"].get_array(); !tabIds.error()) {
+            for (auto idEl : tabIds.value()) {
+                if (auto val = idEl.get_string(); !val.error()) {
+                    outTabIds.push_back(std::string(val.value()));
+                }
             }
         }
 
@@ -247,4 +504,33 @@ bool SessionManager::deserializeSession(std::string_view jsonStr) {
     }
 }
 
+bool SessionManager::deserializeTab(std::string_view jsonStr, EditorTab& outTab) {
+    try {
+        simdjson::dom::parser parser;
+        simdjson::dom::element doc = parser.parse(jsonStr);
+
+        if (auto val = doc["id"].get_string(); !val.error())
+            outTab.id = std::string(val.value());
+        if (outTab.id.empty()) {
+            return false;
+        }
+        if (auto val = doc["title"].get_string(); !val.error())
+            outTab.title = std::string(val.value());
+        if (auto val = doc["content"].get_string(); !val.error())
+            outTab.content = std::string(val.value());
+        if (auto val = doc["filePath"].get_string(); !val.error())
+            outTab.filePath = std::string(val.value());
+        if (auto val = doc["isDirty"].get_bool(); !val.error())
+            outTab.isDirty = val.value();
+        if (auto val = doc["cursorLine"].get_int64(); !val.error())
+            outTab.cursorLine = static_cast<int>(val.value());
+        if (auto val = doc["cursorColumn"].get_int64(); !val.error())
+            outTab.cursorColumn = static_cast<int>(val.value());
+
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
 }  // namespace velocitydb
@@ -1,9 +1,13 @@
 #pragma once
 
 #include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 namespace velocitydb {
@@ -16,6 +20,9 @@ struct EditorTab {
     bool isDirty = false;
     int cursorLine = 1;
     int cursorColumn = 1;
+    // False while content still lives only in the tab's file on disk;
+    // restore fills metadata first and streams content in on first focus
+    bool contentLoaded = true;
 };
 
 struct SessionState {
@@ -33,20 +40,37 @@ struct SessionState {
     std::chrono::system_clock::time_point lastSaved;
 };
 
+/// Persists window/tab/connection state across runs. Storage is split so
+/// a save costs only what actually changed: session.json holds geometry,
+/// tree state and the tab order, while each tab's content lives in its
+/// own file under tabs/. Saves are differential (per-tab dirty flags)
+/// and can be debounced through requestSave(), so a keystroke burst in a
+/// large tab rewrites one small file once, not every tab on every save.
 class SessionManager {
 public:
     SessionManager();
-    ~SessionManager() = default;
+    ~SessionManager();
 
     SessionManager(const SessionManager&) = delete;
     SessionManager& operator=(const SessionManager&) = delete;
 
-    /// Load session state from disk
+    /// Load session state from disk. Only tab metadata and the active
+    /// tab's content are read here; other tabs' contents load lazily via
+    /// loadTabContent(), so a heavy session doesn't delay startup.
     bool load();
 
-    /// Save session state to disk
+    /// Content of the given tab, reading its file on first access.
+    /// Empty optional when the tab id is unknown.
+    [[nodiscard]] std::optional<std::string> loadTabContent(const std::string& tabId);
+
+    /// Flush all pending changes to disk immediately (only dirty pieces
+    /// are written)
     bool save();
 
+    /// Schedule a debounced save: coalesces bursts of updates into one
+    /// differential write after a short quiet period
+    void requestSave();
+
     /// Get current session state
     [[nodiscard]] const SessionState& getState() const { return m_state; }
 
@@ -77,14 +101,36 @@ public:
     [[nodiscard]] std::filesystem::path getSessionPath() const;
 
 private:
-    [[nodiscard]] std::string serializeSession() const;
-    bool deserializeSession(std::string_view json);
+    [[nodiscard]] std::string serializeMeta() const;
+    [[nodiscard]] static std::string serializeTab(const EditorTab& tab);
+    bool deserializeMeta(std::string_view json, std::vector<std::string>& outTabIds);
+    [[nodiscard]] static bool deserializeTab(std::string_view json, EditorTab& outTab);
+
+    [[nodiscard]] std::filesystem::path tabFilePath(const std::string& tabId) const;
+    std::optional<std::string> loadTabContentLocked(const std::string& tabId);
+    bool flushLocked();
+    void flushLoop();
 
     SessionState m_state;
     std::filesystem::path m_sessionPath;
+    std::filesystem::path m_tabsDir;
     mutable std::mutex m_mutex;
     bool m_autoSaveEnabled = false;
     int m_autoSaveInterval = 30;
+
+    // Differential-save bookkeeping: which tab files need rewriting or
+    // deleting, and whether the small meta file changed at all
+    std::unordered_set<std::string> m_dirtyTabIds;
+    std::unordered_set<std::string> m_removedTabIds;
+    bool m_metaDirty = false;
+
+    // Debounce machinery: requestSave() pushes the deadline forward and
+    // the flush thread writes once the burst goes quiet
+    std::thread m_flushThread;
+    std::condition_variable m_flushCv;
+    std::chrono::steady_clock::time_point m_flushDeadline;
+    bool m_flushRequested = false;
+    bool m_stopFlush = false;
 };
 
 }  // namespace velocitydb
@@ -50,7 +50,15 @@ bool SettingsManager::load() {
 
     std::stringstream buffer;
     buffer << file.rdbuf();
-    return deserializeSettings(buffer.str());
+    if (!deserializeSettings(buffer.str())) {
+        return false;
+    }
+    publishSnapshot();
+    return true;
+}
+
+void SettingsManager::publishSnapshot() {
+    m_snapshot.store(std::make_shared<const AppSettings>(m_settings), std::memory_order_release);
 }
 
 bool SettingsManager::save() {
@@ -68,11 +76,23 @@ bool SettingsManager::save() {
 void SettingsManager::updateSettings(const AppSettings& settings) {
     std::lock_guard lock(m_mutex);
     m_settings = settings;
+    publishSnapshot();
+}
+
+std::string SettingsManager::getDetectedOdbcDriver() const {
+    return getSettings()->general.detectedOdbcDriver;
+}
+
+void SettingsManager::setDetectedOdbcDriver(const std::string& driverName) {
+    std::lock_guard lock(m_mutex);
+    m_settings.general.detectedOdbcDriver = driverName;
+    publishSnapshot();
 }
 
 void SettingsManager::addConnectionProfile(const ConnectionProfile& profile) {
     std::lock_guard lock(m_mutex);
     m_settings.connectionProfiles.push_back(profile);
+    publishSnapshot();
 }
 
 void SettingsManager::updateConnectionProfile(const ConnectionProfile& profile) {
@@ -80,6 +100,7 @@ void SettingsManager::updateConnectionProfile(const ConnectionProfile& profile)
     for (auto& existing : m_settings.connectionProfiles) {
         if (existing.id == profile.id) {
             existing = profile;
+            publishSnapshot();
             return;
         }
     }
@@ -89,11 +110,12 @@ void SettingsManager::removeConnectionProfile(const std::string& id) {
     std::lock_guard lock(m_mutex);
     auto& profiles = m_settings.connectionProfiles;
     profiles.erase(std::remove_if(profiles.begin(), profiles.end(), [&id](const ConnectionProfile& p) { return p.id == id; }), profiles.end());
+    publishSnapshot();
 }
 
 std::optional<ConnectionProfile> SettingsManager::getConnectionProfile(const std::string& id) const {
-    std::lock_guard lock(m_mutex);
-    for (const auto& profile : m_settings.connectionProfiles) {
+    const auto settings = getSettings();
+    for (const auto& profile : settings->connectionProfiles) {
         if (profile.id == id) {
             return profile;
         }
@@ -101,8 +123,8 @@ std::optional<ConnectionProfile> SettingsManager::getConnectionProfile(const std
     return std::nullopt;
 }
 
-const std::vector<ConnectionProfile>& SettingsManager::getConnectionProfiles() const {
-    return m_settings.connectionProfiles;
+std::vector<ConnectionProfile> SettingsManager::getConnectionProfiles() const {
+    return getSettings()->connectionProfiles;
 }
 
 std::expected<void, std::string> SettingsManager::setProfilePassword(const std::string& profileId, std::string_view plainPassword) {
@@ -113,6 +135,8 @@ std::expected<void, std::string> SettingsManager::setProfilePassword(const std::
             if (plainPassword.empty()) {
                 profile.encryptedPassword.clear();
                 profile.savePassword = false;
+                CredentialCache::instance().wipe();
+                publishSnapshot();
                 return {};
             }
 
@@ -123,6 +147,8 @@ std::expected<void, std::string> SettingsManager::setProfilePassword(const std::
 
             profile.encryptedPassword = encryptResult.value();
             profile.savePassword = true;
+            CredentialCache::instance().wipe();
+            publishSnapshot();
             return {};
         }
     }
@@ -131,15 +157,15 @@ std::expected<void, std::string> SettingsManager::setProfilePassword(const std::
 }
 
 std::expected<std::string, std::string> SettingsManager::getProfilePassword(const std::string& profileId) const {
-    std::lock_guard lock(m_mutex);
+    const auto settings = getSettings();
 
-    for (const auto& profile : m_settings.connectionProfiles) {
+    for (const auto& profile : settings->connectionProfiles) {
         if (profile.id == profileId) {
             if (profile.encryptedPassword.empty()) {
                 return std::string{};
             }
 
-            return CredentialProtector::decrypt(profile.encryptedPassword);
+            return CredentialCache::instance().decrypt(profile.encryptedPassword);
         }
     }
 
@@ -157,6 +183,8 @@ std::expected<void, std::string> SettingsManager::setSshPassword(const std::stri
         if (profile.id == profileId) {
             if (plainPassword.empty()) {
                 profile.ssh.encryptedPassword.clear();
+                CredentialCache::instance().wipe();
+                publishSnapshot();
                 return {};
             }
 
@@ -166,6 +194,8 @@ std::expected<void, std::string> SettingsManager::setSshPassword(const std::stri
             }
 
             profile.ssh.encryptedPassword = encryptResult.value();
+            CredentialCache::instance().wipe();
+            publishSnapshot();
             return {};
         }
     }
@@ -174,15 +204,15 @@ std::expected<void, std::string> SettingsManager::setSshPassword(const std::stri
 }
 
 std::expected<std::string, std::string> SettingsManager::getSshPassword(const std::string& profileId) const {
-    std::lock_guard lock(m_mutex);
+    const auto settings = getSettings();
 
-    for (const auto& profile : m_settings.connectionProfiles) {
+    for (const auto& profile : settings->connectionProfiles) {
         if (profile.id == profileId) {
             if (profile.ssh.encryptedPassword.empty()) {
                 return std::string{};
             }
 
-            return CredentialProtector::decrypt(profile.ssh.encryptedPassword);
+            return CredentialCache::instance().decrypt(profile.ssh.encryptedPassword);
         }
     }
 
@@ -196,6 +226,8 @@ std::expected<void, std::string> SettingsManager::setSshKeyPassphrase(const std:
         if (profile.id == profileId) {
             if (passphrase.empty()) {
                 profile.ssh.encryptedKeyPassphrase.clear();
+                CredentialCache::instance().wipe();
+                publishSnapshot();
                 return {};
             }
 
@@ -205,6 +237,8 @@ std::expected<void, std::string> SettingsManager::setSshKeyPassphrase(const std:
             }
 
             profile.ssh.encryptedKeyPassphrase = encryptResult.value();
+            CredentialCache::instance().wipe();
+            publishSnapshot();
             return {};
         }
     }
@@ -213,15 +247,15 @@ std::expected<void, std::string> SettingsManager::setSshKeyPassphrase(const std:
 }
 
 std::expected<std::string, std::string> SettingsManager::getSshKeyPassphrase(const std::string& profileId) const {
-    std::lock_guard lock(m_mutex);
+    const auto settings = getSettings();
 
-    for (const auto& profile : m_settings.connectionProfiles) {
+    for (const auto& profile : settings->connectionProfiles) {
         if (profile.id == profileId) {
             if (profile.ssh.encryptedKeyPassphrase.empty()) {
                 return std::string{};
             }
 
-            return CredentialProtector::decrypt(profile.ssh.encryptedKeyPassphrase);
+            return CredentialCache::instance().decrypt(profile.ssh.encryptedKeyPassphrase);
         }
     }
 
@@ -238,7 +272,11 @@ std::string SettingsManager::serializeSettings() const {
     json += std::format("    \"confirmOnExit\": {},\n", m_settings.general.confirmOnExit ? "true" : "false");
     json += std::format("    \"maxQueryHistory\": {},\n", m_settings.general.maxQueryHistory);
     json += std::format("    \"maxRecentConnections\": {},\n", m_settings.general.maxRecentConnections);
-    json += std::format("    \"language\": \"{}\"\n", JsonUtils::escapeString(m_settings.general.language));
+    json += std::format("    \"memoryBudgetMb\": {},\n", m_settings.general.memoryBudgetMb);
+    json += std::format("    \"queryTimeoutSeconds\": {},\n", m_settings.general.queryTimeoutSeconds);
+    json += std::format("    \"dmlBatchSize\": {},\n", m_settings.general.dmlBatchSize);
+    json += std::format("    \"language\": \"{}\",\n", JsonUtils::escapeString(m_settings.general.language));
+    json += std::format("    \"detectedOdbcDriver\": \"{}\"\n", JsonUtils::escapeString(m_settings.general.detectedOdbcDriver));
     json += "  },\n";
 
     // Editor settings
@@ -325,8 +363,16 @@ bool SettingsManager::deserializeSettings(std::string_view jsonStr) {
                 m_settings.general.maxQueryHistory = static_cast<int>(val.value());
             if (auto val = general["maxRecentConnections"].get_int64(); !val.error())
                 m_settings.general.maxRecentConnections = static_cast<int>(val.value());
+            if (auto val = general["memoryBudgetMb"].get_int64(); !val.error() && val.value() > 0)
+                m_settings.general.memoryBudgetMb = static_cast<int>(val.value());
+            if (auto val = general["queryTimeoutSeconds"].get_int64(); !val.error() && val.value() >= 0)
+                m_settings.general.queryTimeoutSeconds = static_cast<int>(val.value());
+            if (auto val = general["dmlBatchSize"].get_int64(); !val.error() && val.value() >= 0)
+                m_settings.general.dmlBatchSize = static_cast<int>(val.value());
             if (auto val = general["language"].get_string(); !val.error())
                 m_settings.general.language = std::string(val.value());
+            if (auto val = general["detectedOdbcDriver"].get_string(); !val.error())
+                m_settings.general.detectedOdbcDriver = std::string(val.value());
         }
 
         // Editor settings
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <expected>
 #include <filesystem>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -68,7 +70,11 @@ struct GeneralSettings {
     bool confirmOnExit = true;
     int maxQueryHistory = 1000;
     int maxRecentConnections = 10;
+    int memoryBudgetMb = 1536;  // Process budget for caches and retained results
+    int queryTimeoutSeconds = 0;  // Watchdog budget for async queries; 0 disables
+    int dmlBatchSize = 0;  // Statements per auto-commit batch for scripted DML; 0 disables
     std::string language = "en";
+    std::string detectedOdbcDriver;  // Memoized ODBC driver scan result; empty until first detection
 };
 
 struct WindowSettings {
@@ -87,6 +93,12 @@ struct AppSettings {
     std::vector<ConnectionProfile> connectionProfiles;
 };
 
+/// Owns the persisted application settings. Reads are lock-free: the
+/// current settings live in an immutable snapshot behind an atomic
+/// shared_ptr, so hot paths (export defaults, cache limits, profile
+/// lookups) pay one atomic load. Writers mutate a master copy under the
+/// mutex, then publish a fresh snapshot; readers holding the old one
+/// keep a consistent view until they drop it.
 class SettingsManager {
 public:
     SettingsManager();
@@ -101,18 +113,25 @@ public:
     /// Save settings to disk
     bool save();
 
-    /// Get current settings
-    [[nodiscard]] const AppSettings& getSettings() const { return m_settings; }
+    /// Current settings snapshot: a single atomic load, never a lock.
+    /// The returned snapshot is immutable and stays valid (and
+    /// internally consistent) for as long as the caller holds it.
+    [[nodiscard]] std::shared_ptr<const AppSettings> getSettings() const noexcept { return m_snapshot.load(std::memory_order_acquire); }
 
     /// Update settings
     void updateSettings(const AppSettings& settings);
 
+    /// Memoized ODBC driver detection result (persisted so later startups
+    /// skip the registry scan entirely)
+    [[nodiscard]] std::string getDetectedOdbcDriver() const;
+    void setDetectedOdbcDriver(const std::string& driverName);
+
     /// Connection profile management
     void addConnectionProfile(const ConnectionProfile& profile);
     void updateConnectionProfile(const ConnectionProfile& profile);
     void removeConnectionProfile(const std::string& id);
     [[nodiscard]] std::optional<ConnectionProfile> getConnectionProfile(const std::string& id) const;
-    [[nodiscard]] const std::vector<ConnectionProfile>& getConnectionProfiles() const;
+    [[nodiscard]] std::vector<ConnectionProfile> getConnectionProfiles() const;
 
     /// Password management using DPAPI encryption
     /// @param profileId The profile to set password for
@@ -146,7 +165,12 @@ private:
     [[nodiscard]] std::string serializeSettings() const;
     bool deserializeSettings(std::string_view json);
 
+    // Rebuilds the published snapshot from m_settings; caller holds m_mutex
+    void publishSnapshot();
+
+    // Writer-side master copy, guarded by m_mutex; readers never touch it
     AppSettings m_settings;
+    std::atomic<std::shared_ptr<const AppSettings>> m_snapshot{std::make_shared<const AppSettings>()};
     std::filesystem::path m_settingsPath;
     mutable std::mutex m_mutex;
 };
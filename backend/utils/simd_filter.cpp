@@ -1,8 +1,13 @@
 #include "simd_filter.h"
 
 #include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
 #include <cstring>
+#include <execution>
 #include <numeric>
+#include <utility>
 
 #ifdef _MSC_VER
 #include <immintrin.h>
@@ -58,30 +63,112 @@ namespace {
 }
 #endif
 
+// Full-string numeric parse; partial parses ("12abc") do not count
+[[nodiscard]] bool parseNumber(std::string_view text, double& value) {
+    if (text.empty()) {
+        return false;
+    }
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return ec == std::errc{} && end == text.data() + text.size();
+}
+
+// Below this row count the thread-spawning overhead of a parallel sort
+// outweighs the work; above it the comparison sort goes wide
+constexpr size_t PARALLEL_SORT_THRESHOLD = 10'000;
+
+// Above this row count fully numeric columns use LSD radix instead of a
+// comparison sort: eight counting passes beat n log n on millions of rows
+constexpr size_t RADIX_SORT_THRESHOLD = 100'000;
+
+// Maps a double to a uint64_t whose unsigned order matches numeric order
+// (negatives get all bits flipped, positives just the sign bit), so the
+// radix passes can treat the keys as plain unsigned bytes
+[[nodiscard]] uint64_t sortableBits(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & (1ULL << 63)) != 0 ? ~bits : bits | (1ULL << 63);
+}
+
+// Stable LSD radix sort of row indices by their precomputed numeric keys,
+// one byte per pass from least significant to most
+void radixSortIndices(const std::vector<double>& keys, std::vector<size_t>& indices) {
+    const size_t count = indices.size();
+    std::vector<uint64_t> bits(count);
+    for (size_t i = 0; i < count; ++i) {
+        bits[i] = sortableBits(keys[indices[i]]);
+    }
+
+    std::vector<size_t> scratchIndices(count);
+    std::vector<uint64_t> scratchBits(count);
+    for (int shift = 0; shift < 64; shift += 8) {
+        std::array<size_t, 256> bucketStarts{};
+        for (size_t i = 0; i < count; ++i) {
+            ++bucketStarts[(bits[i] >> shift) & 0xFF];
+        }
+        size_t offset = 0;
+        for (auto& start : bucketStarts) {
+            offset += std::exchange(start, offset);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            auto pos = bucketStarts[(bits[i] >> shift) & 0xFF]++;
+            scratchIndices[pos] = indices[i];
+            scratchBits[pos] = bits[i];
+        }
+        indices.swap(scratchIndices);
+        bits.swap(scratchBits);
+    }
+}
+
 }  // namespace
 
 bool SIMDFilter::isAVX2Available() {
+    // cpuid is a serializing instruction; probe once and cache the answer
+    // so per-cell dispatch in the filter loops costs a predicted branch
+    static const bool available = [] {
 #ifdef _MSC_VER
-    int cpuInfo[4];
-    __cpuid(cpuInfo, 0);
-    int nIds = cpuInfo[0];
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 0);
+        int nIds = cpuInfo[0];
 
-    if (nIds >= 7) {
-        __cpuidex(cpuInfo, 7, 0);
-        return (cpuInfo[1] & (1 << 5)) != 0;  // AVX2 bit
-    }
+        if (nIds >= 7) {
+            __cpuidex(cpuInfo, 7, 0);
+            return (cpuInfo[1] & (1 << 5)) != 0;  // AVX2 bit
+        }
 #endif
-    return false;
+        return false;
+    }();
+    return available;
 }
 
 std::vector<size_t> SIMDFilter::filterEquals(const ResultSet& data, size_t columnIndex, const std::string& value) const {
+    // Build the hash index on the first filter against this column; the
+    // build is one scan, the same cost the scan-based filter paid per call
+    if (m_equalsIndex.source != &data || m_equalsIndex.columnIndex != columnIndex || m_equalsIndex.rowCount != data.rows.size()) {
+        m_equalsIndex.source = &data;
+        m_equalsIndex.columnIndex = columnIndex;
+        m_equalsIndex.rowCount = data.rows.size();
+        m_equalsIndex.valueToRows.clear();
+        for (size_t i = 0; i < data.rows.size(); ++i) {
+            if (columnIndex < data.rows[i].values.size()) {
+                m_equalsIndex.valueToRows[std::string(data.rows[i].values[columnIndex])].push_back(i);
+            }
+        }
+    }
+
+    auto entry = m_equalsIndex.valueToRows.find(value);
+    return entry != m_equalsIndex.valueToRows.end() ? entry->second : std::vector<size_t>{};
+}
+
+std::vector<size_t> SIMDFilter::filterContains(const ResultSet& data, size_t columnIndex, const std::string& substring) const {
     std::vector<size_t> result;
-    result.reserve(data.rows.size() / 4);  // Estimate 25% match rate
+    result.reserve(data.rows.size() / 4);
 
     for (size_t i = 0; i < data.rows.size(); ++i) {
         if (columnIndex < data.rows[i].values.size()) {
             const auto& cellValue = data.rows[i].values[columnIndex];
-            if (cellValue == value) {
+            // Vectorized first-byte scan + memcmp verify instead of
+            // std::string::find's per-byte loop
+            if (simdStringContains(cellValue.data(), cellValue.size(), substring.data(), substring.size())) {
                 result.push_back(i);
             }
         }
@@ -90,15 +177,15 @@ std::vector<size_t> SIMDFilter::filterEquals(const ResultSet& data, size_t colum
     return result;
 }
 
-std::vector<size_t> SIMDFilter::filterContains(const ResultSet& data, size_t columnIndex, const std::string& substring) const {
+std::vector<size_t> SIMDFilter::filterContains(const ResultSet& data, size_t columnIndex, const std::string& substring, const std::vector<size_t>& candidateRows) const {
     std::vector<size_t> result;
-    result.reserve(data.rows.size() / 4);
+    result.reserve(candidateRows.size());
 
-    for (size_t i = 0; i < data.rows.size(); ++i) {
-        if (columnIndex < data.rows[i].values.size()) {
-            const auto& cellValue = data.rows[i].values[columnIndex];
-            if (cellValue.find(substring) != std::string::npos) {
-                result.push_back(i);
+    for (size_t rowIndex : candidateRows) {
+        if (rowIndex < data.rows.size() && columnIndex < data.rows[rowIndex].values.size()) {
+            const auto& cellValue = data.rows[rowIndex].values[columnIndex];
+            if (simdStringContains(cellValue.data(), cellValue.size(), substring.data(), substring.size())) {
+                result.push_back(rowIndex);
             }
         }
     }
@@ -106,13 +193,64 @@ std::vector<size_t> SIMDFilter::filterContains(const ResultSet& data, size_t col
     return result;
 }
 
+const std::vector<double>* SIMDFilter::numericColumnValues(const ResultSet& data, size_t columnIndex) const {
+    if (m_numericColumn.source != &data || m_numericColumn.columnIndex != columnIndex || m_numericColumn.rowCount != data.rows.size()) {
+        m_numericColumn.source = &data;
+        m_numericColumn.columnIndex = columnIndex;
+        m_numericColumn.rowCount = data.rows.size();
+        m_numericColumn.values.assign(data.rows.size(), 0.0);
+        m_numericColumn.allNumeric = !data.rows.empty();
+        for (size_t i = 0; i < data.rows.size() && m_numericColumn.allNumeric; ++i) {
+            m_numericColumn.allNumeric = columnIndex < data.rows[i].values.size() && parseNumber(data.rows[i].values[columnIndex], m_numericColumn.values[i]);
+        }
+    }
+    return m_numericColumn.allNumeric ? &m_numericColumn.values : nullptr;
+}
+
 std::vector<size_t> SIMDFilter::filterRange(const ResultSet& data, size_t columnIndex, const std::string& minValue, const std::string& maxValue) const {
     std::vector<size_t> result;
     result.reserve(data.rows.size() / 4);
 
+    // Typed path: when both bounds and every cell parse numerically, the
+    // column is materialized once as doubles and compared as numbers -
+    // "10" falls between "9" and "11" here, unlike the string compare
+    double minKey = 0.0;
+    double maxKey = 0.0;
+    if (parseNumber(minValue, minKey) && parseNumber(maxValue, maxKey)) {
+        if (const auto* values = numericColumnValues(data, columnIndex)) {
+            const size_t count = values->size();
+            size_t i = 0;
+#ifdef _MSC_VER
+            if (isAVX2Available()) {
+                // Four doubles per compare; the mask walks set bits so
+                // sparse matches cost one _BitScanForward each
+                __m256d minVec = _mm256_set1_pd(minKey);
+                __m256d maxVec = _mm256_set1_pd(maxKey);
+                for (; i + 4 <= count; i += 4) {
+                    __m256d chunk = _mm256_loadu_pd(values->data() + i);
+                    __m256d inRange = _mm256_and_pd(_mm256_cmp_pd(chunk, minVec, _CMP_GE_OQ), _mm256_cmp_pd(chunk, maxVec, _CMP_LE_OQ));
+                    int mask = _mm256_movemask_pd(inRange);
+                    while (mask != 0) {
+                        unsigned long pos;
+                        _BitScanForward(&pos, static_cast<unsigned long>(mask));
+                        result.push_back(i + pos);
+                        mask &= mask - 1;
+                    }
+                }
+            }
+#endif
+            for (; i < count; ++i) {
+                if ((*values)[i] >= minKey && (*values)[i] <= maxKey) {
+                    result.push_back(i);
+                }
+            }
+            return result;
+        }
+    }
+
     for (size_t i = 0; i < data.rows.size(); ++i) {
         if (columnIndex < data.rows[i].values.size()) {
-            const auto& cellValue = data.rows[i].values[columnIndex];
+            const std::string_view cellValue = data.rows[i].values[columnIndex];
             if (cellValue >= minValue && cellValue <= maxValue) {
                 result.push_back(i);
             }
@@ -122,26 +260,223 @@ std::vector<size_t> SIMDFilter::filterRange(const ResultSet& data, size_t column
     return result;
 }
 
+std::vector<size_t> SIMDFilter::evaluateCondition(const ResultSet& data, const FilterCondition& condition, const std::vector<size_t>* candidates) const {
+    if (!candidates) {
+        // Full-data pass: the single-filter entry points already have the
+        // fast paths (equality hash index, vectorized range compare)
+        switch (condition.op) {
+            case FilterCondition::Op::Equals:
+                return filterEquals(data, condition.columnIndex, condition.value);
+            case FilterCondition::Op::Range:
+                return filterRange(data, condition.columnIndex, condition.value, condition.valueMax);
+            case FilterCondition::Op::Contains:
+                return filterContains(data, condition.columnIndex, condition.value);
+        }
+        return {};
+    }
+
+    if (condition.op == FilterCondition::Op::Contains) {
+        return filterContains(data, condition.columnIndex, condition.value, *candidates);
+    }
+
+    std::vector<size_t> result;
+    result.reserve(candidates->size());
+
+    if (condition.op == FilterCondition::Op::Range) {
+        // Numeric path over the surviving rows, same semantics as
+        // filterRange: numbers when both bounds and the whole column parse
+        double minKey = 0.0;
+        double maxKey = 0.0;
+        if (parseNumber(condition.value, minKey) && parseNumber(condition.valueMax, maxKey)) {
+            if (const auto* values = numericColumnValues(data, condition.columnIndex)) {
+                for (size_t rowIndex : *candidates) {
+                    if (rowIndex < values->size() && (*values)[rowIndex] >= minKey && (*values)[rowIndex] <= maxKey) {
+                        result.push_back(rowIndex);
+                    }
+                }
+                return result;
+            }
+        }
+        for (size_t rowIndex : *candidates) {
+            if (rowIndex < data.rows.size() && condition.columnIndex < data.rows[rowIndex].values.size()) {
+                const std::string_view cellValue = data.rows[rowIndex].values[condition.columnIndex];
+                if (cellValue >= condition.value && cellValue <= condition.valueMax) {
+                    result.push_back(rowIndex);
+                }
+            }
+        }
+        return result;
+    }
+
+    for (size_t rowIndex : *candidates) {
+        if (rowIndex < data.rows.size() && condition.columnIndex < data.rows[rowIndex].values.size() && std::string_view(data.rows[rowIndex].values[condition.columnIndex]) == condition.value) {
+            result.push_back(rowIndex);
+        }
+    }
+    return result;
+}
+
+std::vector<size_t> SIMDFilter::evaluateGroup(const ResultSet& data, const CompoundFilter& group, const std::vector<size_t>* candidates) const {
+    // Cheapest-and-typically-most-selective terms first (the enumerator
+    // order): an indexed equality shrinks the selection for pennies before
+    // any substring scan runs. Nested groups go last - their cost is
+    // unknown, so they get the smallest selection to chew on.
+    std::vector<const FilterCondition*> ordered;
+    ordered.reserve(group.conditions.size());
+    for (const auto& condition : group.conditions) {
+        ordered.push_back(&condition);
+    }
+    std::stable_sort(ordered.begin(), ordered.end(), [](const FilterCondition* a, const FilterCondition* b) { return static_cast<uint8_t>(a->op) < static_cast<uint8_t>(b->op); });
+
+    if (group.combine == CompoundFilter::Combine::And) {
+        std::vector<size_t> selection;
+        bool narrowed = false;
+        for (const auto* condition : ordered) {
+            selection = evaluateCondition(data, *condition, narrowed ? &selection : candidates);
+            narrowed = true;
+            if (selection.empty()) {
+                return selection;  // Short-circuit: nothing survives
+            }
+        }
+        for (const auto& child : group.groups) {
+            selection = evaluateGroup(data, child, narrowed ? &selection : candidates);
+            narrowed = true;
+            if (selection.empty()) {
+                return selection;
+            }
+        }
+        if (!narrowed) {
+            // Empty AND group matches everything in scope
+            if (candidates) {
+                return *candidates;
+            }
+            std::vector<size_t> all(data.rows.size());
+            std::iota(all.begin(), all.end(), size_t{0});
+            return all;
+        }
+        return selection;
+    }
+
+    // OR: rows already matched are never rescanned - each term sees only
+    // the still-unmatched remainder, and the union short-circuits once
+    // everything in scope has matched
+    std::vector<size_t> remaining;
+    if (candidates) {
+        remaining = *candidates;
+    } else {
+        remaining.resize(data.rows.size());
+        std::iota(remaining.begin(), remaining.end(), size_t{0});
+    }
+
+    std::vector<size_t> matched;
+    auto absorb = [&](std::vector<size_t> hits) {
+        if (hits.empty()) {
+            return;
+        }
+        matched.insert(matched.end(), hits.begin(), hits.end());
+        // Both sorted and hits is a subset of remaining, so the difference
+        // is one linear pass
+        std::vector<size_t> stillUnmatched;
+        stillUnmatched.reserve(remaining.size() - hits.size());
+        std::set_difference(remaining.begin(), remaining.end(), hits.begin(), hits.end(), std::back_inserter(stillUnmatched));
+        remaining.swap(stillUnmatched);
+    };
+
+    for (const auto* condition : ordered) {
+        if (remaining.empty()) {
+            break;
+        }
+        absorb(evaluateCondition(data, *condition, &remaining));
+    }
+    for (const auto& child : group.groups) {
+        if (remaining.empty()) {
+            break;
+        }
+        absorb(evaluateGroup(data, child, &remaining));
+    }
+
+    // Disjoint sorted runs concatenated out of order; one sort restores
+    // row order for the response builder
+    std::sort(matched.begin(), matched.end());
+    return matched;
+}
+
+std::vector<size_t> SIMDFilter::filterCompound(const ResultSet& data, const CompoundFilter& filter) const {
+    return evaluateGroup(data, filter, nullptr);
+}
+
 std::vector<size_t> SIMDFilter::sortByColumn(const ResultSet& data, size_t columnIndex, bool ascending) const {
-    std::vector<size_t> indices(data.rows.size());
+    const size_t rowCount = data.rows.size();
+    std::vector<size_t> indices(rowCount);
     std::iota(indices.begin(), indices.end(), 0);
 
-    auto comparator = [&](size_t a, size_t b) {
-        const auto& valA = data.rows[a].values[columnIndex];
-        const auto& valB = data.rows[b].values[columnIndex];
+    // Parse each cell once up front instead of inside the comparator; the
+    // old per-comparison std::stod plus catch dominated large sorts
+    std::vector<double> numericKeys(rowCount);
+    bool allNumeric = rowCount > 0;
+    for (size_t i = 0; i < rowCount && allNumeric; ++i) {
+        allNumeric = parseNumber(data.rows[i].values[columnIndex], numericKeys[i]);
+    }
 
-        // Try numeric comparison first
-        try {
-            double numA = std::stod(valA);
-            double numB = std::stod(valB);
-            return ascending ? (numA < numB) : (numA > numB);
-        } catch (...) {
-            // Fall back to string comparison
-            return ascending ? (valA < valB) : (valA > valB);
+    if (allNumeric) {
+        if (rowCount >= RADIX_SORT_THRESHOLD) {
+            radixSortIndices(numericKeys, indices);
+        } else {
+            auto byKey = [&](size_t a, size_t b) { return numericKeys[a] < numericKeys[b]; };
+            if (rowCount >= PARALLEL_SORT_THRESHOLD) {
+                std::sort(std::execution::par, indices.begin(), indices.end(), byKey);
+            } else {
+                std::sort(indices.begin(), indices.end(), byKey);
+            }
+        }
+    } else {
+        auto byString = [&](size_t a, size_t b) { return data.rows[a].values[columnIndex] < data.rows[b].values[columnIndex]; };
+        if (rowCount >= PARALLEL_SORT_THRESHOLD) {
+            std::sort(std::execution::par, indices.begin(), indices.end(), byString);
+        } else {
+            std::sort(indices.begin(), indices.end(), byString);
         }
+    }
+
+    if (!ascending) {
+        std::reverse(indices.begin(), indices.end());
+    }
+    return indices;
+}
+
+std::vector<size_t> SIMDFilter::sortTopK(const ResultSet& data, size_t columnIndex, size_t k, bool ascending) const {
+    const size_t rowCount = data.rows.size();
+    if (k >= rowCount) {
+        return sortByColumn(data, columnIndex, ascending);
+    }
+
+    std::vector<size_t> indices(rowCount);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    std::vector<double> numericKeys(rowCount);
+    bool allNumeric = rowCount > 0;
+    for (size_t i = 0; i < rowCount && allNumeric; ++i) {
+        allNumeric = parseNumber(data.rows[i].values[columnIndex], numericKeys[i]);
+    }
+
+    // Direction goes into the comparator here: the k-prefix of an
+    // ascending partition is not the descending top-k
+    auto byKey = [&](size_t a, size_t b) { return ascending ? numericKeys[a] < numericKeys[b] : numericKeys[b] < numericKeys[a]; };
+    auto byString = [&](size_t a, size_t b) {
+        const auto& valA = data.rows[a].values[columnIndex];
+        const auto& valB = data.rows[b].values[columnIndex];
+        return ascending ? valA < valB : valB < valA;
     };
 
-    std::sort(indices.begin(), indices.end(), comparator);
+    if (allNumeric) {
+        std::nth_element(indices.begin(), indices.begin() + k, indices.end(), byKey);
+        indices.resize(k);
+        std::sort(indices.begin(), indices.end(), byKey);
+    } else {
+        std::nth_element(indices.begin(), indices.begin() + k, indices.end(), byString);
+        indices.resize(k);
+        std::sort(indices.begin(), indices.end(), byString);
+    }
     return indices;
 }
 
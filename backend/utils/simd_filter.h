@@ -4,6 +4,7 @@
 
 #include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace velocitydb {
@@ -13,20 +14,90 @@ public:
     SIMDFilter() = default;
     ~SIMDFilter() = default;
 
+    /// One per-column condition of a compound filter. The ops mirror the
+    /// single-filter entry points; enumerator order is evaluation order
+    /// (indexed equality before numeric range before substring scan).
+    struct FilterCondition {
+        enum class Op : uint8_t { Equals, Range, Contains };
+        size_t columnIndex = 0;
+        Op op = Op::Equals;
+        std::string value;
+        std::string valueMax;  // Range upper bound
+    };
+
+    /// AND/OR tree of conditions and nested sub-groups
+    struct CompoundFilter {
+        enum class Combine : uint8_t { And, Or };
+        Combine combine = Combine::And;
+        std::vector<FilterCondition> conditions;
+        std::vector<CompoundFilter> groups;
+    };
+
     // Filter rows based on column value
     std::vector<size_t> filterEquals(const ResultSet& data, size_t columnIndex, const std::string& value) const;
 
     std::vector<size_t> filterContains(const ResultSet& data, size_t columnIndex, const std::string& substring) const;
 
+    // Contains restricted to candidate rows: when a typed pattern extends
+    // the previous one, only the rows that matched before can still match,
+    // so each keystroke scans an ever-shrinking set
+    std::vector<size_t> filterContains(const ResultSet& data, size_t columnIndex, const std::string& substring, const std::vector<size_t>& candidateRows) const;
+
     std::vector<size_t> filterRange(const ResultSet& data, size_t columnIndex, const std::string& minValue, const std::string& maxValue) const;
 
+    // Evaluates an AND/OR tree with selection vectors passed between
+    // terms: the first term of an AND group scans the full data and every
+    // later term scans only the surviving rows (cheapest ops first); an OR
+    // group scans only the rows no earlier term matched. N conditions cost
+    // one full pass plus N-1 shrinking ones instead of N full scans.
+    std::vector<size_t> filterCompound(const ResultSet& data, const CompoundFilter& filter) const;
+
     // Sort rows by column
     std::vector<size_t> sortByColumn(const ResultSet& data, size_t columnIndex, bool ascending = true) const;
 
+    // Indices of the first k rows in sorted order without ordering the
+    // rest: nth_element partitions in O(n), then only the k-prefix is
+    // sorted, so the first grid page costs O(n + k log k)
+    std::vector<size_t> sortTopK(const ResultSet& data, size_t columnIndex, size_t k, bool ascending = true) const;
+
     // Check if AVX2 is available
     static bool isAVX2Available();
 
 private:
+    // Lazy value -> row-indices index built by the first equality filter
+    // against a column: analysts refilter the same loaded result on the
+    // same column with different values, so later lookups skip the scan.
+    // Source address plus row count guard invalidation when the data
+    // changes or a different result is filtered.
+    struct EqualsIndex {
+        const ResultSet* source = nullptr;
+        size_t columnIndex = 0;
+        size_t rowCount = 0;
+        std::unordered_map<std::string, std::vector<size_t>> valueToRows;
+    };
+    mutable EqualsIndex m_equalsIndex;
+
+    // Column parsed once into a contiguous double array so range filters
+    // compare numbers instead of reparsing strings per row per filter;
+    // invalidated the same way as the equality index
+    struct NumericColumn {
+        const ResultSet* source = nullptr;
+        size_t columnIndex = 0;
+        size_t rowCount = 0;
+        bool allNumeric = false;
+        std::vector<double> values;
+    };
+    mutable NumericColumn m_numericColumn;
+
+    // Returns the parsed values for the column, or nullptr when any cell
+    // is non-numeric (callers fall back to string comparison)
+    const std::vector<double>* numericColumnValues(const ResultSet& data, size_t columnIndex) const;
+
+    // Compound evaluation: one term against the data, restricted to the
+    // candidate rows when given (nullptr means all rows)
+    std::vector<size_t> evaluateCondition(const ResultSet& data, const FilterCondition& condition, const std::vector<size_t>* candidates) const;
+    std::vector<size_t> evaluateGroup(const ResultSet& data, const CompoundFilter& group, const std::vector<size_t>* candidates) const;
+
     // SIMD-optimized string comparison (when available)
     bool simdStringEquals(const char* a, const char* b, size_t len) const;
     bool simdStringContains(const char* haystack, size_t haystackLen, const char* needle, size_t needleLen) const;
@@ -0,0 +1,105 @@
+#include "trace.h"
+
+#include <format>
+#include <thread>
+
+#ifdef VDB_ETW_TRACELOGGING
+#include <Windows.h>
+#include <TraceLoggingProvider.h>
+
+// Provider GUID is fixed so field-collection profiles can reference it;
+// capture with: wpr -start <profile targeting VelocityDB-Trace>
+// {b1f4f9a3-52cf-4d86-a1b7-3e9c6d28e4f0}
+TRACELOGGING_DEFINE_PROVIDER(g_velocitydbTraceProvider, "VelocityDB-Trace", (0xb1f4f9a3, 0x52cf, 0x4d86, 0xa1, 0xb7, 0x3e, 0x9c, 0x6d, 0x28, 0xe4, 0xf0));
+
+namespace {
+
+// Registers on first span, unregisters at process exit; registration is
+// cheap and the provider stays dormant until an ETW session enables it
+struct ProviderRegistration {
+    ProviderRegistration() noexcept { TraceLoggingRegister(g_velocitydbTraceProvider); }
+    ~ProviderRegistration() { TraceLoggingUnregister(g_velocitydbTraceProvider); }
+};
+
+ProviderRegistration& providerRegistration() noexcept {
+    static ProviderRegistration registration;
+    return registration;
+}
+
+}  // namespace
+#endif
+
+namespace velocitydb {
+
+#ifdef VDB_ETW_TRACELOGGING
+
+bool etw::providerEnabled() noexcept {
+    providerRegistration();
+    return TraceLoggingProviderEnabled(g_velocitydbTraceProvider, /*level=*/5, /*keyword=*/0) != 0;
+}
+
+void etw::writeSpan(const char* category, const char* name, int64_t startUs, int64_t durationUs) noexcept {
+    if (!TraceLoggingProviderEnabled(g_velocitydbTraceProvider, /*level=*/5, /*keyword=*/0)) {
+        return;
+    }
+    // Same fields as the Chrome-trace record, so WPA tables line up with
+    // dumpTrace output taken on the same run
+    TraceLoggingWrite(g_velocitydbTraceProvider, "Span", TraceLoggingString(category, "category"), TraceLoggingString(name, "name"), TraceLoggingInt64(startUs, "startUs"), TraceLoggingInt64(durationUs, "durationUs"));
+}
+
+#endif
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+Tracer::ThreadBuffer& Tracer::threadBuffer() {
+    // Registered once per thread; the shared_ptr keeps the buffer alive
+    // for dumping even after the thread exits
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [this] {
+        auto created = std::make_shared<ThreadBuffer>();
+        created->threadId = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        std::lock_guard lock(m_registryMutex);
+        m_buffers.push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+void Tracer::record(const char* category, const char* name, int64_t startUs, int64_t durationUs) {
+    auto& buffer = threadBuffer();
+    std::lock_guard lock(buffer.mutex);
+    if (buffer.events.size() >= MAX_EVENTS_PER_THREAD) {
+        return;
+    }
+    buffer.events.push_back({.name = name, .category = category, .startUs = startUs, .durationUs = durationUs, .threadId = buffer.threadId});
+}
+
+std::string Tracer::dumpJson() {
+    std::vector<TraceEvent> drained;
+    {
+        std::lock_guard registryLock(m_registryMutex);
+        for (auto& buffer : m_buffers) {
+            std::lock_guard bufferLock(buffer->mutex);
+            drained.insert(drained.end(), buffer->events.begin(), buffer->events.end());
+            buffer->events.clear();
+        }
+    }
+
+    std::string json = "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& event : drained) {
+        if (!first) {
+            json += ',';
+        }
+        first = false;
+        // Complete ("X") events; names/categories are literals and never
+        // contain characters that need JSON escaping
+        json += std::format("{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{},\"dur\":{},\"pid\":1,\"tid\":{}}}", event.name, event.category, event.startUs, event.durationUs, event.threadId);
+    }
+    json += "]}";
+    return json;
+}
+
+}  // namespace velocitydb
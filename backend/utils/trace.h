@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace velocitydb {
+
+/// One completed span; names and categories are string literals so a
+/// recorded event is five trivially-copyable fields, no allocation
+struct TraceEvent {
+    const char* name = nullptr;
+    const char* category = nullptr;
+    int64_t startUs = 0;
+    int64_t durationUs = 0;
+    uint32_t threadId = 0;
+};
+
+/// Lightweight tracing subsystem. Spans are buffered per thread (each
+/// buffer has its own mutex, contended only while a dump drains it) and
+/// exported as Chrome trace JSON loadable in chrome://tracing or Perfetto.
+/// Disabled by default: an inactive span costs one relaxed atomic load,
+/// so instrumented hot paths stay free until someone asks "where did the
+/// 4 seconds go".
+class Tracer {
+public:
+    [[nodiscard]] static Tracer& instance();
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    void setEnabled(bool enabled) noexcept { m_enabled.store(enabled, std::memory_order_relaxed); }
+    [[nodiscard]] bool isEnabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Record a completed span into the calling thread's buffer
+    void record(const char* category, const char* name, int64_t startUs, int64_t durationUs);
+
+    /// Drain every thread's buffer into a Chrome trace JSON document
+    /// ({"traceEvents":[...]}); events are consumed by the dump
+    [[nodiscard]] std::string dumpJson();
+
+    /// Microseconds on the steady clock (trace timebase)
+    [[nodiscard]] static int64_t nowUs() noexcept {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    Tracer() = default;
+
+    // Per-thread buffers are bounded so a forgotten enabled tracer cannot
+    // grow without limit; once full the thread stops recording until a dump
+    static constexpr size_t MAX_EVENTS_PER_THREAD = 65536;
+
+    struct ThreadBuffer {
+        std::mutex mutex;
+        std::vector<TraceEvent> events;
+        uint32_t threadId = 0;
+    };
+
+    [[nodiscard]] ThreadBuffer& threadBuffer();
+
+    std::atomic<bool> m_enabled{false};
+    std::mutex m_registryMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+};
+
+#ifdef VDB_ETW_TRACELOGGING
+/// ETW (TraceLogging) mirror of the span sink, compiled in by the
+/// RelWithProfiling preset. Spans are written as events on the
+/// "VelocityDB-Trace" provider, so Windows Performance Analyzer can
+/// correlate them with sampled stacks on a user's machine without the
+/// in-memory tracer being switched on.
+namespace etw {
+/// One provider-enabled check; false whenever no ETW session listens
+[[nodiscard]] bool providerEnabled() noexcept;
+void writeSpan(const char* category, const char* name, int64_t startUs, int64_t durationUs) noexcept;
+}  // namespace etw
+#endif
+
+/// RAII span: captures the start time on construction and records the
+/// completed event on destruction. Category and name must be string
+/// literals (they are stored as pointers).
+class TraceSpan {
+public:
+    TraceSpan(const char* category, const char* name) {
+        bool armed = Tracer::instance().isEnabled();
+#ifdef VDB_ETW_TRACELOGGING
+        armed = armed || etw::providerEnabled();
+#endif
+        if (armed) [[unlikely]] {
+            m_category = category;
+            m_name = name;
+            m_startUs = Tracer::nowUs();
+        }
+    }
+
+    ~TraceSpan() {
+        if (m_name != nullptr) {
+            const auto durationUs = Tracer::nowUs() - m_startUs;
+#ifdef VDB_ETW_TRACELOGGING
+            etw::writeSpan(m_category, m_name, m_startUs, durationUs);
+#endif
+            if (Tracer::instance().isEnabled()) {
+                Tracer::instance().record(m_category, m_name, m_startUs, durationUs);
+            }
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* m_category = nullptr;
+    const char* m_name = nullptr;
+    int64_t m_startUs = 0;
+};
+
+// Scoped span with a unique local name, usable several times per scope
+#define VDB_TRACE_CONCAT_INNER(a, b) a##b
+#define VDB_TRACE_CONCAT(a, b) VDB_TRACE_CONCAT_INNER(a, b)
+#define VDB_TRACE_SPAN(category, name) ::velocitydb::TraceSpan VDB_TRACE_CONCAT(traceSpan_, __LINE__)(category, name)
+
+}  // namespace velocitydb
@@ -4,6 +4,7 @@
 
 #include <expected>
 #include <filesystem>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -46,6 +47,12 @@ private:
     std::unique_ptr<IPCHandler> m_ipcHandler;
     std::unique_ptr<webview::webview> m_webview;
     std::unique_ptr<SettingsManager> m_settingsManager;
+
+    // Startup work kicked off in the constructor and joined in
+    // createAndConfigureWebView, so it overlaps WebView2 environment
+    // creation on the main thread
+    std::future<std::unique_ptr<IPCHandler>> m_ipcHandlerFuture;
+    std::future<void> m_settingsLoadFuture;
 };
 
 }  // namespace velocitydb
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+#include "database/result_cache.h"
+#include "support/result_generator.h"
+
+#include <format>
+#include <memory>
+#include <string>
+
+namespace velocitydb {
+namespace bench {
+
+namespace {
+
+std::shared_ptr<const ResultSet> makeResult(size_t rows) {
+    return std::make_shared<const ResultSet>(test::generateResultSet(test::mixedWorkloadSpec(rows)));
+}
+
+void BM_ResultCachePut(benchmark::State& state) {
+    ResultCache cache;
+    const auto result = makeResult(static_cast<size_t>(state.range(0)));
+    size_t key = 0;
+    for (auto _ : state) {
+        cache.put(std::format("conn1:query-{}", key++), result, {"orders"});
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ResultCacheGetHit(benchmark::State& state) {
+    ResultCache cache;
+    cache.put("conn1:hot-query", makeResult(static_cast<size_t>(state.range(0))), {"orders"});
+    for (auto _ : state) {
+        auto hit = cache.get("conn1:hot-query");
+        benchmark::DoNotOptimize(hit);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ResultCacheGetMiss(benchmark::State& state) {
+    ResultCache cache;
+    for (auto _ : state) {
+        auto miss = cache.get("conn1:never-stored");
+        benchmark::DoNotOptimize(miss);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ResultCachePut)->Arg(100)->Arg(1000);
+BENCHMARK(BM_ResultCacheGetHit)->Arg(100)->Arg(1000);
+BENCHMARK(BM_ResultCacheGetMiss);
+
+}  // namespace bench
+}  // namespace velocitydb
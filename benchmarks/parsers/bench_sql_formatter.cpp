@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include "parsers/sql_formatter.h"
+
+#include <string>
+
+namespace velocitydb {
+namespace bench {
+
+namespace {
+
+constexpr std::string_view REPORT_QUERY = R"(
+select o.orderid, o.orderdate, c.companyname, c.contactname, sum(od.unitprice * od.quantity * (1 - od.discount)) as total,
+case when o.shippeddate is null then 'PENDING' else 'SHIPPED' end as shipstate
+from orders o inner join customers c on c.customerid = o.customerid
+inner join [order details] od on od.orderid = o.orderid
+left join shippers s on s.shipperid = o.shipvia
+where o.orderdate >= '2024-01-01' and o.orderdate < '2025-01-01' and c.country in ('Japan', 'Germany', 'USA')
+group by o.orderid, o.orderdate, c.companyname, c.contactname, o.shippeddate
+having sum(od.unitprice * od.quantity * (1 - od.discount)) > 1000
+order by total desc
+)";
+
+/// One statement repeated into a script the size of a typical saved
+/// worksheet; formatting cost should scale linearly with this
+std::string makeScript(size_t statements) {
+    std::string script;
+    script.reserve(REPORT_QUERY.size() * statements + statements * 2);
+    for (size_t i = 0; i < statements; ++i) {
+        script += REPORT_QUERY;
+        script += ";\n";
+    }
+    return script;
+}
+
+void BM_FormatStatement(benchmark::State& state) {
+    SQLFormatter formatter;
+    const SQLFormatter::FormatOptions options;
+    for (auto _ : state) {
+        auto formatted = formatter.format(REPORT_QUERY, options);
+        benchmark::DoNotOptimize(formatted);
+    }
+}
+
+void BM_FormatScript(benchmark::State& state) {
+    SQLFormatter formatter;
+    const SQLFormatter::FormatOptions options;
+    const auto script = makeScript(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto formatted = formatter.format(script, options);
+        benchmark::DoNotOptimize(formatted);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FormatRangeSingleEdit(benchmark::State& state) {
+    SQLFormatter formatter;
+    const SQLFormatter::FormatOptions options;
+    const auto script = makeScript(static_cast<size_t>(state.range(0)));
+    // Edit in the middle of the script; incremental mode should stay flat
+    // while BM_FormatScript grows with the statement count
+    const size_t editAt = script.size() / 2;
+    for (auto _ : state) {
+        auto formatted = formatter.formatRange(script, editAt, editAt + 10, options);
+        benchmark::DoNotOptimize(formatted);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_FormatStatement);
+BENCHMARK(BM_FormatScript)->Arg(10)->Arg(100);
+BENCHMARK(BM_FormatRangeSingleEdit)->Arg(10)->Arg(100);
+
+}  // namespace bench
+}  // namespace velocitydb
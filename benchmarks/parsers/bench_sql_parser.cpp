@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+#include "parsers/sql_parser.h"
+
+#include <format>
+#include <string>
+
+namespace velocitydb {
+namespace bench {
+
+namespace {
+
+/// Script with the separators splitStatements has to get right: quoted
+/// semicolons, comments, and GO batch markers
+std::string makeScript(size_t statements) {
+    std::string script;
+    for (size_t i = 0; i < statements; ++i) {
+        script += std::format("UPDATE accounts SET note = 'batch; {}' WHERE id = {}; -- step {}\n", i, i, i);
+        if (i % 10 == 9) {
+            script += "GO\n";
+        }
+    }
+    return script;
+}
+
+void BM_SplitStatements(benchmark::State& state) {
+    const auto script = makeScript(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto statements = SQLParser::splitStatements(script);
+        benchmark::DoNotOptimize(statements);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ExtractTableNames(benchmark::State& state) {
+    const auto script = makeScript(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto tables = SQLParser::extractTableNames(script);
+        benchmark::DoNotOptimize(tables);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_SplitStatements)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_ExtractTableNames)->Arg(100)->Arg(1000);
+
+}  // namespace bench
+}  // namespace velocitydb
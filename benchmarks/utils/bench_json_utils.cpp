@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+#include "database/sqlserver_driver.h"
+#include "support/result_generator.h"
+#include "utils/json_utils.h"
+
+#include <string>
+
+namespace velocitydb {
+namespace bench {
+
+namespace {
+
+void BM_SerializeResultSet(benchmark::State& state) {
+    const auto result = test::generateResultSet(test::mixedWorkloadSpec(static_cast<size_t>(state.range(0))));
+    for (auto _ : state) {
+        auto json = JsonUtils::serializeResultSet(result, false);
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SerializeResultSetChunked(benchmark::State& state) {
+    const auto result = test::generateResultSet(test::mixedWorkloadSpec(static_cast<size_t>(state.range(0))));
+    for (auto _ : state) {
+        size_t total = 0;
+        JsonUtils::serializeResultSetChunked(result, false, 256 * 1024, [&](std::string_view chunk, bool) { total += chunk.size(); });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_SerializeResultSet)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK(BM_SerializeResultSetChunked)->Arg(10000)->Arg(100000);
+
+}  // namespace bench
+}  // namespace velocitydb
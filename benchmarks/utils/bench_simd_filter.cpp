@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include "support/result_generator.h"
+#include "utils/simd_filter.h"
+
+#include <string>
+
+namespace velocitydb {
+namespace bench {
+
+namespace {
+
+// Shared corpus columns: 0 = id (INT), 1 = status (8 distinct), 2 = message
+
+void BM_FilterContains(benchmark::State& state) {
+    const auto data = test::generateResultSet(test::mixedWorkloadSpec(static_cast<size_t>(state.range(0))));
+    SIMDFilter filter;
+    for (auto _ : state) {
+        auto matches = filter.filterContains(data, 2, "ab");
+        benchmark::DoNotOptimize(matches);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_FilterEqualsLowCardinality(benchmark::State& state) {
+    const auto data = test::generateResultSet(test::mixedWorkloadSpec(static_cast<size_t>(state.range(0))));
+    const std::string needle(data.rows.front().values[1]);
+    SIMDFilter filter;
+    for (auto _ : state) {
+        auto matches = filter.filterEquals(data, 1, needle);
+        benchmark::DoNotOptimize(matches);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SortByColumnNumeric(benchmark::State& state) {
+    const auto data = test::generateResultSet(test::mixedWorkloadSpec(static_cast<size_t>(state.range(0))));
+    SIMDFilter filter;
+    for (auto _ : state) {
+        auto order = filter.sortByColumn(data, 0, /*ascending=*/false);
+        benchmark::DoNotOptimize(order);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SortByColumnString(benchmark::State& state) {
+    const auto data = test::generateResultSet(test::mixedWorkloadSpec(static_cast<size_t>(state.range(0))));
+    SIMDFilter filter;
+    for (auto _ : state) {
+        auto order = filter.sortByColumn(data, 2, /*ascending=*/true);
+        benchmark::DoNotOptimize(order);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_FilterContains)->Arg(10000)->Arg(100000)->Arg(500000);
+BENCHMARK(BM_FilterEqualsLowCardinality)->Arg(10000)->Arg(100000);
+BENCHMARK(BM_SortByColumnNumeric)->Arg(10000)->Arg(100000);
+BENCHMARK(BM_SortByColumnString)->Arg(10000)->Arg(100000);
+
+}  // namespace bench
+}  // namespace velocitydb
@@ -7,6 +7,21 @@ declare global {
   }
 }
 
+// Compound filter tree for filterResultSet: AND/OR groups of per-column
+// conditions, evaluated backend-side in one pass with selection vectors
+export interface CompoundFilterCondition {
+  columnIndex: number;
+  filterType: 'equals' | 'contains' | 'range';
+  filterValue: string;
+  filterValueMax?: string;
+}
+
+export interface CompoundFilterGroup {
+  combine: 'and' | 'or';
+  conditions?: CompoundFilterCondition[];
+  groups?: CompoundFilterGroup[];
+}
+
 class Bridge {
   private async call<T>(method: string, params: Record<string, unknown> = {}): Promise<T> {
     const request: IPCRequest = {
@@ -149,7 +164,10 @@ class Bridge {
   async executeQuery(
     connectionId: string,
     sql: string,
-    useCache = true
+    useCache = true,
+    // Statements per auto-commit transaction for multi-statement DML
+    // scripts; overrides the dmlBatchSize setting, 0 disables batching
+    batchSize?: number
   ): Promise<{
     columns: { name: string; type: string; comment?: string }[];
     rows: string[][];
@@ -157,7 +175,7 @@ class Bridge {
     executionTimeMs: number;
     cached: boolean;
   }> {
-    return this.call('executeQuery', { connectionId, sql, useCache });
+    return this.call('executeQuery', { connectionId, sql, useCache, batchSize });
   }
 
   async executeQueryPaginated(
@@ -181,8 +199,12 @@ class Bridge {
     });
   }
 
-  async getRowCount(connectionId: string, sql: string): Promise<{ rowCount: number }> {
-    return this.call('getRowCount', { connectionId, sql });
+  async getRowCount(
+    connectionId: string,
+    sql: string,
+    options?: { table?: string; exact?: boolean }
+  ): Promise<{ rowCount: number; approximate: boolean }> {
+    return this.call('getRowCount', { connectionId, sql, ...options });
   }
 
   async cancelQuery(connectionId: string): Promise<void> {
@@ -291,6 +313,26 @@ class Bridge {
     return this.call('getQueryHistory', {});
   }
 
+  async getQueryStatistics(options?: {
+    sortBy?: 'totalTime' | 'p95' | 'count';
+    limit?: number;
+  }): Promise<{
+    statistics: {
+      fingerprint: string;
+      exampleSql: string;
+      runCount: number;
+      failureCount: number;
+      totalTimeMs: number;
+      avgMs: number;
+      p50Ms: number;
+      p95Ms: number;
+      maxMs: number;
+      totalAffectedRows: number;
+    }[];
+  }> {
+    return this.call('getQueryStatistics', { ...options });
+  }
+
   // A5:ER methods
   async parseA5ER(filepath: string): Promise<{
     name: string;
@@ -331,12 +373,33 @@ class Bridge {
   }
 
   // Execution plan methods
+  // Cached plans come back immediately; misses run on the backend's async
+  // executor and are polled here so dispatch never blocks on SHOWPLAN
   async getExecutionPlan(
     connectionId: string,
     sql: string,
     actual = false
-  ): Promise<{ plan: string; actual: boolean }> {
-    return this.call('getExecutionPlan', { connectionId, sql, actual });
+  ): Promise<{ plan: string; actual: boolean; cached: boolean }> {
+    const submitted = await this.call<{ plan?: string; cached?: boolean; queryId?: string }>(
+      'getExecutionPlan',
+      { connectionId, sql, actual }
+    );
+    if (submitted.plan !== undefined) {
+      return { plan: submitted.plan, actual, cached: submitted.cached === true };
+    }
+    if (submitted.queryId === undefined) {
+      throw new Error('Execution plan request returned neither a plan nor a queryId');
+    }
+
+    for (;;) {
+      await new Promise((resolve) => setTimeout(resolve, 100));
+      const result = await this.call<{ status: string; plan?: string }>('getExecutionPlanResult', {
+        queryId: submitted.queryId,
+      });
+      if (result.status === 'completed' && result.plan !== undefined) {
+        return { plan: result.plan, actual, cached: false };
+      }
+    }
   }
 
   // Cache methods
@@ -353,13 +416,22 @@ class Bridge {
   }
 
   // Async query methods
-  async executeAsyncQuery(connectionId: string, sql: string): Promise<{ queryId: string }> {
-    return this.call('executeAsyncQuery', { connectionId, sql });
+  async executeAsyncQuery(
+    connectionId: string,
+    sql: string,
+    // parallel opts a script of independent statements into fan-out across
+    // pool connections; the backend falls back to serial when ineligible.
+    // timeoutSeconds overrides the watchdog budget for this run (0 disables)
+    options?: { parallel?: boolean; timeoutSeconds?: number }
+  ): Promise<{ queryId: string; parallel?: boolean }> {
+    return this.call('executeAsyncQuery', { connectionId, sql, ...options });
   }
 
   async getAsyncQueryResult(queryId: string): Promise<{
     queryId: string;
     status: 'pending' | 'running' | 'completed' | 'cancelled' | 'failed';
+    // First rows of a still-running query; the completed poll replaces them
+    partial?: boolean;
     error?: string;
     // Single result
     columns?: { name: string; type: string; comment?: string }[];
@@ -414,6 +486,38 @@ class Bridge {
     });
   }
 
+  async filterResultSetCompound(
+    connectionId: string,
+    sql: string,
+    filter: CompoundFilterGroup
+  ): Promise<{
+    columns: { name: string; type: string }[];
+    rows: string[][];
+    totalRows: number;
+    filteredRows: number;
+    simdAvailable: boolean;
+  }> {
+    return this.call('filterResultSet', { connectionId, sql, filter });
+  }
+
+  // Diff methods
+  async diffResultSets(
+    beforeQueryId: string,
+    afterQueryId: string,
+    keyColumns?: number[]
+  ): Promise<{
+    addedCount: number;
+    removedCount: number;
+    changedCount: number;
+    unchangedCount: number;
+    truncated: boolean;
+    added: number[];
+    removed: number[];
+    changed: { beforeRow: number; afterRow: number; columns: number[] }[];
+  }> {
+    return this.call('diffResultSets', { beforeQueryId, afterQueryId, keyColumns });
+  }
+
   // Settings methods
   async getSettings(): Promise<{
     general: {
@@ -746,13 +850,20 @@ class Bridge {
       id: string;
       name: string;
       content: string;
+      connectionId?: string;
+      refreshIntervalSeconds?: number;
     }[]
   > {
     return this.call('getBookmarks', {});
   }
 
-  async saveBookmark(id: string, name: string, content: string): Promise<void> {
-    return this.call('saveBookmark', { id, name, content });
+  async saveBookmark(
+    id: string,
+    name: string,
+    content: string,
+    options?: { connectionId?: string; refreshIntervalSeconds?: number }
+  ): Promise<void> {
+    return this.call('saveBookmark', { id, name, content, ...options });
   }
 
   async deleteBookmark(id: string): Promise<void> {
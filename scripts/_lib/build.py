@@ -98,10 +98,15 @@ def build_frontend(clean: bool = False) -> bool:
 
 def build_backend(build_type: str = "Release", clean: bool = False) -> bool:
     """Build the backend."""
-    if build_type not in ("Debug", "Release"):
-        print(f"ERROR: Invalid build type '{build_type}'. Use 'Debug' or 'Release'")
+    if build_type not in ("Debug", "Release", "Profiling"):
+        print(f"ERROR: Invalid build type '{build_type}'. Use 'Debug', 'Release', or 'Profiling'")
         return False
 
+    # Profiling = RelWithDebInfo + ETW TraceLogging (the relwithprofiling
+    # preset): optimized code with frame pointers and symbols for WPA
+    profiling = build_type == "Profiling"
+    cmake_build_type = "RelWithDebInfo" if profiling else build_type
+
     project_root = utils.get_project_root()
     build_dir = project_root / "build"
 
@@ -135,9 +140,11 @@ def build_backend(build_type: str = "Release", clean: bool = False) -> bool:
     # Configure
     print("\n[3/4] Configuring with CMake...")
     if has_ninja:
-        cmake_cmd = ["cmake", "-B", "build", "-G", "Ninja", f"-DCMAKE_BUILD_TYPE={build_type}"]
+        cmake_cmd = ["cmake", "-B", "build", "-G", "Ninja", f"-DCMAKE_BUILD_TYPE={cmake_build_type}"]
     else:
         cmake_cmd = ["cmake", "-B", "build", "-G", "Visual Studio 17 2022", "-A", "x64"]
+    if profiling:
+        cmake_cmd.append("-DENABLE_ETW_TRACELOGGING=ON")
 
     success, stderr = utils.run_command(cmake_cmd, "CMake Configure", env=env, capture_output=True)
     if not success:
@@ -146,14 +153,14 @@ def build_backend(build_type: str = "Release", clean: bool = False) -> bool:
 
     # Build
     print("\n[4/4] Building...")
-    build_cmd = ["cmake", "--build", "build", "--config", build_type, "--parallel"]
+    build_cmd = ["cmake", "--build", "build", "--config", cmake_build_type, "--parallel"]
     success, _ = utils.run_command(build_cmd, f"CMake Build ({build_type})", env=env)
     if not success:
         print("\nERROR: Build failed")
         return False
 
     # Find executable
-    exe_path = build_dir / build_type / "VelocityDB.exe"
+    exe_path = build_dir / cmake_build_type / "VelocityDB.exe"
     if not exe_path.exists():
         for exe in build_dir.rglob("VelocityDB.exe"):
             exe_path = exe
@@ -169,7 +176,7 @@ def build_backend(build_type: str = "Release", clean: bool = False) -> bool:
     # Copy frontend files
     print("\n[Post-Build] Copying frontend files...")
     frontend_dist = project_root / "frontend" / "dist"
-    frontend_target = build_dir / build_type / "frontend"
+    frontend_target = build_dir / cmake_build_type / "frontend"
 
     if frontend_dist.exists():
         try:
@@ -177,7 +184,7 @@ def build_backend(build_type: str = "Release", clean: bool = False) -> bool:
                 shutil.rmtree(frontend_target)
             shutil.copytree(frontend_dist, frontend_target)
             file_count = sum(1 for _ in frontend_target.rglob("*") if _.is_file())
-            print(f"  [OK] Copied: frontend/dist -> build/{build_type}/frontend")
+            print(f"  [OK] Copied: frontend/dist -> build/{cmake_build_type}/frontend")
             print(f"  Files: {file_count}")
         except Exception as e:
             print(f"  [FAIL] {e}")
@@ -1,5 +1,8 @@
 """Test commands for Velocity-DB."""
 
+import shutil
+from datetime import datetime
+
 from . import utils
 
 
@@ -74,3 +77,108 @@ def test_backend(build_type: str = "Release") -> bool:
         print("\n[FAIL] Tests failed")
 
     return success
+
+
+def bench_backend(
+    build_type: str = "Release",
+    filter_pattern: str | None = None,
+    baseline: bool = False,
+) -> bool:
+    """Build and run the backend microbenchmarks."""
+    if build_type not in ("Debug", "Release"):
+        print(f"ERROR: Invalid build type '{build_type}'")
+        return False
+
+    project_root = utils.get_project_root()
+    build_dir = project_root / "build"
+
+    print(f"\n{'#' * 60}")
+    print(f"#  Running Backend Benchmarks ({build_type})")
+    print(f"{'#' * 60}")
+
+    # Setup MSVC environment
+    env = utils.get_msvc_env()
+
+    # Configure with benchmarks enabled (no-op when the cache already has it)
+    has_ninja = shutil.which("ninja") is not None
+    build_dir.mkdir(exist_ok=True)
+    if has_ninja:
+        cmake_cmd = [
+            "cmake",
+            "-B",
+            "build",
+            "-G",
+            "Ninja",
+            f"-DCMAKE_BUILD_TYPE={build_type}",
+            "-DBUILD_BENCHMARKS=ON",
+        ]
+    else:
+        cmake_cmd = [
+            "cmake",
+            "-B",
+            "build",
+            "-G",
+            "Visual Studio 17 2022",
+            "-A",
+            "x64",
+            "-DBUILD_BENCHMARKS=ON",
+        ]
+    success, _ = utils.run_command(cmake_cmd, "CMake Configure", env=env, capture_output=True)
+    if not success:
+        print("\nERROR: CMake configuration failed")
+        return False
+
+    build_cmd = [
+        "cmake",
+        "--build",
+        "build",
+        "--config",
+        build_type,
+        "--target",
+        "VelocityDBBenchmarks",
+        "--parallel",
+    ]
+    success, _ = utils.run_command(build_cmd, "CMake Build (benchmarks)", env=env)
+    if not success:
+        print("\nERROR: Benchmark build failed")
+        return False
+
+    exe_path = build_dir / build_type / "VelocityDBBenchmarks.exe"
+    if not exe_path.exists():
+        for exe in build_dir.rglob("VelocityDBBenchmarks.exe"):
+            exe_path = exe
+            break
+    if not exe_path.exists():
+        print("\nERROR: VelocityDBBenchmarks.exe not found")
+        return False
+
+    # Baseline runs overwrite the comparison file; normal runs are
+    # timestamped so nothing clobbers the history
+    if baseline:
+        out_path = project_root / "log" / "benchmark-baseline.json"
+    else:
+        stamp = datetime.now().strftime("%Y%m%d-%H%M%S")
+        out_path = project_root / "log" / f"benchmark-{stamp}.json"
+    out_path.parent.mkdir(exist_ok=True)
+
+    bench_cmd = [
+        str(exe_path),
+        "--benchmark_out_format=json",
+        f"--benchmark_out={out_path}",
+    ]
+    if filter_pattern:
+        bench_cmd.append(f"--benchmark_filter={filter_pattern}")
+
+    success, _ = utils.run_command(bench_cmd, "Benchmarks", env=env)
+
+    if success:
+        print(f"\n[OK] Benchmark results: {out_path}")
+        if not baseline:
+            baseline_path = project_root / "log" / "benchmark-baseline.json"
+            if baseline_path.exists():
+                print(f"     Compare against: {baseline_path}")
+                print("     (google-benchmark tools/compare.py benchmarks <baseline> <run>)")
+    else:
+        print("\n[FAIL] Benchmarks failed")
+
+    return success
@@ -9,6 +9,7 @@ Usage:
     uv run scripts/pdg.py build [backend|frontend|all] [--clean]
     uv run scripts/pdg.py debug [--clean]              # Backend Debug build
     uv run scripts/pdg.py test [backend|frontend] [--watch]
+    uv run scripts/pdg.py bench [backend] [--filter PATTERN] [--baseline]
     uv run scripts/pdg.py lint [--fix] [--unsafe]
     uv run scripts/pdg.py dev
     uv run scripts/pdg.py package
@@ -21,6 +22,7 @@ Examples:
     uv run scripts/pdg.py build all
     uv run scripts/pdg.py debug                        # Quick debug build
     uv run scripts/pdg.py test frontend --watch
+    uv run scripts/pdg.py bench backend --filter BM_Serialize
     uv run scripts/pdg.py lint --fix
     uv run scripts/pdg.py lint --fix --unsafe
     uv run scripts/pdg.py clean logs
@@ -73,6 +75,19 @@ def cmd_test(args):
         return False
 
 
+def cmd_bench(args):
+    """Handle bench command."""
+    target = args.target
+
+    if target == "backend":
+        return test.bench_backend(
+            build_type=args.type, filter_pattern=args.filter, baseline=args.baseline
+        )
+    else:
+        print(f"ERROR: Unknown bench target: {target}")
+        return False
+
+
 def cmd_lint(args):
     """Handle lint command."""
     fix = args.fix
@@ -498,9 +513,9 @@ def main():
     build_parser.add_argument(
         "--type",
         "-t",
-        choices=["Debug", "Release"],
+        choices=["Debug", "Release", "Profiling"],
         default="Release",
-        help="Build type for backend (default: Release)",
+        help="Build type for backend (default: Release; Profiling = RelWithDebInfo + ETW)",
     )
 
     # Debug command (shortcut for build backend --type Debug)
@@ -529,6 +544,31 @@ def main():
         help="Build type for backend tests (default: Release)",
     )
 
+    # Bench command
+    bench_parser = subparsers.add_parser("bench", help="Run microbenchmarks")
+    bench_parser.add_argument(
+        "target",
+        choices=["backend"],
+        default="backend",
+        nargs="?",
+        help="Benchmark target (default: backend)",
+    )
+    bench_parser.add_argument(
+        "--filter", "-f", help="Only run benchmarks matching this regex"
+    )
+    bench_parser.add_argument(
+        "--baseline",
+        action="store_true",
+        help="Write results to log/benchmark-baseline.json for later comparison",
+    )
+    bench_parser.add_argument(
+        "--type",
+        "-t",
+        choices=["Debug", "Release"],
+        default="Release",
+        help="Build type (default: Release)",
+    )
+
     # Lint command
     lint_parser = subparsers.add_parser("lint", aliases=["l"], help="Lint code")
     lint_parser.add_argument("--fix", "-f", action="store_true", help="Auto-fix issues")
@@ -582,6 +622,7 @@ def main():
         "debug": cmd_debug,
         "test": cmd_test,
         "t": cmd_test,
+        "bench": cmd_bench,
         "lint": cmd_lint,
         "l": cmd_lint,
         "dev": cmd_dev,
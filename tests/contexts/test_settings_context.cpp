@@ -15,11 +15,11 @@ protected:
 TEST_F(SettingsContextTest, AccessSettingsManager) {
     // Verify direct access to SettingsManager works
     auto& manager = ctx.settingsManager();
-    const auto& settings = manager.getSettings();
+    const auto settings = manager.getSettings();
 
     // Default settings should have reasonable values
-    EXPECT_GT(settings.editor.fontSize, 0);
-    EXPECT_FALSE(settings.editor.fontFamily.empty());
+    EXPECT_GT(settings->editor.fontSize, 0);
+    EXPECT_FALSE(settings->editor.fontFamily.empty());
 }
 
 TEST_F(SettingsContextTest, AccessSessionManager) {
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "database/columnar_result.h"
+
+namespace velocitydb {
+namespace test {
+
+namespace {
+
+ResultSet makeRowResult() {
+    ResultSet result;
+    result.columns = {
+        {.name = "id", .type = "INT"},
+        {.name = "name", .type = "NVARCHAR"},
+    };
+    result.rows.push_back({.values = {"1", "alpha"}});
+    result.rows.push_back({.values = {"2", ""}});
+    result.rows.push_back({.values = {"3", "gamma"}});
+    result.affectedRows = 3;
+    result.executionTimeMs = 1.5;
+    return result;
+}
+
+}  // namespace
+
+class ColumnarResultTest : public ::testing::Test {};
+
+TEST_F(ColumnarResultTest, AppendAndReadCells) {
+    ColumnBuffer buffer;
+    buffer.append("hello");
+    buffer.appendNull();
+    buffer.append("world");
+
+    EXPECT_EQ(buffer.rowCount(), 3);
+    EXPECT_EQ(buffer.cell(0), "hello");
+    EXPECT_TRUE(buffer.isNull(1));
+    EXPECT_EQ(buffer.cell(1), "");
+    EXPECT_EQ(buffer.cell(2), "world");
+    EXPECT_FALSE(buffer.isNull(2));
+}
+
+TEST_F(ColumnarResultTest, FromRowsPreservesData) {
+    auto columnar = ColumnarResultSet::fromRows(makeRowResult());
+
+    EXPECT_EQ(columnar.rowCount, 3);
+    ASSERT_EQ(columnar.columnData.size(), 2);
+    EXPECT_EQ(columnar.cell(0, 0), "1");
+    EXPECT_EQ(columnar.cell(0, 1), "alpha");
+    EXPECT_EQ(columnar.cell(1, 1), "");
+    EXPECT_EQ(columnar.cell(2, 1), "gamma");
+    EXPECT_EQ(columnar.affectedRows, 3);
+}
+
+TEST_F(ColumnarResultTest, RoundTripMatchesOriginal) {
+    auto original = makeRowResult();
+    auto roundTripped = ColumnarResultSet::fromRows(original).toRows();
+
+    ASSERT_EQ(roundTripped.rows.size(), original.rows.size());
+    for (size_t i = 0; i < original.rows.size(); ++i) {
+        EXPECT_EQ(roundTripped.rows[i].values, original.rows[i].values);
+    }
+    EXPECT_EQ(roundTripped.columns.size(), original.columns.size());
+}
+
+TEST_F(ColumnarResultTest, TypedAppendKeepsTextAndNativeAligned) {
+    ColumnBuffer buffer;
+    buffer.valueType = ColumnValueType::Int64;
+    buffer.appendInt64(42);
+    buffer.appendNull();
+    buffer.appendInt64(-7);
+
+    ASSERT_EQ(buffer.rowCount(), 3);
+    ASSERT_EQ(buffer.intValues.size(), 3);
+    EXPECT_EQ(buffer.intValues[0], 42);
+    EXPECT_EQ(buffer.intValues[2], -7);
+    EXPECT_TRUE(buffer.isNull(1));
+    EXPECT_EQ(buffer.cell(0), "42");
+    EXPECT_EQ(buffer.cell(2), "-7");
+}
+
+TEST_F(ColumnarResultTest, TypedDoubleAndBoolMaterializeText) {
+    ColumnBuffer doubles;
+    doubles.valueType = ColumnValueType::Double;
+    doubles.appendDouble(2.5);
+    ASSERT_EQ(doubles.doubleValues.size(), 1);
+    EXPECT_DOUBLE_EQ(doubles.doubleValues[0], 2.5);
+    EXPECT_EQ(doubles.cell(0), "2.5");
+
+    ColumnBuffer bools;
+    bools.valueType = ColumnValueType::Bool;
+    bools.appendBool(true);
+    bools.appendBool(false);
+    ASSERT_EQ(bools.intValues.size(), 2);
+    EXPECT_EQ(bools.cell(0), "1");
+    EXPECT_EQ(bools.cell(1), "0");
+}
+
+TEST_F(ColumnarResultTest, InternStringsDictionaryEncodesRepeatedValues) {
+    ColumnBuffer buffer;
+    for (int i = 0; i < 300; ++i) {
+        buffer.append(i % 2 == 0 ? "ACTIVE" : "SUSPENDED");
+    }
+
+    const auto plainBytes = buffer.data.size();
+    ASSERT_TRUE(buffer.internStrings());
+
+    EXPECT_TRUE(buffer.isDictionary());
+    EXPECT_EQ(buffer.rowCount(), 300);
+    EXPECT_LT(buffer.data.size(), plainBytes);
+    EXPECT_EQ(buffer.offsets.size(), 3u);  // Two distinct values
+    for (size_t row = 0; row < buffer.rowCount(); ++row) {
+        EXPECT_EQ(buffer.cell(row), row % 2 == 0 ? "ACTIVE" : "SUSPENDED");
+    }
+}
+
+TEST_F(ColumnarResultTest, InternStringsBailsOnHighCardinality) {
+    ColumnBuffer buffer;
+    for (int i = 0; i < 300; ++i) {
+        buffer.append(std::to_string(i));
+    }
+
+    EXPECT_FALSE(buffer.internStrings(16));
+    EXPECT_FALSE(buffer.isDictionary());
+    EXPECT_EQ(buffer.cell(299), "299");
+}
+
+TEST_F(ColumnarResultTest, InternedColumnRoundTripsThroughRows) {
+    ResultSet rows;
+    rows.columns = {{.name = "status", .type = "NVARCHAR"}};
+    for (int i = 0; i < 100; ++i) {
+        ResultRow row;
+        row.values.emplace_back(i % 3 == 0 ? "OPEN" : "CLOSED");
+        rows.rows.push_back(std::move(row));
+    }
+
+    auto columnar = ColumnarResultSet::fromRows(rows);
+    columnar.internLowCardinalityColumns();
+    ASSERT_TRUE(columnar.columnData[0].isDictionary());
+
+    auto roundTripped = columnar.toRows();
+    ASSERT_EQ(roundTripped.rows.size(), rows.rows.size());
+    for (size_t i = 0; i < rows.rows.size(); ++i) {
+        EXPECT_EQ(roundTripped.rows[i].values[0], rows.rows[i].values[0]);
+    }
+}
+
+TEST_F(ColumnarResultTest, EstimateSizeGrowsWithData) {
+    ColumnarResultSet empty;
+    auto populated = ColumnarResultSet::fromRows(makeRowResult());
+    EXPECT_GT(populated.estimateSizeBytes(), empty.estimateSizeBytes());
+}
+
+}  // namespace test
+}  // namespace velocitydb
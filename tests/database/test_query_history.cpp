@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include "database/query_history.h"
 
+#include <filesystem>
+#include <format>
+
 namespace velocitydb {
 namespace test {
 
@@ -120,5 +123,191 @@ TEST_F(QueryHistoryTest, RespectsMaxItems) {
     EXPECT_LE(all.size(), 5);
 }
 
+TEST_F(QueryHistoryTest, SearchExcludesRemovedItems) {
+    HistoryItem item;
+    item.id = "item-1";
+    item.sql = "SELECT * FROM Customers";
+    item.timestamp = std::chrono::system_clock::now();
+    item.success = true;
+
+    history.add(item);
+    ASSERT_EQ(history.search("Customers").size(), 1);
+
+    history.remove("item-1");
+
+    EXPECT_TRUE(history.search("Customers").empty());
+}
+
+TEST_F(QueryHistoryTest, SearchExcludesEvictedItems) {
+    QueryHistory smallHistory{2};
+
+    for (int i = 0; i < 3; ++i) {
+        HistoryItem item;
+        item.id = "item-" + std::to_string(i);
+        item.sql = "SELECT col" + std::to_string(i) + " FROM T";
+        item.timestamp = std::chrono::system_clock::now();
+        item.success = true;
+        smallHistory.add(item);
+    }
+
+    // item-0 was evicted by the cap; its trigrams must be gone too
+    EXPECT_TRUE(smallHistory.search("col0").empty());
+    EXPECT_EQ(smallHistory.search("col2").size(), 1);
+}
+
+TEST_F(QueryHistoryTest, SearchRejectsScatteredTrigramMatches) {
+    HistoryItem item;
+    item.id = "item-1";
+    // Contains the trigrams of "Users FROM" but not the phrase itself
+    item.sql = "SELECT * FROM Users";
+    item.timestamp = std::chrono::system_clock::now();
+    item.success = true;
+
+    history.add(item);
+
+    EXPECT_TRUE(history.search("Users FROM").empty());
+    EXPECT_EQ(history.search("FROM Users").size(), 1);
+}
+
+TEST_F(QueryHistoryTest, SearchShortKeywordStillMatches) {
+    HistoryItem item;
+    item.id = "item-1";
+    item.sql = "SELECT * FROM T1";
+    item.timestamp = std::chrono::system_clock::now();
+    item.success = true;
+
+    history.add(item);
+
+    EXPECT_EQ(history.search("T1").size(), 1);
+}
+
+class QueryHistoryLogTest : public ::testing::Test {
+protected:
+    void SetUp() override { logPath = std::filesystem::temp_directory_path() / "velocitydb_history_test.ndjson"; std::filesystem::remove(logPath); }
+    void TearDown() override { std::filesystem::remove(logPath); }
+
+    static HistoryItem makeItem(std::string id, std::string sql) {
+        HistoryItem item;
+        item.id = std::move(id);
+        item.sql = std::move(sql);
+        item.timestamp = std::chrono::system_clock::now();
+        item.success = true;
+        return item;
+    }
+
+    std::filesystem::path logPath;
+};
+
+TEST_F(QueryHistoryLogTest, ReplaysAppendedRecordsNewestFirst) {
+    {
+        QueryHistory history{100};
+        ASSERT_TRUE(history.openLog(logPath.string()));
+        history.add(makeItem("item-1", "SELECT 1"));
+        history.add(makeItem("item-2", "SELECT 2"));
+    }
+
+    QueryHistory replayed{100};
+    ASSERT_TRUE(replayed.openLog(logPath.string()));
+
+    auto all = replayed.getAll();
+    ASSERT_EQ(all.size(), 2u);
+    EXPECT_EQ(all[0].id, "item-2");
+    EXPECT_EQ(all[1].id, "item-1");
+    EXPECT_EQ(replayed.search("SELECT 1").size(), 1u);
+}
+
+TEST_F(QueryHistoryLogTest, RoundTripsSqlWithQuotesAndNewlines) {
+    {
+        QueryHistory history{100};
+        ASSERT_TRUE(history.openLog(logPath.string()));
+        history.add(makeItem("item-1", "SELECT 'it''s'\n  FROM \"T\"\tWHERE x = 1"));
+    }
+
+    QueryHistory replayed{100};
+    ASSERT_TRUE(replayed.openLog(logPath.string()));
+
+    auto all = replayed.getAll();
+    ASSERT_EQ(all.size(), 1u);
+    EXPECT_EQ(all[0].sql, "SELECT 'it''s'\n  FROM \"T\"\tWHERE x = 1");
+}
+
+TEST_F(QueryHistoryLogTest, CompactionKeepsLogNearTheCap) {
+    {
+        QueryHistory history{10};
+        ASSERT_TRUE(history.openLog(logPath.string()));
+        // Enough appends to cross the compaction slack past the cap
+        for (int i = 0; i < 1200; ++i) {
+            history.add(makeItem("item-" + std::to_string(i), "SELECT " + std::to_string(i)));
+        }
+    }
+
+    QueryHistory replayed{10};
+    ASSERT_TRUE(replayed.openLog(logPath.string()));
+
+    auto all = replayed.getAll();
+    ASSERT_EQ(all.size(), 10u);
+    EXPECT_EQ(all[0].id, "item-1199");
+}
+
+TEST_F(QueryHistoryLogTest, SkipsTornTrailingLine) {
+    {
+        QueryHistory history{100};
+        ASSERT_TRUE(history.openLog(logPath.string()));
+        history.add(makeItem("item-1", "SELECT 1"));
+    }
+    {
+        // Simulate a crash mid-append: an unterminated partial record
+        std::ofstream torn(logPath, std::ios::app);
+        torn << R"({"id":"item-2","sql":"SELE)";
+    }
+
+    QueryHistory replayed{100};
+    ASSERT_TRUE(replayed.openLog(logPath.string()));
+
+    auto all = replayed.getAll();
+    ASSERT_EQ(all.size(), 1u);
+    EXPECT_EQ(all[0].id, "item-1");
+}
+
+TEST_F(QueryHistoryTest, AggregateGroupsRunsByFingerprint) {
+    for (double ms : {10.0, 30.0, 20.0}) {
+        HistoryItem item;
+        item.id = std::format("h{}", ms);
+        item.sql = std::format("SELECT * FROM Users WHERE id = {}", static_cast<int>(ms));
+        item.executionTimeMs = ms;
+        item.affectedRows = 1;
+        history.add(item);
+    }
+    HistoryItem other;
+    other.id = "h-other";
+    other.sql = "SELECT * FROM Orders";
+    other.executionTimeMs = 100.0;
+    other.success = false;
+    history.add(other);
+
+    auto stats = history.aggregateByFingerprint();
+
+    ASSERT_EQ(stats.size(), 2u);
+    const auto& users = stats[0].runCount == 3 ? stats[0] : stats[1];
+    const auto& orders = stats[0].runCount == 3 ? stats[1] : stats[0];
+
+    EXPECT_EQ(users.fingerprint, "SELECT*FROM USERS WHERE ID=?");
+    EXPECT_EQ(users.exampleSql, "SELECT * FROM Users WHERE id = 20");  // Most recent run
+    EXPECT_EQ(users.runCount, 3u);
+    EXPECT_EQ(users.failureCount, 0u);
+    EXPECT_DOUBLE_EQ(users.totalTimeMs, 60.0);
+    EXPECT_DOUBLE_EQ(users.p50Ms, 20.0);
+    EXPECT_DOUBLE_EQ(users.maxMs, 30.0);
+    EXPECT_EQ(users.totalAffectedRows, 3);
+
+    EXPECT_EQ(orders.runCount, 1u);
+    EXPECT_EQ(orders.failureCount, 1u);
+    EXPECT_DOUBLE_EQ(orders.p95Ms, 100.0);
+}
+
+TEST_F(QueryHistoryTest, AggregateOnEmptyHistoryIsEmpty) {
+    EXPECT_TRUE(history.aggregateByFingerprint().empty());
+}
+
 }  // namespace test
 }  // namespace velocitydb
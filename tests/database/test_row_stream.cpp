@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "database/row_stream.h"
+
+namespace velocitydb {
+namespace test {
+
+namespace {
+
+ColumnarResultSet makeBatch(std::vector<std::vector<std::string>> rows) {
+    ColumnarResultSet batch;
+    batch.columns = {{.name = "id", .type = "INT"}, {.name = "status", .type = "NVARCHAR"}};
+    batch.columnData.resize(batch.columns.size());
+    for (const auto& row : rows) {
+        for (size_t col = 0; col < row.size(); ++col) {
+            batch.columnData[col].append(row[col]);
+        }
+        ++batch.rowCount;
+    }
+    return batch;
+}
+
+std::generator<ColumnarResultSet> yieldBatches(std::vector<ColumnarResultSet> batches) {
+    for (auto& batch : batches) {
+        co_yield std::move(batch);
+    }
+}
+
+}  // namespace
+
+class RowStreamTest : public ::testing::Test {};
+
+TEST_F(RowStreamTest, FilteredCompactsRowsAcrossBatches) {
+    std::vector<ColumnarResultSet> batches;
+    batches.push_back(makeBatch({{"1", "active"}, {"2", "deleted"}}));
+    batches.push_back(makeBatch({{"3", "active"}}));
+
+    auto keepActive = [](const ColumnarResultSet& batch, size_t row) { return batch.cell(row, 1) == "active"; };
+
+    size_t totalRows = 0;
+    std::vector<std::string> ids;
+    for (auto&& batch : rowstream::filtered(yieldBatches(std::move(batches)), keepActive)) {
+        totalRows += batch.rowCount;
+        for (size_t row = 0; row < batch.rowCount; ++row) {
+            ids.emplace_back(batch.cell(row, 0));
+        }
+    }
+
+    EXPECT_EQ(totalRows, 2u);
+    ASSERT_EQ(ids.size(), 2u);
+    EXPECT_EQ(ids[0], "1");
+    EXPECT_EQ(ids[1], "3");
+}
+
+TEST_F(RowStreamTest, FilteredSkipsBatchesLeftEmpty) {
+    std::vector<ColumnarResultSet> batches;
+    batches.push_back(makeBatch({{"1", "deleted"}}));
+    batches.push_back(makeBatch({{"2", "active"}}));
+
+    auto keepActive = [](const ColumnarResultSet& batch, size_t row) { return batch.cell(row, 1) == "active"; };
+
+    size_t batchCount = 0;
+    for ([[maybe_unused]] auto&& batch : rowstream::filtered(yieldBatches(std::move(batches)), keepActive)) {
+        ++batchCount;
+    }
+
+    EXPECT_EQ(batchCount, 1u);
+}
+
+TEST_F(RowStreamTest, ToJsonRowsFragmentsConcatenateWithCommas) {
+    std::vector<ColumnarResultSet> batches;
+    batches.push_back(makeBatch({{"1", "a\"b"}}));
+    batches.push_back(makeBatch({{"2", "ok"}}));
+
+    std::string joined;
+    for (auto&& fragment : rowstream::toJsonRows(yieldBatches(std::move(batches)))) {
+        joined += fragment;
+    }
+
+    EXPECT_EQ(joined, R"(["1","a\"b"],["2","ok"])");
+}
+
+TEST_F(RowStreamTest, ToJsonRowsSerializesNullAsEmptyString) {
+    ColumnarResultSet batch;
+    batch.columns = {{.name = "id", .type = "INT"}};
+    batch.columnData.resize(1);
+    batch.columnData[0].appendNull();
+    batch.rowCount = 1;
+
+    std::vector<ColumnarResultSet> batches;
+    batches.push_back(std::move(batch));
+
+    std::string joined;
+    for (auto&& fragment : rowstream::toJsonRows(yieldBatches(std::move(batches)))) {
+        joined += fragment;
+    }
+
+    EXPECT_EQ(joined, R"([""])");
+}
+
+}  // namespace test
+}  // namespace velocitydb
@@ -70,6 +70,15 @@ TEST_F(SchemaInspectorTest, GetForeignKeysReturnsEmptyWithoutDriver) {
     EXPECT_TRUE(fks.empty());
 }
 
+// Unit test: hydrateDatabaseSchema returns empty without driver
+TEST_F(SchemaInspectorTest, HydrateDatabaseSchemaReturnsEmptyWithoutDriver) {
+    SchemaInspector inspector;
+
+    auto schemas = inspector.hydrateDatabaseSchema("master");
+
+    EXPECT_TRUE(schemas.empty());
+}
+
 // Integration tests (require actual database)
 // These are disabled by default and should be run manually with a test database
 
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include "database/columnar_result.h"
 #include "database/sqlserver_driver.h"
 
 namespace velocitydb {
@@ -64,5 +65,29 @@ TEST_F(SQLServerDriverTest, DISABLED_ExecutesSimpleQuery) {
     driver.disconnect();
 }
 
+TEST_F(SQLServerDriverTest, DISABLED_BlockFetchInternsLowCardinalityColumns) {
+    SQLServerDriver driver;
+    std::string connectionString =
+        "Driver={ODBC Driver 17 for SQL Server};"
+        "Server=localhost;"
+        "Database=master;"
+        "Trusted_Connection=yes;";
+
+    ASSERT_TRUE(driver.connect(connectionString));
+
+    // A narrow VARCHAR column over 2048 rows: bindable, so the block-fetch
+    // path runs, and three distinct values make it dictionary-compactable
+    auto result = driver.executeColumnar(R"(
+        SELECT CAST(CASE number % 3 WHEN 0 THEN 'ACTIVE' WHEN 1 THEN 'PENDING' ELSE 'DELETED' END AS VARCHAR(16)) AS status
+        FROM master..spt_values WHERE type = 'P'
+    )");
+
+    ASSERT_EQ(result.columnData.size(), 1u);
+    EXPECT_GT(result.rowCount, 1000u);
+    EXPECT_TRUE(result.columnData[0].isDictionary());
+
+    driver.disconnect();
+}
+
 }  // namespace test
 }  // namespace velocitydb
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "exporters/excel_exporter.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace velocitydb {
+namespace test {
+
+class ExcelExporterTest : public ::testing::Test {
+protected:
+    ExcelExporter exporter;
+    std::string testFilePath = "test_export.xlsx";
+
+    void TearDown() override {
+        std::filesystem::remove(testFilePath);
+    }
+
+    ResultSet createTestResultSet() {
+        ResultSet result;
+
+        ColumnInfo col1;
+        col1.name = "id";
+        col1.type = "INT";
+        result.columns.push_back(col1);
+
+        ColumnInfo col2;
+        col2.name = "name";
+        col2.type = "VARCHAR";
+        result.columns.push_back(col2);
+
+        ResultRow row1;
+        row1.values = {"1", "Alice"};
+        result.rows.push_back(row1);
+
+        ResultRow row2;
+        row2.values = {"2", "Bob & <Co>"};
+        result.rows.push_back(row2);
+
+        return result;
+    }
+
+    std::string readFile() {
+        std::ifstream file(testFilePath, std::ios::binary);
+        std::ostringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+};
+
+TEST_F(ExcelExporterTest, WritesZipContainerWithSheetParts) {
+    auto data = createTestResultSet();
+
+    EXPECT_TRUE(exporter.exportData(data, testFilePath));
+
+    auto content = readFile();
+    // Zip local file header magic
+    ASSERT_GE(content.size(), 4u);
+    EXPECT_EQ(content.substr(0, 2), "PK");
+    // Sheet entries are stored uncompressed, so the parts are findable
+    EXPECT_NE(content.find("[Content_Types].xml"), std::string::npos);
+    EXPECT_NE(content.find("xl/worksheets/sheet1.xml"), std::string::npos);
+    EXPECT_NE(content.find("<sheetData>"), std::string::npos);
+}
+
+TEST_F(ExcelExporterTest, WritesHeaderAndEscapedCells) {
+    auto data = createTestResultSet();
+
+    EXPECT_TRUE(exporter.exportData(data, testFilePath));
+
+    auto content = readFile();
+    EXPECT_NE(content.find("<t>id</t>"), std::string::npos);
+    EXPECT_NE(content.find("<t>Alice</t>"), std::string::npos);
+    EXPECT_NE(content.find("<t>Bob &amp; &lt;Co&gt;</t>"), std::string::npos);
+}
+
+TEST_F(ExcelExporterTest, RespectsIncludeHeaderOption) {
+    auto data = createTestResultSet();
+
+    ExportOptions options;
+    options.includeHeader = false;
+    EXPECT_TRUE(exporter.exportData(data, testFilePath, options));
+
+    auto content = readFile();
+    EXPECT_EQ(content.find("<t>id</t>"), std::string::npos);
+    EXPECT_NE(content.find("<t>Alice</t>"), std::string::npos);
+}
+
+TEST_F(ExcelExporterTest, UsesConfiguredSheetName) {
+    auto data = createTestResultSet();
+
+    exporter.setSheetName("Results");
+    EXPECT_TRUE(exporter.exportData(data, testFilePath));
+
+    auto content = readFile();
+    EXPECT_NE(content.find("name=\"Results\""), std::string::npos);
+}
+
+}  // namespace test
+}  // namespace velocitydb
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "exporters/json_exporter.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace velocitydb {
+namespace test {
+
+class JSONExporterTest : public ::testing::Test {
+protected:
+    JSONExporter exporter;
+    std::string testFilePath = "test_export.json";
+
+    void TearDown() override {
+        std::filesystem::remove(testFilePath);
+    }
+
+    ResultSet createTestResultSet() {
+        ResultSet result;
+
+        ColumnInfo col1;
+        col1.name = "id";
+        col1.type = "INT";
+        result.columns.push_back(col1);
+
+        ColumnInfo col2;
+        col2.name = "name";
+        col2.type = "VARCHAR";
+        result.columns.push_back(col2);
+
+        ResultRow row1;
+        row1.values = {"1", "Alice"};
+        result.rows.push_back(row1);
+
+        ResultRow row2;
+        row2.values = {"2", "Say \"hi\""};
+        result.rows.push_back(row2);
+
+        return result;
+    }
+
+    std::vector<std::string> readLines() {
+        std::ifstream file(testFilePath, std::ios::binary);
+        std::vector<std::string> lines;
+        std::string line;
+        while (std::getline(file, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+};
+
+TEST_F(JSONExporterTest, ExportsArrayByDefault) {
+    auto data = createTestResultSet();
+
+    EXPECT_TRUE(exporter.exportData(data, testFilePath));
+
+    std::ifstream file(testFilePath);
+    std::ostringstream content;
+    content << file.rdbuf();
+    EXPECT_EQ(content.str().front(), '[');
+    EXPECT_NE(content.str().find("\"name\": \"Alice\""), std::string::npos);
+}
+
+TEST_F(JSONExporterTest, NdjsonWritesOneObjectPerLine) {
+    auto data = createTestResultSet();
+
+    exporter.setArrayFormat(false);
+    EXPECT_TRUE(exporter.exportData(data, testFilePath));
+
+    auto lines = readLines();
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], R"({"id":1,"name":"Alice"})");
+    EXPECT_EQ(lines[1], R"({"id":2,"name":"Say \"hi\""})");
+}
+
+TEST_F(JSONExporterTest, NdjsonKeepsValueTypingRules) {
+    ResultSet data;
+
+    ColumnInfo flag;
+    flag.name = "active";
+    flag.type = "BIT";
+    data.columns.push_back(flag);
+
+    ColumnInfo note;
+    note.name = "note";
+    note.type = "VARCHAR";
+    data.columns.push_back(note);
+
+    ResultRow row;
+    row.values = {"1", ""};
+    data.rows.push_back(row);
+
+    exporter.setArrayFormat(false);
+    EXPECT_TRUE(exporter.exportData(data, testFilePath));
+
+    auto lines = readLines();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], R"({"active":true,"note":null})");
+}
+
+}  // namespace test
+}  // namespace velocitydb
@@ -1,9 +1,27 @@
 #include <gtest/gtest.h>
 #include "parsers/a5er_parser.h"
 
+#include <filesystem>
+#include <fstream>
+
 namespace velocitydb {
 namespace test {
 
+namespace {
+
+constexpr const char* SAMPLE_MODEL = R"(<?xml version="1.0"?>
+<A5ER Name="Sample" DatabaseType="SQLServer">
+  <Entity Name="Users" LogicalName="ユーザー">
+    <Attribute Name="id" Type="INT" Nullable="false" PK="true"/>
+    <Attribute Name="email" Type="VARCHAR" Size="255"/>
+    <Index Name="IX_Users_Email" Unique="true" Columns="email"/>
+    <Index Name="IX_Users_Composite" Columns="id,email"/>
+  </Entity>
+  <Relation Name="FK_Orders_Users" ParentEntity="Users" ChildEntity="Orders" ParentAttribute="id" ChildAttribute="user_id"/>
+</A5ER>)";
+
+}  // namespace
+
 class A5ERParserTest : public ::testing::Test {
 protected:
     A5ERParser parser;
@@ -79,5 +97,64 @@ TEST_F(A5ERParserTest, GeneratesIndexes) {
     EXPECT_NE(ddl.find("[IX_Users_Email]"), std::string::npos);
 }
 
+TEST_F(A5ERParserTest, ParsesModelFromString) {
+    auto model = parser.parseFromString(SAMPLE_MODEL);
+
+    EXPECT_EQ(model.name, "Sample");
+    ASSERT_EQ(model.tables.size(), 1u);
+    EXPECT_EQ(model.tables[0].name, "Users");
+    ASSERT_EQ(model.tables[0].columns.size(), 2u);
+    EXPECT_TRUE(model.tables[0].columns[0].isPrimaryKey);
+    ASSERT_EQ(model.tables[0].indexes.size(), 2u);
+    EXPECT_TRUE(model.tables[0].indexes[0].isUnique);
+    ASSERT_EQ(model.tables[0].indexes[1].columns.size(), 2u);
+    EXPECT_EQ(model.tables[0].indexes[1].columns[1], "email");
+    ASSERT_EQ(model.relations.size(), 1u);
+    EXPECT_EQ(model.relations[0].childColumn, "user_id");
+}
+
+TEST_F(A5ERParserTest, ParsesModelFromMappedFile) {
+    auto path = std::filesystem::temp_directory_path() / "velocitydb_test_model.a5er";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << SAMPLE_MODEL;
+    }
+
+    auto model = parser.parse(path.string());
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(model.tables.size(), 1u);
+    EXPECT_EQ(model.tables[0].name, "Users");
+    ASSERT_EQ(model.tables[0].indexes.size(), 2u);
+}
+
+TEST_F(A5ERParserTest, GenerateDDLKeepsDiagramOrderWithManyTables) {
+    // Enough tables to cross the parallel-generation threshold
+    A5ERModel model;
+    model.name = "Big";
+    for (int i = 0; i < 32; ++i) {
+        A5ERTable table;
+        table.name = "Table" + std::to_string(i);
+        A5ERColumn col;
+        col.name = "id";
+        col.type = "INT";
+        table.columns.push_back(col);
+        model.tables.push_back(table);
+    }
+
+    std::string ddl = parser.generateDDL(model);
+
+    size_t lastPos = 0;
+    for (int i = 0; i < 32; ++i) {
+        auto pos = ddl.find("CREATE TABLE [Table" + std::to_string(i) + "]", lastPos);
+        ASSERT_NE(pos, std::string::npos) << "missing table " << i;
+        lastPos = pos;
+    }
+}
+
+TEST_F(A5ERParserTest, ThrowsOnMissingFile) {
+    EXPECT_THROW(parser.parse("Z:\\does\\not\\exist.a5er"), std::runtime_error);
+}
+
 }  // namespace test
 }  // namespace velocitydb
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include "parsers/completion_index.h"
+
+#include <string>
+
+namespace velocitydb {
+namespace test {
+
+class CompletionIndexTest : public ::testing::Test {
+protected:
+    CompletionIndex index;
+};
+
+TEST_F(CompletionIndexTest, ExtractsTablesAndAliases) {
+    index.setBuffer("SELECT u.name FROM dbo.users u JOIN orders AS o ON o.user_id = u.id");
+
+    auto refs = index.scopeAt(20);
+    ASSERT_EQ(refs.size(), 2u);
+    EXPECT_EQ(refs[0].table, "dbo.users");
+    EXPECT_EQ(refs[0].alias, "u");
+    EXPECT_EQ(refs[1].table, "orders");
+    EXPECT_EQ(refs[1].alias, "o");
+}
+
+TEST_F(CompletionIndexTest, HandlesCommaSeparatedFromList) {
+    index.setBuffer("SELECT * FROM users u, orders o WHERE u.id = o.user_id");
+
+    auto refs = index.scopeAt(10);
+    ASSERT_EQ(refs.size(), 2u);
+    EXPECT_EQ(refs[0].alias, "u");
+    EXPECT_EQ(refs[1].alias, "o");
+}
+
+TEST_F(CompletionIndexTest, TableWithoutAliasHasEmptyAlias) {
+    index.setBuffer("SELECT * FROM users WHERE id = 1");
+
+    auto refs = index.scopeAt(10);
+    ASSERT_EQ(refs.size(), 1u);
+    EXPECT_EQ(refs[0].table, "users");
+    EXPECT_TRUE(refs[0].alias.empty());
+}
+
+TEST_F(CompletionIndexTest, ScopeFollowsCursorAcrossStatements) {
+    std::string sql = "SELECT * FROM users u; SELECT * FROM orders o";
+    index.setBuffer(sql);
+    ASSERT_EQ(index.statementCount(), 2u);
+
+    auto first = index.scopeAt(5);
+    ASSERT_EQ(first.size(), 1u);
+    EXPECT_EQ(first[0].table, "users");
+
+    auto second = index.scopeAt(sql.size());
+    ASSERT_EQ(second.size(), 1u);
+    EXPECT_EQ(second[0].table, "orders");
+}
+
+TEST_F(CompletionIndexTest, AppliesInsertDelta) {
+    index.setBuffer("SELECT * FROM users u");
+
+    // Type " JOIN orders o" at the end
+    index.applyEdit(index.buffer().size(), 0, " JOIN orders o");
+
+    EXPECT_EQ(index.buffer(), "SELECT * FROM users u JOIN orders o");
+    auto refs = index.scopeAt(index.buffer().size());
+    ASSERT_EQ(refs.size(), 2u);
+    EXPECT_EQ(refs[1].table, "orders");
+    EXPECT_EQ(refs[1].alias, "o");
+}
+
+TEST_F(CompletionIndexTest, DeltaOnlyReindexesTouchedStatement) {
+    std::string sql = "SELECT * FROM users u;\nSELECT * FROM orders o;\nSELECT * FROM items i";
+    index.setBuffer(sql);
+    ASSERT_EQ(index.statementCount(), 3u);
+
+    // Replace "orders" with "invoices" in the middle statement
+    auto pos = index.buffer().find("orders");
+    index.applyEdit(pos, 6, "invoices");
+
+    ASSERT_EQ(index.statementCount(), 3u);
+    auto middle = index.scopeAt(pos);
+    ASSERT_EQ(middle.size(), 1u);
+    EXPECT_EQ(middle[0].table, "invoices");
+
+    // The untouched statements kept their scopes at shifted offsets
+    auto last = index.scopeAt(index.buffer().size());
+    ASSERT_EQ(last.size(), 1u);
+    EXPECT_EQ(last[0].table, "items");
+}
+
+TEST_F(CompletionIndexTest, DeletingSemicolonMergesStatements) {
+    std::string sql = "SELECT * FROM users u; SELECT * FROM orders o";
+    index.setBuffer(sql);
+    ASSERT_EQ(index.statementCount(), 2u);
+
+    index.applyEdit(sql.find(';'), 1, "");
+
+    EXPECT_EQ(index.statementCount(), 1u);
+}
+
+TEST_F(CompletionIndexTest, TypingSemicolonSplitsStatement) {
+    index.setBuffer("SELECT * FROM users u SELECT * FROM orders o");
+
+    index.applyEdit(21, 0, ";");
+
+    EXPECT_EQ(index.statementCount(), 2u);
+    auto refs = index.scopeAt(index.buffer().size());
+    ASSERT_EQ(refs.size(), 1u);
+    EXPECT_EQ(refs[0].table, "orders");
+}
+
+TEST_F(CompletionIndexTest, IgnoresTablesInStringsAndComments) {
+    index.setBuffer("SELECT 'FROM fake' FROM users u -- JOIN ghosts g");
+
+    auto refs = index.scopeAt(10);
+    ASSERT_EQ(refs.size(), 1u);
+    EXPECT_EQ(refs[0].table, "users");
+}
+
+TEST_F(CompletionIndexTest, UpdateAndInsertTargetsAreInScope) {
+    index.setBuffer("UPDATE dbo.users SET name = 'x' WHERE id = 1");
+    auto refs = index.scopeAt(10);
+    ASSERT_EQ(refs.size(), 1u);
+    EXPECT_EQ(refs[0].table, "dbo.users");
+    EXPECT_TRUE(refs[0].alias.empty());
+
+    index.setBuffer("INSERT INTO orders (id) VALUES (1)");
+    refs = index.scopeAt(10);
+    ASSERT_EQ(refs.size(), 1u);
+    EXPECT_EQ(refs[0].table, "orders");
+}
+
+TEST_F(CompletionIndexTest, CursorBeforeFirstStatementHasEmptyScope) {
+    index.setBuffer("   SELECT * FROM users u");
+    EXPECT_TRUE(index.scopeAt(0).empty());
+}
+
+}  // namespace test
+}  // namespace velocitydb
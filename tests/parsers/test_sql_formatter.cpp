@@ -409,5 +409,39 @@ TEST_F(SQLFormatterTest, FormatsVeryComplexQuery) {
     EXPECT_NE(formatted.find("CASE"), std::string::npos);
 }
 
+TEST_F(SQLFormatterTest, FormatRangeTouchesOnlyTheEditedStatement) {
+    std::string sql = "select   1   from users;\nselect 2 from orders;\nselect   3   from items";
+    size_t editPos = sql.find("orders");
+
+    std::string result = formatter.formatRange(sql, editPos, editPos + 6);
+
+    // The edited statement is re-formatted...
+    EXPECT_NE(result.find("SELECT 2"), std::string::npos);
+    // ...while its untouched neighbors keep their original text
+    EXPECT_NE(result.find("select   1   from users"), std::string::npos);
+    EXPECT_NE(result.find("select   3   from items"), std::string::npos);
+}
+
+TEST_F(SQLFormatterTest, FormatRangeSpansMultipleStatements) {
+    std::string sql = "select 1 from a; select 2 from b; select 3 from c";
+    size_t editStart = sql.find("from a");
+    size_t editEnd = sql.find("from b") + 6;
+
+    std::string result = formatter.formatRange(sql, editStart, editEnd);
+
+    EXPECT_NE(result.find("SELECT 1"), std::string::npos);
+    EXPECT_NE(result.find("SELECT 2"), std::string::npos);
+    // The third statement was outside the edit
+    EXPECT_NE(result.find("select 3 from c"), std::string::npos);
+}
+
+TEST_F(SQLFormatterTest, FormatRangeLeavesSeparatorOnlyEditsAlone) {
+    std::string sql = "select 1;\n\n\nselect 2";
+    // The edit sits entirely in the blank lines between statements
+    std::string result = formatter.formatRange(sql, 10, 11);
+
+    EXPECT_EQ(result, sql);
+}
+
 }  // namespace test
 }  // namespace velocitydb
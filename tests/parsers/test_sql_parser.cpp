@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include "parsers/sql_parser.h"
+
+namespace velocitydb {
+namespace test {
+
+class SQLParserTest : public ::testing::Test {};
+
+TEST_F(SQLParserTest, ExtractsFromClauseTable) {
+    auto tables = SQLParser::extractTableNames("SELECT * FROM Users WHERE id = 1");
+    ASSERT_EQ(tables.size(), 1);
+    EXPECT_EQ(tables[0], "users");
+}
+
+TEST_F(SQLParserTest, ExtractsJoinedTables) {
+    auto tables = SQLParser::extractTableNames("SELECT u.name FROM Users u INNER JOIN Orders o ON o.user_id = u.id");
+    ASSERT_EQ(tables.size(), 2);
+    EXPECT_EQ(tables[0], "users");
+    EXPECT_EQ(tables[1], "orders");
+}
+
+TEST_F(SQLParserTest, ExtractsCommaSeparatedFromList) {
+    auto tables = SQLParser::extractTableNames("SELECT * FROM Users u, Orders o WHERE o.user_id = u.id");
+    ASSERT_EQ(tables.size(), 2);
+    EXPECT_EQ(tables[0], "users");
+    EXPECT_EQ(tables[1], "orders");
+}
+
+TEST_F(SQLParserTest, ExtractsUpdateTarget) {
+    auto tables = SQLParser::extractTableNames("UPDATE dbo.Accounts SET balance = 0 WHERE id = 7");
+    ASSERT_EQ(tables.size(), 1);
+    EXPECT_EQ(tables[0], "dbo.accounts");
+}
+
+TEST_F(SQLParserTest, ExtractsInsertTarget) {
+    auto tables = SQLParser::extractTableNames("INSERT INTO [AuditLog] (msg) VALUES ('x')");
+    ASSERT_EQ(tables.size(), 1);
+    EXPECT_EQ(tables[0], "auditlog");
+}
+
+TEST_F(SQLParserTest, DeduplicatesRepeatedTables) {
+    auto tables = SQLParser::extractTableNames("SELECT * FROM Users UNION ALL SELECT * FROM Users");
+    ASSERT_EQ(tables.size(), 1);
+    EXPECT_EQ(tables[0], "users");
+}
+
+TEST_F(SQLParserTest, IgnoresSubqueryParenthesis) {
+    auto tables = SQLParser::extractTableNames("SELECT * FROM (SELECT 1 AS x) AS sub");
+    // A derived table has no base-table name to tag
+    EXPECT_TRUE(tables.empty());
+}
+
+TEST_F(SQLParserTest, SplitsOnSemicolons) {
+    auto statements = SQLParser::splitStatements("SELECT 1; SELECT 2;\nSELECT 3");
+    ASSERT_EQ(statements.size(), 3);
+    EXPECT_EQ(statements[0], "SELECT 1");
+    EXPECT_EQ(statements[1], "SELECT 2");
+    EXPECT_EQ(statements[2], "SELECT 3");
+}
+
+TEST_F(SQLParserTest, SplitReturnsViewsIntoTheOriginalBuffer) {
+    std::string sql = "SELECT 1; SELECT 2";
+    auto statements = SQLParser::splitStatements(sql);
+    ASSERT_EQ(statements.size(), 2);
+    // Zero-copy: each view slices the caller's buffer
+    EXPECT_GE(statements[0].data(), sql.data());
+    EXPECT_LE(statements[1].data() + statements[1].size(), sql.data() + sql.size());
+}
+
+TEST_F(SQLParserTest, SplitIgnoresSemicolonsInStringLiterals) {
+    auto statements = SQLParser::splitStatements("INSERT INTO t (msg) VALUES ('a;b''c;d'); SELECT 1");
+    ASSERT_EQ(statements.size(), 2);
+    EXPECT_EQ(statements[0], "INSERT INTO t (msg) VALUES ('a;b''c;d')");
+}
+
+TEST_F(SQLParserTest, SplitIgnoresSemicolonsInComments) {
+    auto statements = SQLParser::splitStatements("SELECT 1 -- trailing; comment\n; SELECT 2 /* block; /* nested; */ still; */ ; SELECT 3");
+    ASSERT_EQ(statements.size(), 3);
+    EXPECT_EQ(statements[1], "SELECT 2 /* block; /* nested; */ still; */");
+}
+
+TEST_F(SQLParserTest, SplitKeepsBeginEndBlockTogether) {
+    auto statements = SQLParser::splitStatements("CREATE TRIGGER trg ON t AFTER INSERT AS BEGIN UPDATE s SET n = n + 1; DELETE FROM q; END; SELECT 1");
+    ASSERT_EQ(statements.size(), 2);
+    EXPECT_TRUE(statements[0].starts_with("CREATE TRIGGER"));
+    EXPECT_TRUE(statements[0].ends_with("END"));
+}
+
+TEST_F(SQLParserTest, SplitDoesNotTreatBeginTransactionAsBlock) {
+    auto statements = SQLParser::splitStatements("BEGIN TRANSACTION; UPDATE t SET x = 1; COMMIT");
+    ASSERT_EQ(statements.size(), 3);
+    EXPECT_EQ(statements[0], "BEGIN TRANSACTION");
+}
+
+TEST_F(SQLParserTest, SplitTreatsGoAsBatchSeparator) {
+    auto statements = SQLParser::splitStatements("CREATE VIEW v AS SELECT 1 AS x\nGO\nSELECT * FROM v\ngo 3\nSELECT 2");
+    ASSERT_EQ(statements.size(), 3);
+    EXPECT_EQ(statements[0], "CREATE VIEW v AS SELECT 1 AS x");
+    EXPECT_EQ(statements[1], "SELECT * FROM v");
+    EXPECT_EQ(statements[2], "SELECT 2");
+}
+
+TEST_F(SQLParserTest, SplitIgnoresGoMidLine) {
+    auto statements = SQLParser::splitStatements("SELECT * FROM PlacesTo GO WHERE id = 1");
+    ASSERT_EQ(statements.size(), 1);
+}
+
+TEST_F(SQLParserTest, ParallelSafeAcceptsIndependentStatements) {
+    EXPECT_TRUE(SQLParser::isParallelSafeStatement("ALTER INDEX ALL ON dbo.Orders REBUILD"));
+    EXPECT_TRUE(SQLParser::isParallelSafeStatement("UPDATE STATISTICS dbo.Customers"));
+    EXPECT_TRUE(SQLParser::isParallelSafeStatement("SELECT COUNT(*) FROM dbo.Orders"));
+}
+
+TEST_F(SQLParserTest, ParallelSafeRejectsSessionState) {
+    EXPECT_FALSE(SQLParser::isParallelSafeStatement("SELECT * INTO #staging FROM dbo.Orders"));
+    EXPECT_FALSE(SQLParser::isParallelSafeStatement("UPDATE t SET x = @value"));
+    EXPECT_FALSE(SQLParser::isParallelSafeStatement("USE OtherDb"));
+    EXPECT_FALSE(SQLParser::isParallelSafeStatement("SET NOCOUNT ON"));
+    EXPECT_FALSE(SQLParser::isParallelSafeStatement("BEGIN TRANSACTION"));
+    EXPECT_FALSE(SQLParser::isParallelSafeStatement("COMMIT"));
+    EXPECT_FALSE(SQLParser::isParallelSafeStatement("ROLLBACK"));
+    EXPECT_FALSE(SQLParser::isParallelSafeStatement("SAVE TRANSACTION sp1"));
+    EXPECT_FALSE(SQLParser::isParallelSafeStatement("   "));
+}
+
+TEST_F(SQLParserTest, CanonicalizeFoldsCaseAndWhitespace) {
+    EXPECT_EQ(SQLParser::canonicalize("select * from T"), SQLParser::canonicalize("SELECT *  FROM\n\tT"));
+    EXPECT_EQ(SQLParser::canonicalize("select a from t where a = 1"), SQLParser::canonicalize("SELECT a FROM t WHERE a=1"));
+}
+
+TEST_F(SQLParserTest, CanonicalizeStripsCommentsAndTrailingSemicolons) {
+    EXPECT_EQ(SQLParser::canonicalize("SELECT 1 -- comment\n"), "SELECT 1");
+    EXPECT_EQ(SQLParser::canonicalize("SELECT /* a /* nested */ b */ 1;"), "SELECT 1");
+    EXPECT_EQ(SQLParser::canonicalize("SELECT 1;;"), "SELECT 1");
+}
+
+TEST_F(SQLParserTest, CanonicalizePreservesLiteralsAndQuotedIdentifiers) {
+    EXPECT_EQ(SQLParser::canonicalize("select 'It''s -- not a comment'"), "SELECT'It''s -- not a comment'");
+    EXPECT_EQ(SQLParser::canonicalize("select [Order Id] from o"), "SELECT[Order Id]FROM O");
+    EXPECT_NE(SQLParser::canonicalize("SELECT 'a'"), SQLParser::canonicalize("SELECT 'A'"));
+}
+
+TEST_F(SQLParserTest, FingerprintReplacesLiteralsWithPlaceholders) {
+    EXPECT_EQ(SQLParser::fingerprint("SELECT * FROM t WHERE id = 7"), SQLParser::fingerprint("select * from t WHERE id=42"));
+    EXPECT_EQ(SQLParser::fingerprint("SELECT * FROM t WHERE name = 'alice'"), SQLParser::fingerprint("SELECT * FROM t WHERE name = 'bob'"));
+    EXPECT_EQ(SQLParser::fingerprint("SELECT * FROM t WHERE id = 7"), "SELECT*FROM T WHERE ID=?");
+}
+
+TEST_F(SQLParserTest, FingerprintKeepsIdentifiersWithDigits) {
+    EXPECT_EQ(SQLParser::fingerprint("SELECT c1 FROM t2"), "SELECT C1 FROM T2");
+    EXPECT_EQ(SQLParser::fingerprint("SELECT [Col 9] FROM t WHERE x = 9"), "SELECT[Col 9]FROM T WHERE X=?");
+}
+
+TEST_F(SQLParserTest, FingerprintDistinguishesDifferentShapes) {
+    EXPECT_NE(SQLParser::fingerprint("SELECT * FROM t WHERE id IN (1, 2)"), SQLParser::fingerprint("SELECT * FROM t WHERE id IN (1, 2, 3)"));
+    EXPECT_NE(SQLParser::fingerprint("SELECT * FROM a"), SQLParser::fingerprint("SELECT * FROM b"));
+}
+
+}  // namespace test
+}  // namespace velocitydb
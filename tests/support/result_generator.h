@@ -0,0 +1,146 @@
+#pragma once
+
+#include "database/sqlserver_driver.h"
+
+#include <cstdint>
+#include <format>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace velocitydb {
+namespace test {
+
+/// Deterministic synthetic ResultSet generation for tests and benchmarks.
+/// The same spec and seed always produce byte-identical results, so perf
+/// numbers taken before and after a change are over the same corpus.
+
+enum class GeneratedKind : uint8_t { Int, Double, Bool, String };
+
+struct GeneratedColumnSpec {
+    std::string name;
+    GeneratedKind kind = GeneratedKind::String;
+    size_t minLength = 8;        // String cells: uniform length range
+    size_t maxLength = 24;
+    size_t cardinality = 0;      // 0 = unique per row; N = draw from N distinct values
+    double nullRatio = 0.0;      // Fraction of cells that are empty (NULL display form)
+};
+
+struct ResultSetSpec {
+    size_t rows = 1000;
+    uint64_t seed = 42;
+    std::vector<GeneratedColumnSpec> columns;
+};
+
+namespace detail {
+
+inline std::string randomString(std::mt19937_64& rng, size_t minLength, size_t maxLength) {
+    static constexpr char ALPHABET[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 _-";
+    std::uniform_int_distribution<size_t> lengthDist(minLength, maxLength);
+    std::uniform_int_distribution<size_t> charDist(0, sizeof(ALPHABET) - 2);
+    std::string value(lengthDist(rng), '\0');
+    for (auto& c : value) {
+        c = ALPHABET[charDist(rng)];
+    }
+    return value;
+}
+
+inline std::string cellValue(std::mt19937_64& rng, const GeneratedColumnSpec& spec, const std::vector<std::string>& pool) {
+    if (!pool.empty()) {
+        std::uniform_int_distribution<size_t> poolDist(0, pool.size() - 1);
+        return pool[poolDist(rng)];
+    }
+    switch (spec.kind) {
+        case GeneratedKind::Int:
+            return std::to_string(std::uniform_int_distribution<int64_t>(-1000000, 1000000)(rng));
+        case GeneratedKind::Double:
+            return std::format("{:.4f}", std::uniform_real_distribution<double>(-10000.0, 10000.0)(rng));
+        case GeneratedKind::Bool:
+            return std::uniform_int_distribution<int>(0, 1)(rng) ? "1" : "0";
+        case GeneratedKind::String:
+            return randomString(rng, spec.minLength, spec.maxLength);
+    }
+    return {};
+}
+
+inline std::string typeName(GeneratedKind kind) {
+    switch (kind) {
+        case GeneratedKind::Int:
+            return "INT";
+        case GeneratedKind::Double:
+            return "DECIMAL";
+        case GeneratedKind::Bool:
+            return "BIT";
+        case GeneratedKind::String:
+            return "NVARCHAR";
+    }
+    return "NVARCHAR";
+}
+
+}  // namespace detail
+
+/// Builds an arena-backed row-oriented result from the spec. All
+/// randomness comes from one mt19937_64 seeded by the spec, so results
+/// are reproducible across runs, platforms, and standard libraries that
+/// share the mt19937_64 sequence (distributions are our own draws over
+/// it via uniform_int_distribution, which libstdc++ and MSVC implement
+/// identically for the ranges used here).
+[[nodiscard]] inline ResultSet generateResultSet(const ResultSetSpec& spec) {
+    std::mt19937_64 rng(spec.seed);
+
+    ResultSet result;
+    result.columns.reserve(spec.columns.size());
+    for (const auto& column : spec.columns) {
+        result.columns.push_back({.name = column.name, .type = detail::typeName(column.kind)});
+    }
+
+    // Fixed-cardinality columns draw from a pregenerated pool so the
+    // distinct-value count is exact, not just probable
+    std::vector<std::vector<std::string>> pools(spec.columns.size());
+    for (size_t col = 0; col < spec.columns.size(); ++col) {
+        const auto& columnSpec = spec.columns[col];
+        if (columnSpec.cardinality > 0) {
+            pools[col].reserve(columnSpec.cardinality);
+            for (size_t i = 0; i < columnSpec.cardinality; ++i) {
+                pools[col].push_back(detail::cellValue(rng, columnSpec, {}));
+            }
+        }
+    }
+
+    result.attachArena();
+    result.rows.reserve(spec.rows);
+    std::uniform_real_distribution<double> nullDist(0.0, 1.0);
+    for (size_t rowIndex = 0; rowIndex < spec.rows; ++rowIndex) {
+        auto row = result.makeRow();
+        row.values.reserve(spec.columns.size());
+        for (size_t col = 0; col < spec.columns.size(); ++col) {
+            const auto& columnSpec = spec.columns[col];
+            if (columnSpec.nullRatio > 0.0 && nullDist(rng) < columnSpec.nullRatio) {
+                row.values.emplace_back();
+            } else {
+                row.values.emplace_back(detail::cellValue(rng, columnSpec, pools[col]));
+            }
+        }
+        result.rows.push_back(std::move(row));
+    }
+    result.affectedRows = static_cast<int64_t>(spec.rows);
+    return result;
+}
+
+/// The shared benchmark corpus: id, low-cardinality status, free-text
+/// message with escape-relevant characters, and a sparse numeric column
+[[nodiscard]] inline ResultSetSpec mixedWorkloadSpec(size_t rows, uint64_t seed = 42) {
+    return ResultSetSpec{
+        .rows = rows,
+        .seed = seed,
+        .columns = {
+            {.name = "id", .kind = GeneratedKind::Int},
+            {.name = "status", .kind = GeneratedKind::String, .minLength = 6, .maxLength = 10, .cardinality = 8},
+            {.name = "message", .kind = GeneratedKind::String, .minLength = 20, .maxLength = 80},
+            {.name = "amount", .kind = GeneratedKind::Double, .nullRatio = 0.1},
+        },
+    };
+}
+
+}  // namespace test
+}  // namespace velocitydb
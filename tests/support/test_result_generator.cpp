@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "result_generator.h"
+
+#include <unordered_set>
+
+namespace velocitydb {
+namespace test {
+
+class ResultGeneratorTest : public ::testing::Test {};
+
+TEST_F(ResultGeneratorTest, ProducesRequestedShape) {
+    auto spec = mixedWorkloadSpec(500);
+    auto result = generateResultSet(spec);
+
+    EXPECT_EQ(result.rows.size(), 500u);
+    ASSERT_EQ(result.columns.size(), 4u);
+    EXPECT_EQ(result.columns[0].name, "id");
+    EXPECT_EQ(result.columns[0].type, "INT");
+    EXPECT_EQ(result.columns[3].type, "DECIMAL");
+    for (const auto& row : result.rows) {
+        EXPECT_EQ(row.values.size(), 4u);
+    }
+}
+
+TEST_F(ResultGeneratorTest, SameSeedIsByteIdentical) {
+    auto first = generateResultSet(mixedWorkloadSpec(200, 7));
+    auto second = generateResultSet(mixedWorkloadSpec(200, 7));
+
+    ASSERT_EQ(first.rows.size(), second.rows.size());
+    for (size_t i = 0; i < first.rows.size(); ++i) {
+        EXPECT_EQ(first.rows[i].values, second.rows[i].values);
+    }
+}
+
+TEST_F(ResultGeneratorTest, DifferentSeedsDiffer) {
+    auto first = generateResultSet(mixedWorkloadSpec(200, 1));
+    auto second = generateResultSet(mixedWorkloadSpec(200, 2));
+
+    bool anyDifference = false;
+    for (size_t i = 0; i < first.rows.size() && !anyDifference; ++i) {
+        anyDifference = first.rows[i].values != second.rows[i].values;
+    }
+    EXPECT_TRUE(anyDifference);
+}
+
+TEST_F(ResultGeneratorTest, CardinalityIsExact) {
+    ResultSetSpec spec{
+        .rows = 5000,
+        .seed = 11,
+        .columns = {{.name = "status", .kind = GeneratedKind::String, .cardinality = 8}},
+    };
+    auto result = generateResultSet(spec);
+
+    std::unordered_set<std::string_view> distinct;
+    for (const auto& row : result.rows) {
+        distinct.insert(std::string_view(row.values[0]));
+    }
+    EXPECT_LE(distinct.size(), 8u);
+    EXPECT_GT(distinct.size(), 1u);
+}
+
+TEST_F(ResultGeneratorTest, NullRatioIsApproximatelyHonored) {
+    ResultSetSpec spec{
+        .rows = 10000,
+        .seed = 3,
+        .columns = {{.name = "amount", .kind = GeneratedKind::Double, .nullRatio = 0.25}},
+    };
+    auto result = generateResultSet(spec);
+
+    size_t nulls = 0;
+    for (const auto& row : result.rows) {
+        if (row.values[0].empty()) {
+            ++nulls;
+        }
+    }
+    const double ratio = static_cast<double>(nulls) / static_cast<double>(result.rows.size());
+    EXPECT_GT(ratio, 0.20);
+    EXPECT_LT(ratio, 0.30);
+}
+
+TEST_F(ResultGeneratorTest, StringLengthsStayInRange) {
+    ResultSetSpec spec{
+        .rows = 1000,
+        .seed = 5,
+        .columns = {{.name = "text", .kind = GeneratedKind::String, .minLength = 10, .maxLength = 12}},
+    };
+    auto result = generateResultSet(spec);
+
+    for (const auto& row : result.rows) {
+        EXPECT_GE(row.values[0].size(), 10u);
+        EXPECT_LE(row.values[0].size(), 12u);
+    }
+}
+
+}  // namespace test
+}  // namespace velocitydb
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "ipc_handler.h"
+#include "utils/json_utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <format>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace velocitydb {
+namespace test {
+
+namespace {
+
+/// A recorded production mix of IPC methods (relative frequency encoded by
+/// repetition). None of the entries reaches a live server - the point is
+/// that the error paths still take the same locks as the happy paths:
+/// AsyncQueryExecutor, ConnectionPool, and ResultCache mutexes all get
+/// hammered from every dispatch thread at once, which is exactly the
+/// interleaving that lock-ordering bugs need.
+struct RecordedRequest {
+    std::string_view method;
+    std::string_view params;
+};
+
+constexpr RecordedRequest RECORDED_MIX[] = {
+    {"executeAsyncQuery", R"({"connectionId":"conn-999","sql":"SELECT 1"})"},
+    {"executeAsyncQuery", R"({"connectionId":"conn-999","sql":"SELECT * FROM orders"})"},
+    {"getAsyncQueryResult", R"({"queryId":"query-999"})"},
+    {"getAsyncQueryResult", R"({"queryId":"query-999"})"},
+    {"getAsyncQueryResult", R"({"queryId":"query-999"})"},
+    {"getResultRows", R"({"queryId":"query-999","offset":0,"limit":200})"},
+    {"cancelAsyncQuery", R"({"queryId":"query-999"})"},
+    {"cancelQuery", R"({"connectionId":"conn-999"})"},
+    {"getActiveQueries", R"({})"},
+    {"filterResultSet", R"({"connectionId":"conn-999","sql":"SELECT * FROM orders","columnIndex":1,"pattern":"ab"})"},
+    {"sortResultSet", R"({"connectionId":"conn-999","sql":"SELECT * FROM orders","columnIndex":0,"ascending":true})"},
+    {"aggregateResultSet", R"({"connectionId":"conn-999","sql":"SELECT * FROM orders","columnIndex":0})"},
+    {"getCacheStats", R"({})"},
+    {"getCacheStats", R"({})"},
+    {"clearCache", R"({})"},
+    {"exportCSV", R"({"connectionId":"conn-999","sql":"SELECT 1","filePath":"stress_export.csv"})"},
+    {"formatSQL", R"({"sql":"select o.id,c.name from orders o join customers c on c.id=o.customer_id where o.total>100 order by o.id"})"},
+    {"getQueryHistory", R"({"limit":50})"},
+    {"getSettings", R"({})"},
+};
+
+[[nodiscard]] std::string makeEnvelope(std::string_view method, std::string_view params) {
+    return std::format(R"({{"method":"{}","params":"{}"}})", method, JsonUtils::escapeString(params));
+}
+
+}  // namespace
+
+class IPCDispatchStressTest : public ::testing::Test {};
+
+TEST_F(IPCDispatchStressTest, MixedMethodsReturnWellFormedResponses) {
+    IPCHandler handler;
+
+    for (const auto& recorded : RECORDED_MIX) {
+        auto response = handler.dispatchRequest(makeEnvelope(recorded.method, recorded.params));
+        ASSERT_FALSE(response.empty()) << recorded.method;
+        EXPECT_NE(response.find("\"success\""), std::string::npos) << recorded.method << " -> " << response;
+    }
+}
+
+TEST_F(IPCDispatchStressTest, ConcurrentDispatchMeetsLatencyBoundsWithoutDeadlock) {
+    constexpr size_t THREAD_COUNT = 8;
+    constexpr size_t REQUESTS_PER_THREAD = 400;
+    constexpr auto DEADLOCK_DEADLINE = std::chrono::seconds(120);
+
+    IPCHandler handler;
+
+    // Pre-rendered envelopes: the harness measures dispatch, not std::format
+    std::vector<std::string> envelopes;
+    for (const auto& recorded : RECORDED_MIX) {
+        envelopes.push_back(makeEnvelope(recorded.method, recorded.params));
+    }
+
+    std::atomic<size_t> threadsFinished{0};
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+
+    // Watchdog: a deadlocked dispatch would otherwise hang the whole suite
+    // until the CI job times out. Aborting with a message turns that into
+    // an attributable failure of this gate.
+    std::thread watchdog([&] {
+        std::unique_lock lock(doneMutex);
+        if (!doneCondition.wait_for(lock, DEADLOCK_DEADLINE, [&] { return threadsFinished.load() == THREAD_COUNT; })) {
+            std::fputs("IPCDispatchStressTest: dispatch threads deadlocked (deadline exceeded)\n", stderr);
+            std::abort();
+        }
+    });
+
+    std::vector<std::vector<int64_t>> perThreadLatenciesUs(THREAD_COUNT);
+    std::vector<std::thread> workers;
+    workers.reserve(THREAD_COUNT);
+
+    for (size_t threadIndex = 0; threadIndex < THREAD_COUNT; ++threadIndex) {
+        workers.emplace_back([&, threadIndex] {
+            // Seeded per thread: every run replays the same interleaved mix
+            std::mt19937 rng(static_cast<uint32_t>(threadIndex));
+            std::uniform_int_distribution<size_t> pick(0, envelopes.size() - 1);
+
+            auto& latencies = perThreadLatenciesUs[threadIndex];
+            latencies.reserve(REQUESTS_PER_THREAD);
+
+            for (size_t i = 0; i < REQUESTS_PER_THREAD; ++i) {
+                const auto& envelope = envelopes[pick(rng)];
+                const auto start = std::chrono::steady_clock::now();
+                auto response = handler.dispatchRequest(envelope);
+                latencies.push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+                EXPECT_FALSE(response.empty());
+            }
+
+            {
+                std::lock_guard lock(doneMutex);
+                ++threadsFinished;
+            }
+            doneCondition.notify_all();
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    watchdog.join();
+
+    std::vector<int64_t> latenciesUs;
+    latenciesUs.reserve(THREAD_COUNT * REQUESTS_PER_THREAD);
+    for (const auto& threadLatencies : perThreadLatenciesUs) {
+        latenciesUs.insert(latenciesUs.end(), threadLatencies.begin(), threadLatencies.end());
+    }
+    ASSERT_EQ(latenciesUs.size(), THREAD_COUNT * REQUESTS_PER_THREAD);
+    std::ranges::sort(latenciesUs);
+
+    const auto percentile = [&](double fraction) { return latenciesUs[(std::min)(static_cast<size_t>(static_cast<double>(latenciesUs.size()) * fraction), latenciesUs.size() - 1)]; };
+
+    // Generous bounds - every entry in the mix resolves on an error or
+    // in-memory path, so these only trip on contention collapse (a dispatch
+    // thread parked behind a lock convoy), not on slow CI hardware.
+    EXPECT_LT(percentile(0.50), 50'000) << "p50 exceeded 50ms";
+    EXPECT_LT(percentile(0.99), 250'000) << "p99 exceeded 250ms";
+}
+
+}  // namespace test
+}  // namespace velocitydb
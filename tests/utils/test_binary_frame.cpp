@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "database/columnar_result.h"
+#include "utils/binary_frame.h"
+
+#include <cstring>
+
+namespace velocitydb {
+namespace test {
+
+namespace {
+
+ColumnarResultSet makeColumnarResult() {
+    ResultSet rows;
+    rows.columns = {
+        {.name = "id", .type = "INT"},
+        {.name = "name", .type = "NVARCHAR"},
+    };
+    rows.rows.push_back({.values = {"1", "alpha"}});
+    rows.rows.push_back({.values = {"2", "beta"}});
+    rows.affectedRows = 2;
+    rows.executionTimeMs = 1.0;
+    return ColumnarResultSet::fromRows(rows);
+}
+
+template <typename T>
+T readScalar(const std::vector<uint8_t>& frame, size_t offset) {
+    T value{};
+    std::memcpy(&value, frame.data() + offset, sizeof(T));
+    return value;
+}
+
+}  // namespace
+
+class BinaryFrameTest : public ::testing::Test {};
+
+TEST_F(BinaryFrameTest, HeaderCarriesMagicVersionAndShape) {
+    auto frame = BinaryFrame::encode(makeColumnarResult(), false);
+
+    ASSERT_GE(frame.size(), 32u);
+    EXPECT_EQ(std::memcmp(frame.data(), "VDBF", 4), 0);
+    EXPECT_EQ(readScalar<uint16_t>(frame, 4), BinaryFrame::FORMAT_VERSION);
+    EXPECT_EQ(readScalar<uint16_t>(frame, 6), 0);  // Not cached
+    EXPECT_EQ(readScalar<uint64_t>(frame, 8), 2u);   // rowCount
+    EXPECT_EQ(readScalar<uint32_t>(frame, 16), 2u);  // columnCount
+}
+
+TEST_F(BinaryFrameTest, CachedFlagSetsBitZero) {
+    auto frame = BinaryFrame::encode(makeColumnarResult(), true);
+    EXPECT_EQ(readScalar<uint16_t>(frame, 6), 1);
+}
+
+TEST_F(BinaryFrameTest, FirstColumnSectionFollowsHeader) {
+    auto frame = BinaryFrame::encode(makeColumnarResult(), false);
+
+    // Header is 4 + 2 + 2 + 8 + 4 + 8 + 8 = 36 bytes; first column starts
+    // with the length-prefixed name "id"
+    size_t offset = 36;
+    EXPECT_EQ(readScalar<uint32_t>(frame, offset), 2u);
+    EXPECT_EQ(std::memcmp(frame.data() + offset + 4, "id", 2), 0);
+}
+
+TEST_F(BinaryFrameTest, DictionaryColumnShipsDistinctValuesOnce) {
+    ResultSet rows;
+    rows.columns = {{.name = "status", .type = "NVARCHAR"}};
+    for (int i = 0; i < 200; ++i) {
+        ResultRow row;
+        row.values.emplace_back(i % 2 == 0 ? "ACTIVE" : "SUSPENDED");
+        rows.rows.push_back(std::move(row));
+    }
+    auto columnar = ColumnarResultSet::fromRows(rows);
+
+    auto plainFrame = BinaryFrame::encode(columnar, false);
+    columnar.internLowCardinalityColumns();
+    ASSERT_TRUE(columnar.columnData[0].isDictionary());
+    auto dictFrame = BinaryFrame::encode(columnar, false);
+
+    EXPECT_LT(dictFrame.size(), plainFrame.size());
+
+    // Column section: u32 nameLen + "status", u32 typeLen + "NVARCHAR",
+    // u8 valueType, u8 encoding, nullFlags, then u32 distinctCount
+    size_t offset = 36 + 4 + 6 + 4 + 8 + 1;
+    EXPECT_EQ(readScalar<uint8_t>(dictFrame, offset), 1);  // Dictionary-encoded
+    offset += 1 + 200;
+    EXPECT_EQ(readScalar<uint32_t>(dictFrame, offset), 2u);
+}
+
+TEST_F(BinaryFrameTest, Base64OutputIsPaddedAndNonEmpty) {
+    auto encoded = BinaryFrame::encodeBase64(makeColumnarResult(), false);
+
+    EXPECT_FALSE(encoded.empty());
+    EXPECT_EQ(encoded.size() % 4, 0u);
+    for (char c : encoded) {
+        const bool valid = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '+' || c == '/' || c == '=';
+        EXPECT_TRUE(valid);
+    }
+}
+
+TEST_F(BinaryFrameTest, FrameToBase64MatchesEncodeBase64) {
+    auto result = makeColumnarResult();
+
+    auto frame = BinaryFrame::encode(result, false);
+
+    EXPECT_EQ(BinaryFrame::frameToBase64(frame), BinaryFrame::encodeBase64(result, false));
+}
+
+}  // namespace test
+}  // namespace velocitydb
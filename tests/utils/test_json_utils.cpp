@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "database/sqlserver_driver.h"
+#include "utils/json_utils.h"
+
+namespace velocitydb {
+namespace test {
+
+namespace {
+
+ResultSet makeResult(size_t rows, std::string_view cellText) {
+    ResultSet result;
+    result.columns = {
+        {.name = "id", .type = "INT"},
+        {.name = "payload", .type = "NVARCHAR"},
+    };
+    for (size_t i = 0; i < rows; ++i) {
+        ResultRow row;
+        row.values.emplace_back(std::to_string(i));
+        row.values.emplace_back(cellText);
+        result.rows.push_back(std::move(row));
+    }
+    result.affectedRows = static_cast<int64_t>(rows);
+    result.executionTimeMs = 1.0;
+    return result;
+}
+
+}  // namespace
+
+class JsonUtilsTest : public ::testing::Test {};
+
+TEST_F(JsonUtilsTest, EscapeStringLeavesCleanInputUntouched) {
+    const std::string clean = "a perfectly ordinary cell value with no specials, over 32 bytes long";
+    EXPECT_EQ(JsonUtils::escapeString(clean), clean);
+}
+
+TEST_F(JsonUtilsTest, EscapeStringHandlesSpecialsAtAnyOffset) {
+    // Specials beyond the first SIMD block exercise the block-skip path
+    std::string input(40, 'x');
+    input += "\"quoted\"\\and\ttabbed\n";
+    input += std::string(40, 'y');
+
+    std::string expected(40, 'x');
+    expected += "\\\"quoted\\\"\\\\and\\ttabbed\\n";
+    expected += std::string(40, 'y');
+
+    EXPECT_EQ(JsonUtils::escapeString(input), expected);
+}
+
+TEST_F(JsonUtilsTest, EscapeStringEncodesControlCharacters) {
+    EXPECT_EQ(JsonUtils::escapeString(std::string_view("\x01\x1f", 2)), "\\u0001\\u001f");
+}
+
+TEST_F(JsonUtilsTest, EscapeStringIgnoresHighBitBytes) {
+    // UTF-8 continuation bytes are >= 0x80 and must pass through unescaped
+    const std::string utf8 = "caf\xc3\xa9 na\xc3\xafve \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e plus padding to cross a block";
+    EXPECT_EQ(JsonUtils::escapeString(utf8), utf8);
+}
+
+TEST_F(JsonUtilsTest, ChunkedSegmentsConcatenateToFullSerialization) {
+    auto result = makeResult(50, "some moderately sized cell value");
+
+    std::string reassembled;
+    size_t lastCount = 0;
+    JsonUtils::serializeResultSetChunked(result, false, 256, [&](std::string_view chunk, bool isLast) {
+        reassembled += chunk;
+        if (isLast) {
+            ++lastCount;
+        }
+    });
+
+    EXPECT_EQ(reassembled, JsonUtils::serializeResultSet(result, false));
+    EXPECT_EQ(lastCount, 1u);
+}
+
+TEST_F(JsonUtilsTest, ChunkedFlushesAtRowBoundaries) {
+    auto result = makeResult(100, "0123456789abcdef");
+
+    size_t chunks = 0;
+    size_t maxChunkBytes = 0;
+    JsonUtils::serializeResultSetChunked(result, false, 512, [&](std::string_view chunk, bool) {
+        ++chunks;
+        maxChunkBytes = (std::max)(maxChunkBytes, chunk.size());
+    });
+
+    EXPECT_GT(chunks, 1u);
+    // Flush happens at the first row boundary past chunkSize, so a segment
+    // never exceeds chunkSize by more than one serialized row
+    EXPECT_LT(maxChunkBytes, 512u + 128u);
+}
+
+TEST_F(JsonUtilsTest, ChunkedEmitsSingleSegmentForSmallResults) {
+    auto result = makeResult(2, "tiny");
+
+    size_t chunks = 0;
+    JsonUtils::serializeResultSetChunked(result, true, 4 * 1024 * 1024, [&](std::string_view, bool isLast) {
+        ++chunks;
+        EXPECT_TRUE(isLast);
+    });
+
+    EXPECT_EQ(chunks, 1u);
+}
+
+}  // namespace test
+}  // namespace velocitydb
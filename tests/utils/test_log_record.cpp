@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "utils/logger.h"
+
+namespace velocitydb {
+namespace test {
+
+class LogRecordTest : public ::testing::Test {};
+
+TEST_F(LogRecordTest, RendersPlainMessageWithoutArguments) {
+    auto record = LogRecord::capture("Connection established");
+    EXPECT_EQ(record.render(), "Connection established");
+}
+
+TEST_F(LogRecordTest, SubstitutesScalarArguments) {
+    auto record = LogRecord::capture("Executed {} rows in {}ms", int64_t{42}, 3.5);
+    EXPECT_EQ(record.render(), "Executed 42 rows in 3.5ms");
+}
+
+TEST_F(LogRecordTest, SubstitutesMixedArgumentTypes) {
+    auto record = LogRecord::capture("[{}] cached={} hits={}", std::string_view("Pool"), true, uint64_t{7});
+    EXPECT_EQ(record.render(), "[Pool] cached=true hits=7");
+}
+
+TEST_F(LogRecordTest, CopiesStringArgumentsByValue) {
+    std::string transient = "profile-123";
+    auto record = LogRecord::capture("Loaded {}", transient);
+    transient = "overwritten";
+    EXPECT_EQ(record.render(), "Loaded profile-123");
+}
+
+TEST_F(LogRecordTest, EscapedBracesAreLiteral) {
+    auto record = LogRecord::capture("literal {{}} and value {}", 1);
+    EXPECT_EQ(record.render(), "literal {} and value 1");
+}
+
+TEST_F(LogRecordTest, ExtraPlaceholdersStayLiteral) {
+    auto record = LogRecord::capture("have {} want {}", 1);
+    EXPECT_EQ(record.render(), "have 1 want {}");
+}
+
+TEST_F(LogRecordTest, TruncatesOversizedStringArgument) {
+    std::string huge(LogRecord::MAX_PAYLOAD_BYTES * 2, 'x');
+    auto record = LogRecord::capture("{}", huge);
+    auto rendered = record.render();
+    EXPECT_LE(rendered.size(), LogRecord::MAX_PAYLOAD_BYTES);
+    EXPECT_EQ(rendered.find_first_not_of('x'), std::string::npos);
+}
+
+TEST_F(LogRecordTest, TruncatesOversizedFormatString) {
+    std::string huge(LogRecord::MAX_FORMAT_CHARS * 2, 'f');
+    auto record = LogRecord::capture(huge);
+    EXPECT_EQ(record.render().size(), LogRecord::MAX_FORMAT_CHARS);
+}
+
+}  // namespace test
+}  // namespace velocitydb
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "utils/memory_budget.h"
+
+namespace velocitydb {
+namespace test {
+
+// The accountant is a process-wide singleton, so every test registers its
+// own slots, restores the default budget, and unregisters on the way out
+class MemoryBudgetTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        for (auto id : m_slots) {
+            MemoryBudget::instance().unregisterSubsystem(id);
+        }
+        MemoryBudget::instance().setBudgetBytes(MemoryBudget::DEFAULT_BUDGET_BYTES);
+    }
+
+    size_t track(size_t id) {
+        m_slots.push_back(id);
+        return id;
+    }
+
+    std::vector<size_t> m_slots;
+};
+
+TEST_F(MemoryBudgetTest, RecordAccumulatesIntoTotal) {
+    auto& budget = MemoryBudget::instance();
+    const auto before = budget.totalBytes();
+
+    auto slot = track(budget.registerSubsystem("testAccumulate", MemoryBudget::Priority::Pinned, nullptr));
+    budget.record(slot, 1000);
+    budget.record(slot, 500);
+    budget.record(slot, -200);
+
+    EXPECT_EQ(budget.totalBytes() - before, 1300);
+}
+
+TEST_F(MemoryBudgetTest, UnregisterRemovesSubsystemBytes) {
+    auto& budget = MemoryBudget::instance();
+    const auto before = budget.totalBytes();
+
+    auto slot = budget.registerSubsystem("testUnregister", MemoryBudget::Priority::Pinned, nullptr);
+    budget.record(slot, 4096);
+    budget.unregisterSubsystem(slot);
+
+    EXPECT_EQ(budget.totalBytes(), before);
+}
+
+TEST_F(MemoryBudgetTest, CrossingBudgetShrinksCachesBeforeResultWindows) {
+    auto& budget = MemoryBudget::instance();
+    std::vector<std::string> shrinkOrder;
+
+    auto windowSlot = track(budget.registerSubsystem("testWindows", MemoryBudget::Priority::ResultWindows, [&](size_t) {
+        shrinkOrder.push_back("windows");
+        return size_t{0};
+    }));
+    int64_t cacheHeld = 0;
+    size_t cacheSlot = 0;
+    cacheSlot = track(budget.registerSubsystem("testCache", MemoryBudget::Priority::Cache, [&](size_t bytesWanted) {
+        shrinkOrder.push_back("cache");
+        auto freed = (std::min)(static_cast<int64_t>(bytesWanted), cacheHeld);
+        cacheHeld -= freed;
+        MemoryBudget::instance().record(cacheSlot, -freed);
+        return static_cast<size_t>(freed);
+    }));
+
+    budget.setBudgetBytes(static_cast<size_t>(budget.totalBytes()) + 1000);
+    budget.record(windowSlot, 400);
+    cacheHeld = 2000;
+    budget.record(cacheSlot, 2000);
+
+    // The cache freed enough on its own, so the windows never shrink
+    ASSERT_EQ(shrinkOrder.size(), 1u);
+    EXPECT_EQ(shrinkOrder.front(), "cache");
+    EXPECT_LE(budget.totalBytes(), static_cast<int64_t>(budget.budgetBytes()));
+}
+
+TEST_F(MemoryBudgetTest, PinnedSubsystemsAreNeverShrunk) {
+    auto& budget = MemoryBudget::instance();
+    bool pinnedShrunk = false;
+
+    auto pinnedSlot = track(budget.registerSubsystem("testPinned", MemoryBudget::Priority::Pinned, [&](size_t) {
+        pinnedShrunk = true;
+        return size_t{0};
+    }));
+
+    budget.setBudgetBytes(static_cast<size_t>(budget.totalBytes()) + 100);
+    budget.record(pinnedSlot, 5000);
+
+    EXPECT_FALSE(pinnedShrunk);
+}
+
+TEST_F(MemoryBudgetTest, LoweringBudgetEvictsImmediately) {
+    auto& budget = MemoryBudget::instance();
+    size_t wanted = 0;
+
+    size_t slot = 0;
+    slot = track(budget.registerSubsystem("testLower", MemoryBudget::Priority::Cache, [&](size_t bytesWanted) {
+        wanted = bytesWanted;
+        MemoryBudget::instance().record(slot, -static_cast<int64_t>(bytesWanted));
+        return bytesWanted;
+    }));
+
+    budget.setBudgetBytes(static_cast<size_t>(budget.totalBytes()) + 10000);
+    budget.record(slot, 8000);
+    EXPECT_EQ(wanted, 0u);  // Still under budget
+
+    budget.setBudgetBytes(budget.budgetBytes() - 9000);
+    EXPECT_GT(wanted, 0u);
+}
+
+TEST_F(MemoryBudgetTest, SnapshotListsActiveSubsystems) {
+    auto& budget = MemoryBudget::instance();
+    auto slot = track(budget.registerSubsystem("testSnapshotSlot", MemoryBudget::Priority::Pinned, nullptr));
+    budget.record(slot, 123);
+
+    auto json = budget.snapshotJson();
+    EXPECT_NE(json.find(R"("budgetBytes":)"), std::string::npos);
+    EXPECT_NE(json.find(R"("totalBytes":)"), std::string::npos);
+    EXPECT_NE(json.find(R"("testSnapshotSlot":123)"), std::string::npos);
+}
+
+}  // namespace test
+}  // namespace velocitydb
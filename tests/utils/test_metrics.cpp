@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "utils/metrics.h"
+
+namespace velocitydb {
+namespace test {
+
+class LatencyHistogramTest : public ::testing::Test {};
+
+TEST_F(LatencyHistogramTest, EmptyHistogramSnapshotsZeros) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.snapshotJson(), R"({"count":0,"avgUs":0.0,"p50Us":0,"p95Us":0,"p99Us":0})");
+}
+
+TEST_F(LatencyHistogramTest, CountAndAverageReflectSamples) {
+    LatencyHistogram histogram;
+    histogram.record(100);
+    histogram.record(300);
+
+    auto json = histogram.snapshotJson();
+    EXPECT_NE(json.find(R"("count":2)"), std::string::npos);
+    EXPECT_NE(json.find(R"("avgUs":200.0)"), std::string::npos);
+}
+
+TEST_F(LatencyHistogramTest, PercentilesBoundTheSamples) {
+    LatencyHistogram histogram;
+    // 99 fast samples and one slow outlier: p50 stays near the fast
+    // cluster, p99 lands in the outlier's bucket
+    for (int i = 0; i < 99; ++i) {
+        histogram.record(100);
+    }
+    histogram.record(1'000'000);
+
+    auto json = histogram.snapshotJson();
+    EXPECT_NE(json.find(R"("p50Us":128)"), std::string::npos);
+    EXPECT_NE(json.find(R"("p99Us":1048576)"), std::string::npos);
+}
+
+TEST_F(LatencyHistogramTest, NegativeDurationsClampToZero) {
+    LatencyHistogram histogram;
+    histogram.record(-5);
+
+    auto json = histogram.snapshotJson();
+    EXPECT_NE(json.find(R"("count":1)"), std::string::npos);
+    EXPECT_NE(json.find(R"("p50Us":1)"), std::string::npos);
+}
+
+class MetricsTest : public ::testing::Test {};
+
+TEST_F(MetricsTest, IpcMethodHistogramIsStablePerName) {
+    auto& metrics = Metrics::instance();
+    auto& first = metrics.ipcMethod("testStableMethod");
+    auto& second = metrics.ipcMethod("testStableMethod");
+    EXPECT_EQ(&first, &second);
+}
+
+TEST_F(MetricsTest, SnapshotContainsAllSections) {
+    auto& metrics = Metrics::instance();
+    metrics.ipcMethod("testSnapshotMethod").record(500);
+
+    auto json = metrics.snapshotJson();
+    EXPECT_NE(json.find(R"("cacheHitRatio":)"), std::string::npos);
+    EXPECT_NE(json.find(R"("asyncQueueDepth":)"), std::string::npos);
+    EXPECT_NE(json.find(R"("queryExecute":)"), std::string::npos);
+    EXPECT_NE(json.find(R"("poolAcquire":)"), std::string::npos);
+    EXPECT_NE(json.find(R"("testSnapshotMethod":)"), std::string::npos);
+}
+
+}  // namespace test
+}  // namespace velocitydb
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "utils/result_aggregator.h"
+
+namespace velocitydb {
+namespace test {
+
+namespace {
+
+ResultSet makeResult(std::vector<std::vector<std::string>> rows) {
+    ResultSet result;
+    result.columns = {{.name = "category", .type = "NVARCHAR"}, {.name = "amount", .type = "DECIMAL"}};
+    for (const auto& row : rows) {
+        ResultRow resultRow;
+        for (const auto& cell : row) {
+            resultRow.values.emplace_back(cell);
+        }
+        result.rows.push_back(std::move(resultRow));
+    }
+    return result;
+}
+
+}  // namespace
+
+class ResultAggregatorTest : public ::testing::Test {
+protected:
+    ResultAggregator aggregator;
+};
+
+TEST_F(ResultAggregatorTest, ColumnStatisticsForNumericColumn) {
+    auto data = makeResult({{"a", "10"}, {"b", "-2.5"}, {"c", "10"}, {"d", "4"}});
+
+    auto stats = aggregator.columnStatistics(data, 1);
+
+    EXPECT_EQ(stats.rowCount, 4u);
+    EXPECT_EQ(stats.nonNullCount, 4u);
+    EXPECT_EQ(stats.distinctCount, 3u);
+    EXPECT_TRUE(stats.numeric);
+    EXPECT_DOUBLE_EQ(stats.sum, 21.5);
+    EXPECT_DOUBLE_EQ(stats.minimum, -2.5);
+    EXPECT_DOUBLE_EQ(stats.maximum, 10.0);
+    EXPECT_DOUBLE_EQ(stats.average, 21.5 / 4.0);
+}
+
+TEST_F(ResultAggregatorTest, ColumnStatisticsSkipsNullCells) {
+    auto data = makeResult({{"a", "5"}, {"b", ""}, {"c", "7"}});
+
+    auto stats = aggregator.columnStatistics(data, 1);
+
+    EXPECT_EQ(stats.rowCount, 3u);
+    EXPECT_EQ(stats.nonNullCount, 2u);
+    EXPECT_TRUE(stats.numeric);
+    EXPECT_DOUBLE_EQ(stats.sum, 12.0);
+}
+
+TEST_F(ResultAggregatorTest, ColumnStatisticsNonNumericColumnHasNoAccumulators) {
+    auto data = makeResult({{"a", "5"}, {"b", "n/a"}, {"a", "7"}});
+
+    auto stats = aggregator.columnStatistics(data, 0);
+
+    EXPECT_FALSE(stats.numeric);
+    EXPECT_EQ(stats.distinctCount, 2u);
+    EXPECT_DOUBLE_EQ(stats.sum, 0.0);
+}
+
+TEST_F(ResultAggregatorTest, ColumnStatisticsAccumulatesPastOneVectorWidth) {
+    // Nine values so the AVX2 path runs two steps plus a scalar tail
+    std::vector<std::vector<std::string>> rows;
+    for (int i = 1; i <= 9; ++i) {
+        rows.push_back({"k", std::to_string(i)});
+    }
+    auto data = makeResult(std::move(rows));
+
+    auto stats = aggregator.columnStatistics(data, 1);
+
+    EXPECT_DOUBLE_EQ(stats.sum, 45.0);
+    EXPECT_DOUBLE_EQ(stats.minimum, 1.0);
+    EXPECT_DOUBLE_EQ(stats.maximum, 9.0);
+}
+
+TEST_F(ResultAggregatorTest, GroupByAggregatesValueColumnPerKey) {
+    auto data = makeResult({{"fruit", "3"}, {"veg", "10"}, {"fruit", "7"}, {"fruit", "5"}});
+
+    auto groups = aggregator.groupBy(data, 0, 1);
+
+    ASSERT_EQ(groups.size(), 2u);
+    EXPECT_EQ(groups[0].key, "fruit");
+    EXPECT_EQ(groups[0].count, 3u);
+    EXPECT_DOUBLE_EQ(groups[0].sum, 15.0);
+    EXPECT_DOUBLE_EQ(groups[0].minimum, 3.0);
+    EXPECT_DOUBLE_EQ(groups[0].maximum, 7.0);
+    EXPECT_EQ(groups[1].key, "veg");
+    EXPECT_EQ(groups[1].count, 1u);
+}
+
+TEST_F(ResultAggregatorTest, GroupByOrdersByCountThenKey) {
+    auto data = makeResult({{"b", "1"}, {"a", "1"}, {"c", "1"}, {"c", "1"}});
+
+    auto groups = aggregator.groupBy(data, 0, 1);
+
+    ASSERT_EQ(groups.size(), 3u);
+    EXPECT_EQ(groups[0].key, "c");
+    EXPECT_EQ(groups[1].key, "a");
+    EXPECT_EQ(groups[2].key, "b");
+}
+
+}  // namespace test
+}  // namespace velocitydb
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "utils/result_diff.h"
+
+namespace velocitydb {
+namespace test {
+
+namespace {
+
+ResultSet makeResult(std::vector<std::vector<std::string>> rows) {
+    ResultSet result;
+    result.columns = {{.name = "id", .type = "INT"}, {.name = "name", .type = "NVARCHAR"}, {.name = "amount", .type = "DECIMAL"}};
+    for (const auto& row : rows) {
+        ResultRow resultRow;
+        for (const auto& cell : row) {
+            resultRow.values.emplace_back(cell);
+        }
+        result.rows.push_back(std::move(resultRow));
+    }
+    return result;
+}
+
+}  // namespace
+
+class ResultDiffTest : public ::testing::Test {
+protected:
+    ResultDiffer differ;
+};
+
+TEST_F(ResultDiffTest, WholeRowModeReportsAddedAndRemoved) {
+    auto before = makeResult({{"1", "alice", "10"}, {"2", "bob", "20"}});
+    auto after = makeResult({{"1", "alice", "10"}, {"3", "carol", "30"}});
+
+    auto summary = differ.diff(before, after);
+
+    EXPECT_EQ(summary.unchangedRows, 1u);
+    ASSERT_EQ(summary.addedRows.size(), 1u);
+    EXPECT_EQ(summary.addedRows[0], 1u);
+    ASSERT_EQ(summary.removedRows.size(), 1u);
+    EXPECT_EQ(summary.removedRows[0], 1u);
+    EXPECT_TRUE(summary.changedRows.empty());
+}
+
+TEST_F(ResultDiffTest, WholeRowModeReportsModificationAsRemovedPlusAdded) {
+    auto before = makeResult({{"1", "alice", "10"}});
+    auto after = makeResult({{"1", "alice", "15"}});
+
+    auto summary = differ.diff(before, after);
+
+    EXPECT_EQ(summary.unchangedRows, 0u);
+    EXPECT_EQ(summary.addedRows.size(), 1u);
+    EXPECT_EQ(summary.removedRows.size(), 1u);
+}
+
+TEST_F(ResultDiffTest, KeyColumnModeListsChangedColumns) {
+    auto before = makeResult({{"1", "alice", "10"}, {"2", "bob", "20"}});
+    auto after = makeResult({{"1", "alice", "15"}, {"2", "bob", "20"}});
+
+    auto summary = differ.diff(before, after, {0});
+
+    EXPECT_EQ(summary.unchangedRows, 1u);
+    EXPECT_TRUE(summary.addedRows.empty());
+    EXPECT_TRUE(summary.removedRows.empty());
+    ASSERT_EQ(summary.changedRows.size(), 1u);
+    EXPECT_EQ(summary.changedRows[0].beforeRow, 0u);
+    EXPECT_EQ(summary.changedRows[0].afterRow, 0u);
+    ASSERT_EQ(summary.changedRows[0].changedColumns.size(), 1u);
+    EXPECT_EQ(summary.changedRows[0].changedColumns[0], 2u);
+}
+
+TEST_F(ResultDiffTest, KeyColumnModeDetectsAddedAndRemovedKeys) {
+    auto before = makeResult({{"1", "alice", "10"}, {"2", "bob", "20"}});
+    auto after = makeResult({{"2", "bob", "20"}, {"3", "carol", "30"}});
+
+    auto summary = differ.diff(before, after, {0});
+
+    EXPECT_EQ(summary.unchangedRows, 1u);
+    ASSERT_EQ(summary.addedRows.size(), 1u);
+    EXPECT_EQ(summary.addedRows[0], 1u);
+    ASSERT_EQ(summary.removedRows.size(), 1u);
+    EXPECT_EQ(summary.removedRows[0], 0u);
+}
+
+TEST_F(ResultDiffTest, DuplicateKeysPairInRowOrder) {
+    auto before = makeResult({{"1", "alice", "10"}, {"1", "alice", "20"}});
+    auto after = makeResult({{"1", "alice", "10"}, {"1", "alice", "25"}});
+
+    auto summary = differ.diff(before, after, {0, 1});
+
+    EXPECT_EQ(summary.unchangedRows, 1u);
+    ASSERT_EQ(summary.changedRows.size(), 1u);
+    EXPECT_EQ(summary.changedRows[0].beforeRow, 1u);
+    EXPECT_EQ(summary.changedRows[0].afterRow, 1u);
+}
+
+TEST_F(ResultDiffTest, ColumnCountMismatchThrows) {
+    auto before = makeResult({{"1", "alice", "10"}});
+    ResultSet after;
+    after.columns = {{.name = "id", .type = "INT"}};
+
+    EXPECT_THROW(differ.diff(before, after), std::invalid_argument);
+}
+
+TEST_F(ResultDiffTest, KeyColumnOutOfRangeThrows) {
+    auto before = makeResult({{"1", "alice", "10"}});
+    auto after = makeResult({{"1", "alice", "10"}});
+
+    EXPECT_THROW(differ.diff(before, after, {5}), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace velocitydb
@@ -0,0 +1,327 @@
+#include <gtest/gtest.h>
+#include "utils/simd_filter.h"
+
+namespace velocitydb {
+namespace test {
+
+namespace {
+
+ResultSet makeResult(std::vector<std::string> cells) {
+    ResultSet result;
+    result.columns = {{.name = "value", .type = "NVARCHAR"}};
+    for (const auto& cell : cells) {
+        ResultRow row;
+        row.values.emplace_back(cell);
+        result.rows.push_back(std::move(row));
+    }
+    return result;
+}
+
+// Longer than one 32-byte vector so the AVX2 path runs multiple steps
+const std::string longValue = "a cell value long enough to span more than one simd block easily";
+
+ResultSet makeTwoColumnResult(std::vector<std::pair<std::string, std::string>> rows) {
+    ResultSet result;
+    result.columns = {{.name = "status", .type = "NVARCHAR"}, {.name = "amount", .type = "INT"}};
+    for (auto& [status, amount] : rows) {
+        ResultRow row;
+        row.values.emplace_back(std::move(status));
+        row.values.emplace_back(std::move(amount));
+        result.rows.push_back(std::move(row));
+    }
+    return result;
+}
+
+}  // namespace
+
+class SIMDFilterTest : public ::testing::Test {
+protected:
+    SIMDFilter filter;
+};
+
+TEST_F(SIMDFilterTest, FilterEqualsMatchesExactCellsOnly) {
+    auto data = makeResult({longValue, "short", longValue + "x", longValue});
+
+    auto matches = filter.filterEquals(data, 0, longValue);
+
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], 0u);
+    EXPECT_EQ(matches[1], 3u);
+}
+
+TEST_F(SIMDFilterTest, FilterEqualsRejectsEqualLengthMismatch) {
+    std::string almost = longValue;
+    almost.back() = '!';
+    auto data = makeResult({longValue, almost});
+
+    auto matches = filter.filterEquals(data, 0, longValue);
+
+    ASSERT_EQ(matches.size(), 1u);
+    EXPECT_EQ(matches[0], 0u);
+}
+
+TEST_F(SIMDFilterTest, FilterContainsFindsSubstringAcrossBlockBoundary) {
+    // "needle" straddles the 32-byte boundary of the first vector step
+    std::string straddling = std::string(29, 'x') + "needle" + std::string(29, 'y');
+    auto data = makeResult({straddling, "no match here", "needle at the start"});
+
+    auto matches = filter.filterContains(data, 0, "needle");
+
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], 0u);
+    EXPECT_EQ(matches[1], 2u);
+}
+
+TEST_F(SIMDFilterTest, FilterContainsEmptyNeedleMatchesAll) {
+    auto data = makeResult({"a", "b"});
+    EXPECT_EQ(filter.filterContains(data, 0, "").size(), 2u);
+}
+
+TEST_F(SIMDFilterTest, FilterContainsRepeatedFirstByteStillVerifies) {
+    // First-byte hits that fail verification must not be reported
+    auto data = makeResult({std::string(40, 'n') + "needle", std::string(48, 'n')});
+
+    auto matches = filter.filterContains(data, 0, "needle");
+
+    ASSERT_EQ(matches.size(), 1u);
+    EXPECT_EQ(matches[0], 0u);
+}
+
+TEST_F(SIMDFilterTest, FilterContainsCandidateRowsReturnsShrinkingSubset) {
+    auto data = makeResult({"customer_name", "customer_id", "custard", "customer_na"});
+
+    auto broad = filter.filterContains(data, 0, "cust");
+    ASSERT_EQ(broad.size(), 4u);
+
+    auto refined = filter.filterContains(data, 0, "customer_na", broad);
+
+    ASSERT_EQ(refined.size(), 2u);
+    EXPECT_EQ(refined[0], 0u);
+    EXPECT_EQ(refined[1], 3u);
+}
+
+TEST_F(SIMDFilterTest, FilterContainsCandidateRowsIgnoresStaleIndices) {
+    auto data = makeResult({"alpha", "beta"});
+
+    // Indices beyond the current row count are skipped, not dereferenced
+    auto matches = filter.filterContains(data, 0, "a", {0, 1, 7});
+
+    ASSERT_EQ(matches.size(), 2u);
+}
+
+TEST_F(SIMDFilterTest, FilterEqualsRepeatedLookupsReturnConsistentResults) {
+    auto data = makeResult({"apple", "pear", "apple", "plum"});
+
+    // Second and later filters are served from the lazy hash index
+    auto first = filter.filterEquals(data, 0, "apple");
+    auto second = filter.filterEquals(data, 0, "pear");
+    auto third = filter.filterEquals(data, 0, "missing");
+
+    ASSERT_EQ(first.size(), 2u);
+    EXPECT_EQ(first[0], 0u);
+    EXPECT_EQ(first[1], 2u);
+    ASSERT_EQ(second.size(), 1u);
+    EXPECT_EQ(second[0], 1u);
+    EXPECT_TRUE(third.empty());
+}
+
+TEST_F(SIMDFilterTest, FilterEqualsIndexRebuildsWhenRowCountChanges) {
+    auto data = makeResult({"a", "b"});
+    ASSERT_EQ(filter.filterEquals(data, 0, "a").size(), 1u);
+
+    data.rows.push_back({.values = {"a"}});
+
+    auto matches = filter.filterEquals(data, 0, "a");
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[1], 2u);
+}
+
+TEST_F(SIMDFilterTest, FilterRangeComparesNumericColumnsNumerically) {
+    // String comparison would reject "10" from the range ["9", "11"]
+    auto data = makeResult({"10", "9", "11", "8.5", "12"});
+
+    auto matches = filter.filterRange(data, 0, "9", "11");
+
+    ASSERT_EQ(matches.size(), 3u);
+    EXPECT_EQ(matches[0], 0u);
+    EXPECT_EQ(matches[1], 1u);
+    EXPECT_EQ(matches[2], 2u);
+}
+
+TEST_F(SIMDFilterTest, FilterRangeNumericPastOneVectorWidth) {
+    // More than four rows so the AVX2 path takes at least one full step
+    auto data = makeResult({"1", "2", "3", "4", "5", "6", "7", "8", "9"});
+
+    auto matches = filter.filterRange(data, 0, "3", "7");
+
+    ASSERT_EQ(matches.size(), 5u);
+    EXPECT_EQ(matches.front(), 2u);
+    EXPECT_EQ(matches.back(), 6u);
+}
+
+TEST_F(SIMDFilterTest, FilterRangeMixedColumnFallsBackToStringComparison) {
+    auto data = makeResult({"banana", "apple", "cherry", "10"});
+
+    auto matches = filter.filterRange(data, 0, "apple", "banana");
+
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], 0u);
+    EXPECT_EQ(matches[1], 1u);
+}
+
+TEST_F(SIMDFilterTest, SortByColumnOrdersFullyNumericColumnsNumerically) {
+    auto data = makeResult({"10", "-3", "2.5", "9"});
+
+    auto order = filter.sortByColumn(data, 0);
+
+    ASSERT_EQ(order.size(), 4u);
+    EXPECT_EQ(order[0], 1u);  // -3
+    EXPECT_EQ(order[1], 2u);  // 2.5
+    EXPECT_EQ(order[2], 3u);  // 9
+    EXPECT_EQ(order[3], 0u);  // 10
+}
+
+TEST_F(SIMDFilterTest, SortByColumnDescendingReversesOrder) {
+    auto data = makeResult({"1", "3", "2"});
+
+    auto order = filter.sortByColumn(data, 0, false);
+
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[0], 1u);
+    EXPECT_EQ(order[1], 2u);
+    EXPECT_EQ(order[2], 0u);
+}
+
+TEST_F(SIMDFilterTest, SortByColumnMixedColumnFallsBackToLexicographic) {
+    // One non-numeric cell makes the whole column sort as strings
+    auto data = makeResult({"10", "banana", "9"});
+
+    auto order = filter.sortByColumn(data, 0);
+
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[0], 0u);  // "10"
+    EXPECT_EQ(order[1], 2u);  // "9"
+    EXPECT_EQ(order[2], 1u);  // "banana"
+}
+
+TEST_F(SIMDFilterTest, SortByColumnRadixPathMatchesComparisonOrder) {
+    // Enough rows to cross the radix threshold; values descend so the
+    // sorted order is the exact reverse of the input
+    std::vector<std::string> cells;
+    cells.reserve(120000);
+    for (int i = 119999; i >= 0; --i) {
+        cells.push_back(std::to_string(i) + ".5");
+    }
+    auto data = makeResult(std::move(cells));
+
+    auto order = filter.sortByColumn(data, 0);
+
+    ASSERT_EQ(order.size(), 120000u);
+    EXPECT_EQ(order.front(), 119999u);
+    EXPECT_EQ(order.back(), 0u);
+    EXPECT_EQ(order[1], 119998u);
+}
+
+TEST_F(SIMDFilterTest, SortTopKMatchesFullSortPrefix) {
+    auto data = makeResult({"10", "-3", "2.5", "9", "7", "0"});
+
+    auto full = filter.sortByColumn(data, 0);
+    auto topThree = filter.sortTopK(data, 0, 3);
+
+    ASSERT_EQ(topThree.size(), 3u);
+    EXPECT_EQ(topThree[0], full[0]);
+    EXPECT_EQ(topThree[1], full[1]);
+    EXPECT_EQ(topThree[2], full[2]);
+}
+
+TEST_F(SIMDFilterTest, SortTopKDescendingSelectsLargestValues) {
+    auto data = makeResult({"1", "5", "3", "4", "2"});
+
+    auto topTwo = filter.sortTopK(data, 0, 2, false);
+
+    ASSERT_EQ(topTwo.size(), 2u);
+    EXPECT_EQ(topTwo[0], 1u);  // 5
+    EXPECT_EQ(topTwo[1], 3u);  // 4
+}
+
+TEST_F(SIMDFilterTest, SortTopKLargerThanRowCountReturnsFullOrder) {
+    auto data = makeResult({"b", "a", "c"});
+
+    auto order = filter.sortTopK(data, 0, 10);
+
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[0], 1u);
+    EXPECT_EQ(order[1], 0u);
+    EXPECT_EQ(order[2], 2u);
+}
+
+TEST_F(SIMDFilterTest, CompoundAndIntersectsAcrossColumns) {
+    auto data = makeTwoColumnResult({{"ACTIVE", "10"}, {"ACTIVE", "50"}, {"CLOSED", "50"}, {"ACTIVE", "90"}});
+
+    SIMDFilter::CompoundFilter compound;
+    compound.conditions.push_back({.columnIndex = 0, .op = SIMDFilter::FilterCondition::Op::Equals, .value = "ACTIVE"});
+    compound.conditions.push_back({.columnIndex = 1, .op = SIMDFilter::FilterCondition::Op::Range, .value = "40", .valueMax = "100"});
+
+    auto matches = filter.filterCompound(data, compound);
+
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], 1u);
+    EXPECT_EQ(matches[1], 3u);
+}
+
+TEST_F(SIMDFilterTest, CompoundOrUnionsInRowOrder) {
+    auto data = makeTwoColumnResult({{"CLOSED", "90"}, {"ACTIVE", "10"}, {"CLOSED", "20"}, {"SUSPENDED", "95"}});
+
+    SIMDFilter::CompoundFilter compound;
+    compound.combine = SIMDFilter::CompoundFilter::Combine::Or;
+    compound.conditions.push_back({.columnIndex = 0, .op = SIMDFilter::FilterCondition::Op::Equals, .value = "ACTIVE"});
+    compound.conditions.push_back({.columnIndex = 1, .op = SIMDFilter::FilterCondition::Op::Range, .value = "80", .valueMax = "100"});
+
+    auto matches = filter.filterCompound(data, compound);
+
+    ASSERT_EQ(matches.size(), 3u);
+    EXPECT_EQ(matches[0], 0u);
+    EXPECT_EQ(matches[1], 1u);
+    EXPECT_EQ(matches[2], 3u);
+}
+
+TEST_F(SIMDFilterTest, CompoundNestedGroupCombinesWithOuterAnd) {
+    // status = ACTIVE AND (amount < 20 OR amount > 80)
+    auto data = makeTwoColumnResult({{"ACTIVE", "10"}, {"ACTIVE", "50"}, {"ACTIVE", "90"}, {"CLOSED", "90"}});
+
+    SIMDFilter::CompoundFilter inner;
+    inner.combine = SIMDFilter::CompoundFilter::Combine::Or;
+    inner.conditions.push_back({.columnIndex = 1, .op = SIMDFilter::FilterCondition::Op::Range, .value = "0", .valueMax = "19"});
+    inner.conditions.push_back({.columnIndex = 1, .op = SIMDFilter::FilterCondition::Op::Range, .value = "81", .valueMax = "1000"});
+
+    SIMDFilter::CompoundFilter compound;
+    compound.conditions.push_back({.columnIndex = 0, .op = SIMDFilter::FilterCondition::Op::Equals, .value = "ACTIVE"});
+    compound.groups.push_back(std::move(inner));
+
+    auto matches = filter.filterCompound(data, compound);
+
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches[0], 0u);
+    EXPECT_EQ(matches[1], 2u);
+}
+
+TEST_F(SIMDFilterTest, CompoundAndShortCircuitsToEmpty) {
+    auto data = makeTwoColumnResult({{"ACTIVE", "10"}, {"ACTIVE", "50"}});
+
+    SIMDFilter::CompoundFilter compound;
+    compound.conditions.push_back({.columnIndex = 0, .op = SIMDFilter::FilterCondition::Op::Equals, .value = "MISSING"});
+    compound.conditions.push_back({.columnIndex = 0, .op = SIMDFilter::FilterCondition::Op::Contains, .value = "ACT"});
+
+    EXPECT_TRUE(filter.filterCompound(data, compound).empty());
+}
+
+TEST_F(SIMDFilterTest, CompoundEmptyAndMatchesEverything) {
+    auto data = makeTwoColumnResult({{"A", "1"}, {"B", "2"}});
+
+    auto matches = filter.filterCompound(data, SIMDFilter::CompoundFilter{});
+
+    ASSERT_EQ(matches.size(), 2u);
+}
+
+}  // namespace test
+}  // namespace velocitydb
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include "utils/trace.h"
+
+namespace velocitydb {
+namespace test {
+
+class TraceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Drain anything earlier tests may have recorded
+        Tracer::instance().setEnabled(false);
+        static_cast<void>(Tracer::instance().dumpJson());
+    }
+
+    void TearDown() override {
+        Tracer::instance().setEnabled(false);
+        static_cast<void>(Tracer::instance().dumpJson());
+    }
+};
+
+TEST_F(TraceTest, DisabledSpansRecordNothing) {
+    { VDB_TRACE_SPAN("test", "disabledSpan"); }
+    EXPECT_EQ(Tracer::instance().dumpJson(), R"({"traceEvents":[]})");
+}
+
+TEST_F(TraceTest, EnabledSpanAppearsInDump) {
+    Tracer::instance().setEnabled(true);
+    { VDB_TRACE_SPAN("test", "enabledSpan"); }
+
+    auto json = Tracer::instance().dumpJson();
+    EXPECT_NE(json.find(R"("name":"enabledSpan")"), std::string::npos);
+    EXPECT_NE(json.find(R"("cat":"test")"), std::string::npos);
+    EXPECT_NE(json.find(R"("ph":"X")"), std::string::npos);
+}
+
+TEST_F(TraceTest, DumpDrainsRecordedEvents) {
+    Tracer::instance().setEnabled(true);
+    { VDB_TRACE_SPAN("test", "drainedSpan"); }
+
+    static_cast<void>(Tracer::instance().dumpJson());
+    EXPECT_EQ(Tracer::instance().dumpJson(), R"({"traceEvents":[]})");
+}
+
+TEST_F(TraceTest, SpanStartedWhileEnabledStillRecordsAfterDisable) {
+    auto& tracer = Tracer::instance();
+    tracer.setEnabled(true);
+    {
+        VDB_TRACE_SPAN("test", "straddlingSpan");
+        tracer.setEnabled(false);
+    }
+
+    auto json = tracer.dumpJson();
+    EXPECT_NE(json.find(R"("name":"straddlingSpan")"), std::string::npos);
+}
+
+}  // namespace test
+}  // namespace velocitydb
@@ -17,6 +17,7 @@
 #include <queue>
 #include <string>
 #include <thread>
+#include <vector>
 #include "simdjson.h"
 
 #define WEBVIEW_HINT_NONE 0
@@ -61,12 +62,23 @@ using Microsoft::WRL::ComPtr;
 
 // Custom Windows message for async IPC responses
 constexpr UINT WM_IPC_RESPONSE = WM_USER + 1;
+constexpr UINT WM_IPC_EVENT = WM_USER + 2;
+constexpr UINT WM_IPC_SHARED_BUFFER = WM_USER + 3;
 
 struct IPCResponse {
     int64_t requestId;
     std::string response;
 };
 
+struct IPCEvent {
+    std::string payload;
+};
+
+struct IPCSharedBuffer {
+    std::vector<uint8_t> payload;
+    std::string additionalDataJson;
+};
+
 class webview {
 public:
     webview(bool debug = false, void* window = nullptr)
@@ -116,6 +128,32 @@ public:
         }
     }
 
+    // Push a backend-initiated event to the page (thread-safe).
+    // Delivered as window.__webview_event__(payload) on the UI thread;
+    // payload must be a JSON object string.
+    void post_message(const std::string& json) {
+        if (!m_hwnd) return;
+        auto* event = new IPCEvent{json};
+        PostMessage(m_hwnd, WM_IPC_EVENT, 0, reinterpret_cast<LPARAM>(event));
+    }
+
+    // True once the controller is up on a runtime new enough for
+    // CoreWebView2SharedBuffer; callers fall back to the string channel
+    // while this is false (startup, or an old WebView2 runtime).
+    bool supports_shared_buffer() const { return m_sharedBufferSupported; }
+
+    // Post a binary payload to the page through a CoreWebView2SharedBuffer
+    // (thread-safe). The payload crosses the process boundary as one memcpy
+    // into the shared mapping instead of a UTF-16 marshal of the whole
+    // string; the page receives it as a zero-copy ArrayBuffer with the
+    // additionalData fields attached, routed to window.onBackendEvent
+    // listeners. The page owns the buffer until chrome.webview.releaseBuffer.
+    void post_shared_buffer(std::vector<uint8_t> payload, const std::string& additionalDataJson) {
+        if (!m_hwnd) return;
+        auto* transfer = new IPCSharedBuffer{std::move(payload), additionalDataJson};
+        PostMessage(m_hwnd, WM_IPC_SHARED_BUFFER, 0, reinterpret_cast<LPARAM>(transfer));
+    }
+
     void bind(const std::string& name, std::function<std::string(const std::string&)> fn) {
         m_bindings[name] = fn;
     }
@@ -241,6 +279,8 @@ private:
             return result;
         }
 
+        m_environment = env;  // Kept for CreateSharedBuffer
+
         env->CreateCoreWebView2Controller(
             m_hwnd,
             Callback<ICoreWebView2CreateCoreWebView2ControllerCompletedHandler>(
@@ -270,6 +310,16 @@ private:
                     // Setup bindings
                     setupBindings();
 
+                    // Shared-buffer transfers need Environment12 +
+                    // ICoreWebView2_17; older runtimes keep the string path
+                    {
+                        ComPtr<ICoreWebView2Environment12> env12;
+                        ComPtr<ICoreWebView2_17> webview17;
+                        m_sharedBufferSupported =
+                            m_environment && SUCCEEDED(m_environment.As(&env12)) && env12 &&
+                            SUCCEEDED(m_webviewWindow->QueryInterface(IID_PPV_ARGS(&webview17))) && webview17;
+                    }
+
                     // Open DevTools in debug builds
                     if (m_debug) {
                         m_webviewWindow->OpenDevToolsWindow();
@@ -375,6 +425,31 @@ private:
             pending.resolve(response);
         }
     };
+
+    // Backend-initiated events (e.g. async query completion)
+    const eventListeners = new Set();
+    window.onBackendEvent = function(listener) {
+        eventListeners.add(listener);
+        return () => eventListeners.delete(listener);
+    };
+    window.__webview_event__ = function(payload) {
+        for (const listener of eventListeners) {
+            try { listener(payload); } catch (e) { console.error(e); }
+        }
+    };
+
+    // Shared-buffer transfers (large result frames) arrive out of band;
+    // surface them to the same listeners with the ArrayBuffer attached.
+    // The listener that consumes the frame calls
+    // window.chrome.webview.releaseBuffer(payload.buffer) when done.
+    if (window.chrome && window.chrome.webview && window.chrome.webview.addEventListener) {
+        window.chrome.webview.addEventListener('sharedbufferreceived', (e) => {
+            const payload = Object.assign({}, e.additionalData, { buffer: e.getBuffer() });
+            for (const listener of eventListeners) {
+                try { listener(payload); } catch (err) { console.error(err); }
+            }
+        });
+    }
 })();
 )";
         m_webviewWindow->AddScriptToExecuteOnDocumentCreated(script.c_str(), nullptr);
@@ -464,6 +539,26 @@ private:
             return 0;
         }
 
+        case WM_IPC_EVENT: {
+            auto* event = reinterpret_cast<IPCEvent*>(lParam);
+            if (self && self->m_webviewWindow && event) {
+                std::wstring wpayload = utf8_to_utf16(event->payload);
+                std::wstring script = L"window.__webview_event__ && window.__webview_event__(" + wpayload + L");";
+                self->m_webviewWindow->ExecuteScript(script.c_str(), nullptr);
+            }
+            delete event;
+            return 0;
+        }
+
+        case WM_IPC_SHARED_BUFFER: {
+            auto* transfer = reinterpret_cast<IPCSharedBuffer*>(lParam);
+            if (self && transfer) {
+                self->postSharedBufferToScript(*transfer);
+            }
+            delete transfer;
+            return 0;
+        }
+
         case WM_DESTROY:
             if (self) {
                 self->stopWorker();
@@ -475,6 +570,27 @@ private:
         return DefWindowProc(hwnd, msg, wParam, lParam);
     }
 
+    void postSharedBufferToScript(const IPCSharedBuffer& transfer) {
+        if (!m_environment || !m_webviewWindow || transfer.payload.empty()) return;
+
+        ComPtr<ICoreWebView2Environment12> env12;
+        if (FAILED(m_environment.As(&env12)) || !env12) return;
+        ComPtr<ICoreWebView2_17> webview17;
+        if (FAILED(m_webviewWindow->QueryInterface(IID_PPV_ARGS(&webview17))) || !webview17) return;
+
+        ComPtr<ICoreWebView2SharedBuffer> buffer;
+        if (FAILED(env12->CreateSharedBuffer(transfer.payload.size(), &buffer)) || !buffer) return;
+        BYTE* mapped = nullptr;
+        if (FAILED(buffer->get_Buffer(&mapped)) || !mapped) return;
+        memcpy(mapped, transfer.payload.data(), transfer.payload.size());
+
+        std::wstring additionalData = utf8_to_utf16(transfer.additionalDataJson);
+        webview17->PostSharedBufferToScript(buffer.Get(), COREWEBVIEW2_SHARED_BUFFER_ACCESS_READ_ONLY, additionalData.c_str());
+        // Drop the backend mapping; the page's reference keeps the memory
+        // alive until it calls chrome.webview.releaseBuffer
+        buffer->Close();
+    }
+
     void startWorker() {
         m_workerRunning = true;
         m_workerThread = std::thread([this]() {
@@ -531,6 +647,8 @@ private:
 
     ComPtr<ICoreWebView2Controller> m_webviewController;
     ComPtr<ICoreWebView2> m_webviewWindow;
+    ComPtr<ICoreWebView2Environment> m_environment;
+    std::atomic<bool> m_sharedBufferSupported{false};
 
 public:
     void set_frontend_path(const std::string& path) {